@@ -26,6 +26,12 @@ if(NOT TE_RHI_BACKEND_COUNT EQUAL 1)
         "Set one of TE_RHI_OPENGL/TE_RHI_VULKAN/TE_RHI_D3D12 to ON and the others to OFF.")
 endif()
 
+# 内存作用域 tag 归属：关闭后 TE_MEMORY_SCOPE 展开为空，未指定 tag 的分配不再继承作用域 tag（按 tag 的统计与预算照常）
+option(TE_ENABLE_MEMORY_SCOPES "Enable scoped memory tag attribution (TE_MEMORY_SCOPE)" ON)
+
+# 数学内核指令集：默认只依赖 x64 基线 SSE2（ARM64 走 NEON）；开启后以 AVX2 + FMA 编译全部模块
+option(TE_ENABLE_AVX2 "Compile with AVX2/FMA (MatrixKernels uses 256-bit paths)" OFF)
+
 # MinGW 可执行文件默认静态链接编译器运行库，确保开发产物无需额外部署
 # libgcc_s_seh-1.dll、libstdc++-6.dll 与 libwinpthread-1.dll 即可直接启动。
 option(TE_STATIC_MINGW_RUNTIME "Statically link MinGW runtime libraries into executables" ON)
@@ -40,3 +46,4 @@ endif()
 # 应用选项（根 CMakeLists.txt 已定义，此处留作参考）
 # option(TE_BUILD_SANDBOX "Build Sandbox application" ON)
 # option(TE_BUILD_TESTS "Build test executables" ON)
+# option(TE_BUILD_BENCHMARKS "Build benchmark executables (Tests/MathBench)" OFF)
@@ -8,6 +8,7 @@
 #include "Material.h"
 #include "StaticMesh.h"
 #include "Log/Log.h"
+#include "Memory/MemoryScope.h"
 
 // Assimp 头文件（仅在 Private 中引用）
 #include <assimp/Importer.hpp>
@@ -267,6 +268,9 @@ std::shared_ptr<StaticMesh> FAssetImporter::ImportStaticMesh(const std::string&
 {
     TE_LOG_INFO("[Asset] Importing static mesh: {}", filePath);
 
+    // Assimp 与网格构建过程中经由全局 new 的分配都记到 Asset
+    TE_MEMORY_SCOPE(Asset);
+
     // 创建 Assimp Importer（RAII，析构时自动释放 aiScene）
     Assimp::Importer importer;
 
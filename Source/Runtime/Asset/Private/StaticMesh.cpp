@@ -40,9 +40,38 @@ uint32_t StaticMesh::GetTotalIndexCount() const
 
 void StaticMesh::AddSection(FMeshSection section)
 {
+    for (const auto& vertex : section.Vertices)
+    {
+        if (!m_HasBounds)
+        {
+            m_LocalBounds = BoundingBox(vertex.Position, vertex.Position);
+            m_HasBounds = true;
+            continue;
+        }
+        m_LocalBounds.Expand(vertex.Position);
+    }
     m_Sections.push_back(std::move(section));
 }
 
+uint32_t AppendMeshSectionTriangles(const FMeshSection& section, TriangleSoA& outTriangles)
+{
+    const auto firstTriangle = static_cast<uint32_t>(outTriangles.Size());
+    const size_t vertexCount = section.Vertices.size();
+    outTriangles.Reserve(outTriangles.Size() + section.Indices.size() / 3);
+
+    for (size_t i = 0; i + 2 < section.Indices.size(); i += 3)
+    {
+        const uint32_t i0 = section.Indices[i];
+        const uint32_t i1 = section.Indices[i + 1];
+        const uint32_t i2 = section.Indices[i + 2];
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount)
+            continue;
+
+        outTriangles.Add(section.Vertices[i0].Position, section.Vertices[i1].Position, section.Vertices[i2].Position);
+    }
+    return firstTriangle;
+}
+
 const FMaterial* StaticMesh::GetMaterial(uint32_t materialIndex) const
 {
     if (materialIndex >= m_Materials.size())
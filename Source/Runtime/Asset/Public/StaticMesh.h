@@ -15,7 +15,9 @@
 #pragma once
 
 #include "Material.h"
+#include "Math/Geometry.h"
 #include "Math/MathTypes.h"
+#include "Math/RayIntersection.h"
 #include <vector>
 #include <string>
 #include <cstdint>
@@ -52,6 +54,10 @@ struct FMeshSection
     uint32_t                        MaterialIndex = 0;  // 材质索引
 };
 
+/// 将 Section 的三角形（按 Indices 每 3 个一组）追加到 SoA 三角形数组，供拾取 / 视线等射线查询使用。
+/// 返回该 Section 第一个三角形在 outTriangles 中的索引；引用越界顶点的三角形会被跳过
+uint32_t AppendMeshSectionTriangles(const FMeshSection& section, TriangleSoA& outTriangles);
+
 /// 静态网格资产（对应 UE5 UStaticMesh）
 ///
 /// 核心职责：
@@ -89,6 +95,9 @@ public:
     /// 获取所有 Section 的总索引数
     [[nodiscard]] uint32_t GetTotalIndexCount() const;
 
+    /// 获取模型空间包围盒（所有 Section 顶点的并集，AddSection 时增量更新）
+    [[nodiscard]] const BoundingBox& GetLocalBounds() const { return m_LocalBounds; }
+
     /// 获取 Section 数量
     [[nodiscard]] uint32_t GetSectionCount() const { return static_cast<uint32_t>(m_Sections.size()); }
 
@@ -111,6 +120,8 @@ private:
     std::string               m_Name;       // 资产名称（通常为文件名）
     std::vector<FMeshSection> m_Sections;   // 所有子网格段
     std::vector<FMaterial> m_Materials; // 材质槽
+    BoundingBox               m_LocalBounds; // 模型空间包围盒（无顶点时为零盒）
+    bool                      m_HasBounds = false;
 };
 
 } // namespace TE
@@ -0,0 +1,440 @@
+// ToyEngine Core Module
+// 作业系统实现
+
+#include "Jobs/JobSystem.h"
+
+#include "Jobs/WorkStealingQueue.h"
+#include "Log/Log.h"
+#include "Memory/Memory.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <string>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#endif
+
+namespace TE {
+
+namespace {
+
+using JobDetail::Job;
+
+// 空闲线程休眠前的自旋轮数（每轮扫描一次全部队列）
+constexpr uint32_t IdleSpinRounds = 64;
+
+// 调用线程所属的作业系统与序号；非作业线程 Owner 为空
+struct JobThreadContext
+{
+    const JobSystem* Owner = nullptr;
+    int32_t Index = -1;
+    uint32_t RandomState = 0x9E3779B9u;
+};
+
+thread_local JobThreadContext t_jobContext{};
+
+inline void CpuPause()
+{
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+inline uint32_t NextRandom(uint32_t& state)
+{
+    // xorshift32：只用于挑选窃取对象
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+void SetCurrentThreadName(const std::string& name)
+{
+#if defined(_WIN32)
+    const std::wstring wideName(name.begin(), name.end());
+    SetThreadDescription(GetCurrentThread(), wideName.c_str());
+#elif defined(__APPLE__)
+    pthread_setname_np(name.c_str());
+#elif defined(__linux__)
+    // Linux 线程名上限 16 字节（含结尾 0）
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#else
+    (void)name;
+#endif
+}
+
+bool PinCurrentThread(uint32_t logicalCore)
+{
+#if defined(_WIN32)
+    if (logicalCore >= 64)
+        return false;
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << logicalCore) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(logicalCore, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    // macOS 只提供亲和性提示（thread_affinity_policy），不做绑定
+    (void)logicalCore;
+    return false;
+#endif
+}
+
+} // namespace
+
+JobSystem& JobSystem::Get()
+{
+    static JobSystem instance;
+    return instance;
+}
+
+// WorkStealingQueue 只在本文件完整定义，构造 / 析构须在此实例化
+JobSystem::JobSystem() = default;
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+void JobSystem::Init(const JobSystemConfig& config)
+{
+    Shutdown();
+
+    const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    m_Config = config;
+    m_Config.WorkerCount = config.WorkerCount != 0 ? config.WorkerCount : std::max(1u, hardwareThreads - 1);
+    m_Config.QueueCapacity = std::bit_ceil(std::max(config.QueueCapacity, 64u));
+    if (!m_Config.NamePrefix)
+    {
+        m_Config.NamePrefix = "TE Worker";
+    }
+
+    const uint32_t threadCount = m_Config.WorkerCount + 1;
+    m_Queues.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        m_Queues.push_back(std::make_unique<JobDetail::WorkStealingQueue>(m_Config.QueueCapacity));
+    }
+
+    t_jobContext = JobThreadContext{this, 0, 0x9E3779B9u};
+    m_Stopping.store(false, std::memory_order_relaxed);
+    m_Running.store(true, std::memory_order_release);
+
+    m_Workers.reserve(m_Config.WorkerCount);
+    for (uint32_t i = 1; i < threadCount; ++i)
+    {
+        m_Workers.emplace_back([this, i]() { WorkerMain(i); });
+    }
+
+    TE_LOG_INFO("JobSystem initialized: {} workers, queue capacity {}{}", m_Config.WorkerCount,
+                m_Config.QueueCapacity, m_Config.PinWorkers ? ", pinned" : "");
+}
+
+void JobSystem::Shutdown()
+{
+    if (!m_Running.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    assert(t_jobContext.Owner == this && t_jobContext.Index == 0 && "JobSystem::Shutdown 须由 Init 的线程调用");
+
+    // 工作线程在找不到作业时才检查 m_Stopping，因此退出前会帮忙清空队列
+    {
+        std::lock_guard lock(m_SleepMutex);
+        m_Stopping.store(true, std::memory_order_release);
+    }
+    m_SleepCondition.notify_all();
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+
+    // 此时只剩调用线程：执行剩余作业（包括其完成后释放出的依赖作业）
+    while (Job* job = FindJob(0))
+    {
+        Execute(job);
+    }
+
+    m_Running.store(false, std::memory_order_release);
+    m_Queues.clear();
+    t_jobContext = JobThreadContext{};
+    TE_LOG_INFO("JobSystem shut down");
+}
+
+int32_t JobSystem::GetCurrentThreadIndex() const
+{
+    return t_jobContext.Owner == this ? t_jobContext.Index : -1;
+}
+
+Job* JobSystem::AllocateJob()
+{
+    void* memory = MemAlloc(sizeof(Job), MemoryTag::Core);
+    return memory ? ::new (memory) Job : nullptr;
+}
+
+void JobSystem::Submit(Job* job, JobCounter* counter, JobCounter* dependency)
+{
+    job->Counter = counter;
+    if (counter)
+    {
+        counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (dependency)
+    {
+        std::lock_guard lock(dependency->m_WaitersMutex);
+        if (dependency->m_Pending.load(std::memory_order_acquire) != 0)
+        {
+            job->Next = dependency->m_Waiters;
+            dependency->m_Waiters = job;
+            return;
+        }
+    }
+    Schedule(job);
+}
+
+void JobSystem::Schedule(Job* job)
+{
+    const JobThreadContext& context = t_jobContext;
+    if (context.Owner != this || !m_Queues[static_cast<size_t>(context.Index)]->Push(job))
+    {
+        PushGlobal(job);
+    }
+    WakeWorker();
+}
+
+void JobSystem::Execute(Job* job)
+{
+    job->Invoke(*job);
+    JobCounter* counter = job->Counter;
+    MemFreeSized(job, sizeof(Job));
+    if (counter)
+    {
+        CompleteCounter(*counter);
+    }
+}
+
+void JobSystem::CompleteCounter(JobCounter& counter)
+{
+    // 快速路径：不是最后一个作业时无锁递减
+    uint32_t pending = counter.m_Pending.load(std::memory_order_relaxed);
+    while (pending > 1)
+    {
+        if (counter.m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel,
+                                                    std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    // 可能是最后一个：在锁内归零并取走等待链表，与 Submit 的依赖检查互斥
+    Job* waiters = nullptr;
+    {
+        std::lock_guard lock(counter.m_WaitersMutex);
+        if (counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            waiters = counter.m_Waiters;
+            counter.m_Waiters = nullptr;
+        }
+    }
+
+    // 此后不再访问 counter（Wait 返回后它可能立即销毁）
+    while (waiters)
+    {
+        Job* next = waiters->Next;
+        waiters->Next = nullptr;
+        Schedule(waiters);
+        waiters = next;
+    }
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    const int32_t threadIndex = GetCurrentThreadIndex();
+    uint32_t idleRounds = 0;
+    while (!counter.IsDone())
+    {
+        if (Job* job = FindJob(threadIndex))
+        {
+            Execute(job);
+            idleRounds = 0;
+            continue;
+        }
+        // 剩余作业正在其它线程上执行：先自旋，久等后让出时间片
+        if (++idleRounds < IdleSpinRounds)
+        {
+            CpuPause();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+Job* JobSystem::FindJob(int32_t threadIndex)
+{
+    if (threadIndex >= 0)
+    {
+        if (Job* job = m_Queues[static_cast<size_t>(threadIndex)]->Pop())
+        {
+            return job;
+        }
+    }
+
+    if (m_GlobalCount.load(std::memory_order_acquire) != 0)
+    {
+        if (Job* job = PopGlobal())
+        {
+            return job;
+        }
+    }
+
+    // 从随机位置开始轮询其它线程的 deque
+    const uint32_t queueCount = static_cast<uint32_t>(m_Queues.size());
+    if (queueCount == 0)
+    {
+        return nullptr;
+    }
+    const uint32_t start = NextRandom(t_jobContext.RandomState) % queueCount;
+    for (uint32_t i = 0; i < queueCount; ++i)
+    {
+        const uint32_t victim = (start + i) % queueCount;
+        if (static_cast<int32_t>(victim) == threadIndex)
+        {
+            continue;
+        }
+        if (Job* job = m_Queues[victim]->Steal())
+        {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+Job* JobSystem::PopGlobal()
+{
+    std::lock_guard lock(m_GlobalMutex);
+    Job* job = m_GlobalHead;
+    if (job)
+    {
+        m_GlobalHead = job->Next;
+        if (!m_GlobalHead)
+        {
+            m_GlobalTail = nullptr;
+        }
+        job->Next = nullptr;
+        m_GlobalCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+void JobSystem::PushGlobal(Job* job)
+{
+    std::lock_guard lock(m_GlobalMutex);
+    job->Next = nullptr;
+    if (m_GlobalTail)
+    {
+        m_GlobalTail->Next = job;
+    }
+    else
+    {
+        m_GlobalHead = job;
+    }
+    m_GlobalTail = job;
+    m_GlobalCount.fetch_add(1, std::memory_order_release);
+}
+
+void JobSystem::WakeWorker()
+{
+    // 与 WorkerMain 的休眠判断构成 Dekker 式配对：双方都用 seq_cst，
+    // 要么提交方看到休眠计数并在锁内通知，要么休眠方看到新的 generation 而不进入等待
+    m_WorkGeneration.fetch_add(1, std::memory_order_seq_cst);
+    if (m_SleepingWorkers.load(std::memory_order_seq_cst) != 0)
+    {
+        {
+            std::lock_guard lock(m_SleepMutex);
+        }
+        m_SleepCondition.notify_one();
+    }
+}
+
+void JobSystem::WorkerMain(uint32_t threadIndex)
+{
+    t_jobContext = JobThreadContext{this, static_cast<int32_t>(threadIndex), 0x9E3779B9u * (threadIndex + 1)};
+    SetCurrentThreadName(std::string(m_Config.NamePrefix) + " " + std::to_string(threadIndex));
+    if (m_Config.PinWorkers)
+    {
+        const uint32_t logicalCore = threadIndex % std::max(1u, std::thread::hardware_concurrency());
+        if (!PinCurrentThread(logicalCore))
+        {
+            TE_LOG_WARN("JobSystem: failed to pin worker {} to logical core {}", threadIndex, logicalCore);
+        }
+    }
+
+    const int32_t index = static_cast<int32_t>(threadIndex);
+    uint32_t idleRounds = 0;
+    while (true)
+    {
+        if (Job* job = FindJob(index))
+        {
+            Execute(job);
+            idleRounds = 0;
+            continue;
+        }
+        if (m_Stopping.load(std::memory_order_acquire))
+        {
+            break;
+        }
+        if (++idleRounds < IdleSpinRounds)
+        {
+            CpuPause();
+            continue;
+        }
+
+        // 休眠：先登记，再读 generation 并最后扫描一次，避免与提交方错过彼此
+        m_SleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        const uint64_t generation = m_WorkGeneration.load(std::memory_order_seq_cst);
+        if (Job* job = FindJob(index))
+        {
+            m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+            Execute(job);
+            idleRounds = 0;
+            continue;
+        }
+        {
+            std::unique_lock lock(m_SleepMutex);
+            m_SleepCondition.wait(lock, [&]() {
+                return m_Stopping.load(std::memory_order_relaxed) ||
+                       m_WorkGeneration.load(std::memory_order_seq_cst) != generation;
+            });
+        }
+        m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+        idleRounds = 0;
+    }
+
+    // 退出前归还线程本地小块缓存（线程退出钩子也会做，这里提前以便统计及时）
+    MemoryFlushThreadCache();
+}
+
+} // namespace TE
@@ -0,0 +1,107 @@
+// ToyEngine Core Module
+// Chase–Lev 工作窃取双端队列（定长环形缓冲）—— JobSystem 内部使用
+//
+// 算法按 Lê et al. 2013（"Correct and Efficient Work-Stealing for Weak Memory Models"），
+// 其中的 seq_cst 栅栏改为对 m_Bottom / m_Top 的 seq_cst 读写（x86 上同样是一次 xchg），槽位读写使用 release / acquire，
+// 使作业内容的发布对 ThreadSanitizer 可见（TSan 不建模独立栅栏）。
+
+#pragma once
+
+#include "Jobs/JobSystem.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace TE::JobDetail {
+
+class WorkStealingQueue final
+{
+public:
+    explicit WorkStealingQueue(uint32_t capacity)
+        : m_Mask(capacity - 1)
+        , m_Slots(std::make_unique<std::atomic<Job*>[]>(capacity))
+    {
+    }
+
+    WorkStealingQueue(const WorkStealingQueue&) = delete;
+    WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+    /// <summary>
+    /// 仅拥有者线程调用：压入底部；队列满时返回 false
+    /// </summary>
+    bool Push(Job* job)
+    {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_Top.load(std::memory_order_acquire);
+        if (bottom - top > static_cast<int64_t>(m_Mask))
+        {
+            return false;
+        }
+        m_Slots[static_cast<size_t>(bottom) & m_Mask].store(job, std::memory_order_release);
+        m_Bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// <summary>
+    /// 仅拥有者线程调用：从底部弹出（LIFO）；与窃取者争最后一个元素时以 CAS 裁决
+    /// </summary>
+    Job* Pop()
+    {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job* job = m_Slots[static_cast<size_t>(bottom) & m_Mask].load(std::memory_order_acquire);
+        if (top == bottom)
+        {
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                job = nullptr;
+            }
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    /// <summary>
+    /// 任意线程调用：从顶部窃取（FIFO）；队列为空或竞争失败时返回 nullptr
+    /// </summary>
+    Job* Steal()
+    {
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+        const int64_t bottom = m_Bottom.load(std::memory_order_seq_cst);
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        Job* job = m_Slots[static_cast<size_t>(top) & m_Mask].load(std::memory_order_acquire);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return job;
+    }
+
+    /// 近似的元素个数（仅作启发式判断）
+    [[nodiscard]] bool LooksEmpty() const
+    {
+        return m_Top.load(std::memory_order_relaxed) >= m_Bottom.load(std::memory_order_relaxed);
+    }
+
+private:
+    // 拥有者频繁写 m_Bottom、窃取者频繁写 m_Top，分开两条缓存行
+    alignas(64) std::atomic<int64_t> m_Top{0};
+    alignas(64) std::atomic<int64_t> m_Bottom{0};
+    alignas(64) const size_t m_Mask;
+    std::unique_ptr<std::atomic<Job*>[]> m_Slots;
+};
+
+} // namespace TE::JobDetail
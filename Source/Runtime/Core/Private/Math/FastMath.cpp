@@ -0,0 +1,378 @@
+// ToyEngine Core Module
+// Math::Fast* 的批量（SIMD 宽度）实现：与 ScalarMath.h 中的标量版本同一规约与多项式
+
+#include "Math/ScalarMath.h"
+#include "Math/MatrixKernels.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace TE::Math {
+
+namespace {
+
+using namespace FastMathDetail;
+
+// ==================== 通道抽象 ====================
+// AVX2 一次 8 通道，SSE2 一次 4 通道；只用到 SSE2 指令（取整走 cvtps_epi32 的就近舍入）
+
+#if TE_MATH_AVX2
+#define TE_FAST_MATH_SIMD 1
+constexpr size_t LaneWidth = 8;
+using FLane = __m256;
+using FLaneInt = __m256i;
+inline FLane LaneLoad(const float* p) { return _mm256_loadu_ps(p); }
+inline void LaneStore(float* p, FLane v) { _mm256_storeu_ps(p, v); }
+inline FLane LaneSplat(float v) { return _mm256_set1_ps(v); }
+inline FLane LaneAdd(FLane a, FLane b) { return _mm256_add_ps(a, b); }
+inline FLane LaneSub(FLane a, FLane b) { return _mm256_sub_ps(a, b); }
+inline FLane LaneMul(FLane a, FLane b) { return _mm256_mul_ps(a, b); }
+inline FLane LaneDiv(FLane a, FLane b) { return _mm256_div_ps(a, b); }
+inline FLane LaneMulAdd(FLane a, FLane b, FLane c) { return MatrixKernels::MultiplyAdd256(a, b, c); }
+inline FLane LaneMin(FLane a, FLane b) { return _mm256_min_ps(a, b); }
+inline FLane LaneMax(FLane a, FLane b) { return _mm256_max_ps(a, b); }
+inline FLane LaneSqrt(FLane a) { return _mm256_sqrt_ps(a); }
+inline FLane LaneRsqrtEstimate(FLane a) { return _mm256_rsqrt_ps(a); }
+inline FLane LaneAnd(FLane a, FLane b) { return _mm256_and_ps(a, b); }
+inline FLane LaneAndNot(FLane a, FLane b) { return _mm256_andnot_ps(a, b); }
+inline FLane LaneOr(FLane a, FLane b) { return _mm256_or_ps(a, b); }
+inline FLane LaneLess(FLane a, FLane b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+inline FLane LaneGreater(FLane a, FLane b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+inline FLane LaneSelect(FLane mask, FLane a, FLane b) { return _mm256_blendv_ps(b, a, mask); }
+inline FLaneInt LaneRoundToInt(FLane a) { return _mm256_cvtps_epi32(a); }
+inline FLane LaneIntToFloat(FLaneInt a) { return _mm256_cvtepi32_ps(a); }
+inline FLaneInt LaneIntSplat(int32_t v) { return _mm256_set1_epi32(v); }
+inline FLaneInt LaneIntAdd(FLaneInt a, FLaneInt b) { return _mm256_add_epi32(a, b); }
+inline FLaneInt LaneIntAnd(FLaneInt a, FLaneInt b) { return _mm256_and_si256(a, b); }
+inline FLaneInt LaneIntOr(FLaneInt a, FLaneInt b) { return _mm256_or_si256(a, b); }
+inline FLaneInt LaneShiftLeft23(FLaneInt a) { return _mm256_slli_epi32(a, 23); }
+inline FLaneInt LaneShiftRight23(FLaneInt a) { return _mm256_srli_epi32(a, 23); }
+inline FLane LaneAsFloat(FLaneInt a) { return _mm256_castsi256_ps(a); }
+inline FLaneInt LaneAsInt(FLane a) { return _mm256_castps_si256(a); }
+#elif TE_MATH_SSE
+#define TE_FAST_MATH_SIMD 1
+constexpr size_t LaneWidth = 4;
+using FLane = __m128;
+using FLaneInt = __m128i;
+inline FLane LaneLoad(const float* p) { return _mm_loadu_ps(p); }
+inline void LaneStore(float* p, FLane v) { _mm_storeu_ps(p, v); }
+inline FLane LaneSplat(float v) { return _mm_set1_ps(v); }
+inline FLane LaneAdd(FLane a, FLane b) { return _mm_add_ps(a, b); }
+inline FLane LaneSub(FLane a, FLane b) { return _mm_sub_ps(a, b); }
+inline FLane LaneMul(FLane a, FLane b) { return _mm_mul_ps(a, b); }
+inline FLane LaneDiv(FLane a, FLane b) { return _mm_div_ps(a, b); }
+inline FLane LaneMulAdd(FLane a, FLane b, FLane c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline FLane LaneMin(FLane a, FLane b) { return _mm_min_ps(a, b); }
+inline FLane LaneMax(FLane a, FLane b) { return _mm_max_ps(a, b); }
+inline FLane LaneSqrt(FLane a) { return _mm_sqrt_ps(a); }
+inline FLane LaneRsqrtEstimate(FLane a) { return _mm_rsqrt_ps(a); }
+inline FLane LaneAnd(FLane a, FLane b) { return _mm_and_ps(a, b); }
+inline FLane LaneAndNot(FLane a, FLane b) { return _mm_andnot_ps(a, b); }
+inline FLane LaneOr(FLane a, FLane b) { return _mm_or_ps(a, b); }
+inline FLane LaneLess(FLane a, FLane b) { return _mm_cmplt_ps(a, b); }
+inline FLane LaneGreater(FLane a, FLane b) { return _mm_cmpgt_ps(a, b); }
+inline FLane LaneSelect(FLane mask, FLane a, FLane b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+inline FLaneInt LaneRoundToInt(FLane a) { return _mm_cvtps_epi32(a); }
+inline FLane LaneIntToFloat(FLaneInt a) { return _mm_cvtepi32_ps(a); }
+inline FLaneInt LaneIntSplat(int32_t v) { return _mm_set1_epi32(v); }
+inline FLaneInt LaneIntAdd(FLaneInt a, FLaneInt b) { return _mm_add_epi32(a, b); }
+inline FLaneInt LaneIntAnd(FLaneInt a, FLaneInt b) { return _mm_and_si128(a, b); }
+inline FLaneInt LaneIntOr(FLaneInt a, FLaneInt b) { return _mm_or_si128(a, b); }
+inline FLaneInt LaneShiftLeft23(FLaneInt a) { return _mm_slli_epi32(a, 23); }
+inline FLaneInt LaneShiftRight23(FLaneInt a) { return _mm_srli_epi32(a, 23); }
+inline FLane LaneAsFloat(FLaneInt a) { return _mm_castsi128_ps(a); }
+inline FLaneInt LaneAsInt(FLane a) { return _mm_castps_si128(a); }
+#else
+#define TE_FAST_MATH_SIMD 0
+#endif
+
+#if TE_FAST_MATH_SIMD
+
+inline FLane LaneSignBit() { return LaneSplat(-0.0f); }
+inline FLane LaneAbs(FLane a) { return LaneAndNot(LaneSignBit(), a); }
+// |magnitude| 带上 sign 的符号位（magnitude 须非负）
+inline FLane LaneCopySign(FLane magnitude, FLane sign) { return LaneOr(magnitude, LaneAnd(LaneSignBit(), sign)); }
+
+inline FLane LaneRsqrt(FLane x)
+{
+    const FLane estimate = LaneRsqrtEstimate(x);
+    const FLane halfXee = LaneMul(LaneMul(LaneSplat(0.5f), x), LaneMul(estimate, estimate));
+    return LaneMul(estimate, LaneSub(LaneSplat(1.5f), halfXee));
+}
+
+// 规约到 [-π/2, π/2]；outCosSign 为 ±1
+inline FLane LaneReduceHalfPi(FLane x, FLane& outCosSign)
+{
+    const FLane q = LaneIntToFloat(LaneRoundToInt(LaneMul(x, LaneSplat(InvTwoPi))));
+    FLane y = LaneSub(x, LaneMul(q, LaneSplat(TwoPiHigh)));
+    y = LaneSub(y, LaneMul(q, LaneSplat(TwoPiMid)));
+    y = LaneSub(y, LaneMul(q, LaneSplat(TwoPiLow)));
+
+    // |y| > π/2 时反射：y = copysign(π, y) - y，cos 取反
+    const FLane reflect = LaneGreater(LaneAbs(y), LaneSplat(HALF_PI));
+    const FLane reflected = LaneSub(LaneCopySign(LaneSplat(PI), y), y);
+    outCosSign = LaneSelect(reflect, LaneSplat(-1.0f), LaneSplat(1.0f));
+    return LaneSelect(reflect, reflected, y);
+}
+
+inline FLane LaneSinPoly(FLane y)
+{
+    const FLane y2 = LaneMul(y, y);
+    FLane p = LaneMulAdd(LaneSplat(SinC5), y2, LaneSplat(SinC4));
+    p = LaneMulAdd(p, y2, LaneSplat(SinC3));
+    p = LaneMulAdd(p, y2, LaneSplat(SinC2));
+    p = LaneMulAdd(p, y2, LaneSplat(SinC1));
+    return LaneMulAdd(LaneMul(p, y2), y, y);
+}
+
+inline FLane LaneCosPoly(FLane y)
+{
+    const FLane y2 = LaneMul(y, y);
+    FLane p = LaneMulAdd(LaneSplat(CosC5), y2, LaneSplat(CosC4));
+    p = LaneMulAdd(p, y2, LaneSplat(CosC3));
+    p = LaneMulAdd(p, y2, LaneSplat(CosC2));
+    p = LaneMulAdd(p, y2, LaneSplat(CosC1));
+    return LaneMulAdd(p, y2, LaneSplat(1.0f));
+}
+
+inline FLane LaneAtan2(FLane y, FLane x)
+{
+    const FLane ax = LaneAbs(x);
+    const FLane ay = LaneAbs(y);
+    const FLane maxValue = LaneMax(ax, ay);
+    // maxValue == 0 时 0 / 0 = nan，按掩码置 0
+    const FLane a = LaneAnd(LaneGreater(maxValue, LaneSplat(0.0f)), LaneDiv(LaneMin(ax, ay), maxValue));
+    const FLane s = LaneMul(a, a);
+    FLane r = LaneMulAdd(LaneSplat(AtanC5), s, LaneSplat(AtanC4));
+    r = LaneMulAdd(r, s, LaneSplat(AtanC3));
+    r = LaneMulAdd(r, s, LaneSplat(AtanC2));
+    r = LaneMulAdd(r, s, LaneSplat(AtanC1));
+    r = LaneMulAdd(r, s, LaneSplat(AtanC0));
+    r = LaneMul(r, a);
+    r = LaneSelect(LaneGreater(ay, ax), LaneSub(LaneSplat(HALF_PI), r), r);
+    r = LaneSelect(LaneLess(x, LaneSplat(0.0f)), LaneSub(LaneSplat(PI), r), r);
+    return LaneCopySign(r, y);
+}
+
+// acos(|x|)，x 已钳制到 [-1, 1]
+inline FLane LaneAcosPositive(FLane ax)
+{
+    FLane p = LaneMulAdd(LaneSplat(AcosC7), ax, LaneSplat(AcosC6));
+    p = LaneMulAdd(p, ax, LaneSplat(AcosC5));
+    p = LaneMulAdd(p, ax, LaneSplat(AcosC4));
+    p = LaneMulAdd(p, ax, LaneSplat(AcosC3));
+    p = LaneMulAdd(p, ax, LaneSplat(AcosC2));
+    p = LaneMulAdd(p, ax, LaneSplat(AcosC1));
+    p = LaneMulAdd(p, ax, LaneSplat(AcosC0));
+    return LaneMul(LaneSqrt(LaneSub(LaneSplat(1.0f), ax)), p);
+}
+
+inline FLane LaneClampUnit(FLane x)
+{
+    return LaneMin(LaneMax(x, LaneSplat(-1.0f)), LaneSplat(1.0f));
+}
+
+inline FLane LaneExp2(FLane value)
+{
+    const FLane x = LaneMin(LaneMax(value, LaneSplat(-126.0f)), LaneSplat(127.0f));
+    const FLaneInt i = LaneRoundToInt(x);
+    const FLane f = LaneSub(x, LaneIntToFloat(i));
+    FLane p = LaneMulAdd(LaneSplat(Exp2C6), f, LaneSplat(Exp2C5));
+    p = LaneMulAdd(p, f, LaneSplat(Exp2C4));
+    p = LaneMulAdd(p, f, LaneSplat(Exp2C3));
+    p = LaneMulAdd(p, f, LaneSplat(Exp2C2));
+    p = LaneMulAdd(p, f, LaneSplat(Exp2C1));
+    p = LaneMulAdd(p, f, LaneSplat(1.0f));
+    return LaneMul(p, LaneAsFloat(LaneShiftLeft23(LaneIntAdd(i, LaneIntSplat(127)))));
+}
+
+inline FLane LaneLog2(FLane value)
+{
+    const FLaneInt bits = LaneAsInt(value);
+    FLane exponent = LaneIntToFloat(LaneIntAdd(LaneIntAnd(LaneShiftRight23(bits), LaneIntSplat(0xFF)), LaneIntSplat(-127)));
+    FLane m = LaneAsFloat(LaneIntOr(LaneIntAnd(bits, LaneIntSplat(0x007FFFFF)), LaneIntSplat(0x3F800000)));
+    const FLane high = LaneGreater(m, LaneSplat(Sqrt2));
+    m = LaneSelect(high, LaneMul(m, LaneSplat(0.5f)), m);
+    exponent = LaneAdd(exponent, LaneAnd(high, LaneSplat(1.0f)));
+
+    const FLane one = LaneSplat(1.0f);
+    const FLane t = LaneDiv(LaneSub(m, one), LaneAdd(m, one));
+    const FLane t2 = LaneMul(t, t);
+    FLane p = LaneMulAdd(LaneSplat(Log2C9), t2, LaneSplat(Log2C7));
+    p = LaneMulAdd(p, t2, LaneSplat(Log2C5));
+    p = LaneMulAdd(p, t2, LaneSplat(Log2C3));
+    p = LaneMulAdd(p, t2, LaneSplat(Log2C1));
+    return LaneMulAdd(p, t, exponent);
+}
+
+#endif
+
+// 逐元素内核：Scalar 为标量版本（尾部与无 SIMD 构建），Lane 为同一算法的通道版本
+struct FRsqrtKernel
+{
+    static float Scalar(float x) { return FastRsqrt(x); }
+#if TE_FAST_MATH_SIMD
+    static FLane Lane(FLane x) { return LaneRsqrt(x); }
+#endif
+};
+
+struct FSinKernel
+{
+    static float Scalar(float x) { return FastSin(x); }
+#if TE_FAST_MATH_SIMD
+    static FLane Lane(FLane x)
+    {
+        FLane cosSign;
+        return LaneSinPoly(LaneReduceHalfPi(x, cosSign));
+    }
+#endif
+};
+
+struct FCosKernel
+{
+    static float Scalar(float x) { return FastCos(x); }
+#if TE_FAST_MATH_SIMD
+    static FLane Lane(FLane x)
+    {
+        FLane cosSign;
+        const FLane y = LaneReduceHalfPi(x, cosSign);
+        return LaneMul(cosSign, LaneCosPoly(y));
+    }
+#endif
+};
+
+struct FAsinKernel
+{
+    static float Scalar(float x) { return FastAsin(x); }
+#if TE_FAST_MATH_SIMD
+    static FLane Lane(FLane x)
+    {
+        const FLane clamped = LaneClampUnit(x);
+        return LaneCopySign(LaneSub(LaneSplat(HALF_PI), LaneAcosPositive(LaneAbs(clamped))), clamped);
+    }
+#endif
+};
+
+struct FAcosKernel
+{
+    static float Scalar(float x) { return FastAcos(x); }
+#if TE_FAST_MATH_SIMD
+    static FLane Lane(FLane x)
+    {
+        const FLane clamped = LaneClampUnit(x);
+        const FLane r = LaneAcosPositive(LaneAbs(clamped));
+        return LaneSelect(LaneLess(clamped, LaneSplat(0.0f)), LaneSub(LaneSplat(PI), r), r);
+    }
+#endif
+};
+
+struct FExp2Kernel
+{
+    static float Scalar(float x) { return FastExp2(x); }
+#if TE_FAST_MATH_SIMD
+    static FLane Lane(FLane x) { return LaneExp2(x); }
+#endif
+};
+
+struct FLog2Kernel
+{
+    static float Scalar(float x) { return FastLog2(x); }
+#if TE_FAST_MATH_SIMD
+    static FLane Lane(FLane x) { return LaneLog2(x); }
+#endif
+};
+
+// 单输入单输出的批量驱动：SIMD 主循环 + 标量尾部
+template<typename TKernel>
+void ForEachUnary(std::span<const float> values, std::span<float> outValues)
+{
+    assert(values.size() == outValues.size());
+    const size_t count = std::min(values.size(), outValues.size());
+    size_t i = 0;
+#if TE_FAST_MATH_SIMD
+    for (; i + LaneWidth <= count; i += LaneWidth)
+    {
+        LaneStore(outValues.data() + i, TKernel::Lane(LaneLoad(values.data() + i)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outValues[i] = TKernel::Scalar(values[i]);
+    }
+}
+
+} // namespace
+
+void FastRsqrt(std::span<const float> values, std::span<float> outValues)
+{
+    ForEachUnary<FRsqrtKernel>(values, outValues);
+}
+
+void FastSin(std::span<const float> radians, std::span<float> outValues)
+{
+    ForEachUnary<FSinKernel>(radians, outValues);
+}
+
+void FastCos(std::span<const float> radians, std::span<float> outValues)
+{
+    ForEachUnary<FCosKernel>(radians, outValues);
+}
+
+void FastSinCos(std::span<const float> radians, std::span<float> outSin, std::span<float> outCos)
+{
+    assert(radians.size() == outSin.size() && radians.size() == outCos.size());
+    const size_t count = std::min({radians.size(), outSin.size(), outCos.size()});
+    size_t i = 0;
+#if TE_FAST_MATH_SIMD
+    for (; i + LaneWidth <= count; i += LaneWidth)
+    {
+        FLane cosSign;
+        const FLane y = LaneReduceHalfPi(LaneLoad(radians.data() + i), cosSign);
+        LaneStore(outSin.data() + i, LaneSinPoly(y));
+        LaneStore(outCos.data() + i, LaneMul(cosSign, LaneCosPoly(y)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        FastSinCos(radians[i], outSin[i], outCos[i]);
+    }
+}
+
+void FastAtan2(std::span<const float> y, std::span<const float> x, std::span<float> outValues)
+{
+    assert(y.size() == x.size() && y.size() == outValues.size());
+    const size_t count = std::min({y.size(), x.size(), outValues.size()});
+    size_t i = 0;
+#if TE_FAST_MATH_SIMD
+    for (; i + LaneWidth <= count; i += LaneWidth)
+    {
+        LaneStore(outValues.data() + i, LaneAtan2(LaneLoad(y.data() + i), LaneLoad(x.data() + i)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outValues[i] = FastAtan2(y[i], x[i]);
+    }
+}
+
+void FastAsin(std::span<const float> values, std::span<float> outValues)
+{
+    ForEachUnary<FAsinKernel>(values, outValues);
+}
+
+void FastAcos(std::span<const float> values, std::span<float> outValues)
+{
+    ForEachUnary<FAcosKernel>(values, outValues);
+}
+
+void FastExp2(std::span<const float> values, std::span<float> outValues)
+{
+    ForEachUnary<FExp2Kernel>(values, outValues);
+}
+
+void FastLog2(std::span<const float> values, std::span<float> outValues)
+{
+    ForEachUnary<FLog2Kernel>(values, outValues);
+}
+
+} // namespace TE::Math
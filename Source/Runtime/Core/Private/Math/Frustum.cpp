@@ -2,10 +2,309 @@
 // 视锥体实现
 
 #include "Math/Frustum.h"
+#include "Math/MatrixKernels.h"
+
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 
 namespace TE {
 
+namespace {
+
+// ==================== 批量剔除：通道抽象 ====================
+// AVX2 一次 8 通道，SSE 一次 4 通道；一个剔除块（Frustum::CullBlockSize = 8）由 1 或 2 组通道组成
+
+#if TE_MATH_AVX2
+#define TE_FRUSTUM_SIMD 1
+constexpr size_t LaneWidth = 8;
+using FLane = __m256;
+inline FLane LaneLoad(const float* p) { return _mm256_loadu_ps(p); }
+inline FLane LaneSplat(float v) { return _mm256_set1_ps(v); }
+inline FLane LaneAdd(FLane a, FLane b) { return _mm256_add_ps(a, b); }
+inline FLane LaneMul(FLane a, FLane b) { return _mm256_mul_ps(a, b); }
+inline FLane LaneNeg(FLane a) { return _mm256_sub_ps(_mm256_setzero_ps(), a); }
+inline uint32_t LaneLessBits(FLane a, FLane b) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ))); }
+inline FLane LaneZero() { return _mm256_setzero_ps(); }
+#elif TE_MATH_SSE
+#define TE_FRUSTUM_SIMD 1
+constexpr size_t LaneWidth = 4;
+using FLane = __m128;
+inline FLane LaneLoad(const float* p) { return _mm_loadu_ps(p); }
+inline FLane LaneSplat(float v) { return _mm_set1_ps(v); }
+inline FLane LaneAdd(FLane a, FLane b) { return _mm_add_ps(a, b); }
+inline FLane LaneMul(FLane a, FLane b) { return _mm_mul_ps(a, b); }
+inline FLane LaneNeg(FLane a) { return _mm_sub_ps(_mm_setzero_ps(), a); }
+inline uint32_t LaneLessBits(FLane a, FLane b) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(a, b))); }
+inline FLane LaneZero() { return _mm_setzero_ps(); }
+#else
+#define TE_FRUSTUM_SIMD 0
+#endif
+
+#if TE_FRUSTUM_SIMD
+// 平面系数按通道广播；法线分量符号决定 P-vertex 取 Max 还是 Min（对所有通道一致，无需逐通道选择）
+struct FPlaneLanes
+{
+    FLane NormalX, NormalY, NormalZ, Distance;
+    bool PositiveX, PositiveY, PositiveZ;
+
+    explicit FPlaneLanes(const Plane& plane)
+        : NormalX(LaneSplat(plane.Normal.X))
+        , NormalY(LaneSplat(plane.Normal.Y))
+        , NormalZ(LaneSplat(plane.Normal.Z))
+        , Distance(LaneSplat(plane.Distance))
+        , PositiveX(plane.Normal.X >= 0.0f)
+        , PositiveY(plane.Normal.Y >= 0.0f)
+        , PositiveZ(plane.Normal.Z >= 0.0f)
+    {}
+
+    [[nodiscard]] FLane SignedDistance(FLane x, FLane y, FLane z) const
+    {
+        return LaneAdd(LaneAdd(LaneAdd(LaneMul(NormalX, x), LaneMul(NormalY, y)), LaneMul(NormalZ, z)), Distance);
+    }
+};
+#endif
+
+float SignedDistance(const Plane& plane, float x, float y, float z)
+{
+    return plane.Normal.X * x + plane.Normal.Y * y + plane.Normal.Z * z + plane.Distance;
+}
+
+// AABB：Outside 取 P-vertex（沿法线最远的顶点）在负半空间，NotInside 取 N-vertex 在负半空间
+struct FAABBShape
+{
+    const BoundingBoxSoA& Boxes;
+
+    [[nodiscard]] bool Outside(const Plane& plane, size_t i) const
+    {
+        return SignedDistance(plane,
+                              plane.Normal.X >= 0.0f ? Boxes.MaxX[i] : Boxes.MinX[i],
+                              plane.Normal.Y >= 0.0f ? Boxes.MaxY[i] : Boxes.MinY[i],
+                              plane.Normal.Z >= 0.0f ? Boxes.MaxZ[i] : Boxes.MinZ[i]) < 0.0f;
+    }
+
+    [[nodiscard]] bool NotInside(const Plane& plane, size_t i) const
+    {
+        return SignedDistance(plane,
+                              plane.Normal.X >= 0.0f ? Boxes.MinX[i] : Boxes.MaxX[i],
+                              plane.Normal.Y >= 0.0f ? Boxes.MinY[i] : Boxes.MaxY[i],
+                              plane.Normal.Z >= 0.0f ? Boxes.MinZ[i] : Boxes.MaxZ[i]) < 0.0f;
+    }
+
+#if TE_FRUSTUM_SIMD
+    [[nodiscard]] uint32_t OutsideBits(const FPlaneLanes& plane, size_t base) const
+    {
+        const FLane x = LaneLoad((plane.PositiveX ? Boxes.MaxX : Boxes.MinX).data() + base);
+        const FLane y = LaneLoad((plane.PositiveY ? Boxes.MaxY : Boxes.MinY).data() + base);
+        const FLane z = LaneLoad((plane.PositiveZ ? Boxes.MaxZ : Boxes.MinZ).data() + base);
+        return LaneLessBits(plane.SignedDistance(x, y, z), LaneZero());
+    }
+
+    [[nodiscard]] uint32_t NotInsideBits(const FPlaneLanes& plane, size_t base) const
+    {
+        const FLane x = LaneLoad((plane.PositiveX ? Boxes.MinX : Boxes.MaxX).data() + base);
+        const FLane y = LaneLoad((plane.PositiveY ? Boxes.MinY : Boxes.MaxY).data() + base);
+        const FLane z = LaneLoad((plane.PositiveZ ? Boxes.MinZ : Boxes.MaxZ).data() + base);
+        return LaneLessBits(plane.SignedDistance(x, y, z), LaneZero());
+    }
+#endif
+};
+
+// 包围球：Outside 为 distance < -radius，NotInside 为 distance < radius
+struct FSphereShape
+{
+    const BoundingSphereSoA& Spheres;
+
+    [[nodiscard]] float Distance(const Plane& plane, size_t i) const
+    {
+        return SignedDistance(plane, Spheres.CenterX[i], Spheres.CenterY[i], Spheres.CenterZ[i]);
+    }
+
+    [[nodiscard]] bool Outside(const Plane& plane, size_t i) const { return Distance(plane, i) < -Spheres.Radius[i]; }
+    [[nodiscard]] bool NotInside(const Plane& plane, size_t i) const { return Distance(plane, i) < Spheres.Radius[i]; }
+
+#if TE_FRUSTUM_SIMD
+    [[nodiscard]] FLane Distance(const FPlaneLanes& plane, size_t base) const
+    {
+        return plane.SignedDistance(LaneLoad(Spheres.CenterX.data() + base),
+                                    LaneLoad(Spheres.CenterY.data() + base),
+                                    LaneLoad(Spheres.CenterZ.data() + base));
+    }
+
+    [[nodiscard]] uint32_t OutsideBits(const FPlaneLanes& plane, size_t base) const
+    {
+        return LaneLessBits(Distance(plane, base), LaneNeg(LaneLoad(Spheres.Radius.data() + base)));
+    }
+
+    [[nodiscard]] uint32_t NotInsideBits(const FPlaneLanes& plane, size_t base) const
+    {
+        return LaneLessBits(Distance(plane, base), LaneLoad(Spheres.Radius.data() + base));
+    }
+#endif
+};
+
+// 一个块内 count 个对象在某平面下的"完全在外"位；满块走 SIMD，尾块逐个测试
+template<typename TShape, typename TPlaneLanes>
+uint32_t BlockOutsideBits(const TShape& shape, const Plane& plane, const TPlaneLanes* planeLanes, size_t base, size_t count)
+{
+#if TE_FRUSTUM_SIMD
+    if (count == Frustum::CullBlockSize)
+    {
+        uint32_t bits = 0;
+        for (size_t lane = 0; lane < Frustum::CullBlockSize; lane += LaneWidth)
+            bits |= shape.OutsideBits(*planeLanes, base + lane) << lane;
+        return bits;
+    }
+#else
+    (void)planeLanes;
+#endif
+    uint32_t bits = 0;
+    for (size_t j = 0; j < count; ++j)
+        bits |= static_cast<uint32_t>(shape.Outside(plane, base + j)) << j;
+    return bits;
+}
+
+template<typename TShape, typename TPlaneLanes>
+uint32_t BlockNotInsideBits(const TShape& shape, const Plane& plane, const TPlaneLanes* planeLanes, size_t base, size_t count)
+{
+#if TE_FRUSTUM_SIMD
+    if (count == Frustum::CullBlockSize)
+    {
+        uint32_t bits = 0;
+        for (size_t lane = 0; lane < Frustum::CullBlockSize; lane += LaneWidth)
+            bits |= shape.NotInsideBits(*planeLanes, base + lane) << lane;
+        return bits;
+    }
+#else
+    (void)planeLanes;
+#endif
+    uint32_t bits = 0;
+    for (size_t j = 0; j < count; ++j)
+        bits |= static_cast<uint32_t>(shape.NotInside(plane, base + j)) << j;
+    return bits;
+}
+
+#if TE_FRUSTUM_SIMD
+using FPlaneLanesStorage = FPlaneLanes;
+#else
+struct FPlaneLanesStorage
+{
+    explicit FPlaneLanesStorage(const Plane&) {}
+};
+#endif
+
+template<typename TShape>
+void CullBlocks(const Plane (&planes)[6],
+                const TShape& shape,
+                size_t count,
+                std::span<uint64_t> outVisibleMask,
+                std::span<uint8_t> inOutLastFailedPlane)
+{
+    const size_t words = Frustum::VisibilityMaskWords(count);
+    assert(outVisibleMask.size() >= words && "CullAABBs/CullSpheres: visibility mask too small");
+    std::fill(outVisibleMask.begin(), outVisibleMask.begin() + static_cast<std::ptrdiff_t>(std::min(words, outVisibleMask.size())), 0ull);
+    if (outVisibleMask.size() < words)
+    {
+        return;
+    }
+
+    const bool useCache = inOutLastFailedPlane.size() >= Frustum::CullBlockCount(count);
+    assert((inOutLastFailedPlane.empty() || useCache) && "CullAABBs/CullSpheres: plane cache too small");
+
+    const FPlaneLanesStorage planeLanes[6] = {
+        FPlaneLanesStorage(planes[0]), FPlaneLanesStorage(planes[1]), FPlaneLanesStorage(planes[2]),
+        FPlaneLanesStorage(planes[3]), FPlaneLanesStorage(planes[4]), FPlaneLanesStorage(planes[5]),
+    };
+
+    for (size_t base = 0, block = 0; base < count; base += Frustum::CullBlockSize, ++block)
+    {
+        const size_t blockCount = std::min(Frustum::CullBlockSize, count - base);
+        const uint32_t fullMask = (1u << blockCount) - 1u;
+        const uint32_t firstPlane = useCache ? inOutLastFailedPlane[block] % 6u : 0u;
+
+        // 从缓存的平面开始轮转测试；整块都被剔除后立即结束
+        uint32_t outside = 0;
+        for (uint32_t k = 0; k < 6; ++k)
+        {
+            const uint32_t planeIndex = (firstPlane + k) % 6u;
+            outside |= BlockOutsideBits(shape, planes[planeIndex], &planeLanes[planeIndex], base, blockCount);
+            if (outside == fullMask)
+            {
+                if (useCache)
+                {
+                    inOutLastFailedPlane[block] = static_cast<uint8_t>(planeIndex);
+                }
+                break;
+            }
+        }
+
+        const uint64_t visible = fullMask & ~outside;
+        outVisibleMask[base >> 6] |= visible << (base & 63);
+    }
+}
+
+template<typename TShape>
+void ClassifyBlocks(const Plane (&planes)[6], const TShape& shape, size_t count, std::span<EFrustumCullResult> outResults)
+{
+    assert(outResults.size() >= count && "ClassifyAABBs: result span too small");
+    count = std::min(count, outResults.size());
+
+    const FPlaneLanesStorage planeLanes[6] = {
+        FPlaneLanesStorage(planes[0]), FPlaneLanesStorage(planes[1]), FPlaneLanesStorage(planes[2]),
+        FPlaneLanesStorage(planes[3]), FPlaneLanesStorage(planes[4]), FPlaneLanesStorage(planes[5]),
+    };
+
+    for (size_t base = 0; base < count; base += Frustum::CullBlockSize)
+    {
+        const size_t blockCount = std::min(Frustum::CullBlockSize, count - base);
+        uint32_t outside = 0;
+        uint32_t notInside = 0;
+        for (int planeIndex = 0; planeIndex < 6; ++planeIndex)
+        {
+            outside |= BlockOutsideBits(shape, planes[planeIndex], &planeLanes[planeIndex], base, blockCount);
+            notInside |= BlockNotInsideBits(shape, planes[planeIndex], &planeLanes[planeIndex], base, blockCount);
+        }
+
+        for (size_t j = 0; j < blockCount; ++j)
+        {
+            outResults[base + j] = (outside >> j) & 1u ? EFrustumCullResult::Outside
+                                 : (notInside >> j) & 1u ? EFrustumCullResult::Intersect
+                                                         : EFrustumCullResult::Inside;
+        }
+    }
+}
+
+template<typename TOutside, typename TInside>
+EFrustumCullResult ClassifySingle(const Plane (&planes)[6],
+                                  uint8_t& inOutPlaneMask,
+                                  uint8_t& inOutLastFailedPlane,
+                                  TOutside&& isOutside,
+                                  TInside&& isInside)
+{
+    const uint32_t firstPlane = inOutLastFailedPlane % 6u;
+    for (uint32_t k = 0; k < 6; ++k)
+    {
+        const uint32_t planeIndex = (firstPlane + k) % 6u;
+        const uint8_t planeBit = static_cast<uint8_t>(1u << planeIndex);
+        if ((inOutPlaneMask & planeBit) == 0)
+        {
+            continue;
+        }
+        if (isOutside(planes[planeIndex]))
+        {
+            inOutLastFailedPlane = static_cast<uint8_t>(planeIndex);
+            return EFrustumCullResult::Outside;
+        }
+        if (isInside(planes[planeIndex]))
+        {
+            inOutPlaneMask = static_cast<uint8_t>(inOutPlaneMask & ~planeBit);
+        }
+    }
+    return inOutPlaneMask == 0 ? EFrustumCullResult::Inside : EFrustumCullResult::Intersect;
+}
+
+} // namespace
+
 // Gribb-Hartmann 方法：从右手系、ZO 深度范围的 VP 矩阵行提取 6 个裁剪平面。
 // 矩阵按列主序存储：M[col][row]
 // 行向量通过 row 索引取各列元素
@@ -124,4 +423,52 @@ bool Frustum::IntersectsSphere(const BoundingSphere& sphere) const
     return true;
 }
 
+void Frustum::CullAABBs(const BoundingBoxSoA& boxes,
+                        std::span<uint64_t> outVisibleMask,
+                        std::span<uint8_t> inOutLastFailedPlane) const
+{
+    CullBlocks(Planes, FAABBShape{boxes}, boxes.Size(), outVisibleMask, inOutLastFailedPlane);
+}
+
+void Frustum::CullSpheres(const BoundingSphereSoA& spheres,
+                          std::span<uint64_t> outVisibleMask,
+                          std::span<uint8_t> inOutLastFailedPlane) const
+{
+    CullBlocks(Planes, FSphereShape{spheres}, spheres.Size(), outVisibleMask, inOutLastFailedPlane);
+}
+
+void Frustum::ClassifyAABBs(const BoundingBoxSoA& boxes, std::span<EFrustumCullResult> outResults) const
+{
+    ClassifyBlocks(Planes, FAABBShape{boxes}, boxes.Size(), outResults);
+}
+
+EFrustumCullResult Frustum::ClassifyAABB(const BoundingBox& box,
+                                         uint8_t& inOutPlaneMask,
+                                         uint8_t& inOutLastFailedPlane) const
+{
+    const auto vertexDistance = [&box](const Plane& plane, bool positive)
+    {
+        // positive 为 true 取 P-vertex，否则取 N-vertex
+        const bool useMaxX = (plane.Normal.X >= 0.0f) == positive;
+        const bool useMaxY = (plane.Normal.Y >= 0.0f) == positive;
+        const bool useMaxZ = (plane.Normal.Z >= 0.0f) == positive;
+        return SignedDistance(plane,
+                              useMaxX ? box.Max.X : box.Min.X,
+                              useMaxY ? box.Max.Y : box.Min.Y,
+                              useMaxZ ? box.Max.Z : box.Min.Z);
+    };
+    return ClassifySingle(Planes, inOutPlaneMask, inOutLastFailedPlane,
+                          [&](const Plane& plane) { return vertexDistance(plane, true) < 0.0f; },
+                          [&](const Plane& plane) { return vertexDistance(plane, false) >= 0.0f; });
+}
+
+EFrustumCullResult Frustum::ClassifySphere(const BoundingSphere& sphere,
+                                           uint8_t& inOutPlaneMask,
+                                           uint8_t& inOutLastFailedPlane) const
+{
+    return ClassifySingle(Planes, inOutPlaneMask, inOutLastFailedPlane,
+                          [&](const Plane& plane) { return plane.SignedDistance(sphere.Center) < -sphere.Radius; },
+                          [&](const Plane& plane) { return plane.SignedDistance(sphere.Center) >= sphere.Radius; });
+}
+
 } // namespace TE
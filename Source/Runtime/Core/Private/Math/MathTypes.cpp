@@ -2,16 +2,15 @@
 // 数学类型实现 - Vector、Matrix、Quat 的方法实现
 
 #include "Math/Matrix.h"
+#include "Math/MatrixKernels.h"
 #include "Math/Quat.h"
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
-#define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/type_ptr.hpp>
-#include <glm/gtx/matrix_decompose.hpp>
 
 namespace TE {
 
@@ -22,50 +21,11 @@ glm::vec3 ToGlm(const Vector3& v)
     return {v.X, v.Y, v.Z};
 }
 
-glm::mat3 ToGlm(const Matrix3& m)
-{
-    glm::mat3 result(1.0f);
-    for (int i = 0; i < 3; ++i)
-    {
-        for (int j = 0; j < 3; ++j)
-        {
-            result[i][j] = m.M[i][j];
-        }
-    }
-    return result;
-}
-
-glm::mat4 ToGlm(const Matrix4& m)
-{
-    glm::mat4 result(1.0f);
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            result[i][j] = m.M[i][j];
-        }
-    }
-    return result;
-}
-
 glm::quat ToGlm(const Quat& q)
 {
     return {q.W, q.X, q.Y, q.Z};
 }
 
-Matrix3 FromGlm(const glm::mat3& m)
-{
-    Matrix3 result(0.0f);
-    for (int i = 0; i < 3; ++i)
-    {
-        for (int j = 0; j < 3; ++j)
-        {
-            result.M[i][j] = m[i][j];
-        }
-    }
-    return result;
-}
-
 Matrix4 FromGlm(const glm::mat4& m)
 {
     Matrix4 result(0.0f);
@@ -84,6 +44,29 @@ Quat FromGlm(const glm::quat& q)
     return {q.x, q.y, q.z, q.w};
 }
 
+// 纯旋转矩阵（列主序 3 列）转四元数，Shepperd 方法：按最大对角分量选择分支以保证数值稳定
+Quat QuatFromRotationColumns(const Vector3& c0, const Vector3& c1, const Vector3& c2)
+{
+    const float trace = c0.X + c1.Y + c2.Z;
+    if (trace > 0.0f)
+    {
+        const float s = 0.5f / std::sqrt(trace + 1.0f);
+        return {(c1.Z - c2.Y) * s, (c2.X - c0.Z) * s, (c0.Y - c1.X) * s, 0.25f / s};
+    }
+    if (c0.X > c1.Y && c0.X > c2.Z)
+    {
+        const float s = 2.0f * std::sqrt(1.0f + c0.X - c1.Y - c2.Z);
+        return {0.25f * s, (c1.X + c0.Y) / s, (c2.X + c0.Z) / s, (c1.Z - c2.Y) / s};
+    }
+    if (c1.Y > c2.Z)
+    {
+        const float s = 2.0f * std::sqrt(1.0f + c1.Y - c0.X - c2.Z);
+        return {(c1.X + c0.Y) / s, 0.25f * s, (c2.Y + c1.Z) / s, (c2.X - c0.Z) / s};
+    }
+    const float s = 2.0f * std::sqrt(1.0f + c2.Z - c0.X - c1.Y);
+    return {(c2.X + c0.Z) / s, (c2.Y + c1.Z) / s, 0.25f * s, (c0.Y - c1.X) / s};
+}
+
 } // namespace
 
 // ==================== Vector2 常量 ====================
@@ -110,16 +93,28 @@ const Matrix3 Matrix3::Zero(0.0f);
 // Matrix3 逆矩阵
 Matrix3 Matrix3::Inverse() const
 {
-    glm::mat3 glmMat = ToGlm(*this);
-    glm::mat3 inv = glm::inverse(glmMat);
-    return FromGlm(inv);
+    // 逆矩阵的各行是两列叉积 / 行列式；转置写回列主序
+    const Vector3 c0(M[0][0], M[0][1], M[0][2]);
+    const Vector3 c1(M[1][0], M[1][1], M[1][2]);
+    const Vector3 c2(M[2][0], M[2][1], M[2][2]);
+    const Vector3 r0 = Vector3::Cross(c1, c2);
+    const Vector3 r1 = Vector3::Cross(c2, c0);
+    const Vector3 r2 = Vector3::Cross(c0, c1);
+    const float invDet = 1.0f / Vector3::Dot(c0, r0);
+
+    Matrix3 result(0.0f);
+    result.M[0][0] = r0.X * invDet; result.M[0][1] = r1.X * invDet; result.M[0][2] = r2.X * invDet;
+    result.M[1][0] = r0.Y * invDet; result.M[1][1] = r1.Y * invDet; result.M[1][2] = r2.Y * invDet;
+    result.M[2][0] = r0.Z * invDet; result.M[2][1] = r1.Z * invDet; result.M[2][2] = r2.Z * invDet;
+    return result;
 }
 
 // Matrix3 行列式
 float Matrix3::Determinant() const
 {
-    glm::mat3 glmMat = ToGlm(*this);
-    return glm::determinant(glmMat);
+    return M[0][0] * (M[1][1] * M[2][2] - M[2][1] * M[1][2])
+         - M[1][0] * (M[0][1] * M[2][2] - M[2][1] * M[0][2])
+         + M[2][0] * (M[0][1] * M[1][2] - M[1][1] * M[0][2]);
 }
 
 // ==================== Matrix4 常量 ====================
@@ -129,16 +124,40 @@ const Matrix4 Matrix4::Zero(0.0f);
 // Matrix4 逆矩阵
 Matrix4 Matrix4::Inverse() const
 {
-    glm::mat4 glmMat = ToGlm(*this);
-    glm::mat4 inv = glm::inverse(glmMat);
-    return FromGlm(inv);
+    Matrix4 result(0.0f);
+    (void)MatrixKernels::Inverse(&M[0][0], &result.M[0][0]);
+    return result;
 }
 
-// Matrix4 行列式
+// Matrix4 仿射逆矩阵
+Matrix4 Matrix4::InverseAffine() const
+{
+    Matrix4 result;
+    if (!MatrixKernels::InverseAffine(&M[0][0], &result.M[0][0]))
+    {
+        return Identity;
+    }
+    return result;
+}
+
+// Matrix4 行列式（按第 4 列的 2x2 子式展开）
 float Matrix4::Determinant() const
 {
-    glm::mat4 glmMat = ToGlm(*this);
-    return glm::determinant(glmMat);
+    const float s0 = M[0][0] * M[1][1] - M[1][0] * M[0][1];
+    const float s1 = M[0][0] * M[1][2] - M[1][0] * M[0][2];
+    const float s2 = M[0][0] * M[1][3] - M[1][0] * M[0][3];
+    const float s3 = M[0][1] * M[1][2] - M[1][1] * M[0][2];
+    const float s4 = M[0][1] * M[1][3] - M[1][1] * M[0][3];
+    const float s5 = M[0][2] * M[1][3] - M[1][2] * M[0][3];
+
+    const float c5 = M[2][2] * M[3][3] - M[3][2] * M[2][3];
+    const float c4 = M[2][1] * M[3][3] - M[3][1] * M[2][3];
+    const float c3 = M[2][1] * M[3][2] - M[3][1] * M[2][2];
+    const float c2 = M[2][0] * M[3][3] - M[3][0] * M[2][3];
+    const float c1 = M[2][0] * M[3][2] - M[3][0] * M[2][2];
+    const float c0 = M[2][0] * M[3][1] - M[3][0] * M[2][1];
+
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 }
 
 // Matrix4 法线变换矩阵（逆转置 3x3）
@@ -153,21 +172,55 @@ Matrix3 Matrix4::GetNormalMatrix() const
 // Matrix4 分解为 TRS 分量
 bool Matrix4::Decompose(Vector3& outTranslation, Quat& outRotation, Vector3& outScale) const
 {
-    glm::mat4 glmMat = ToGlm(*this);
-    glm::vec3 scale;
-    glm::quat rotation;
-    glm::vec3 translation;
-    glm::vec3 skew;
-    glm::vec4 perspective;
+    // 仅处理仿射 TRS（含切变时按 Gram-Schmidt 正交化剔除），不提取透视分量
+    if (M[3][3] == 0.0f)
+    {
+        return false;
+    }
+    const float invW = 1.0f / M[3][3];
+
+    Vector3 c0 = Vector3(M[0][0], M[0][1], M[0][2]) * invW;
+    Vector3 c1 = Vector3(M[1][0], M[1][1], M[1][2]) * invW;
+    Vector3 c2 = Vector3(M[2][0], M[2][1], M[2][2]) * invW;
+
+    Vector3 scale;
+    scale.X = c0.Length();
+    if (scale.X <= 0.0f)
+    {
+        return false;
+    }
+    c0 = c0 / scale.X;
+
+    c1 = c1 - c0 * Vector3::Dot(c0, c1);
+    scale.Y = c1.Length();
+    if (scale.Y <= 0.0f)
+    {
+        return false;
+    }
+    c1 = c1 / scale.Y;
+
+    c2 = c2 - c0 * Vector3::Dot(c0, c2);
+    c2 = c2 - c1 * Vector3::Dot(c1, c2);
+    scale.Z = c2.Length();
+    if (scale.Z <= 0.0f)
+    {
+        return false;
+    }
+    c2 = c2 / scale.Z;
 
-    bool success = glm::decompose(glmMat, scale, rotation, translation, skew, perspective);
-    if (success)
+    // 镜像变换：与 glm::decompose 一致，翻转全部缩放与基向量
+    if (Vector3::Dot(c0, Vector3::Cross(c1, c2)) < 0.0f)
     {
-        outTranslation = Vector3(translation.x, translation.y, translation.z);
-        outRotation = Quat(rotation.x, rotation.y, rotation.z, rotation.w);
-        outScale = Vector3(scale.x, scale.y, scale.z);
+        scale = scale * -1.0f;
+        c0 = c0 * -1.0f;
+        c1 = c1 * -1.0f;
+        c2 = c2 * -1.0f;
     }
-    return success;
+
+    outTranslation = Vector3(M[3][0], M[3][1], M[3][2]) * invW;
+    outRotation = QuatFromRotationColumns(c0, c1, c2);
+    outScale = scale;
+    return true;
 }
 
 // 获取平移分量
@@ -195,13 +248,10 @@ Quat Matrix4::GetRotation() const
     float invSy = scale.Y > 1e-6f ? 1.0f / scale.Y : 0.0f;
     float invSz = scale.Z > 1e-6f ? 1.0f / scale.Z : 0.0f;
 
-    glm::mat3 rotMat;
-    rotMat[0][0] = M[0][0] * invSx; rotMat[0][1] = M[0][1] * invSx; rotMat[0][2] = M[0][2] * invSx;
-    rotMat[1][0] = M[1][0] * invSy; rotMat[1][1] = M[1][1] * invSy; rotMat[1][2] = M[1][2] * invSy;
-    rotMat[2][0] = M[2][0] * invSz; rotMat[2][1] = M[2][1] * invSz; rotMat[2][2] = M[2][2] * invSz;
-
-    glm::quat q = glm::quat_cast(rotMat);
-    return {q.x, q.y, q.z, q.w};
+    return QuatFromRotationColumns(
+        Vector3(M[0][0], M[0][1], M[0][2]) * invSx,
+        Vector3(M[1][0], M[1][1], M[1][2]) * invSy,
+        Vector3(M[2][0], M[2][1], M[2][2]) * invSz);
 }
 
 // 提取左上角 3x3 矩阵
@@ -217,8 +267,11 @@ Matrix3 Matrix4::ToMatrix3() const
 // Matrix4 变换辅助函数
 Matrix4 Matrix4::Translate(const Vector3& translation)
 {
-    glm::mat4 result = glm::translate(glm::mat4(1.0f), ToGlm(translation));
-    return FromGlm(result);
+    Matrix4 result;
+    result.M[3][0] = translation.X;
+    result.M[3][1] = translation.Y;
+    result.M[3][2] = translation.Z;
+    return result;
 }
 
 Matrix4 Matrix4::Rotate(float angleRadians, const Vector3& axis)
@@ -229,8 +282,11 @@ Matrix4 Matrix4::Rotate(float angleRadians, const Vector3& axis)
 
 Matrix4 Matrix4::Scale(const Vector3& scale)
 {
-    glm::mat4 result = glm::scale(glm::mat4(1.0f), ToGlm(scale));
-    return FromGlm(result);
+    Matrix4 result;
+    result.M[0][0] = scale.X;
+    result.M[1][1] = scale.Y;
+    result.M[2][2] = scale.Z;
+    return result;
 }
 
 Matrix4 Matrix4::LookAtRH(const Vector3& eye, const Vector3& center, const Vector3& up)
@@ -299,6 +355,59 @@ Matrix4 Matrix4::OrthographicLH_ZO(float left, float right, float bottom, float
     return FromGlm(result);
 }
 
+// ==================== Matrix3x4 ====================
+
+const Matrix3x4 Matrix3x4::Identity;
+
+Matrix3x4::Matrix3x4(const Matrix4& affine)
+{
+    for (int row = 0; row < 3; ++row)
+        for (int col = 0; col < 4; ++col)
+            M[row][col] = affine.M[col][row];
+}
+
+Matrix3x4 Matrix3x4::Inverse() const
+{
+    Matrix3x4 result;
+    if (!MatrixKernels::Inverse3x4(&M[0][0], &result.M[0][0]))
+    {
+        return Identity;
+    }
+    return result;
+}
+
+Matrix3 Matrix3x4::GetNormalMatrix() const
+{
+    Matrix3 result(0.0f);
+    MatrixKernels::NormalMatrix3x4(&M[0][0], &result.M[0][0]);
+    return result;
+}
+
+Matrix4 Matrix3x4::ToMatrix4() const
+{
+    Matrix4 result;
+    for (int col = 0; col < 4; ++col)
+        for (int row = 0; row < 3; ++row)
+            result.M[col][row] = M[row][col];
+    return result;
+}
+
+Matrix3 Matrix3x4::ToMatrix3() const
+{
+    Matrix3 result;
+    for (int col = 0; col < 3; ++col)
+        for (int row = 0; row < 3; ++row)
+            result.M[col][row] = M[row][col];
+    return result;
+}
+
+float Matrix3x4::Determinant() const
+{
+    return M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) -
+           M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0]) +
+           M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]);
+}
+
 // ==================== Quat 常量 ====================
 const Quat Quat::Identity(0.0f, 0.0f, 0.0f, 1.0f);
 
@@ -316,16 +425,15 @@ Quat Quat::FromEuler(float yaw, float pitch, float roll)
 // 转换为旋转矩阵
 Matrix4 Quat::ToMatrix4() const
 {
-    glm::quat glmQuat = ToGlm(*this);
-    glm::mat4 result = glm::mat4_cast(glmQuat);
-    return FromGlm(result);
+    const float q[4] = {X, Y, Z, W};
+    Matrix4 result(0.0f);
+    MatrixKernels::QuatToMatrix(q, &result.M[0][0]);
+    return result;
 }
 
 Matrix3 Quat::ToMatrix3() const
 {
-    glm::quat glmQuat = ToGlm(*this);
-    glm::mat3 result = glm::mat3_cast(glmQuat);
-    return FromGlm(result);
+    return ToMatrix4().ToMatrix3();
 }
 
 // 转换为欧拉角
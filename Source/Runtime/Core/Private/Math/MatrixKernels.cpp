@@ -0,0 +1,445 @@
+// ToyEngine Core Module
+// 4x4 矩阵 / 四元数 SIMD 内核实现（求逆、仿射求逆、四元数转矩阵、3x4 仿射求逆与法线矩阵）
+
+#include "Math/MatrixKernels.h"
+
+#include <cmath>
+
+namespace TE::MatrixKernels {
+
+// ==================== 标量参考实现 ====================
+
+namespace Scalar {
+
+float Inverse(const float* m, float* out)
+{
+    float inv[16];
+
+    inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] +
+             m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+    inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] -
+             m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+    inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] +
+             m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+    inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] -
+              m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+    inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] -
+             m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+    inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] +
+             m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+    inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] -
+             m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+    inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] +
+              m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+    inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] +
+             m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+    inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] -
+             m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+    inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] +
+              m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+    inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] -
+              m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+    inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] -
+             m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+    inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] +
+             m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+    inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] -
+              m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+    inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] +
+              m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+    const float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+    const float invDet = 1.0f / det;
+    for (int i = 0; i < 16; ++i)
+        out[i] = inv[i] * invDet;
+    return det;
+}
+
+bool InverseAffine(const float* m, float* out)
+{
+    // 列 c0 / c1 / c2 为线性部分，R^-1 的各行为两两叉积 / det
+    const float* c0 = m;
+    const float* c1 = m + 4;
+    const float* c2 = m + 8;
+    const float r0[3] = {c1[1] * c2[2] - c1[2] * c2[1], c1[2] * c2[0] - c1[0] * c2[2], c1[0] * c2[1] - c1[1] * c2[0]};
+    const float r1[3] = {c2[1] * c0[2] - c2[2] * c0[1], c2[2] * c0[0] - c2[0] * c0[2], c2[0] * c0[1] - c2[1] * c0[0]};
+    const float r2[3] = {c0[1] * c1[2] - c0[2] * c1[1], c0[2] * c1[0] - c0[0] * c1[2], c0[0] * c1[1] - c0[1] * c1[0]};
+
+    const float det = c0[0] * r0[0] + c0[1] * r0[1] + c0[2] * r0[2];
+    if (det == 0.0f)
+    {
+        return false;
+    }
+    const float invDet = 1.0f / det;
+    const float t[3] = {m[12], m[13], m[14]};
+
+    float result[16];
+    for (int i = 0; i < 3; ++i)
+    {
+        // 逆矩阵第 i 列 = (r0[i], r1[i], r2[i]) / det
+        result[i * 4 + 0] = r0[i] * invDet;
+        result[i * 4 + 1] = r1[i] * invDet;
+        result[i * 4 + 2] = r2[i] * invDet;
+        result[i * 4 + 3] = 0.0f;
+    }
+    for (int j = 0; j < 3; ++j)
+        result[12 + j] = -(result[j] * t[0] + result[4 + j] * t[1] + result[8 + j] * t[2]);
+    result[15] = 1.0f;
+
+    for (int i = 0; i < 16; ++i)
+        out[i] = result[i];
+    return true;
+}
+
+void QuatToMatrix(const float* q, float* out)
+{
+    const float x = q[0];
+    const float y = q[1];
+    const float z = q[2];
+    const float w = q[3];
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+
+    out[0] = 1.0f - 2.0f * (yy + zz);
+    out[1] = 2.0f * (xy + wz);
+    out[2] = 2.0f * (xz - wy);
+    out[3] = 0.0f;
+
+    out[4] = 2.0f * (xy - wz);
+    out[5] = 1.0f - 2.0f * (xx + zz);
+    out[6] = 2.0f * (yz + wx);
+    out[7] = 0.0f;
+
+    out[8] = 2.0f * (xz + wy);
+    out[9] = 2.0f * (yz - wx);
+    out[10] = 1.0f - 2.0f * (xx + yy);
+    out[11] = 0.0f;
+
+    out[12] = 0.0f;
+    out[13] = 0.0f;
+    out[14] = 0.0f;
+    out[15] = 1.0f;
+}
+
+namespace {
+
+// 3x4 线性部分的余子式矩阵（各行 = 两两叉积）与行列式
+float Cofactors3x4(const float* m, float cof[3][3])
+{
+    const float* r0 = m;
+    const float* r1 = m + 4;
+    const float* r2 = m + 8;
+    const float rows[3][3] = {
+        {r1[1] * r2[2] - r1[2] * r2[1], r1[2] * r2[0] - r1[0] * r2[2], r1[0] * r2[1] - r1[1] * r2[0]},
+        {r2[1] * r0[2] - r2[2] * r0[1], r2[2] * r0[0] - r2[0] * r0[2], r2[0] * r0[1] - r2[1] * r0[0]},
+        {r0[1] * r1[2] - r0[2] * r1[1], r0[2] * r1[0] - r0[0] * r1[2], r0[0] * r1[1] - r0[1] * r1[0]},
+    };
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            cof[i][j] = rows[i][j];
+    return r0[0] * cof[0][0] + r0[1] * cof[0][1] + r0[2] * cof[0][2];
+}
+
+} // namespace
+
+bool Inverse3x4(const float* m, float* out)
+{
+    float cof[3][3];
+    const float det = Cofactors3x4(m, cof);
+    if (det == 0.0f)
+    {
+        return false;
+    }
+    const float invDet = 1.0f / det;
+    const float t[3] = {m[3], m[7], m[11]};
+
+    // 逆矩阵 = 余子式矩阵的转置 / det；平移 = -(R^-1 t)
+    float result[12];
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+            result[i * 4 + j] = cof[j][i] * invDet;
+        result[i * 4 + 3] = -(result[i * 4 + 0] * t[0] + result[i * 4 + 1] * t[1] + result[i * 4 + 2] * t[2]);
+    }
+    for (int i = 0; i < 12; ++i)
+        out[i] = result[i];
+    return true;
+}
+
+void NormalMatrix3x4(const float* m, float* out)
+{
+    // 逆转置 = 余子式矩阵 / det；输出列主序：out[col * 3 + row] = N[row][col]
+    float cof[3][3];
+    const float invDet = 1.0f / Cofactors3x4(m, cof);
+    for (int col = 0; col < 3; ++col)
+        for (int row = 0; row < 3; ++row)
+            out[col * 3 + row] = cof[row][col] * invDet;
+}
+
+} // namespace Scalar
+
+// ==================== SSE 实现 ====================
+
+#if TE_MATH_SSE
+
+namespace {
+
+#define TE_SHUFFLE_MASK(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+template<int X, int Y, int Z, int W>
+__m128 Swizzle(__m128 v)
+{
+    return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(v), TE_SHUFFLE_MASK(X, Y, Z, W)));
+}
+
+template<int X, int Y, int Z, int W>
+__m128 Shuffle(__m128 a, __m128 b)
+{
+    return _mm_shuffle_ps(a, b, TE_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+// 以下 2x2 矩阵按 (m00, m01, m10, m11) 打包在一个寄存器里
+
+// A * B
+__m128 Mat2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                      _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+// adj(A) * B
+__m128 Mat2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                      _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+// A * adj(B)
+__m128 Mat2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                      _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+__m128 Cross3(__m128 a, __m128 b)
+{
+    const __m128 aYzx = Swizzle<1, 2, 0, 3>(a);
+    const __m128 bYzx = Swizzle<1, 2, 0, 3>(b);
+    return Swizzle<1, 2, 0, 3>(_mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b)));
+}
+
+__m128 Dot3Splat(__m128 a, __m128 b)
+{
+    const __m128 p = _mm_mul_ps(a, b);
+    return _mm_add_ps(_mm_add_ps(Swizzle<0, 0, 0, 0>(p), Swizzle<1, 1, 1, 1>(p)), Swizzle<2, 2, 2, 2>(p));
+}
+
+} // namespace
+
+float Inverse(const float* m, float* out)
+{
+    // 2x2 分块法：M = | A B |，逆为 1/|M| * | X Y |（X/Y/Z/W 由伴随矩阵组合而成）
+    //                 | C D |                | Z W |
+    // 列主序存储等于转置矩阵的行主序，而 (M^T)^-1 = (M^-1)^T，因此按行主序推导的公式可直接套用
+    const __m128 v0 = _mm_load_ps(m + 0);
+    const __m128 v1 = _mm_load_ps(m + 4);
+    const __m128 v2 = _mm_load_ps(m + 8);
+    const __m128 v3 = _mm_load_ps(m + 12);
+
+    const __m128 A = _mm_movelh_ps(v0, v1);
+    const __m128 B = _mm_movehl_ps(v1, v0);
+    const __m128 C = _mm_movelh_ps(v2, v3);
+    const __m128 D = _mm_movehl_ps(v3, v2);
+
+    // (|A|, |B|, |C|, |D|)
+    const __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(Shuffle<0, 2, 0, 2>(v0, v2), Shuffle<1, 3, 1, 3>(v1, v3)),
+        _mm_mul_ps(Shuffle<1, 3, 1, 3>(v0, v2), Shuffle<0, 2, 0, 2>(v1, v3)));
+    const __m128 detA = Swizzle<0, 0, 0, 0>(detSub);
+    const __m128 detB = Swizzle<1, 1, 1, 1>(detSub);
+    const __m128 detC = Swizzle<2, 2, 2, 2>(detSub);
+    const __m128 detD = Swizzle<3, 3, 3, 3>(detSub);
+
+    const __m128 adjDC = Mat2AdjMul(D, C);
+    const __m128 adjAB = Mat2AdjMul(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, adjDC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, adjAB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, adjAB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, adjDC));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+    __m128 tr = _mm_mul_ps(adjAB, Swizzle<0, 2, 1, 3>(adjDC));
+    tr = _mm_add_ps(tr, Swizzle<2, 3, 0, 1>(tr));
+    tr = _mm_add_ps(tr, Swizzle<1, 0, 3, 2>(tr));
+    const __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+    const __m128 adjSign = _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f);
+    const __m128 rcpDet = _mm_div_ps(adjSign, detM);
+    X = _mm_mul_ps(X, rcpDet);
+    Y = _mm_mul_ps(Y, rcpDet);
+    Z = _mm_mul_ps(Z, rcpDet);
+    W = _mm_mul_ps(W, rcpDet);
+
+    // 伴随重排与写回合并为一次 shuffle
+    _mm_store_ps(out + 0, Shuffle<3, 1, 3, 1>(X, Y));
+    _mm_store_ps(out + 4, Shuffle<2, 0, 2, 0>(X, Y));
+    _mm_store_ps(out + 8, Shuffle<3, 1, 3, 1>(Z, W));
+    _mm_store_ps(out + 12, Shuffle<2, 0, 2, 0>(Z, W));
+    return _mm_cvtss_f32(detM);
+}
+
+bool InverseAffine(const float* m, float* out)
+{
+    const __m128 c0 = _mm_load_ps(m + 0);
+    const __m128 c1 = _mm_load_ps(m + 4);
+    const __m128 c2 = _mm_load_ps(m + 8);
+    const __m128 t = _mm_load_ps(m + 12);
+
+    __m128 r0 = Cross3(c1, c2);
+    __m128 r1 = Cross3(c2, c0);
+    __m128 r2 = Cross3(c0, c1);
+    const __m128 det = Dot3Splat(c0, r0);
+    if (_mm_cvtss_f32(det) == 0.0f)
+    {
+        return false;
+    }
+
+    const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+    r0 = _mm_mul_ps(r0, invDet);
+    r1 = _mm_mul_ps(r1, invDet);
+    r2 = _mm_mul_ps(r2, invDet);
+
+    // r0 / r1 / r2 是 R^-1 的行；转置成列（第 4 行补 0），平移列 = -(R^-1 t)
+    __m128 r3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    __m128 translation = _mm_mul_ps(r0, Swizzle<0, 0, 0, 0>(t));
+    translation = _mm_add_ps(translation, _mm_mul_ps(r1, Swizzle<1, 1, 1, 1>(t)));
+    translation = _mm_add_ps(translation, _mm_mul_ps(r2, Swizzle<2, 2, 2, 2>(t)));
+    translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation);
+
+    // 转置后 r0..r2 的第 4 分量来自各行的 w（叉积结果的 w 为 0），无需再清零
+    _mm_store_ps(out + 0, r0);
+    _mm_store_ps(out + 4, r1);
+    _mm_store_ps(out + 8, r2);
+    _mm_store_ps(out + 12, translation);
+    return true;
+}
+
+bool Inverse3x4(const float* m, float* out)
+{
+    const __m128 r0 = _mm_load_ps(m + 0);
+    const __m128 r1 = _mm_load_ps(m + 4);
+    const __m128 r2 = _mm_load_ps(m + 8);
+
+    // q0 / q1 / q2 = 余子式矩阵的各行 = R^-1 的各列（乘 det 前）；叉积只用 xyz，结果 w 为 0
+    __m128 q0 = Cross3(r1, r2);
+    __m128 q1 = Cross3(r2, r0);
+    __m128 q2 = Cross3(r0, r1);
+    const __m128 det = Dot3Splat(r0, q0);
+    if (_mm_cvtss_f32(det) == 0.0f)
+    {
+        return false;
+    }
+
+    const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+    q0 = _mm_mul_ps(q0, invDet);
+    q1 = _mm_mul_ps(q1, invDet);
+    q2 = _mm_mul_ps(q2, invDet);
+
+    // 新平移 = -(R^-1 t) = -(t.x * q0 + t.y * q1 + t.z * q2)，作为第 4 列参与转置后正好落在每行的 w
+    __m128 q3 = _mm_mul_ps(q0, Swizzle<3, 3, 3, 3>(r0));
+    q3 = _mm_add_ps(q3, _mm_mul_ps(q1, Swizzle<3, 3, 3, 3>(r1)));
+    q3 = _mm_add_ps(q3, _mm_mul_ps(q2, Swizzle<3, 3, 3, 3>(r2)));
+    q3 = _mm_sub_ps(_mm_setzero_ps(), q3);
+
+    _MM_TRANSPOSE4_PS(q0, q1, q2, q3);
+    _mm_store_ps(out + 0, q0);
+    _mm_store_ps(out + 4, q1);
+    _mm_store_ps(out + 8, q2);
+    return true;
+}
+
+void NormalMatrix3x4(const float* m, float* out)
+{
+    const __m128 r0 = _mm_load_ps(m + 0);
+    const __m128 r1 = _mm_load_ps(m + 4);
+    const __m128 r2 = _mm_load_ps(m + 8);
+
+    const __m128 q0 = Cross3(r1, r2);
+    const __m128 q1 = Cross3(r2, r0);
+    const __m128 q2 = Cross3(r0, r1);
+    const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), Dot3Splat(r0, q0));
+
+    // 法线矩阵的行 = q / det；Matrix3 为 9 个 float 的紧凑列主序，无法整列对齐写入，逐元素散射
+    alignas(16) float rows[3][4];
+    _mm_store_ps(rows[0], _mm_mul_ps(q0, invDet));
+    _mm_store_ps(rows[1], _mm_mul_ps(q1, invDet));
+    _mm_store_ps(rows[2], _mm_mul_ps(q2, invDet));
+    for (int col = 0; col < 3; ++col)
+        for (int row = 0; row < 3; ++row)
+            out[col * 3 + row] = rows[row][col];
+}
+
+void QuatToMatrix(const float* q, float* out)
+{
+    // 每列 = 单位列 + 两组带符号的乘积，例如第 0 列：
+    //   (1 - y*2y - z*2z, x*2y + w*2z, x*2z - w*2y, 0)
+    const __m128 v = _mm_loadu_ps(q);
+    const __m128 v2 = _mm_add_ps(v, v);
+    const __m128 lane3Mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+    const __m128 c0a = _mm_mul_ps(Swizzle<1, 0, 0, 0>(v), Swizzle<1, 1, 2, 0>(v2));
+    const __m128 c0b = _mm_mul_ps(Swizzle<2, 3, 3, 0>(v), Swizzle<2, 2, 1, 0>(v2));
+    const __m128 c0 = _mm_add_ps(_mm_mul_ps(c0a, _mm_setr_ps(-1.0f, 1.0f, 1.0f, 0.0f)),
+                                 _mm_mul_ps(c0b, _mm_setr_ps(-1.0f, 1.0f, -1.0f, 0.0f)));
+
+    const __m128 c1a = _mm_mul_ps(Swizzle<0, 0, 1, 0>(v), Swizzle<1, 0, 2, 0>(v2));
+    const __m128 c1b = _mm_mul_ps(Swizzle<3, 2, 3, 0>(v), Swizzle<2, 2, 0, 0>(v2));
+    const __m128 c1 = _mm_add_ps(_mm_mul_ps(c1a, _mm_setr_ps(1.0f, -1.0f, 1.0f, 0.0f)),
+                                 _mm_mul_ps(c1b, _mm_setr_ps(-1.0f, -1.0f, 1.0f, 0.0f)));
+
+    const __m128 c2a = _mm_mul_ps(Swizzle<0, 1, 0, 0>(v), Swizzle<2, 2, 0, 0>(v2));
+    const __m128 c2b = _mm_mul_ps(Swizzle<3, 3, 1, 0>(v), Swizzle<1, 0, 1, 0>(v2));
+    const __m128 c2 = _mm_add_ps(_mm_mul_ps(c2a, _mm_setr_ps(1.0f, 1.0f, -1.0f, 0.0f)),
+                                 _mm_mul_ps(c2b, _mm_setr_ps(1.0f, -1.0f, -1.0f, 0.0f)));
+
+    _mm_store_ps(out + 0, _mm_add_ps(_mm_and_ps(c0, lane3Mask), _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f)));
+    _mm_store_ps(out + 4, _mm_add_ps(_mm_and_ps(c1, lane3Mask), _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f)));
+    _mm_store_ps(out + 8, _mm_add_ps(_mm_and_ps(c2, lane3Mask), _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f)));
+    _mm_store_ps(out + 12, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+#undef TE_SHUFFLE_MASK
+
+#else
+
+// NEON 缺少任意 shuffle，求逆与四元数转矩阵的收益有限，沿用标量实现（乘法 / 变换 / 转置已在头文件中向量化）
+float Inverse(const float* m, float* out)
+{
+    return Scalar::Inverse(m, out);
+}
+
+bool InverseAffine(const float* m, float* out)
+{
+    return Scalar::InverseAffine(m, out);
+}
+
+bool Inverse3x4(const float* m, float* out)
+{
+    return Scalar::Inverse3x4(m, out);
+}
+
+void NormalMatrix3x4(const float* m, float* out)
+{
+    Scalar::NormalMatrix3x4(m, out);
+}
+
+void QuatToMatrix(const float* q, float* out)
+{
+    Scalar::QuatToMatrix(q, out);
+}
+
+#endif
+
+} // namespace TE::MatrixKernels
@@ -0,0 +1,325 @@
+// ToyEngine Core Module
+// RandomStream 实现 - PCG32 单步、跳跃与 AVX2 批量生成
+
+#include "Math/RandomStream.h"
+#include "Math/MatrixKernels.h"
+#include "Math/ScalarMath.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace TE {
+
+namespace {
+
+constexpr uint64_t PcgMultiplier = 6364136223846793005ULL;
+constexpr float UInt24ToUnitFloat = 1.0f / 16777216.0f;
+
+// XSH-RR 输出置换
+inline uint32_t PcgOutput(uint64_t state)
+{
+    const uint32_t xorShifted = static_cast<uint32_t>(((state >> 18u) ^ state) >> 27u);
+    const uint32_t rot = static_cast<uint32_t>(state >> 59u);
+    return (xorShifted >> rot) | (xorShifted << ((0u - rot) & 31u));
+}
+
+/// <summary>
+/// 前进 delta 步的仿射系数：state' = mult * state + plus（Brown, "Random Number Generation with Arbitrary Strides"）
+/// </summary>
+void AdvanceCoefficients(uint64_t delta, uint64_t inc, uint64_t& outMult, uint64_t& outPlus)
+{
+    uint64_t curMult = PcgMultiplier;
+    uint64_t curPlus = inc;
+    uint64_t accMult = 1u;
+    uint64_t accPlus = 0u;
+    while (delta > 0)
+    {
+        if (delta & 1u)
+        {
+            accMult *= curMult;
+            accPlus = accPlus * curMult + curPlus;
+        }
+        curPlus = (curMult + 1u) * curPlus;
+        curMult *= curMult;
+        delta >>= 1u;
+    }
+    outMult = accMult;
+    outPlus = accPlus;
+}
+
+#if TE_MATH_AVX2
+// 8 条交错的 LCG 通道：Low 持有第 0..3 个输出的状态，High 持有第 4..7 个，每步整体前进 8 个输出
+struct FPcgLanes8
+{
+    __m256i Low;
+    __m256i High;
+    __m256i StrideMult;
+    __m256i StridePlus;
+
+    FPcgLanes8(uint64_t state, uint64_t inc)
+    {
+        alignas(32) uint64_t states[8];
+        states[0] = state;
+        for (int i = 1; i < 8; ++i)
+        {
+            states[i] = states[i - 1] * PcgMultiplier + inc;
+        }
+        Low = _mm256_load_si256(reinterpret_cast<const __m256i*>(states));
+        High = _mm256_load_si256(reinterpret_cast<const __m256i*>(states + 4));
+
+        uint64_t mult = 0;
+        uint64_t plus = 0;
+        AdvanceCoefficients(8, inc, mult, plus);
+        StrideMult = _mm256_set1_epi64x(static_cast<long long>(mult));
+        StridePlus = _mm256_set1_epi64x(static_cast<long long>(plus));
+    }
+
+    // 64 位乘法低半部分：AVX2 没有 mullo_epi64，用三次 32x32->64 乘法拼出
+    static __m256i MulLow64(__m256i a, __m256i b)
+    {
+        const __m256i low = _mm256_mul_epu32(a, b);
+        const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                               _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+        return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+    }
+
+    // 每个 64 位通道得到一个 32 位输出（位于低半部分）
+    static __m256i Output(__m256i state)
+    {
+        const __m256i low32 = _mm256_set1_epi64x(0xFFFFFFFFLL);
+        const __m256i xorShifted = _mm256_and_si256(
+            _mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(state, 18), state), 27), low32);
+        const __m256i rot = _mm256_srli_epi64(state, 59);
+        const __m256i leftRot = _mm256_and_si256(_mm256_sub_epi64(_mm256_set1_epi64x(32), rot), _mm256_set1_epi64x(31));
+        return _mm256_and_si256(_mm256_or_si256(_mm256_srlv_epi64(xorShifted, rot), _mm256_sllv_epi64(xorShifted, leftRot)), low32);
+    }
+
+    // 输出 8 个连续的 32 位结果并前进一步
+    __m256i Next()
+    {
+        // 把两组 4x64 位通道的低 32 位压成 8x32 位，保持输出顺序
+        const __m256i permute = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+        const __m256i low = _mm256_permutevar8x32_epi32(Output(Low), permute);
+        const __m256i high = _mm256_permutevar8x32_epi32(Output(High), permute);
+        const __m256i result = _mm256_permute2x128_si256(low, high, 0x20);
+
+        Low = _mm256_add_epi64(MulLow64(Low, StrideMult), StridePlus);
+        High = _mm256_add_epi64(MulLow64(High, StrideMult), StridePlus);
+        return result;
+    }
+
+    // 下一个待输出的状态（第 0 通道）
+    [[nodiscard]] uint64_t CurrentState() const
+    {
+        return static_cast<uint64_t>(_mm256_extract_epi64(Low, 0));
+    }
+};
+#endif
+
+// 球内点：u -> 方位角，v -> cos(极角)，w -> 半径的立方根（取 1 - w ∈ (0, 1]，避开 log2(0)）
+inline Vector3 InsideSphereFromUniform(float u, float v, float w, float radius)
+{
+    float sinPhi = 0.0f;
+    float cosPhi = 0.0f;
+    Math::FastSinCos(Math::TWO_PI * u, sinPhi, cosPhi);
+    const float z = 2.0f * v - 1.0f;
+    const float r = radius * Math::FastExp2(Math::FastLog2(1.0f - w) * (1.0f / 3.0f));
+    const float ring = std::sqrt(std::max(0.0f, 1.0f - z * z));
+    return {r * ring * cosPhi, r * ring * sinPhi, r * z};
+}
+
+} // anonymous namespace
+
+RandomStream::RandomStream(uint64_t seed, uint64_t streamId)
+{
+    Reset(seed, streamId);
+}
+
+void RandomStream::Reset(uint64_t seed, uint64_t streamId)
+{
+    // 与 PCG 参考实现 pcg32_srandom_r 相同的初始化
+    m_Seed = seed;
+    m_StreamId = streamId;
+    m_Inc = (streamId << 1u) | 1u;
+    m_State = 0u;
+    (void)NextUInt32();
+    m_State += seed;
+    (void)NextUInt32();
+    m_HasGaussianSpare = false;
+}
+
+void RandomStream::Advance(uint64_t delta)
+{
+    uint64_t mult = 0;
+    uint64_t plus = 0;
+    AdvanceCoefficients(delta, m_Inc, mult, plus);
+    m_State = mult * m_State + plus;
+}
+
+uint32_t RandomStream::NextUInt32()
+{
+    const uint64_t oldState = m_State;
+    m_State = oldState * PcgMultiplier + m_Inc;
+    return PcgOutput(oldState);
+}
+
+int RandomStream::NextInt(int min, int max)
+{
+    if (min >= max) return min;
+
+    const uint32_t range = static_cast<uint32_t>(max - min + 1);
+    const uint32_t threshold = (0xFFFFFFFFu / range) * range;
+
+    uint32_t value;
+    do {
+        value = NextUInt32();
+    } while (value >= threshold);
+
+    return min + static_cast<int>(value % range);
+}
+
+Vector3 RandomStream::NextUnitVector()
+{
+    float x, y, z, d2;
+    do {
+        x = NextFloat(-1.0f, 1.0f);
+        y = NextFloat(-1.0f, 1.0f);
+        z = NextFloat(-1.0f, 1.0f);
+        d2 = x * x + y * y + z * z;
+    } while (d2 > 1.0f || d2 < 0.0001f);
+
+    const float scale = 1.0f / Math::Sqrt(d2);
+    return {x * scale, y * scale, z * scale};
+}
+
+Vector2 RandomStream::NextUnitCircle()
+{
+    float x, y, d2;
+    do {
+        x = NextFloat(-1.0f, 1.0f);
+        y = NextFloat(-1.0f, 1.0f);
+        d2 = x * x + y * y;
+    } while (d2 > 1.0f || d2 < 0.0001f);
+
+    const float scale = 1.0f / Math::Sqrt(d2);
+    return {x * scale, y * scale};
+}
+
+Vector3 RandomStream::NextInsideSphere(float radius)
+{
+    const float u = NextFloat();
+    const float v = NextFloat();
+    const float w = NextFloat();
+    return InsideSphereFromUniform(u, v, w, radius);
+}
+
+float RandomStream::NextGaussian(float mean, float stdDev)
+{
+    if (m_HasGaussianSpare)
+    {
+        m_HasGaussianSpare = false;
+        return mean + stdDev * m_GaussianSpare;
+    }
+
+    float u, v, s;
+    do {
+        u = NextFloat(-1.0f, 1.0f);
+        v = NextFloat(-1.0f, 1.0f);
+        s = u * u + v * v;
+    } while (s >= 1.0f || s < 0.0001f);
+
+    const float mul = Math::Sqrt(-2.0f * Math::Log(s) / s);
+    m_GaussianSpare = v * mul;
+    m_HasGaussianSpare = true;
+
+    return mean + stdDev * u * mul;
+}
+
+void RandomStream::FillUInt32(std::span<uint32_t> outValues)
+{
+    size_t i = 0;
+#if TE_MATH_AVX2
+    if (outValues.size() >= 8)
+    {
+        FPcgLanes8 lanes(m_State, m_Inc);
+        for (; i + 8 <= outValues.size(); i += 8)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(outValues.data() + i), lanes.Next());
+        }
+        m_State = lanes.CurrentState();
+    }
+#endif
+    for (; i < outValues.size(); ++i)
+    {
+        outValues[i] = NextUInt32();
+    }
+}
+
+void RandomStream::FillUniform(std::span<float> outValues, float min, float max)
+{
+    size_t i = 0;
+#if TE_MATH_AVX2
+    if (outValues.size() >= 8)
+    {
+        FPcgLanes8 lanes(m_State, m_Inc);
+        const __m256 scale = _mm256_set1_ps(UInt24ToUnitFloat);
+        const __m256 minValue = _mm256_set1_ps(min);
+        const __m256 range = _mm256_set1_ps(max - min);
+        for (; i + 8 <= outValues.size(); i += 8)
+        {
+            // 与 NextFloat(min, max) 相同的运算顺序：先 u = bits * 2^-24，再 min + u * range
+            const __m256 unit = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(lanes.Next(), 8)), scale);
+            _mm256_storeu_ps(outValues.data() + i, _mm256_add_ps(minValue, _mm256_mul_ps(unit, range)));
+        }
+        m_State = lanes.CurrentState();
+    }
+#endif
+    for (; i < outValues.size(); ++i)
+    {
+        outValues[i] = NextFloat(min, max);
+    }
+}
+
+void RandomStream::FillInsideSphere(std::span<Vector3> outPoints, float radius)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+    constexpr size_t ChunkSize = 64;
+    std::array<float, ChunkSize * 3> uniforms{};
+    std::array<float, ChunkSize> angles{}, sinPhi{}, cosPhi{}, logW{}, cubeRoot{};
+
+    for (size_t base = 0; base < outPoints.size(); base += ChunkSize)
+    {
+        const size_t count = std::min(ChunkSize, outPoints.size() - base);
+        const std::span<float> chunkUniforms(uniforms.data(), count * 3);
+        FillUniform(chunkUniforms);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            angles[i] = Math::TWO_PI * uniforms[i * 3 + 0];
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            logW[i] = 1.0f - uniforms[i * 3 + 2];
+        }
+        Math::FastSinCos(std::span<const float>(angles.data(), count), std::span<float>(sinPhi.data(), count),
+                         std::span<float>(cosPhi.data(), count));
+        Math::FastLog2(std::span<const float>(logW.data(), count), std::span<float>(logW.data(), count));
+        for (size_t i = 0; i < count; ++i)
+        {
+            logW[i] *= 1.0f / 3.0f;
+        }
+        Math::FastExp2(std::span<const float>(logW.data(), count), std::span<float>(cubeRoot.data(), count));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float z = 2.0f * uniforms[i * 3 + 1] - 1.0f;
+            const float r = radius * cubeRoot[i];
+            const float ring = std::sqrt(std::max(0.0f, 1.0f - z * z));
+            outPoints[base + i] = Vector3(r * ring * cosPhi[i], r * ring * sinPhi[i], r * z);
+        }
+    }
+}
+
+} // namespace TE
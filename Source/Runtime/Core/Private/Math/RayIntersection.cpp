@@ -0,0 +1,439 @@
+// ToyEngine Core Module
+// 射线批量求交内核实现
+
+#include "Math/RayIntersection.h"
+#include "Math/MatrixKernels.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+namespace TE {
+
+// ==================== TriangleSoA ====================
+
+void TriangleSoA::Reserve(size_t triangleCount)
+{
+    const size_t padded = (triangleCount + Alignment - 1) / Alignment * Alignment;
+    for (auto& component : m_Components)
+    {
+        component.reserve(padded);
+    }
+}
+
+void TriangleSoA::Clear()
+{
+    for (auto& component : m_Components)
+    {
+        component.clear();
+    }
+    m_Count = 0;
+}
+
+uint32_t TriangleSoA::Add(const Vector3& v0, const Vector3& v1, const Vector3& v2)
+{
+    const size_t index = m_Count;
+    if (index == PaddedSize())
+    {
+        // 一次补齐一整块零三角形，内核读取整块时无需判断尾部
+        for (auto& component : m_Components)
+        {
+            component.resize(index + Alignment, 0.0f);
+        }
+    }
+
+    const Vector3 edge1 = v1 - v0;
+    const Vector3 edge2 = v2 - v0;
+    m_Components[V0X][index] = v0.X;
+    m_Components[V0Y][index] = v0.Y;
+    m_Components[V0Z][index] = v0.Z;
+    m_Components[Edge1X][index] = edge1.X;
+    m_Components[Edge1Y][index] = edge1.Y;
+    m_Components[Edge1Z][index] = edge1.Z;
+    m_Components[Edge2X][index] = edge2.X;
+    m_Components[Edge2Y][index] = edge2.Y;
+    m_Components[Edge2Z][index] = edge2.Z;
+    ++m_Count;
+    return static_cast<uint32_t>(index);
+}
+
+Vector3 TriangleSoA::GetVertex0(size_t index) const
+{
+    return {m_Components[V0X][index], m_Components[V0Y][index], m_Components[V0Z][index]};
+}
+
+Vector3 TriangleSoA::GetEdge1(size_t index) const
+{
+    return {m_Components[Edge1X][index], m_Components[Edge1Y][index], m_Components[Edge1Z][index]};
+}
+
+Vector3 TriangleSoA::GetEdge2(size_t index) const
+{
+    return {m_Components[Edge2X][index], m_Components[Edge2Y][index], m_Components[Edge2Z][index]};
+}
+
+namespace Math {
+
+namespace {
+
+// ==================== 标量路径（无 SIMD 时使用） ====================
+
+#if !TE_MATH_SSE
+
+// 与 IntersectRayTriangle 相同的 Möller–Trumbore 公式，直接使用预存的边
+bool IntersectTriangleScalar(const Ray& ray, const TriangleSoA& triangles, size_t index, float maxDistance,
+                             float& outDistance, float& outU, float& outV)
+{
+    const Vector3 edge1 = triangles.GetEdge1(index);
+    const Vector3 edge2 = triangles.GetEdge2(index);
+    const Vector3 pvec = Vector3::Cross(ray.Direction, edge2);
+    const float det = Vector3::Dot(edge1, pvec);
+    if (std::abs(det) < RayTriangleEpsilon)
+        return false;
+
+    const float invDet = 1.0f / det;
+    const Vector3 tvec = ray.Origin - triangles.GetVertex0(index);
+    const float u = Vector3::Dot(tvec, pvec) * invDet;
+    if (u < 0.0f || u > 1.0f)
+        return false;
+
+    const Vector3 qvec = Vector3::Cross(tvec, edge1);
+    const float v = Vector3::Dot(ray.Direction, qvec) * invDet;
+    if (v < 0.0f || u + v > 1.0f)
+        return false;
+
+    const float distance = Vector3::Dot(edge2, qvec) * invDet;
+    if (distance < 0.0f || distance > maxDistance)
+        return false;
+
+    outDistance = distance;
+    outU = u;
+    outV = v;
+    return true;
+}
+
+template<size_t N>
+uint32_t IntersectAABBScalar(const TRayPacket<N>& rays, size_t firstLane, size_t laneCount,
+                             const BoundingBox& box, float* outNearDistances)
+{
+    uint32_t mask = 0;
+    for (size_t lane = firstLane; lane < firstLane + laneCount; ++lane)
+    {
+        const float t1x = (box.Min.X - rays.OriginX[lane]) * rays.InvDirectionX[lane];
+        const float t2x = (box.Max.X - rays.OriginX[lane]) * rays.InvDirectionX[lane];
+        const float t1y = (box.Min.Y - rays.OriginY[lane]) * rays.InvDirectionY[lane];
+        const float t2y = (box.Max.Y - rays.OriginY[lane]) * rays.InvDirectionY[lane];
+        const float t1z = (box.Min.Z - rays.OriginZ[lane]) * rays.InvDirectionZ[lane];
+        const float t2z = (box.Max.Z - rays.OriginZ[lane]) * rays.InvDirectionZ[lane];
+        const float tNear = std::max(std::max(std::min(t1x, t2x), std::min(t1y, t2y)), std::max(std::min(t1z, t2z), 0.0f));
+        const float tFar = std::min(std::min(std::max(t1x, t2x), std::max(t1y, t2y)),
+                                    std::min(std::max(t1z, t2z), rays.MaxDistance[lane]));
+        if (outNearDistances)
+            outNearDistances[lane] = tNear;
+        mask |= (tNear <= tFar ? 1u : 0u) << lane;
+    }
+    return mask;
+}
+
+uint32_t IntersectTrianglesScalar(const Ray& ray, const TriangleSoA& triangles, size_t first, size_t count,
+                                  float maxDistance, float* outDistances)
+{
+    uint32_t mask = 0;
+    for (size_t lane = 0; lane < count; ++lane)
+    {
+        float u = 0.0f;
+        float v = 0.0f;
+        if (IntersectTriangleScalar(ray, triangles, first + lane, maxDistance, outDistances[lane], u, v))
+            mask |= 1u << lane;
+    }
+    return mask;
+}
+#endif
+
+// ==================== SIMD 通道抽象 ====================
+// 4 通道（SSE）与 8 通道（AVX2）共用同一份内核模板；SSE 构建下 8 通道接口拆成两次 4 通道调用
+
+#if TE_MATH_SSE
+struct FLanes4
+{
+    using Lane = __m128;
+    static constexpr size_t Width = 4;
+
+    static Lane Load(const float* p) { return _mm_loadu_ps(p); }
+    static void Store(float* p, Lane a) { _mm_storeu_ps(p, a); }
+    static Lane Splat(float v) { return _mm_set1_ps(v); }
+    static Lane Zero() { return _mm_setzero_ps(); }
+    static Lane Add(Lane a, Lane b) { return _mm_add_ps(a, b); }
+    static Lane Sub(Lane a, Lane b) { return _mm_sub_ps(a, b); }
+    static Lane Mul(Lane a, Lane b) { return _mm_mul_ps(a, b); }
+    static Lane Div(Lane a, Lane b) { return _mm_div_ps(a, b); }
+    static Lane Min(Lane a, Lane b) { return _mm_min_ps(a, b); }
+    static Lane Max(Lane a, Lane b) { return _mm_max_ps(a, b); }
+    static Lane Abs(Lane a) { return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))); }
+    static Lane And(Lane a, Lane b) { return _mm_and_ps(a, b); }
+    static Lane AndNot(Lane a, Lane b) { return _mm_andnot_ps(a, b); }
+    static Lane Xor(Lane a, Lane b) { return _mm_xor_ps(a, b); }
+    static Lane LessEqual(Lane a, Lane b) { return _mm_cmple_ps(a, b); }
+    static Lane GreaterEqual(Lane a, Lane b) { return _mm_cmpge_ps(a, b); }
+    static uint32_t Bits(Lane a) { return static_cast<uint32_t>(_mm_movemask_ps(a)); }
+};
+#endif
+
+#if TE_MATH_AVX2
+struct FLanes8
+{
+    using Lane = __m256;
+    static constexpr size_t Width = 8;
+
+    static Lane Load(const float* p) { return _mm256_loadu_ps(p); }
+    static void Store(float* p, Lane a) { _mm256_storeu_ps(p, a); }
+    static Lane Splat(float v) { return _mm256_set1_ps(v); }
+    static Lane Zero() { return _mm256_setzero_ps(); }
+    static Lane Add(Lane a, Lane b) { return _mm256_add_ps(a, b); }
+    static Lane Sub(Lane a, Lane b) { return _mm256_sub_ps(a, b); }
+    static Lane Mul(Lane a, Lane b) { return _mm256_mul_ps(a, b); }
+    static Lane Div(Lane a, Lane b) { return _mm256_div_ps(a, b); }
+    static Lane Min(Lane a, Lane b) { return _mm256_min_ps(a, b); }
+    static Lane Max(Lane a, Lane b) { return _mm256_max_ps(a, b); }
+    static Lane Abs(Lane a) { return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff))); }
+    static Lane And(Lane a, Lane b) { return _mm256_and_ps(a, b); }
+    static Lane AndNot(Lane a, Lane b) { return _mm256_andnot_ps(a, b); }
+    static Lane Xor(Lane a, Lane b) { return _mm256_xor_ps(a, b); }
+    static Lane LessEqual(Lane a, Lane b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static Lane GreaterEqual(Lane a, Lane b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static uint32_t Bits(Lane a) { return static_cast<uint32_t>(_mm256_movemask_ps(a)); }
+};
+using FWideLanes = FLanes8;
+#elif TE_MATH_SSE
+using FWideLanes = FLanes4;
+#endif
+
+#if TE_MATH_SSE
+template<typename TLanes, size_t N>
+uint32_t IntersectAABBLanes(const TRayPacket<N>& rays, size_t firstLane, const BoundingBox& box, float* outNearDistances)
+{
+    using L = TLanes;
+    const typename L::Lane invX = L::Load(rays.InvDirectionX + firstLane);
+    const typename L::Lane invY = L::Load(rays.InvDirectionY + firstLane);
+    const typename L::Lane invZ = L::Load(rays.InvDirectionZ + firstLane);
+    const typename L::Lane originX = L::Load(rays.OriginX + firstLane);
+    const typename L::Lane originY = L::Load(rays.OriginY + firstLane);
+    const typename L::Lane originZ = L::Load(rays.OriginZ + firstLane);
+
+    const typename L::Lane t1x = L::Mul(L::Sub(L::Splat(box.Min.X), originX), invX);
+    const typename L::Lane t2x = L::Mul(L::Sub(L::Splat(box.Max.X), originX), invX);
+    const typename L::Lane t1y = L::Mul(L::Sub(L::Splat(box.Min.Y), originY), invY);
+    const typename L::Lane t2y = L::Mul(L::Sub(L::Splat(box.Max.Y), originY), invY);
+    const typename L::Lane t1z = L::Mul(L::Sub(L::Splat(box.Min.Z), originZ), invZ);
+    const typename L::Lane t2z = L::Mul(L::Sub(L::Splat(box.Max.Z), originZ), invZ);
+
+    const typename L::Lane tNear = L::Max(L::Max(L::Min(t1x, t2x), L::Min(t1y, t2y)), L::Max(L::Min(t1z, t2z), L::Zero()));
+    const typename L::Lane tFar = L::Min(L::Min(L::Max(t1x, t2x), L::Max(t1y, t2y)),
+                                         L::Min(L::Max(t1z, t2z), L::Load(rays.MaxDistance + firstLane)));
+    if (outNearDistances)
+        L::Store(outNearDistances + firstLane, tNear);
+    return L::Bits(L::LessEqual(tNear, tFar)) << firstLane;
+}
+
+/// <summary>
+/// 射线分量按通道广播，遍历整个 TriangleSoA 时只构造一次
+/// </summary>
+template<typename TLanes>
+struct TRayLanes
+{
+    typename TLanes::Lane OriginX, OriginY, OriginZ;
+    typename TLanes::Lane DirectionX, DirectionY, DirectionZ;
+
+    explicit TRayLanes(const Ray& ray)
+        : OriginX(TLanes::Splat(ray.Origin.X)), OriginY(TLanes::Splat(ray.Origin.Y)), OriginZ(TLanes::Splat(ray.Origin.Z))
+        , DirectionX(TLanes::Splat(ray.Direction.X)), DirectionY(TLanes::Splat(ray.Direction.Y)), DirectionZ(TLanes::Splat(ray.Direction.Z))
+    {}
+};
+
+// Möller–Trumbore：每个通道一个三角形；outU / outV 非空时一并写出重心坐标
+template<typename TLanes>
+uint32_t IntersectTrianglesLanes(const TRayLanes<TLanes>& ray, const TriangleSoA& triangles, size_t first,
+                                 typename TLanes::Lane maxDistance, float* outDistances,
+                                 float* outU = nullptr, float* outV = nullptr)
+{
+    using L = TLanes;
+    using Lane = typename L::Lane;
+    const Lane e1x = L::Load(triangles.Data(TriangleSoA::Edge1X) + first);
+    const Lane e1y = L::Load(triangles.Data(TriangleSoA::Edge1Y) + first);
+    const Lane e1z = L::Load(triangles.Data(TriangleSoA::Edge1Z) + first);
+    const Lane e2x = L::Load(triangles.Data(TriangleSoA::Edge2X) + first);
+    const Lane e2y = L::Load(triangles.Data(TriangleSoA::Edge2Y) + first);
+    const Lane e2z = L::Load(triangles.Data(TriangleSoA::Edge2Z) + first);
+
+    // pvec = dir x edge2，det = edge1 . pvec
+    const Lane px = L::Sub(L::Mul(ray.DirectionY, e2z), L::Mul(ray.DirectionZ, e2y));
+    const Lane py = L::Sub(L::Mul(ray.DirectionZ, e2x), L::Mul(ray.DirectionX, e2z));
+    const Lane pz = L::Sub(L::Mul(ray.DirectionX, e2y), L::Mul(ray.DirectionY, e2x));
+    const Lane det = L::Add(L::Add(L::Mul(e1x, px), L::Mul(e1y, py)), L::Mul(e1z, pz));
+
+    // tvec = origin - v0，qvec = tvec x edge1
+    const Lane tx = L::Sub(ray.OriginX, L::Load(triangles.Data(TriangleSoA::V0X) + first));
+    const Lane ty = L::Sub(ray.OriginY, L::Load(triangles.Data(TriangleSoA::V0Y) + first));
+    const Lane tz = L::Sub(ray.OriginZ, L::Load(triangles.Data(TriangleSoA::V0Z) + first));
+    const Lane qx = L::Sub(L::Mul(ty, e1z), L::Mul(tz, e1y));
+    const Lane qy = L::Sub(L::Mul(tz, e1x), L::Mul(tx, e1z));
+    const Lane qz = L::Sub(L::Mul(tx, e1y), L::Mul(ty, e1x));
+
+    // u / v / t 的分子：u = tvec . pvec，v = dir . qvec，t = edge2 . qvec（均未除以 det）
+    const Lane uNum = L::Add(L::Add(L::Mul(tx, px), L::Mul(ty, py)), L::Mul(tz, pz));
+    const Lane vNum = L::Add(L::Add(L::Mul(ray.DirectionX, qx), L::Mul(ray.DirectionY, qy)), L::Mul(ray.DirectionZ, qz));
+    const Lane tNum = L::Add(L::Add(L::Mul(e2x, qx), L::Mul(e2y, qy)), L::Mul(e2z, qz));
+
+    // 先把分子乘上 det 的符号、与 |det| 比较做全部区间判定，只有整块存在命中时才做除法。
+    // 退化三角形（含补齐的零三角形）由第一项条件排除
+    const Lane absDet = L::Abs(det);
+    const Lane detSign = L::AndNot(L::Abs(det), det);
+    const Lane u = L::Xor(uNum, detSign);
+    const Lane v = L::Xor(vNum, detSign);
+    const Lane t = L::Xor(tNum, detSign);
+    const Lane zero = L::Zero();
+    Lane hit = L::GreaterEqual(absDet, L::Splat(RayTriangleEpsilon));
+    hit = L::And(hit, L::And(L::GreaterEqual(u, zero), L::GreaterEqual(v, zero)));
+    hit = L::And(hit, L::LessEqual(L::Add(u, v), absDet));
+    hit = L::And(hit, L::And(L::GreaterEqual(t, zero), L::LessEqual(t, L::Mul(maxDistance, absDet))));
+
+    const uint32_t bits = L::Bits(hit);
+    if (bits == 0)
+        return 0;
+
+    const Lane invDet = L::Div(L::Splat(1.0f), det);
+    L::Store(outDistances, L::Mul(tNum, invDet));
+    if (outU)
+        L::Store(outU, L::Mul(uNum, invDet));
+    if (outV)
+        L::Store(outV, L::Mul(vNum, invDet));
+    return bits;
+}
+#endif
+
+} // namespace
+
+uint32_t IntersectAABB(const RayPacket4& rays, const BoundingBox& box, float* outNearDistances)
+{
+#if TE_MATH_SSE
+    return IntersectAABBLanes<FLanes4>(rays, 0, box, outNearDistances);
+#else
+    return IntersectAABBScalar(rays, 0, 4, box, outNearDistances);
+#endif
+}
+
+uint32_t IntersectAABB(const RayPacket8& rays, const BoundingBox& box, float* outNearDistances)
+{
+#if TE_MATH_AVX2
+    return IntersectAABBLanes<FLanes8>(rays, 0, box, outNearDistances);
+#elif TE_MATH_SSE
+    return IntersectAABBLanes<FLanes4>(rays, 0, box, outNearDistances) |
+           IntersectAABBLanes<FLanes4>(rays, 4, box, outNearDistances);
+#else
+    return IntersectAABBScalar(rays, 0, 8, box, outNearDistances);
+#endif
+}
+
+uint32_t IntersectTriangles4(const Ray& ray, const TriangleSoA& triangles, size_t first,
+                             float maxDistance, float outDistances[4])
+{
+    assert(first % 4 == 0 && first < triangles.PaddedSize() && "IntersectTriangles4: block out of range");
+#if TE_MATH_SSE
+    return IntersectTrianglesLanes(TRayLanes<FLanes4>(ray), triangles, first, FLanes4::Splat(maxDistance), outDistances);
+#else
+    return IntersectTrianglesScalar(ray, triangles, first, 4, maxDistance, outDistances);
+#endif
+}
+
+uint32_t IntersectTriangles8(const Ray& ray, const TriangleSoA& triangles, size_t first,
+                             float maxDistance, float outDistances[8])
+{
+    assert(first % 8 == 0 && first < triangles.PaddedSize() && "IntersectTriangles8: block out of range");
+#if TE_MATH_AVX2
+    return IntersectTrianglesLanes(TRayLanes<FLanes8>(ray), triangles, first, FLanes8::Splat(maxDistance), outDistances);
+#elif TE_MATH_SSE
+    const TRayLanes<FLanes4> lanes(ray);
+    const FLanes4::Lane limit = FLanes4::Splat(maxDistance);
+    return IntersectTrianglesLanes(lanes, triangles, first, limit, outDistances) |
+           (IntersectTrianglesLanes(lanes, triangles, first + 4, limit, outDistances + 4) << 4);
+#else
+    return IntersectTrianglesScalar(ray, triangles, first, 8, maxDistance, outDistances);
+#endif
+}
+
+bool RaycastTriangles(const Ray& ray, const TriangleSoA& triangles, float maxDistance, RayTriangleHit& outHit)
+{
+    bool found = false;
+    float closest = maxDistance;
+
+#if TE_MATH_SSE
+    // 每块用当前最近距离作为上限，越往后需要比较的命中越少
+    constexpr size_t Width = FWideLanes::Width;
+    const TRayLanes<FWideLanes> lanes(ray);
+    alignas(32) float distances[Width];
+    alignas(32) float us[Width];
+    alignas(32) float vs[Width];
+    for (size_t first = 0; first < triangles.PaddedSize(); first += Width)
+    {
+        uint32_t mask = IntersectTrianglesLanes(lanes, triangles, first, FWideLanes::Splat(closest), distances, us, vs);
+        while (mask != 0)
+        {
+            const int lane = std::countr_zero(mask);
+            mask &= mask - 1;
+            if (!found || distances[lane] < closest)
+            {
+                found = true;
+                closest = distances[lane];
+                outHit.Distance = distances[lane];
+                outHit.U = us[lane];
+                outHit.V = vs[lane];
+                outHit.TriangleIndex = static_cast<uint32_t>(first + lane);
+            }
+        }
+    }
+#else
+    for (size_t index = 0; index < triangles.Size(); ++index)
+    {
+        float distance = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+        if (IntersectTriangleScalar(ray, triangles, index, closest, distance, u, v) && (!found || distance < closest))
+        {
+            found = true;
+            closest = distance;
+            outHit = {distance, u, v, static_cast<uint32_t>(index)};
+        }
+    }
+#endif
+    return found;
+}
+
+bool AnyTriangleHit(const Ray& ray, const TriangleSoA& triangles, float maxDistance)
+{
+#if TE_MATH_SSE
+    constexpr size_t Width = FWideLanes::Width;
+    const TRayLanes<FWideLanes> lanes(ray);
+    const FWideLanes::Lane limit = FWideLanes::Splat(maxDistance);
+    alignas(32) float distances[Width];
+    for (size_t first = 0; first < triangles.PaddedSize(); first += Width)
+    {
+        if (IntersectTrianglesLanes(lanes, triangles, first, limit, distances) != 0)
+            return true;
+    }
+#else
+    for (size_t index = 0; index < triangles.Size(); ++index)
+    {
+        float distance = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+        if (IntersectTriangleScalar(ray, triangles, index, maxDistance, distance, u, v))
+            return true;
+    }
+#endif
+    return false;
+}
+
+} // namespace Math
+
+} // namespace TE
@@ -44,12 +44,21 @@ bool BuildRotationFromForward(const Vector3& forward, const Vector3& worldUp, Qu
 // 转换为 4x4 变换矩阵
 Matrix4 Transform::ToMatrix() const
 {
-    // 顺序：缩放 -> 旋转 -> 平移
-    Matrix4 scaleMatrix = Matrix4::Scale(Scale);
-    Matrix4 rotationMatrix = Rotation.ToMatrix4();
-    Matrix4 translationMatrix = Matrix4::Translate(Position);
+    // 顺序：缩放 -> 旋转 -> 平移，即 T * R * S；直接按列缩放旋转矩阵并写入平移，省去两次矩阵乘法
+    Matrix4 result = Rotation.ToMatrix4();
+    const float scale[3] = {Scale.X, Scale.Y, Scale.Z};
+    for (int col = 0; col < 3; ++col)
+        for (int row = 0; row < 3; ++row)
+            result.M[col][row] *= scale[col];
+    result.M[3][0] = Position.X;
+    result.M[3][1] = Position.Y;
+    result.M[3][2] = Position.Z;
+    return result;
+}
 
-    return translationMatrix * rotationMatrix * scaleMatrix;
+Matrix3x4 Transform::ToMatrix3x4() const
+{
+    return Matrix3x4(ToMatrix());
 }
 
 // 从矩阵还原变换
@@ -0,0 +1,533 @@
+// ToyEngine Core Module
+// 批量变换内核实现
+
+#include "Math/TransformBatch.h"
+#include "Math/MatrixKernels.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace TE::Math {
+
+namespace {
+
+std::size_t BatchCount(std::size_t inputCount, std::size_t outputCount)
+{
+    assert(outputCount >= inputCount && "TransformBatch: output span is shorter than input");
+    return std::min(inputCount, outputCount);
+}
+
+template<typename TMatrix>
+TMatrix ToMatrixOf(const Transform& transform)
+{
+    if constexpr (std::is_same_v<TMatrix, Matrix3x4>)
+        return transform.ToMatrix3x4();
+    else
+        return transform.ToMatrix();
+}
+
+#if TE_MATH_SSE
+
+__m128 Gather(float a, float b, float c, float d)
+{
+    return _mm_setr_ps(a, b, c, d);
+}
+
+/// <summary>
+/// 4 个对象的 TRS 合成：qx..qw / p* / s* 每个寄存器的 4 个通道对应 4 个对象
+/// 输出 Matrix4（列主序）或 Matrix3x4（行主序，省去恒为 0 0 0 1 的最后一行）
+/// </summary>
+template<typename TMatrix>
+void ComposeTRS4(__m128 qx, __m128 qy, __m128 qz, __m128 qw,
+                 __m128 px, __m128 py, __m128 pz,
+                 __m128 sx, __m128 sy, __m128 sz,
+                 TMatrix* out)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+
+    const __m128 xx = _mm_mul_ps(qx, qx);
+    const __m128 yy = _mm_mul_ps(qy, qy);
+    const __m128 zz = _mm_mul_ps(qz, qz);
+    const __m128 xy = _mm_mul_ps(qx, qy);
+    const __m128 xz = _mm_mul_ps(qx, qz);
+    const __m128 yz = _mm_mul_ps(qy, qz);
+    const __m128 wx = _mm_mul_ps(qw, qx);
+    const __m128 wy = _mm_mul_ps(qw, qy);
+    const __m128 wz = _mm_mul_ps(qw, qz);
+
+    // 与 MatrixKernels::Scalar::QuatToMatrix 相同的公式，每列乘以对应缩放
+    __m128 c00 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+    __m128 c01 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+    __m128 c02 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+    __m128 c03 = _mm_setzero_ps();
+
+    __m128 c10 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+    __m128 c11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+    __m128 c12 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+    __m128 c13 = _mm_setzero_ps();
+
+    __m128 c20 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+    __m128 c21 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+    __m128 c22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+    __m128 c23 = _mm_setzero_ps();
+
+    __m128 c30 = px;
+    __m128 c31 = py;
+    __m128 c32 = pz;
+    __m128 c33 = one;
+
+    if constexpr (std::is_same_v<TMatrix, Matrix3x4>)
+    {
+        // (列 0..3) x (对象 0..3) 转置为 (对象 0..3) x (列 0..3)，即各对象的同一行
+        _MM_TRANSPOSE4_PS(c00, c10, c20, c30);
+        _MM_TRANSPOSE4_PS(c01, c11, c21, c31);
+        _MM_TRANSPOSE4_PS(c02, c12, c22, c32);
+
+        const __m128 rows[4][3] = {
+            {c00, c01, c02},
+            {c10, c11, c12},
+            {c20, c21, c22},
+            {c30, c31, c32},
+        };
+        for (int object = 0; object < 4; ++object)
+        {
+            float* dst = &out[object].M[0][0];
+            _mm_store_ps(dst + 0, rows[object][0]);
+            _mm_store_ps(dst + 4, rows[object][1]);
+            _mm_store_ps(dst + 8, rows[object][2]);
+        }
+    }
+    else
+    {
+        // (行 0..3) x (对象 0..3) 转置为 (对象 0..3) x (行 0..3)，即各对象的同一列
+        _MM_TRANSPOSE4_PS(c00, c01, c02, c03);
+        _MM_TRANSPOSE4_PS(c10, c11, c12, c13);
+        _MM_TRANSPOSE4_PS(c20, c21, c22, c23);
+        _MM_TRANSPOSE4_PS(c30, c31, c32, c33);
+
+        const __m128 columns[4][4] = {
+            {c00, c10, c20, c30},
+            {c01, c11, c21, c31},
+            {c02, c12, c22, c32},
+            {c03, c13, c23, c33},
+        };
+        for (int object = 0; object < 4; ++object)
+        {
+            float* dst = &out[object].M[0][0];
+            _mm_store_ps(dst + 0, columns[object][0]);
+            _mm_store_ps(dst + 4, columns[object][1]);
+            _mm_store_ps(dst + 8, columns[object][2]);
+            _mm_store_ps(dst + 12, columns[object][3]);
+        }
+    }
+}
+
+void LoadQuats4(const Quat& q0, const Quat& q1, const Quat& q2, const Quat& q3,
+                __m128& qx, __m128& qy, __m128& qz, __m128& qw)
+{
+    qx = _mm_loadu_ps(&q0.X);
+    qy = _mm_loadu_ps(&q1.X);
+    qz = _mm_loadu_ps(&q2.X);
+    qw = _mm_loadu_ps(&q3.X);
+    _MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+}
+
+#endif
+
+template<typename TMatrix>
+void TransformsToMatricesSoA(std::span<const Vector3> positions,
+                             std::span<const Quat> rotations,
+                             std::span<const Vector3> scales,
+                             std::span<TMatrix> outMatrices)
+{
+    assert(positions.size() == rotations.size() && positions.size() == scales.size());
+    const std::size_t count = BatchCount(std::min({positions.size(), rotations.size(), scales.size()}),
+                                         outMatrices.size());
+    std::size_t i = 0;
+
+#if TE_MATH_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        const Vector3* p = positions.data() + i;
+        const Vector3* s = scales.data() + i;
+        const Quat* r = rotations.data() + i;
+
+        __m128 qx, qy, qz, qw;
+        LoadQuats4(r[0], r[1], r[2], r[3], qx, qy, qz, qw);
+        ComposeTRS4(qx, qy, qz, qw,
+                    Gather(p[0].X, p[1].X, p[2].X, p[3].X),
+                    Gather(p[0].Y, p[1].Y, p[2].Y, p[3].Y),
+                    Gather(p[0].Z, p[1].Z, p[2].Z, p[3].Z),
+                    Gather(s[0].X, s[1].X, s[2].X, s[3].X),
+                    Gather(s[0].Y, s[1].Y, s[2].Y, s[3].Y),
+                    Gather(s[0].Z, s[1].Z, s[2].Z, s[3].Z),
+                    outMatrices.data() + i);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        outMatrices[i] = ToMatrixOf<TMatrix>(Transform(positions[i], rotations[i], scales[i]));
+    }
+}
+
+template<typename TMatrix>
+void TransformsToMatricesAoS(std::span<const Transform> transforms, std::span<TMatrix> outMatrices)
+{
+    const std::size_t count = BatchCount(transforms.size(), outMatrices.size());
+    std::size_t i = 0;
+
+#if TE_MATH_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        const Transform* t = transforms.data() + i;
+
+        __m128 qx, qy, qz, qw;
+        LoadQuats4(t[0].Rotation, t[1].Rotation, t[2].Rotation, t[3].Rotation, qx, qy, qz, qw);
+        ComposeTRS4(qx, qy, qz, qw,
+                    Gather(t[0].Position.X, t[1].Position.X, t[2].Position.X, t[3].Position.X),
+                    Gather(t[0].Position.Y, t[1].Position.Y, t[2].Position.Y, t[3].Position.Y),
+                    Gather(t[0].Position.Z, t[1].Position.Z, t[2].Position.Z, t[3].Position.Z),
+                    Gather(t[0].Scale.X, t[1].Scale.X, t[2].Scale.X, t[3].Scale.X),
+                    Gather(t[0].Scale.Y, t[1].Scale.Y, t[2].Scale.Y, t[3].Scale.Y),
+                    Gather(t[0].Scale.Z, t[1].Scale.Z, t[2].Scale.Z, t[3].Scale.Z),
+                    outMatrices.data() + i);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        outMatrices[i] = ToMatrixOf<TMatrix>(transforms[i]);
+    }
+}
+
+} // namespace
+
+void TransformsToMatrices(std::span<const Vector3> positions,
+                          std::span<const Quat> rotations,
+                          std::span<const Vector3> scales,
+                          std::span<Matrix4> outMatrices)
+{
+    TransformsToMatricesSoA(positions, rotations, scales, outMatrices);
+}
+
+void TransformsToMatrices(std::span<const Vector3> positions,
+                          std::span<const Quat> rotations,
+                          std::span<const Vector3> scales,
+                          std::span<Matrix3x4> outMatrices)
+{
+    TransformsToMatricesSoA(positions, rotations, scales, outMatrices);
+}
+
+void TransformsToMatrices(std::span<const Transform> transforms, std::span<Matrix4> outMatrices)
+{
+    TransformsToMatricesAoS(transforms, outMatrices);
+}
+
+void TransformsToMatrices(std::span<const Transform> transforms, std::span<Matrix3x4> outMatrices)
+{
+    TransformsToMatricesAoS(transforms, outMatrices);
+}
+
+void MultiplyMatrices(const Matrix4& lhs, std::span<const Matrix4> rhs, std::span<Matrix4> outMatrices)
+{
+    const std::size_t count = BatchCount(rhs.size(), outMatrices.size());
+
+#if TE_MATH_SSE && !TE_MATH_AVX2
+    // lhs 的 4 列在整个批次中常驻寄存器
+    const __m128 a0 = _mm_load_ps(lhs.M[0]);
+    const __m128 a1 = _mm_load_ps(lhs.M[1]);
+    const __m128 a2 = _mm_load_ps(lhs.M[2]);
+    const __m128 a3 = _mm_load_ps(lhs.M[3]);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float* b = &rhs[i].M[0][0];
+        __m128 columns[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            const __m128 bc = _mm_load_ps(b + c * 4);
+            __m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(0, 0, 0, 0)));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(1, 1, 1, 1))));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(2, 2, 2, 2))));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(3, 3, 3, 3))));
+            columns[c] = r;
+        }
+        float* dst = &outMatrices[i].M[0][0];
+        for (int c = 0; c < 4; ++c)
+            _mm_store_ps(dst + c * 4, columns[c]);
+    }
+#else
+    // AVX2 / NEON / 标量：单次乘法内核已是最优形态；lhs 先拷贝一份，允许 lhs 与输出重叠
+    const Matrix4 a = lhs;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        MatrixKernels::Multiply(a.Data(), rhs[i].Data(), &outMatrices[i].M[0][0]);
+    }
+#endif
+}
+
+void MultiplyMatrices(const Matrix4& lhs, std::span<const Matrix3x4> rhs, std::span<Matrix4> outMatrices)
+{
+    const std::size_t count = BatchCount(rhs.size(), outMatrices.size());
+
+    // 隐含的最后一行 (0, 0, 0, 1) 让每个结果少 4 次乘加；lhs 先拷贝一份，允许 lhs 与输出重叠
+    const Matrix4 a = lhs;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        MatrixKernels::Multiply4x4By3x4(a.Data(), rhs[i].Data(), &outMatrices[i].M[0][0]);
+    }
+}
+
+void NormalMatrices(std::span<const Matrix4> matrices, std::span<Matrix3> outNormalMatrices)
+{
+    const std::size_t count = BatchCount(matrices.size(), outNormalMatrices.size());
+    std::size_t i = 0;
+
+#if TE_MATH_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        const Matrix4* m = matrices.data() + i;
+
+        // 各对象的第 c 列转置后得到 (x, y, z, w) x 4 个对象
+        __m128 c0x = _mm_load_ps(m[0].M[0]), c0y = _mm_load_ps(m[1].M[0]);
+        __m128 c0z = _mm_load_ps(m[2].M[0]), c0w = _mm_load_ps(m[3].M[0]);
+        __m128 c1x = _mm_load_ps(m[0].M[1]), c1y = _mm_load_ps(m[1].M[1]);
+        __m128 c1z = _mm_load_ps(m[2].M[1]), c1w = _mm_load_ps(m[3].M[1]);
+        __m128 c2x = _mm_load_ps(m[0].M[2]), c2y = _mm_load_ps(m[1].M[2]);
+        __m128 c2z = _mm_load_ps(m[2].M[2]), c2w = _mm_load_ps(m[3].M[2]);
+        _MM_TRANSPOSE4_PS(c0x, c0y, c0z, c0w);
+        _MM_TRANSPOSE4_PS(c1x, c1y, c1z, c1w);
+        _MM_TRANSPOSE4_PS(c2x, c2y, c2z, c2w);
+
+        // 逆转置的各列 = 两两叉积 / 行列式（与 Matrix3::Inverse().Transpose() 相同）
+        const __m128 r0x = _mm_sub_ps(_mm_mul_ps(c1y, c2z), _mm_mul_ps(c1z, c2y));
+        const __m128 r0y = _mm_sub_ps(_mm_mul_ps(c1z, c2x), _mm_mul_ps(c1x, c2z));
+        const __m128 r0z = _mm_sub_ps(_mm_mul_ps(c1x, c2y), _mm_mul_ps(c1y, c2x));
+        const __m128 r1x = _mm_sub_ps(_mm_mul_ps(c2y, c0z), _mm_mul_ps(c2z, c0y));
+        const __m128 r1y = _mm_sub_ps(_mm_mul_ps(c2z, c0x), _mm_mul_ps(c2x, c0z));
+        const __m128 r1z = _mm_sub_ps(_mm_mul_ps(c2x, c0y), _mm_mul_ps(c2y, c0x));
+        const __m128 r2x = _mm_sub_ps(_mm_mul_ps(c0y, c1z), _mm_mul_ps(c0z, c1y));
+        const __m128 r2y = _mm_sub_ps(_mm_mul_ps(c0z, c1x), _mm_mul_ps(c0x, c1z));
+        const __m128 r2z = _mm_sub_ps(_mm_mul_ps(c0x, c1y), _mm_mul_ps(c0y, c1x));
+
+        const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0x, r0x), _mm_mul_ps(c0y, r0y)), _mm_mul_ps(c0z, r0z));
+        const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+        alignas(16) float lanes[9][4];
+        _mm_store_ps(lanes[0], _mm_mul_ps(r0x, invDet));
+        _mm_store_ps(lanes[1], _mm_mul_ps(r0y, invDet));
+        _mm_store_ps(lanes[2], _mm_mul_ps(r0z, invDet));
+        _mm_store_ps(lanes[3], _mm_mul_ps(r1x, invDet));
+        _mm_store_ps(lanes[4], _mm_mul_ps(r1y, invDet));
+        _mm_store_ps(lanes[5], _mm_mul_ps(r1z, invDet));
+        _mm_store_ps(lanes[6], _mm_mul_ps(r2x, invDet));
+        _mm_store_ps(lanes[7], _mm_mul_ps(r2y, invDet));
+        _mm_store_ps(lanes[8], _mm_mul_ps(r2z, invDet));
+
+        // Matrix3 为 9 个 float 的紧凑布局，无法整列对齐写入，逐元素散射
+        for (int object = 0; object < 4; ++object)
+        {
+            float* dst = &outNormalMatrices[i + object].M[0][0];
+            for (int element = 0; element < 9; ++element)
+                dst[element] = lanes[element][object];
+        }
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        outNormalMatrices[i] = matrices[i].GetNormalMatrix();
+    }
+}
+
+void NormalMatrices(std::span<const Matrix3x4> matrices, std::span<Matrix3> outNormalMatrices)
+{
+    const std::size_t count = BatchCount(matrices.size(), outNormalMatrices.size());
+    std::size_t i = 0;
+
+#if TE_MATH_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        const Matrix3x4* m = matrices.data() + i;
+
+        // 行主序：各对象的第 r 行转置后得到 (x, y, z, 平移) x 4 个对象，平移分量不参与计算
+        __m128 r0x = _mm_load_ps(m[0].M[0]), r0y = _mm_load_ps(m[1].M[0]);
+        __m128 r0z = _mm_load_ps(m[2].M[0]), r0w = _mm_load_ps(m[3].M[0]);
+        __m128 r1x = _mm_load_ps(m[0].M[1]), r1y = _mm_load_ps(m[1].M[1]);
+        __m128 r1z = _mm_load_ps(m[2].M[1]), r1w = _mm_load_ps(m[3].M[1]);
+        __m128 r2x = _mm_load_ps(m[0].M[2]), r2y = _mm_load_ps(m[1].M[2]);
+        __m128 r2z = _mm_load_ps(m[2].M[2]), r2w = _mm_load_ps(m[3].M[2]);
+        _MM_TRANSPOSE4_PS(r0x, r0y, r0z, r0w);
+        _MM_TRANSPOSE4_PS(r1x, r1y, r1z, r1w);
+        _MM_TRANSPOSE4_PS(r2x, r2y, r2z, r2w);
+
+        // 法线矩阵的各行 = 线性部分三行的两两叉积 / 行列式
+        const __m128 n0x = _mm_sub_ps(_mm_mul_ps(r1y, r2z), _mm_mul_ps(r1z, r2y));
+        const __m128 n0y = _mm_sub_ps(_mm_mul_ps(r1z, r2x), _mm_mul_ps(r1x, r2z));
+        const __m128 n0z = _mm_sub_ps(_mm_mul_ps(r1x, r2y), _mm_mul_ps(r1y, r2x));
+        const __m128 n1x = _mm_sub_ps(_mm_mul_ps(r2y, r0z), _mm_mul_ps(r2z, r0y));
+        const __m128 n1y = _mm_sub_ps(_mm_mul_ps(r2z, r0x), _mm_mul_ps(r2x, r0z));
+        const __m128 n1z = _mm_sub_ps(_mm_mul_ps(r2x, r0y), _mm_mul_ps(r2y, r0x));
+        const __m128 n2x = _mm_sub_ps(_mm_mul_ps(r0y, r1z), _mm_mul_ps(r0z, r1y));
+        const __m128 n2y = _mm_sub_ps(_mm_mul_ps(r0z, r1x), _mm_mul_ps(r0x, r1z));
+        const __m128 n2z = _mm_sub_ps(_mm_mul_ps(r0x, r1y), _mm_mul_ps(r0y, r1x));
+
+        const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0x, n0x), _mm_mul_ps(r0y, n0y)), _mm_mul_ps(r0z, n0z));
+        const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+        // 列主序 Matrix3：element = col * 3 + row，即 (n0x, n1x, n2x, n0y, ...)
+        alignas(16) float lanes[9][4];
+        _mm_store_ps(lanes[0], _mm_mul_ps(n0x, invDet));
+        _mm_store_ps(lanes[1], _mm_mul_ps(n1x, invDet));
+        _mm_store_ps(lanes[2], _mm_mul_ps(n2x, invDet));
+        _mm_store_ps(lanes[3], _mm_mul_ps(n0y, invDet));
+        _mm_store_ps(lanes[4], _mm_mul_ps(n1y, invDet));
+        _mm_store_ps(lanes[5], _mm_mul_ps(n2y, invDet));
+        _mm_store_ps(lanes[6], _mm_mul_ps(n0z, invDet));
+        _mm_store_ps(lanes[7], _mm_mul_ps(n1z, invDet));
+        _mm_store_ps(lanes[8], _mm_mul_ps(n2z, invDet));
+
+        for (int object = 0; object < 4; ++object)
+        {
+            float* dst = &outNormalMatrices[i + object].M[0][0];
+            for (int element = 0; element < 9; ++element)
+                dst[element] = lanes[element][object];
+        }
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        outNormalMatrices[i] = matrices[i].GetNormalMatrix();
+    }
+}
+
+void TransformPoints(const Matrix3x4& matrix, std::span<const Vector3> points, std::span<Vector3> outPoints)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float), "TransformPoints writes Vector3 arrays as packed floats");
+    const std::size_t count = BatchCount(points.size(), outPoints.size());
+    std::size_t i = 0;
+
+#if TE_MATH_SSE
+    const __m128 m00 = _mm_set1_ps(matrix.M[0][0]), m01 = _mm_set1_ps(matrix.M[0][1]);
+    const __m128 m02 = _mm_set1_ps(matrix.M[0][2]), m03 = _mm_set1_ps(matrix.M[0][3]);
+    const __m128 m10 = _mm_set1_ps(matrix.M[1][0]), m11 = _mm_set1_ps(matrix.M[1][1]);
+    const __m128 m12 = _mm_set1_ps(matrix.M[1][2]), m13 = _mm_set1_ps(matrix.M[1][3]);
+    const __m128 m20 = _mm_set1_ps(matrix.M[2][0]), m21 = _mm_set1_ps(matrix.M[2][1]);
+    const __m128 m22 = _mm_set1_ps(matrix.M[2][2]), m23 = _mm_set1_ps(matrix.M[2][3]);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const Vector3* p = points.data() + i;
+        const __m128 x = Gather(p[0].X, p[1].X, p[2].X, p[3].X);
+        const __m128 y = Gather(p[0].Y, p[1].Y, p[2].Y, p[3].Y);
+        const __m128 z = Gather(p[0].Z, p[1].Z, p[2].Z, p[3].Z);
+
+        const __m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_add_ps(_mm_mul_ps(m02, z), m03));
+        const __m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_add_ps(_mm_mul_ps(m12, z), m13));
+        const __m128 oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_add_ps(_mm_mul_ps(m22, z), m23));
+
+        // SoA 结果按 x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 交错成 3 个寄存器后连续写出（Vector3 紧凑排列）
+        alignas(16) float lanes[3][4];
+        _mm_store_ps(lanes[0], ox);
+        _mm_store_ps(lanes[1], oy);
+        _mm_store_ps(lanes[2], oz);
+        float* dst = &outPoints[i].X;
+        _mm_storeu_ps(dst + 0, _mm_setr_ps(lanes[0][0], lanes[1][0], lanes[2][0], lanes[0][1]));
+        _mm_storeu_ps(dst + 4, _mm_setr_ps(lanes[1][1], lanes[2][1], lanes[0][2], lanes[1][2]));
+        _mm_storeu_ps(dst + 8, _mm_setr_ps(lanes[2][2], lanes[0][3], lanes[1][3], lanes[2][3]));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        outPoints[i] = matrix.TransformPoint(points[i]);
+    }
+}
+
+void TransformBounds(std::span<const BoundingBox> localBounds,
+                     std::span<const Matrix3x4> worldMatrices,
+                     std::span<BoundingBox> outWorldBounds)
+{
+    static_assert(sizeof(BoundingBox) == 6 * sizeof(float), "TransformBounds reads BoundingBox arrays as packed floats");
+    assert(worldMatrices.size() >= localBounds.size() && "TransformBounds: fewer world matrices than bounds");
+    const std::size_t count = BatchCount(std::min(localBounds.size(), worldMatrices.size()), outWorldBounds.size());
+    std::size_t i = 0;
+
+#if TE_MATH_SSE
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const Matrix3x4* m = worldMatrices.data() + i;
+        __m128 r0x = _mm_load_ps(m[0].M[0]), r0y = _mm_load_ps(m[1].M[0]);
+        __m128 r0z = _mm_load_ps(m[2].M[0]), r0w = _mm_load_ps(m[3].M[0]);
+        __m128 r1x = _mm_load_ps(m[0].M[1]), r1y = _mm_load_ps(m[1].M[1]);
+        __m128 r1z = _mm_load_ps(m[2].M[1]), r1w = _mm_load_ps(m[3].M[1]);
+        __m128 r2x = _mm_load_ps(m[0].M[2]), r2y = _mm_load_ps(m[1].M[2]);
+        __m128 r2z = _mm_load_ps(m[2].M[2]), r2w = _mm_load_ps(m[3].M[2]);
+        _MM_TRANSPOSE4_PS(r0x, r0y, r0z, r0w);
+        _MM_TRANSPOSE4_PS(r1x, r1y, r1z, r1w);
+        _MM_TRANSPOSE4_PS(r2x, r2y, r2z, r2w);
+
+        // 每个包围盒读两次 4 个 float：low = 从 Min.X 起的 (Min.xyz, Max.x)，high = 从 Min.Z 起的 (Min.z, Max.xyz)，
+        // 两次读取都不越出该包围盒；各自转置后得到 6 个分量的 SoA（重复的 Min.z / Max.x 各丢弃一份）
+        const BoundingBox* b = localBounds.data() + i;
+        __m128 minX = _mm_loadu_ps(&b[0].Min.X), minY = _mm_loadu_ps(&b[1].Min.X);
+        __m128 minZ = _mm_loadu_ps(&b[2].Min.X), lowMaxX = _mm_loadu_ps(&b[3].Min.X);
+        __m128 highMinZ = _mm_loadu_ps(&b[0].Min.Z), maxX = _mm_loadu_ps(&b[1].Min.Z);
+        __m128 maxY = _mm_loadu_ps(&b[2].Min.Z), maxZ = _mm_loadu_ps(&b[3].Min.Z);
+        _MM_TRANSPOSE4_PS(minX, minY, minZ, lowMaxX);
+        _MM_TRANSPOSE4_PS(highMinZ, maxX, maxY, maxZ);
+
+        const __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+        const __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+        const __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+        const __m128 ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+        const __m128 ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+        const __m128 ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+        // 世界中心 = 仿射变换中心；世界半边长 = |线性部分| * 局部半边长
+        const __m128 wcx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0x, cx), _mm_mul_ps(r0y, cy)), _mm_add_ps(_mm_mul_ps(r0z, cz), r0w));
+        const __m128 wcy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r1x, cx), _mm_mul_ps(r1y, cy)), _mm_add_ps(_mm_mul_ps(r1z, cz), r1w));
+        const __m128 wcz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r2x, cx), _mm_mul_ps(r2y, cy)), _mm_add_ps(_mm_mul_ps(r2z, cz), r2w));
+        const __m128 wex = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(r0x, absMask), ex), _mm_mul_ps(_mm_and_ps(r0y, absMask), ey)),
+                                      _mm_mul_ps(_mm_and_ps(r0z, absMask), ez));
+        const __m128 wey = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(r1x, absMask), ex), _mm_mul_ps(_mm_and_ps(r1y, absMask), ey)),
+                                      _mm_mul_ps(_mm_and_ps(r1z, absMask), ez));
+        const __m128 wez = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(r2x, absMask), ex), _mm_mul_ps(_mm_and_ps(r2y, absMask), ey)),
+                                      _mm_mul_ps(_mm_and_ps(r2z, absMask), ez));
+
+        // 写回时按读取的方式反向转置：low 行 = (Min.xyz, Max.x)，high 行 = (Min.z, Max.xyz)。
+        // 先写 high 再写 low，重叠的两个分量值相同；读取已全部完成，因此允许原地覆盖
+        const __m128 worldMinZ = _mm_sub_ps(wcz, wez);
+        const __m128 worldMaxX = _mm_add_ps(wcx, wex);
+        __m128 low0 = _mm_sub_ps(wcx, wex), low1 = _mm_sub_ps(wcy, wey), low2 = worldMinZ, low3 = worldMaxX;
+        __m128 high0 = worldMinZ, high1 = worldMaxX, high2 = _mm_add_ps(wcy, wey), high3 = _mm_add_ps(wcz, wez);
+        _MM_TRANSPOSE4_PS(low0, low1, low2, low3);
+        _MM_TRANSPOSE4_PS(high0, high1, high2, high3);
+
+        BoundingBox* dst = outWorldBounds.data() + i;
+        _mm_storeu_ps(&dst[0].Min.Z, high0);
+        _mm_storeu_ps(&dst[1].Min.Z, high1);
+        _mm_storeu_ps(&dst[2].Min.Z, high2);
+        _mm_storeu_ps(&dst[3].Min.Z, high3);
+        _mm_storeu_ps(&dst[0].Min.X, low0);
+        _mm_storeu_ps(&dst[1].Min.X, low1);
+        _mm_storeu_ps(&dst[2].Min.X, low2);
+        _mm_storeu_ps(&dst[3].Min.X, low3);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        outWorldBounds[i] = localBounds[i].TransformBy(worldMatrices[i]);
+    }
+}
+
+} // namespace TE::Math
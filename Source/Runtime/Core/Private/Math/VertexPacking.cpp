@@ -0,0 +1,200 @@
+// ToyEngine Core Module
+// 顶点量化与打包：半精度软件实现、批量转换与八面体编码
+
+#include "Math/VertexPacking.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace TE::Math {
+
+// ==================== 半精度浮点 ====================
+
+namespace Scalar {
+
+uint16_t FloatToHalf(float value)
+{
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    // inf / NaN：NaN 置 quiet 位并保留尾数高 10 位
+    if (magnitude >= 0x7F800000u)
+    {
+        if (magnitude == 0x7F800000u)
+            return static_cast<uint16_t>(sign | 0x7C00u);
+        return static_cast<uint16_t>(sign | 0x7E00u | ((magnitude >> 13) & 0x03FFu));
+    }
+
+    // >= 65520 就近舍入后超出 65504，溢出为 inf
+    if (magnitude >= 0x477FF000u)
+        return static_cast<uint16_t>(sign | 0x7C00u);
+
+    // 规格化数（>= 2^-14）：指数偏置 127 -> 15，丢弃的 13 位尾数按就近舍入到偶数进位（进位可自然溢入指数）
+    if (magnitude >= 0x38800000u)
+    {
+        uint32_t rebiased = magnitude - 0x38000000u;
+        rebiased += 0x0FFFu + ((rebiased >> 13) & 1u);
+        return static_cast<uint16_t>(sign | (rebiased >> 13));
+    }
+
+    // <= 2^-25 舍入为 0（恰为 2^-25 时舍入到偶数）
+    if (magnitude <= 0x33000000u)
+        return static_cast<uint16_t>(sign);
+
+    // 非规格化数：以 2^-24 为单位，尾数（含隐含位）右移 126 - exponent 位
+    const uint32_t exponent = magnitude >> 23;
+    const uint32_t mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+    const uint32_t shift = 126u - exponent;
+    const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+    const uint32_t halfway = 1u << (shift - 1u);
+    uint32_t result = mantissa >> shift;
+    if (remainder > halfway || (remainder == halfway && (result & 1u) != 0))
+        ++result;
+    return static_cast<uint16_t>(sign | result);
+}
+
+float HalfToFloat(uint16_t half)
+{
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x03FFu;
+
+    if (exponent == 0x1Fu)
+    {
+        const uint32_t quiet = mantissa != 0 ? 0x00400000u : 0u;
+        return std::bit_cast<float>(sign | 0x7F800000u | quiet | (mantissa << 13));
+    }
+    if (exponent != 0)
+        return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+
+    // 零与非规格化数：mantissa * 2^-24 在 float 中精确表示
+    const float magnitude = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+    return std::bit_cast<float>(sign | std::bit_cast<uint32_t>(magnitude));
+}
+
+} // namespace Scalar
+
+void FloatsToHalves(std::span<const float> values, std::span<uint16_t> outHalves)
+{
+    assert(outHalves.size() >= values.size());
+    const size_t count = std::min(values.size(), outHalves.size());
+    size_t i = 0;
+#if TE_MATH_F16C
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(values.data() + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outHalves.data() + i), halves);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outHalves[i] = FloatToHalf(values[i]);
+    }
+}
+
+void HalvesToFloats(std::span<const uint16_t> halves, std::span<float> outValues)
+{
+    assert(outValues.size() >= halves.size());
+    const size_t count = std::min(halves.size(), outValues.size());
+    size_t i = 0;
+#if TE_MATH_F16C
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(halves.data() + i));
+        _mm256_storeu_ps(outValues.data() + i, _mm256_cvtph_ps(packed));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outValues[i] = HalfToFloat(halves[i]);
+    }
+}
+
+// ==================== 八面体单位向量编码 ====================
+
+namespace {
+
+inline float SignNotZero(float value)
+{
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+/// <summary>
+/// 精确量化：先按 floor 量化，再在 floor / ceil 组成的 4 个候选中取解码后最接近原方向的一个
+/// （Cigolle et al. 2014，"A Survey of Efficient Representations for Independent Unit Vectors"）
+/// </summary>
+template<typename TSnorm>
+void QuantizeOctahedral(const Vector3& direction, float scale, TSnorm& outX, TSnorm& outY)
+{
+    const Vector3 unit = direction.Normalize();
+    const Vector2 encoded = OctahedralEncode(unit);
+    const float baseX = Floor(Clamp(encoded.X, -1.0f, 1.0f) * scale);
+    const float baseY = Floor(Clamp(encoded.Y, -1.0f, 1.0f) * scale);
+
+    // 以解码结果与原方向的距离平方比较：小角度时 dot 在 1 附近分辨不出 16 位量化的差别
+    float bestDistanceSquared = 5.0f;
+    for (int candidate = 0; candidate < 4; ++candidate)
+    {
+        const float qx = Clamp(baseX + static_cast<float>(candidate & 1), -scale, scale);
+        const float qy = Clamp(baseY + static_cast<float>(candidate >> 1), -scale, scale);
+        const float distanceSquared = Vector3::DistanceSquared(OctahedralDecode(Vector2(qx / scale, qy / scale)), unit);
+        if (distanceSquared < bestDistanceSquared)
+        {
+            bestDistanceSquared = distanceSquared;
+            outX = static_cast<TSnorm>(qx);
+            outY = static_cast<TSnorm>(qy);
+        }
+    }
+}
+
+} // anonymous namespace
+
+Vector2 OctahedralEncode(const Vector3& direction)
+{
+    const float invL1 = 1.0f / (Abs(direction.X) + Abs(direction.Y) + Abs(direction.Z));
+    const float x = direction.X * invL1;
+    const float y = direction.Y * invL1;
+    if (direction.Z >= 0.0f)
+        return {x, y};
+    // 下半球折叠到正方形四角
+    return {(1.0f - Abs(y)) * SignNotZero(x), (1.0f - Abs(x)) * SignNotZero(y)};
+}
+
+Vector3 OctahedralDecode(const Vector2& encoded)
+{
+    Vector3 direction(encoded.X, encoded.Y, 1.0f - Abs(encoded.X) - Abs(encoded.Y));
+    const float fold = Max(-direction.Z, 0.0f);
+    direction.X += direction.X >= 0.0f ? -fold : fold;
+    direction.Y += direction.Y >= 0.0f ? -fold : fold;
+    return direction.Normalize();
+}
+
+uint32_t PackOctahedral16(const Vector3& direction)
+{
+    int16_t x = 0;
+    int16_t y = 0;
+    QuantizeOctahedral(direction, 32767.0f, x, y);
+    return static_cast<uint32_t>(static_cast<uint16_t>(x)) | (static_cast<uint32_t>(static_cast<uint16_t>(y)) << 16);
+}
+
+Vector3 UnpackOctahedral16(uint32_t packed)
+{
+    return OctahedralDecode(UnpackSnorm2x16(packed));
+}
+
+uint16_t PackOctahedral8(const Vector3& direction)
+{
+    int8_t x = 0;
+    int8_t y = 0;
+    QuantizeOctahedral(direction, 127.0f, x, y);
+    return static_cast<uint16_t>(static_cast<uint8_t>(x) | (static_cast<uint32_t>(static_cast<uint8_t>(y)) << 8));
+}
+
+Vector3 UnpackOctahedral8(uint16_t packed)
+{
+    return OctahedralDecode(Vector2(Snorm8ToFloat(static_cast<int8_t>(packed)), Snorm8ToFloat(static_cast<int8_t>(packed >> 8))));
+}
+
+} // namespace TE::Math
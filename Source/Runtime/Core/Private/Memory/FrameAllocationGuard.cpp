@@ -0,0 +1,115 @@
+// ToyEngine Core Module
+// 帧分配守卫实现
+
+#include "Memory/FrameAllocationGuard.h"
+
+#include "Memory/MemoryInternal.h"
+#include "Memory/MemoryUtils.h"
+#include "Log/Log.h"
+
+#include <atomic>
+#include <cassert>
+#include <mutex>
+
+namespace TE {
+
+std::atomic<bool> g_frameAllocGuardActive{false};
+
+namespace {
+
+// 配置与帧序号只在帧边界（慢路径）读写
+std::mutex g_guardMutex;
+FrameAllocationGuardConfig g_guardConfig{};
+std::uint64_t g_guardedFrames = 0;
+
+// 守卫打开期间由任意线程的分配前端更新
+std::atomic<std::uint64_t> g_frameAllocations{0};
+std::atomic<std::uint64_t> g_frameBytes{0};
+std::atomic<std::uint64_t> g_firstBytes{0};
+std::atomic<std::uint16_t> g_firstTag{0};
+
+} // namespace
+
+void FrameAllocationGuardOnAlloc(std::size_t size, MemoryTag tag)
+{
+    if (g_frameAllocations.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+        g_firstTag.store(static_cast<std::uint16_t>(tag), std::memory_order_relaxed);
+        g_firstBytes.store(size, std::memory_order_relaxed);
+    }
+    g_frameBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void MemorySetFrameAllocationGuard(const FrameAllocationGuardConfig& config)
+{
+    std::scoped_lock lock(g_guardMutex);
+    g_guardConfig = config;
+    g_guardedFrames = 0;
+}
+
+FrameAllocationGuardConfig MemoryGetFrameAllocationGuard()
+{
+    std::scoped_lock lock(g_guardMutex);
+    return g_guardConfig;
+}
+
+void MemoryResetFrameAllocationWarmup()
+{
+    std::scoped_lock lock(g_guardMutex);
+    g_guardedFrames = 0;
+}
+
+void MemoryBeginFrameAllocationGuard()
+{
+    std::scoped_lock lock(g_guardMutex);
+    if (g_guardConfig.Policy == FrameAllocationPolicy::Off)
+    {
+        return;
+    }
+
+    g_frameAllocations.store(0, std::memory_order_relaxed);
+    g_frameBytes.store(0, std::memory_order_relaxed);
+    g_firstBytes.store(0, std::memory_order_relaxed);
+    g_firstTag.store(0, std::memory_order_relaxed);
+    g_frameAllocGuardActive.store(true, std::memory_order_release);
+}
+
+FrameAllocationReport MemoryEndFrameAllocationGuard()
+{
+    FrameAllocationReport report;
+    FrameAllocationPolicy policy = FrameAllocationPolicy::Off;
+    {
+        std::scoped_lock lock(g_guardMutex);
+        if (!g_frameAllocGuardActive.exchange(false, std::memory_order_acq_rel))
+        {
+            return report;
+        }
+
+        policy = g_guardConfig.Policy;
+        report.FrameIndex = g_guardedFrames;
+        report.SteadyState = g_guardedFrames >= g_guardConfig.WarmupFrames;
+        ++g_guardedFrames;
+    }
+
+    report.Allocations = g_frameAllocations.load(std::memory_order_relaxed);
+    report.Bytes = g_frameBytes.load(std::memory_order_relaxed);
+    report.FirstTag = static_cast<MemoryTag>(g_firstTag.load(std::memory_order_relaxed));
+    report.FirstBytes = g_firstBytes.load(std::memory_order_relaxed);
+    report.Violation = report.SteadyState && report.Allocations != 0;
+
+    // 守卫已关闭：此处的日志格式化不会计入下一帧
+    if (report.Violation && (policy == FrameAllocationPolicy::Log || policy == FrameAllocationPolicy::Assert))
+    {
+        const FormattedBytes total = FormatBytes(report.Bytes);
+        TE_LOG_ERROR("[Memory] Steady-state frame {} allocated {} times ({:.2f} {}); first: {} bytes tagged {}",
+                     report.FrameIndex, report.Allocations, total.Value, total.Unit,
+                     report.FirstBytes, MemoryTagName(report.FirstTag));
+        if (policy == FrameAllocationPolicy::Assert)
+        {
+            assert(false && "heap allocation in a steady-state frame");
+        }
+    }
+    return report;
+}
+
+} // namespace TE
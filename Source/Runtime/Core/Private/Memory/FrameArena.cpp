@@ -0,0 +1,188 @@
+// ToyEngine Core Module
+// 帧线性分配器实现
+
+#include "Memory/FrameArena.h"
+
+#include <algorithm>
+
+namespace TE {
+
+namespace {
+
+bool IsPowerOfTwo(std::size_t x)
+{
+    return x != 0 && (x & (x - 1)) == 0;
+}
+
+std::uintptr_t AlignUp(std::uintptr_t x, std::size_t align)
+{
+    return (x + (align - 1)) & ~(static_cast<std::uintptr_t>(align - 1));
+}
+
+} // namespace
+
+FrameArena& FrameArena::Get()
+{
+    static FrameArena instance;
+    return instance;
+}
+
+FrameArena::~FrameArena()
+{
+    Shutdown();
+}
+
+void FrameArena::Init(std::uint32_t framesInFlight, std::size_t chunkBytes)
+{
+    Shutdown();
+
+    m_framesInFlight = std::clamp<std::uint32_t>(framesInFlight, 1u, MaxFramesInFlight);
+    m_chunkBytes = std::max<std::size_t>(chunkBytes, 4096);
+    m_frameIndex.store(0, std::memory_order_release);
+}
+
+void FrameArena::Shutdown()
+{
+    std::scoped_lock lock(m_growMutex);
+    for (auto& frame : m_frames)
+    {
+        DestroyChunks(frame.Head);
+        frame.Head = nullptr;
+        frame.Current.store(nullptr, std::memory_order_release);
+    }
+}
+
+void FrameArena::EndFrame()
+{
+    const std::uint32_t next = (m_frameIndex.load(std::memory_order_relaxed) + 1) % m_framesInFlight;
+    ResetFrame(m_frames[next]);
+    m_frameIndex.store(next, std::memory_order_release);
+}
+
+void* FrameArena::Allocate(std::size_t size, std::size_t align)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+    if (align == 0)
+    {
+        align = alignof(std::max_align_t);
+    }
+    if (!IsPowerOfTwo(align))
+    {
+        return nullptr;
+    }
+
+    FrameBuffer& frame = m_frames[m_frameIndex.load(std::memory_order_acquire)];
+    for (;;)
+    {
+        Chunk* chunk = frame.Current.load(std::memory_order_acquire);
+        if (chunk)
+        {
+            const auto base = reinterpret_cast<std::uintptr_t>(chunk->Data());
+            std::size_t offset = chunk->Offset.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                const std::size_t aligned = AlignUp(base + offset, align) - base;
+                if (aligned > chunk->Capacity || size > chunk->Capacity - aligned)
+                {
+                    break;
+                }
+                if (chunk->Offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed))
+                {
+                    return reinterpret_cast<void*>(base + aligned);
+                }
+            }
+        }
+
+        if (!Grow(frame, chunk, size + align))
+        {
+            return nullptr;
+        }
+    }
+}
+
+std::size_t FrameArena::GetUsedBytes() const
+{
+    const FrameBuffer& frame = m_frames[m_frameIndex.load(std::memory_order_acquire)];
+    std::size_t used = 0;
+    for (const Chunk* chunk = frame.Head; chunk; chunk = chunk->Next)
+    {
+        used += std::min(chunk->Offset.load(std::memory_order_relaxed), chunk->Capacity);
+    }
+    return used;
+}
+
+FrameArena::Chunk* FrameArena::CreateChunk(std::size_t capacity) const
+{
+    void* mem = MemAlignedAlloc(sizeof(Chunk) + capacity, alignof(Chunk), MemoryTag::Frame);
+    if (!mem)
+    {
+        return nullptr;
+    }
+    auto* chunk = ::new (mem) Chunk();
+    chunk->Capacity = capacity;
+    return chunk;
+}
+
+void FrameArena::DestroyChunks(Chunk* head)
+{
+    while (head)
+    {
+        Chunk* next = head->Next;
+        head->~Chunk();
+        MemFree(head);
+        head = next;
+    }
+}
+
+bool FrameArena::Grow(FrameBuffer& frame, Chunk* observed, std::size_t minBytes)
+{
+    std::scoped_lock lock(m_growMutex);
+
+    // 其它线程已追加了新 chunk：直接重试
+    if (frame.Current.load(std::memory_order_relaxed) != observed)
+    {
+        return true;
+    }
+
+    Chunk* chunk = CreateChunk(std::max(m_chunkBytes, minBytes));
+    if (!chunk)
+    {
+        return false;
+    }
+    chunk->Next = frame.Head;
+    frame.Head = chunk;
+    frame.Current.store(chunk, std::memory_order_release);
+    return true;
+}
+
+void FrameArena::ResetFrame(FrameBuffer& frame)
+{
+    Chunk* head = frame.Head;
+    if (!head)
+    {
+        return;
+    }
+
+    if (!head->Next)
+    {
+        head->Offset.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    // 上一轮溢出到多个 chunk：合并成一个，下一轮无需再追加
+    std::size_t total = 0;
+    for (const Chunk* chunk = head; chunk; chunk = chunk->Next)
+    {
+        total += chunk->Capacity;
+    }
+
+    std::scoped_lock lock(m_growMutex);
+    DestroyChunks(head);
+    frame.Head = CreateChunk(total);
+    frame.Current.store(frame.Head, std::memory_order_release);
+}
+
+} // namespace TE
@@ -1,5 +1,6 @@
 // ToyEngine Core Module
 // 可选：覆盖全局 new/delete，让 STL/默认 new 走引擎分配器
+// 分配记为 MemoryTag::STL；处于 TE_MEMORY_SCOPE 作用域内时改记到作用域 tag
 
 #include "Memory/Memory.h"
 
@@ -37,15 +38,15 @@ void operator delete[](void* ptr) noexcept
     TE::MemFree(ptr);
 }
 
-// C++14 sized delete（MSVC 可能会用到）
-void operator delete(void* ptr, std::size_t /*size*/) noexcept
+// C++14 sized delete：STL 节点等小对象据 size 直接定位 slab 档位，大块跳过 slab 区间判断
+void operator delete(void* ptr, std::size_t size) noexcept
 {
-    TE::MemFree(ptr);
+    TE::MemFreeSized(ptr, size);
 }
 
-void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+void operator delete[](void* ptr, std::size_t size) noexcept
 {
-    TE::MemFree(ptr);
+    TE::MemFreeSized(ptr, size);
 }
 
 #endif
@@ -2,48 +2,489 @@
 // 内存系统全局入口实现
 
 #include "Memory/Memory.h"
+#include "Memory/MemoryNew.h"
+#include "Memory/MemoryScope.h"
+#include "Memory/MemoryTrace.h"
 
+#include "Memory/MemoryInternal.h"
+#include "Memory/ThreadAllocCache.h"
 #include "Memory/TlsfAllocator.h"
+#include "Memory/VirtualMemory.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <mutex>
-#include <memory>
+#include <new>
+#include <thread>
 
 namespace TE {
 
+std::atomic<AllocatorEpoch*> g_allocatorEpoch{nullptr};
+
 namespace {
 
+constexpr std::size_t DefaultInitialBytes = 256ull * 1024ull * 1024ull;
+
+// 仅保护纪元的创建/退役（慢路径），分配/释放热路径不再加锁
 std::mutex g_memoryMutex;
-std::shared_ptr<TlsfAllocator> g_allocator;
+std::uint64_t g_nextGeneration = 1;
+AllocatorEpoch* g_retiredEpochs = nullptr;
+MemoryHeapConfig g_heapConfig{};
+std::atomic<bool> g_threadCacheEnabled{true};
+
+// 轨迹记录时 realloc 只记一条事件：其内部经由前端的 alloc/free 不再单独记录
+thread_local bool t_inTracedRealloc = false;
+
+// 最内层 MemoryTagScope 的 tag（外层值由各作用域对象保存，构成按线程的栈）
+thread_local MemoryTag t_scopeTag = MemoryTag::Unknown;
 
-std::shared_ptr<TlsfAllocator> GetAllocatorSnapshot()
+// ==================== 纪元读端登记 ====================
+
+// 每线程一个读端记录。记录直接向 C 运行时申请、永不释放（链表只增不减，退役方无锁遍历），
+// 线程退出时交还，由之后登记的线程复用
+struct alignas(64) EpochReader
 {
-    std::scoped_lock lock(g_memoryMutex);
-    return g_allocator;
+    std::atomic<std::uint64_t> Sequence{0}; // 奇数：正处于读区间
+    std::atomic<bool> InUse{false};
+    EpochReader* Next = nullptr;
+};
+
+std::atomic<EpochReader*> g_epochReaders{nullptr};
+
+// 已交还记录的线程（退出阶段其它线程局部对象的析构仍可能释放内存）改用共享计数，进出各一次原子读改写
+std::atomic<std::uint32_t> g_unregisteredEpochReaders{0};
+
+// 进程级屏障可用时读端只需编译器屏障；只会由 false 变为 true
+std::atomic<bool> g_epochReadAsymmetric{false};
+
+thread_local EpochReader* t_epochReader = nullptr;
+thread_local std::uint32_t t_epochReadDepth = 0;
+thread_local bool t_epochReaderReleased = false;
+
+// 线程退出时交还读端记录
+struct EpochReaderExitHook
+{
+    bool Armed = false;
+
+    ~EpochReaderExitHook()
+    {
+        if (t_epochReader)
+        {
+            t_epochReader->InUse.store(false, std::memory_order_release);
+            t_epochReader = nullptr;
+        }
+        t_epochReaderReleased = true;
+    }
+};
+
+thread_local EpochReaderExitHook t_epochReaderExitHook;
+
+// 慢路径：复用空闲记录或新建一个；线程已进入退出阶段或申请失败时返回 nullptr
+EpochReader* AcquireEpochReader()
+{
+    if (t_epochReaderReleased)
+    {
+        return nullptr;
+    }
+
+    EpochReader* reader = nullptr;
+    for (EpochReader* it = g_epochReaders.load(std::memory_order_acquire); it; it = it->Next)
+    {
+        bool expected = false;
+        if (!it->InUse.load(std::memory_order_relaxed) &&
+            it->InUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            reader = it;
+            break;
+        }
+    }
+
+    if (!reader)
+    {
+        // 开启全局 new/delete 覆盖时 operator new 会重入 MemAlloc；记录永不释放，手动对齐即可
+        void* raw = std::malloc(sizeof(EpochReader) + alignof(EpochReader));
+        if (!raw)
+        {
+            return nullptr;
+        }
+        const auto address = (reinterpret_cast<std::uintptr_t>(raw) + alignof(EpochReader) - 1) &
+                             ~static_cast<std::uintptr_t>(alignof(EpochReader) - 1);
+        reader = new (reinterpret_cast<void*>(address)) EpochReader();
+        reader->InUse.store(true, std::memory_order_relaxed);
+
+        EpochReader* head = g_epochReaders.load(std::memory_order_relaxed);
+        do
+        {
+            reader->Next = head;
+        } while (!g_epochReaders.compare_exchange_weak(head, reader, std::memory_order_release,
+                                                       std::memory_order_relaxed));
+    }
+
+    t_epochReader = reader;
+    t_epochReaderExitHook.Armed = true;
+    return reader;
 }
 
-std::shared_ptr<TlsfAllocator> GetOrCreateAllocator(std::size_t initialBytes = 256ull * 1024ull * 1024ull)
+// 宽限期：返回时，撤下发布指针之前进入读区间的线程都已离开该读区间。
+// 调用方不得持有 g_memoryMutex（读区间内的线程可能正在等它惰性创建新纪元）
+void WaitForAllocatorEpochReaders()
 {
+    // 与读端的 "序号 + 1 → 屏障 → 加载纪元" 配对：之后仍读到旧纪元的线程，其奇数序号此时必然可见
+    ProcessMemoryBarrier();
+
+    for (EpochReader* reader = g_epochReaders.load(std::memory_order_acquire); reader; reader = reader->Next)
+    {
+        if (reader == t_epochReader)
+        {
+            continue;
+        }
+        // 序号为偶数即处于静止点；奇数则等它变化一次（离开该读区间），不必等到偶数
+        const std::uint64_t sequence = reader->Sequence.load(std::memory_order_acquire);
+        if ((sequence & 1u) == 0)
+        {
+            continue;
+        }
+        while (reader->Sequence.load(std::memory_order_acquire) == sequence)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    while (g_unregisteredEpochReaders.load(std::memory_order_acquire) != 0)
+    {
+        std::this_thread::yield();
+    }
+}
+
+// 调用方需持有 g_memoryMutex。
+// 控制块直接向 C 运行时申请：开启全局 new/delete 覆盖时 operator new 会重入 MemAlloc。
+AllocatorEpoch* PublishEpochLocked(std::size_t initialBytes)
+{
+    // 首次发布前尝试注册进程级屏障；成功后读端改用编译器屏障
+    if (!g_epochReadAsymmetric.load(std::memory_order_relaxed) && InitProcessMemoryBarrier())
+    {
+        g_epochReadAsymmetric.store(true, std::memory_order_relaxed);
+    }
+
+    void* storage = std::malloc(sizeof(AllocatorEpoch));
+    if (!storage)
+    {
+        return nullptr;
+    }
+    auto* epoch = new (storage) AllocatorEpoch(initialBytes, g_heapConfig, g_nextGeneration++);
+    g_allocatorEpoch.store(epoch, std::memory_order_release);
+    return epoch;
+}
+
+// 撤下发布指针 → 宽限期 → 释放池与 slab 区，控制块挂入退役链表
+void RetireAllocatorEpoch()
+{
+    AllocatorEpoch* epoch = nullptr;
+    {
+        std::scoped_lock lock(g_memoryMutex);
+        epoch = g_allocatorEpoch.exchange(nullptr, std::memory_order_seq_cst);
+    }
+    if (!epoch)
+    {
+        return;
+    }
+
+    WaitForAllocatorEpochReaders();
+    epoch->Allocator.Retire();
+    epoch->Slabs.Retire();
+
     std::scoped_lock lock(g_memoryMutex);
-    if (!g_allocator)
+    epoch->NextRetired = g_retiredEpochs;
+    g_retiredEpochs = epoch;
+}
+
+// 进程退出时回收全部纪元控制块（此后 MemFree 看到空指针直接返回）
+struct EpochReaper
+{
+    ~EpochReaper()
+    {
+        RetireAllocatorEpoch();
+        std::scoped_lock lock(g_memoryMutex);
+        while (g_retiredEpochs)
+        {
+            AllocatorEpoch* next = g_retiredEpochs->NextRetired;
+            g_retiredEpochs->~AllocatorEpoch();
+            std::free(g_retiredEpochs);
+            g_retiredEpochs = next;
+        }
+    }
+};
+
+EpochReaper g_epochReaper;
+
+TlsfAllocator* GetOrCreateAllocator()
+{
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (!epoch)
+    {
+        epoch = LoadOrCreateAllocatorEpoch();
+    }
+    return epoch ? &epoch->Allocator : nullptr;
+}
+
+bool IsThreadCachedBlock(void* ptr, MemoryBlockInfo& outInfo)
+{
+    return QueryAllocation(ptr, outInfo) && outInfo.SizeClass != 0;
+}
+
+// 线程缓存块的 realloc：统一走前端 alloc + memcpy + free，保证统计都经由线程缓存记账
+void* ReallocateThreadCachedBlock(void* ptr, const MemoryBlockInfo& info,
+                                  std::size_t newSize, std::size_t align, MemoryTag tag)
+{
+    if (newSize == 0)
+    {
+        MemFree(ptr);
+        return nullptr;
+    }
+
+    const std::size_t effectiveAlign = (align == 0) ? info.Alignment : align;
+    const MemoryTag effectiveTag = (tag == MemoryTag::Unknown) ? info.Tag : tag;
+
+    void* newPtr = MemAlignedAlloc(newSize, effectiveAlign, effectiveTag);
+    if (!newPtr)
     {
-        g_allocator = std::make_shared<TlsfAllocator>(initialBytes);
+        return nullptr;
     }
-    return g_allocator;
+    std::memcpy(newPtr, ptr, static_cast<std::size_t>(std::min<std::uint64_t>(info.RequestedBytes, newSize)));
+    MemFree(ptr);
+    return newPtr;
+}
+
+// realloc 主体（不含轨迹记录）
+void* ReallocateUntraced(void* ptr, std::size_t newSize, std::size_t align, MemoryTag tag)
+{
+    AllocatorEpochReadScope epochScope;
+
+    MemoryBlockInfo info;
+    if (ptr && LoadAllocatorEpoch() && IsThreadCachedBlock(ptr, info))
+    {
+        return ReallocateThreadCachedBlock(ptr, info, newSize, align, tag);
+    }
+
+    TlsfAllocator* alloc = GetOrCreateAllocator();
+    if (!alloc)
+    {
+        return nullptr;
+    }
+
+    // 采样分析器把 realloc 视为一次释放 + 一次分配（线程缓存块在上面经由 MemAlignedAlloc/MemFree 记录）
+    const bool profiling = g_memoryProfilerActive.load(std::memory_order_relaxed);
+    if (profiling)
+    {
+        MemoryProfilerOnFree(ptr);
+    }
+    void* newPtr = alloc->Reallocate(ptr, newSize, align, tag);
+    if (profiling && newPtr)
+    {
+        MemoryProfilerOnAlloc(newPtr, newSize, tag);
+    }
+    if (g_frameAllocGuardActive.load(std::memory_order_relaxed) && newPtr)
+    {
+        FrameAllocationGuardOnAlloc(newSize, tag);
+    }
+    if (g_memoryBudgetPending.load(std::memory_order_relaxed))
+    {
+        MemoryBudgetDispatch();
+    }
+    return newPtr;
+}
+
+// 释放主体：size 为 0 表示未知
+void FreeWithSize(void* ptr, std::size_t size)
+{
+    AllocatorEpochReadScope epochScope;
+
+    // 分配器已关闭时块所在内存已归还 OS，不能再读取块头
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (!ptr || !epoch)
+    {
+        return;
+    }
+    if (g_memoryProfilerActive.load(std::memory_order_relaxed))
+    {
+        MemoryProfilerOnFree(ptr);
+    }
+    if (g_memoryTraceActive.load(std::memory_order_relaxed) && !t_inTracedRealloc)
+    {
+        MemoryTraceOnFree(ptr);
+    }
+    if (ThreadAllocCache::Free(epoch, ptr, size))
+    {
+        return;
+    }
+    epoch->Allocator.Free(ptr);
 }
 
 } // namespace
 
-void MemoryInit(std::size_t initialBytes)
+void EnterAllocatorEpochRead()
+{
+    if (t_epochReadDepth++ != 0)
+    {
+        return;
+    }
+
+    EpochReader* reader = t_epochReader;
+    if (!reader)
+    {
+        reader = AcquireEpochReader();
+        if (!reader)
+        {
+            g_unregisteredEpochReaders.fetch_add(1, std::memory_order_seq_cst);
+            return;
+        }
+    }
+
+    // 只有本线程写自己的序号；序号的写入必须先于随后对 g_allocatorEpoch 的加载对退役方可见
+    reader->Sequence.store(reader->Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (g_epochReadAsymmetric.load(std::memory_order_relaxed))
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+    else
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+void ExitAllocatorEpochRead()
+{
+    if (--t_epochReadDepth != 0)
+    {
+        return;
+    }
+
+    if (EpochReader* reader = t_epochReader)
+    {
+        reader->Sequence.store(reader->Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    else
+    {
+        g_unregisteredEpochReaders.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+bool QueryAllocation(void* ptr, MemoryBlockInfo& outInfo)
+{
+    AllocatorEpochReadScope epochScope;
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (epoch && epoch->Slabs.Contains(ptr))
+    {
+        SmallSlabAllocator::QueryBlock(ptr, outInfo);
+        return true;
+    }
+    return TlsfAllocator::QueryBlock(ptr, outInfo);
+}
+
+void SetAllocationSampled(void* ptr, bool sampled)
+{
+    AllocatorEpochReadScope epochScope;
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (epoch && epoch->Slabs.Contains(ptr))
+    {
+        SmallSlabAllocator::SetBlockSampled(ptr, sampled);
+        return;
+    }
+    TlsfAllocator::SetBlockSampled(ptr, sampled);
+}
+
+AllocatorEpoch* LoadOrCreateAllocatorEpoch()
 {
     std::scoped_lock lock(g_memoryMutex);
-    g_allocator = g_allocator ? g_allocator : std::make_shared<TlsfAllocator>(initialBytes);
+    AllocatorEpoch* epoch = g_allocatorEpoch.load(std::memory_order_acquire);
+    return epoch ? epoch : PublishEpochLocked(DefaultInitialBytes);
+}
+
+void MemorySetHeapConfig(const MemoryHeapConfig& config)
+{
+    std::scoped_lock lock(g_memoryMutex);
+    g_heapConfig = config;
+}
+
+MemoryHeapConfig MemoryGetHeapConfig()
+{
+    std::scoped_lock lock(g_memoryMutex);
+    return g_heapConfig;
+}
+
+void MemoryInit(std::size_t initialBytes)
+{
+    {
+        std::scoped_lock lock(g_memoryMutex);
+        if (!g_allocatorEpoch.load(std::memory_order_acquire))
+        {
+            (void)PublishEpochLocked(initialBytes);
+        }
+    }
+
+    // 录制真实工作负载供 AllocReplayBench 回放：TE_MEMORY_TRACE=<文件路径>
+    const char* tracePath = std::getenv("TE_MEMORY_TRACE");
+    if (tracePath && *tracePath && !MemoryTraceIsActive())
+    {
+        (void)MemoryTraceStart(tracePath);
+    }
 }
 
 void MemoryShutdown()
 {
-    std::shared_ptr<TlsfAllocator> old;
+    MemoryProfilerOnShutdown();
+    MemoryTraceStop();
+
+    // 对象池的 chunk 先按正常路径归还，避免池在新纪元中继续切分已释放的内存
+    FixedSizePool::ReleaseAllPools();
+
+    // 调用线程的缓存块先归还；其它线程的缓存按纪元失效，随旧分配器一并释放
+    {
+        AllocatorEpochReadScope epochScope;
+        ThreadAllocCache::Flush();
+    }
+
+    RetireAllocatorEpoch();
+
     std::scoped_lock lock(g_memoryMutex);
-    old.swap(g_allocator);
+    MemoryBudgetOnShutdown();
+}
+
+void MemorySetThreadCacheEnabled(bool enabled)
+{
+    g_threadCacheEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool MemoryIsThreadCacheEnabled()
+{
+    return g_threadCacheEnabled.load(std::memory_order_relaxed);
+}
+
+void MemoryFlushThreadCache()
+{
+    AllocatorEpochReadScope epochScope;
+    ThreadAllocCache::Flush();
+}
+
+std::size_t MemoryTrim()
+{
+    AllocatorEpochReadScope epochScope;
+
+    // 调用线程缓存的块先归还，才可能并入大的空闲跨度
+    ThreadAllocCache::Flush();
+
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    return epoch ? epoch->Allocator.Trim() + epoch->Slabs.Trim() : 0;
+}
+
+std::size_t MemoryTrimIdle()
+{
+    AllocatorEpochReadScope epochScope;
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    return epoch ? epoch->Allocator.TrimIdle() + epoch->Slabs.TrimIdle() : 0;
 }
 
 void* MemAlloc(std::size_t size, MemoryTag tag)
@@ -51,24 +492,91 @@ void* MemAlloc(std::size_t size, MemoryTag tag)
     return MemAlignedAlloc(size, 0, tag);
 }
 
+MemoryTag MemoryPushScopeTag(MemoryTag tag)
+{
+    const MemoryTag previous = t_scopeTag;
+    t_scopeTag = tag;
+    return previous;
+}
+
+void MemoryPopScopeTag(MemoryTag previous)
+{
+    t_scopeTag = previous;
+}
+
+MemoryTag MemoryGetScopeTag()
+{
+    return t_scopeTag;
+}
+
 void* MemAlignedAlloc(std::size_t size, std::size_t align, MemoryTag tag)
 {
-    auto alloc = GetOrCreateAllocator();
-    if (!alloc)
+#if TE_ENABLE_MEMORY_SCOPES
+    // 未指定归属（Unknown / 全局 new 的 STL）时继承最内层作用域
+    if ((tag == MemoryTag::Unknown || tag == MemoryTag::STL) && t_scopeTag != MemoryTag::Unknown)
     {
-        return nullptr;
+        tag = t_scopeTag;
+    }
+#endif
+
+    AllocatorEpochReadScope epochScope;
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    void* ptr = nullptr;
+
+    if (g_threadCacheEnabled.load(std::memory_order_relaxed) && ThreadAllocCache::CanServe(size, align))
+    {
+        ptr = ThreadAllocCache::Allocate(epoch, size, tag);
+    }
+
+    if (!ptr)
+    {
+        if (!epoch)
+        {
+            epoch = LoadOrCreateAllocatorEpoch();
+            if (!epoch)
+            {
+                return nullptr;
+            }
+        }
+        ptr = epoch->Allocator.Allocate(size, align, tag);
+    }
+
+    if (g_memoryProfilerActive.load(std::memory_order_relaxed))
+    {
+        MemoryProfilerOnAlloc(ptr, size, tag);
+    }
+    if (g_frameAllocGuardActive.load(std::memory_order_relaxed) && ptr)
+    {
+        FrameAllocationGuardOnAlloc(size, tag);
+    }
+    if (g_memoryTraceActive.load(std::memory_order_relaxed) && ptr && !t_inTracedRealloc)
+    {
+        MemoryTraceOnAlloc(ptr, size, align, tag);
+    }
+    if (g_memoryBudgetPending.load(std::memory_order_relaxed))
+    {
+        MemoryBudgetDispatch();
     }
-    return alloc->Allocate(size, align, tag);
+    return ptr;
 }
 
 void* MemAlignedRealloc(void* ptr, std::size_t newSize, std::size_t align, MemoryTag tag)
 {
-    auto alloc = GetOrCreateAllocator();
-    if (!alloc)
+    if (g_memoryTraceActive.load(std::memory_order_relaxed) && !t_inTracedRealloc)
     {
-        return nullptr;
+        const std::uint64_t startNs = MemoryTraceNow();
+        t_inTracedRealloc = true;
+        void* newPtr = ReallocateUntraced(ptr, newSize, align, tag);
+        t_inTracedRealloc = false;
+
+        // 失败（原块仍有效）不记录；newSize 为 0 时记为释放
+        if (newPtr || newSize == 0)
+        {
+            MemoryTraceOnRealloc(startNs, ptr, newPtr, newSize, align, tag);
+        }
+        return newPtr;
     }
-    return alloc->Reallocate(ptr, newSize, align, tag);
+    return ReallocateUntraced(ptr, newSize, align, tag);
 }
 
 void* MemRealloc(void* ptr, std::size_t newSize, MemoryTag tag)
@@ -78,23 +586,45 @@ void* MemRealloc(void* ptr, std::size_t newSize, MemoryTag tag)
 
 void MemFree(void* ptr)
 {
-    auto alloc = GetAllocatorSnapshot();
-    if (!alloc)
-    {
-        return;
-    }
-    alloc->Free(ptr);
+    FreeWithSize(ptr, 0);
+}
+
+void MemFreeSized(void* ptr, std::size_t size)
+{
+    FreeWithSize(ptr, size);
 }
 
 MemoryStats GetMemoryStats()
 {
-    auto alloc = GetAllocatorSnapshot();
-    if (!alloc)
+    AllocatorEpochReadScope epochScope;
+
+    // 只能折算调用线程的增量；其它线程的增量在其补货/归还/退出时折算
+    ThreadAllocCache::FoldStats();
+
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (!epoch)
     {
         return {};
     }
-    return alloc->GetStats();
+    MemoryStats stats = epoch->Allocator.GetStats();
+    epoch->Slabs.FillStats(stats);
+    for (std::size_t i = 0; i < stats.PerTag.size(); ++i)
+    {
+        stats.PerTag[i].BudgetBytes = MemoryBudgetGetBytes(i);
+    }
+    return stats;
 }
 
-} // namespace TE
+HeapFragmentationReport GetHeapFragmentationReport()
+{
+    HeapFragmentationReport report;
+    AllocatorEpochReadScope epochScope;
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (epoch)
+    {
+        epoch->Allocator.BuildFragmentationReport(report);
+    }
+    return report;
+}
 
+} // namespace TE
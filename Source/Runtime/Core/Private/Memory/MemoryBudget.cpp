@@ -0,0 +1,235 @@
+// ToyEngine Core Module
+// 标签预算与水位线回调实现
+
+#include "Memory/Memory.h"
+
+#include "Memory/MemoryInternal.h"
+#include "Memory/ThreadAllocCache.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace TE {
+
+std::atomic<bool> g_memoryBudgetArmed{false};
+std::atomic<bool> g_memoryBudgetPending{false};
+
+namespace {
+
+constexpr std::size_t TagCount = static_cast<std::size_t>(MemoryTag::Count);
+
+enum BudgetLevel : std::uint8_t
+{
+    LevelNormal = 0,
+    LevelHighWatermark = 1,
+    LevelOverBudget = 2,
+};
+
+constexpr std::uint8_t PendingHighWatermark = 1u << 0;
+constexpr std::uint8_t PendingOverBudget = 1u << 1;
+
+// 检查点（可能位于分配器锁内）只访问这里的原子状态
+struct BudgetSlot
+{
+    std::atomic<std::uint64_t> BudgetBytes{0};
+    std::atomic<std::uint64_t> WatermarkBytes{0};
+    std::atomic<std::uint8_t> Level{LevelNormal};
+    std::atomic<std::uint8_t> PendingMask{0};
+    std::atomic<std::uint64_t> PendingBytes{0};
+};
+
+std::array<BudgetSlot, TagCount> g_slots{};
+
+// 回调配置只在设置与派发（慢路径）时读取
+std::mutex g_budgetMutex;
+std::array<MemoryTagBudget, TagCount> g_budgets{};
+
+thread_local bool t_inDispatch = false;
+
+// 回落到阈值的 15/16 以下才降级，避免在阈值附近抖动时反复回调
+std::uint64_t ReArmBytes(std::uint64_t threshold)
+{
+    return threshold - threshold / 16;
+}
+
+std::uint8_t ClassifyLevel(const BudgetSlot& slot, std::uint8_t current, std::uint64_t bytes)
+{
+    const std::uint64_t budget = slot.BudgetBytes.load(std::memory_order_relaxed);
+    const std::uint64_t watermark = slot.WatermarkBytes.load(std::memory_order_relaxed);
+
+    if (bytes >= budget)
+    {
+        return LevelOverBudget;
+    }
+    if (current == LevelOverBudget && bytes >= ReArmBytes(budget))
+    {
+        return LevelOverBudget;
+    }
+    if (bytes >= watermark)
+    {
+        return LevelHighWatermark;
+    }
+    if (current >= LevelHighWatermark && bytes >= ReArmBytes(watermark))
+    {
+        return LevelHighWatermark;
+    }
+    return LevelNormal;
+}
+
+} // namespace
+
+void MemoryBudgetOnTagBytes(std::size_t tagIndex, std::uint64_t bytes)
+{
+    if (tagIndex >= TagCount)
+    {
+        return;
+    }
+    BudgetSlot& slot = g_slots[tagIndex];
+    if (slot.BudgetBytes.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+
+    std::uint8_t current = slot.Level.load(std::memory_order_relaxed);
+    std::uint8_t next = ClassifyLevel(slot, current, bytes);
+    while (next != current && !slot.Level.compare_exchange_weak(current, next, std::memory_order_relaxed))
+    {
+        next = ClassifyLevel(slot, current, bytes);
+    }
+    if (next <= current)
+    {
+        return;
+    }
+
+    // 向上越线：挂起事件，由分配前端在锁外派发
+    std::uint8_t mask = 0;
+    if (current < LevelHighWatermark)
+    {
+        mask |= PendingHighWatermark;
+    }
+    if (next == LevelOverBudget)
+    {
+        mask |= PendingOverBudget;
+    }
+    slot.PendingBytes.store(bytes, std::memory_order_relaxed);
+    slot.PendingMask.fetch_or(mask, std::memory_order_release);
+    g_memoryBudgetPending.store(true, std::memory_order_release);
+}
+
+void MemoryBudgetDispatch()
+{
+    if (t_inDispatch || !g_memoryBudgetPending.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    t_inDispatch = true;
+
+    std::array<MemoryTagBudget, TagCount> budgets;
+    {
+        std::scoped_lock lock(g_budgetMutex);
+        budgets = g_budgets;
+    }
+
+    for (std::size_t i = 0; i < TagCount; ++i)
+    {
+        const std::uint8_t mask = g_slots[i].PendingMask.exchange(0, std::memory_order_acquire);
+        const MemoryTagBudget& budget = budgets[i];
+        if (mask == 0 || !budget.Callback)
+        {
+            continue;
+        }
+
+        const auto tag = static_cast<MemoryTag>(i);
+        const std::uint64_t bytes = g_slots[i].PendingBytes.load(std::memory_order_relaxed);
+        if (mask & PendingHighWatermark)
+        {
+            budget.Callback(tag, MemoryBudgetEvent::HighWatermark, bytes, budget.BudgetBytes, budget.UserData);
+        }
+        if (mask & PendingOverBudget)
+        {
+            budget.Callback(tag, MemoryBudgetEvent::OverBudget, bytes, budget.BudgetBytes, budget.UserData);
+        }
+    }
+
+    t_inDispatch = false;
+}
+
+std::uint64_t MemoryBudgetGetBytes(std::size_t tagIndex)
+{
+    return tagIndex < TagCount ? g_slots[tagIndex].BudgetBytes.load(std::memory_order_relaxed) : 0;
+}
+
+void MemoryBudgetOnShutdown()
+{
+    for (auto& slot : g_slots)
+    {
+        slot.Level.store(LevelNormal, std::memory_order_relaxed);
+        slot.PendingMask.store(0, std::memory_order_relaxed);
+    }
+    g_memoryBudgetPending.store(false, std::memory_order_relaxed);
+}
+
+void MemorySetTagBudget(MemoryTag tag, const MemoryTagBudget& budget)
+{
+    const auto idx = static_cast<std::size_t>(tag);
+    if (idx >= TagCount)
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock lock(g_budgetMutex);
+        MemoryTagBudget& stored = g_budgets[idx];
+        stored = budget;
+        stored.HighWatermark = std::clamp(budget.HighWatermark, 0.0f, 1.0f);
+
+        BudgetSlot& slot = g_slots[idx];
+        const auto watermark = static_cast<std::uint64_t>(
+            static_cast<double>(stored.BudgetBytes) * static_cast<double>(stored.HighWatermark));
+        slot.WatermarkBytes.store(watermark, std::memory_order_relaxed);
+        slot.BudgetBytes.store(stored.BudgetBytes, std::memory_order_relaxed);
+        slot.Level.store(LevelNormal, std::memory_order_relaxed);
+        slot.PendingMask.store(0, std::memory_order_relaxed);
+
+        const bool anyArmed = std::any_of(g_budgets.begin(), g_budgets.end(),
+            [](const MemoryTagBudget& b) { return b.BudgetBytes != 0; });
+        g_memoryBudgetArmed.store(anyArmed, std::memory_order_relaxed);
+    }
+
+    MemoryCheckBudgets();
+}
+
+MemoryTagBudget MemoryGetTagBudget(MemoryTag tag)
+{
+    const auto idx = static_cast<std::size_t>(tag);
+    if (idx >= TagCount)
+    {
+        return {};
+    }
+    std::scoped_lock lock(g_budgetMutex);
+    return g_budgets[idx];
+}
+
+void MemoryCheckBudgets()
+{
+    if (!g_memoryBudgetArmed.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    AllocatorEpochReadScope epochScope;
+
+    // 调用线程缓存中的增量先折算；其它线程的增量在其折算点上报
+    ThreadAllocCache::FoldStats();
+
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (epoch)
+    {
+        epoch->Allocator.GetCounters().CheckAll();
+    }
+    MemoryBudgetDispatch();
+}
+
+} // namespace TE
@@ -0,0 +1,208 @@
+// ToyEngine Core Module
+// 分片原子内存计数器实现
+
+#include "Memory/MemoryCounters.h"
+
+#include "Memory/MemoryInternal.h"
+
+#include <algorithm>
+
+namespace TE {
+
+namespace {
+
+constexpr std::uint32_t NoShard = ~0u;
+
+std::atomic<std::uint32_t> g_nextShard{0};
+thread_local std::uint32_t t_shardIndex = NoShard;
+
+// 把一个原子值单调抬到 value（峰值刷新）
+void RaiseTo(std::atomic<std::uint64_t>& target, std::uint64_t value)
+{
+    std::uint64_t observed = target.load(std::memory_order_relaxed);
+    while (observed < value && !target.compare_exchange_weak(observed, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+// 分片字节数从 before 变为 after 时是否跨过了峰值检查边界
+bool CrossedPeakCheck(std::int64_t before, std::int64_t after)
+{
+    constexpr std::int64_t Shift = 16; // log2(MemoryCounters::PeakCheckBytes)
+    static_assert((1ull << Shift) == MemoryCounters::PeakCheckBytes);
+    return (before >> Shift) != (after >> Shift);
+}
+
+} // namespace
+
+void MemoryStatsDelta::OnAlloc(MemoryTag tag, std::uint64_t bytes)
+{
+    const auto idx = static_cast<std::size_t>(tag);
+    if (idx < TagBytes.size())
+    {
+        TagBytes[idx] += static_cast<std::int64_t>(bytes);
+        TagAllocCount[idx] += 1;
+    }
+    CurrentBytes += static_cast<std::int64_t>(bytes);
+    AllocCount += 1;
+}
+
+void MemoryStatsDelta::OnFree(MemoryTag tag, std::uint64_t bytes)
+{
+    const auto idx = static_cast<std::size_t>(tag);
+    if (idx < TagBytes.size())
+    {
+        TagBytes[idx] -= static_cast<std::int64_t>(bytes);
+        TagFreeCount[idx] += 1;
+    }
+    CurrentBytes -= static_cast<std::int64_t>(bytes);
+    FreeCount += 1;
+}
+
+MemoryCounters::Shard& MemoryCounters::LocalShard()
+{
+    std::uint32_t index = t_shardIndex;
+    if (index == NoShard)
+    {
+        index = g_nextShard.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+        t_shardIndex = index;
+    }
+    return m_shards[index];
+}
+
+void MemoryCounters::OnAlloc(MemoryTag tag, std::uint64_t bytes)
+{
+    const auto idx = static_cast<std::size_t>(tag);
+    if (idx >= TagCount)
+    {
+        return;
+    }
+
+    Shard& shard = LocalShard();
+    const auto signedBytes = static_cast<std::int64_t>(bytes);
+    const std::int64_t before = shard.Bytes[idx].fetch_add(signedBytes, std::memory_order_relaxed);
+    shard.AllocCount[idx].fetch_add(1, std::memory_order_relaxed);
+
+    if (bytes >= PeakCheckBytes || CrossedPeakCheck(before, before + signedBytes))
+    {
+        CheckTag(idx);
+        CheckTotal();
+    }
+}
+
+void MemoryCounters::OnFree(MemoryTag tag, std::uint64_t bytes)
+{
+    const auto idx = static_cast<std::size_t>(tag);
+    if (idx >= TagCount)
+    {
+        return;
+    }
+
+    Shard& shard = LocalShard();
+    shard.Bytes[idx].fetch_sub(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+    shard.FreeCount[idx].fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryCounters::Apply(const MemoryStatsDelta& delta)
+{
+    Shard& shard = LocalShard();
+    bool grew = false;
+    for (std::size_t i = 0; i < TagCount; ++i)
+    {
+        if (delta.TagAllocCount[i] == 0 && delta.TagFreeCount[i] == 0)
+        {
+            continue;
+        }
+        shard.Bytes[i].fetch_add(delta.TagBytes[i], std::memory_order_relaxed);
+        shard.AllocCount[i].fetch_add(delta.TagAllocCount[i], std::memory_order_relaxed);
+        shard.FreeCount[i].fetch_add(delta.TagFreeCount[i], std::memory_order_relaxed);
+
+        // 增量在线程本地已抵消了块内的 alloc/free，峰值只能在折算点近似
+        if (delta.TagBytes[i] > 0)
+        {
+            CheckTag(i);
+            grew = true;
+        }
+    }
+    if (grew)
+    {
+        CheckTotal();
+    }
+}
+
+std::uint64_t MemoryCounters::GetTagBytes(std::size_t tagIndex) const
+{
+    std::int64_t sum = 0;
+    for (const Shard& shard : m_shards)
+    {
+        sum += shard.Bytes[tagIndex].load(std::memory_order_relaxed);
+    }
+    return sum > 0 ? static_cast<std::uint64_t>(sum) : 0;
+}
+
+void MemoryCounters::CheckTag(std::size_t tagIndex)
+{
+    const std::uint64_t bytes = GetTagBytes(tagIndex);
+    RaiseTo(m_tagPeak[tagIndex], bytes);
+
+    if (g_memoryBudgetArmed.load(std::memory_order_relaxed))
+    {
+        MemoryBudgetOnTagBytes(tagIndex, bytes);
+    }
+}
+
+void MemoryCounters::CheckTotal()
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < TagCount; ++i)
+    {
+        total += GetTagBytes(i);
+    }
+    RaiseTo(m_totalPeak, total);
+}
+
+void MemoryCounters::CheckAll()
+{
+    for (std::size_t i = 0; i < TagCount; ++i)
+    {
+        CheckTag(i);
+    }
+    CheckTotal();
+}
+
+void MemoryCounters::Snapshot(MemoryStats& outStats)
+{
+    outStats.CurrentBytes = 0;
+    outStats.AllocCount = 0;
+    outStats.FreeCount = 0;
+
+    for (std::size_t i = 0; i < TagCount; ++i)
+    {
+        std::int64_t bytes = 0;
+        std::uint64_t allocs = 0;
+        std::uint64_t frees = 0;
+        for (const Shard& shard : m_shards)
+        {
+            bytes += shard.Bytes[i].load(std::memory_order_relaxed);
+            allocs += shard.AllocCount[i].load(std::memory_order_relaxed);
+            frees += shard.FreeCount[i].load(std::memory_order_relaxed);
+        }
+
+        auto& t = outStats.PerTag[i];
+        t.CurrentBytes = bytes > 0 ? static_cast<std::uint64_t>(bytes) : 0;
+        t.AllocCount = allocs;
+        t.FreeCount = frees;
+
+        RaiseTo(m_tagPeak[i], t.CurrentBytes);
+        t.PeakBytes = std::max(m_tagPeak[i].load(std::memory_order_relaxed), t.CurrentBytes);
+
+        outStats.CurrentBytes += t.CurrentBytes;
+        outStats.AllocCount += allocs;
+        outStats.FreeCount += frees;
+    }
+
+    RaiseTo(m_totalPeak, outStats.CurrentBytes);
+    outStats.PeakBytes = std::max(m_totalPeak.load(std::memory_order_relaxed), outStats.CurrentBytes);
+}
+
+} // namespace TE
@@ -0,0 +1,81 @@
+// ToyEngine Core Module
+// 分片原子内存计数器 —— 写端按线程分片无锁累加，读端汇总
+
+#pragma once
+
+#include "Memory/Memory.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace TE {
+
+// 线程本地缓存在本地累积、批量折算进计数器的统计增量
+struct MemoryStatsDelta
+{
+    std::int64_t CurrentBytes = 0;
+    std::uint64_t AllocCount = 0;
+    std::uint64_t FreeCount = 0;
+
+    std::array<std::int64_t, static_cast<std::size_t>(MemoryTag::Count)> TagBytes{};
+    std::array<std::uint64_t, static_cast<std::size_t>(MemoryTag::Count)> TagAllocCount{};
+    std::array<std::uint64_t, static_cast<std::size_t>(MemoryTag::Count)> TagFreeCount{};
+
+    void OnAlloc(MemoryTag tag, std::uint64_t bytes);
+    void OnFree(MemoryTag tag, std::uint64_t bytes);
+    [[nodiscard]] bool IsEmpty() const { return AllocCount == 0 && FreeCount == 0; }
+};
+
+/// <summary>
+/// 按 tag 统计的分片计数器：
+/// - 每个线程首次记账时轮转分配一个分片（缓存行对齐），之后只对该分片做 relaxed 原子加减，不持有分配器锁；
+/// - 块可能在 A 分片分配、B 分片释放，单个分片的字节数可以为负，只有各分片之和有意义；
+/// - 读端（GetMemoryStats / 预算检查）汇总全部分片；总量由各 tag 求和得到，不单独计数；
+/// - 峰值只在检查点更新：分片字节数跨过 PeakCheckBytes 边界、单次记账不小于该值、
+///   线程缓存折算以及读端汇总时，因此是近似值（每个分片最多漏记 PeakCheckBytes）。
+/// </summary>
+class MemoryCounters final
+{
+public:
+    static constexpr std::size_t ShardCount = 16;
+    static constexpr std::size_t TagCount = static_cast<std::size_t>(MemoryTag::Count);
+    static constexpr std::uint64_t PeakCheckBytes = 64ull * 1024ull;
+
+    void OnAlloc(MemoryTag tag, std::uint64_t bytes);
+    void OnFree(MemoryTag tag, std::uint64_t bytes);
+
+    // 折算线程缓存的增量（同样写入调用线程的分片）
+    void Apply(const MemoryStatsDelta& delta);
+
+    // 汇总全部分片写入 stats 的计数字段（不含堆占用字段），并顺带刷新峰值
+    void Snapshot(MemoryStats& outStats);
+
+    // 显式检查点：刷新全部 tag 的峰值并汇报预算（MemoryCheckBudgets）
+    void CheckAll();
+
+    // 单个 tag 当前字节数（各分片之和，下限为 0）
+    [[nodiscard]] std::uint64_t GetTagBytes(std::size_t tagIndex) const;
+
+private:
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<std::int64_t>, TagCount> Bytes{};
+        std::array<std::atomic<std::uint64_t>, TagCount> AllocCount{};
+        std::array<std::atomic<std::uint64_t>, TagCount> FreeCount{};
+    };
+
+    [[nodiscard]] Shard& LocalShard();
+
+    // 检查点：按 tag 汇总刷新 tag 峰值、汇报预算；总峰值由全部 tag 之和刷新
+    void CheckTag(std::size_t tagIndex);
+    void CheckTotal();
+
+private:
+    std::array<Shard, ShardCount> m_shards{};
+    std::array<std::atomic<std::uint64_t>, TagCount> m_tagPeak{};
+    std::atomic<std::uint64_t> m_totalPeak{0};
+};
+
+} // namespace TE
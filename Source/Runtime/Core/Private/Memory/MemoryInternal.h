@@ -0,0 +1,118 @@
+// ToyEngine Core Module
+// 内存系统内部接口（仅供 Private/Memory 下的实现文件使用）
+
+#pragma once
+
+#include "Memory/SmallSlabAllocator.h"
+#include "Memory/TlsfAllocator.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace TE {
+
+/// <summary>
+/// 分配器纪元：每次 MemoryInit / 惰性创建发布一个新纪元，MemoryShutdown 将其退役。
+/// - 发布：g_allocatorEpoch 以 release 存储，读端在读区间（AllocatorEpochReadScope）内做一次 acquire 加载；
+/// - 退役：先撤下发布指针，再等待宽限期——每个已登记线程的读区间序号都越过一次静止点
+///   （见 WaitForAllocatorEpochReaders），之后才由 TlsfAllocator::Retire / SmallSlabAllocator::Retire 释放池与 slab 区；
+///   因此在一次 MemAlloc / MemFree 调用之内读到旧纪元的线程，访问的池内存在调用返回前始终有效；
+/// - 回收：控制块（不含池内存）挂入退役链表，进程退出时统一释放。
+///   控制块在进程内不复用，因此指针本身即可作为纪元标识（无 ABA）。
+/// slab 层与 TLSF 堆同属一个纪元：其地址区间在纪元创建时保留，之后只读，供释放路径无锁判断归属。
+/// 宽限期只覆盖调用内部；调用返回的裸指针仍须在 MemoryShutdown 前释放（见 Memory.h）。
+/// </summary>
+struct AllocatorEpoch
+{
+    AllocatorEpoch(std::size_t initialBytes, const MemoryHeapConfig& config, std::uint64_t generation)
+        : Allocator(initialBytes, config)
+        , Slabs(config)
+        , Generation(generation)
+    {}
+
+    TlsfAllocator Allocator;
+    SmallSlabAllocator Slabs;
+    const std::uint64_t Generation = 0;
+    AllocatorEpoch* NextRetired = nullptr;
+};
+
+extern std::atomic<AllocatorEpoch*> g_allocatorEpoch;
+
+// 热路径：一次 acquire 加载；未初始化或已关闭时返回 nullptr。
+// 须位于读区间内，返回的纪元只在读区间结束前有效
+[[nodiscard]] inline AllocatorEpoch* LoadAllocatorEpoch()
+{
+    return g_allocatorEpoch.load(std::memory_order_acquire);
+}
+
+// ==================== 纪元读区间 ====================
+// 每个线程登记一个读端记录，进入最外层读区间时把序号加一（奇数 = 正在使用纪元），离开时再加一。
+// 读端只写本线程的记录：有进程级屏障时只需编译器屏障，否则一次 seq_cst 栅栏。可嵌套
+
+void EnterAllocatorEpochRead();
+void ExitAllocatorEpochRead();
+
+class AllocatorEpochReadScope final
+{
+public:
+    AllocatorEpochReadScope() { EnterAllocatorEpochRead(); }
+    ~AllocatorEpochReadScope() { ExitAllocatorEpochRead(); }
+
+    AllocatorEpochReadScope(const AllocatorEpochReadScope&) = delete;
+    AllocatorEpochReadScope& operator=(const AllocatorEpochReadScope&) = delete;
+};
+
+// 慢路径：按默认大小惰性创建并发布新纪元
+[[nodiscard]] AllocatorEpoch* LoadOrCreateAllocatorEpoch();
+
+// ==================== 块元数据 ====================
+// slab 块没有 AllocHeader：先按当前纪元的 slab 区间分流，其余块解析块头
+
+[[nodiscard]] bool QueryAllocation(void* ptr, MemoryBlockInfo& outInfo);
+void SetAllocationSampled(void* ptr, bool sampled);
+
+// ==================== 采样分析器钩子（MemoryProfiler.cpp） ====================
+// 未开启时调用方只做一次 relaxed 读取；开启后由钩子自行按线程计数决定是否采样
+
+extern std::atomic<bool> g_memoryProfilerActive;
+
+void MemoryProfilerOnAlloc(void* ptr, std::size_t size, MemoryTag tag);
+void MemoryProfilerOnFree(void* ptr);
+
+// MemoryShutdown 调用：按配置写出一次并停止采样
+void MemoryProfilerOnShutdown();
+
+// ==================== 分配轨迹钩子（MemoryTrace.cpp） ====================
+// 分配在返回后、释放在执行前取时间戳，保证跨线程复用同一地址时轨迹中释放先于再分配；
+// realloc 以调用开始时刻记为一条事件，其内部的 alloc/free 不再单独记录
+
+extern std::atomic<bool> g_memoryTraceActive;
+
+[[nodiscard]] std::uint64_t MemoryTraceNow();
+void MemoryTraceOnAlloc(void* ptr, std::size_t size, std::size_t align, MemoryTag tag);
+void MemoryTraceOnRealloc(std::uint64_t startNs, void* oldPtr, void* newPtr,
+                          std::size_t size, std::size_t align, MemoryTag tag);
+void MemoryTraceOnFree(void* ptr);
+
+// ==================== 标签预算钩子（MemoryBudget.cpp） ====================
+// 计数器在检查点汇报 tag 用量（可能持有分配器锁，只做原子状态迁移）；
+// 越线事件挂起后由分配前端在锁外 MemoryBudgetDispatch 调用回调
+
+extern std::atomic<bool> g_memoryBudgetArmed;
+extern std::atomic<bool> g_memoryBudgetPending;
+
+void MemoryBudgetOnTagBytes(std::size_t tagIndex, std::uint64_t bytes);
+void MemoryBudgetDispatch();
+[[nodiscard]] std::uint64_t MemoryBudgetGetBytes(std::size_t tagIndex);
+
+// MemoryShutdown 调用：计数器随纪元清零，越线状态一并复位（预算配置保留）
+void MemoryBudgetOnShutdown();
+
+// ==================== 帧分配守卫钩子（FrameAllocationGuard.cpp） ====================
+// 守卫关闭时调用方只做一次 relaxed 读取；打开期间每次成功的堆分配计数一次
+
+extern std::atomic<bool> g_frameAllocGuardActive;
+
+void FrameAllocationGuardOnAlloc(std::size_t size, MemoryTag tag);
+
+} // namespace TE
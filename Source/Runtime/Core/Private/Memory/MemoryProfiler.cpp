@@ -0,0 +1,560 @@
+// ToyEngine Core Module
+// 采样式分配分析器实现
+
+#include "Memory/MemoryProfiler.h"
+
+#include "Memory/MemoryInternal.h"
+#include "Memory/MemoryUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <execinfo.h>
+#define TE_MEMORY_PROFILER_EXECINFO 1
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#define TE_MEMORY_PROFILER_DEMANGLE 1
+#endif
+
+namespace TE {
+
+std::atomic<bool> g_memoryProfilerActive{false};
+
+namespace {
+
+// 分析器自身的表直接走 C 运行时：开启全局 new/delete 覆盖时不能回到 MemAlloc
+template<typename T>
+struct TMallocAllocator
+{
+    using value_type = T;
+
+    TMallocAllocator() noexcept = default;
+
+    template<typename U>
+    TMallocAllocator(const TMallocAllocator<U>& /*other*/) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        void* p = std::malloc(n * sizeof(T));
+        if (!p)
+        {
+            throw std::bad_alloc{};
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* ptr, std::size_t /*n*/) noexcept
+    {
+        std::free(ptr);
+    }
+
+    template<typename U>
+    bool operator==(const TMallocAllocator<U>& /*other*/) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const TMallocAllocator<U>& /*other*/) const noexcept
+    {
+        return false;
+    }
+};
+
+// 采样点位于 MemoryProfilerOnAlloc / MemAlignedAlloc 之内，这两帧不计入调用栈
+constexpr std::uint32_t SkipFrames = 2;
+
+struct StackKey
+{
+    MemoryTag Tag = MemoryTag::Unknown;
+    std::uint32_t Depth = 0;
+    void* Frames[MemoryProfilerMaxStackDepth] = {};
+
+    bool operator==(const StackKey& other) const
+    {
+        return Tag == other.Tag && Depth == other.Depth &&
+               std::memcmp(Frames, other.Frames, sizeof(void*) * Depth) == 0;
+    }
+};
+
+struct StackKeyHash
+{
+    std::size_t operator()(const StackKey& key) const
+    {
+        // FNV-1a
+        std::uint64_t h = 1469598103934665603ull ^ static_cast<std::uint64_t>(key.Tag);
+        for (std::uint32_t i = 0; i < key.Depth; ++i)
+        {
+            h ^= static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key.Frames[i]));
+            h *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(h);
+    }
+};
+
+struct StackStats
+{
+    std::uint64_t AllocCount = 0;
+    std::uint64_t AllocBytes = 0;
+    std::uint64_t LiveCount = 0;
+    std::uint64_t LiveBytes = 0;
+    double EstimatedAllocBytes = 0.0;
+    double EstimatedLiveBytes = 0.0;
+};
+
+using StackTable = std::unordered_map<StackKey, StackStats, StackKeyHash, std::equal_to<StackKey>,
+                                      TMallocAllocator<std::pair<const StackKey, StackStats>>>;
+
+struct LiveSample
+{
+    StackStats* Stack = nullptr;
+    std::uint64_t Bytes = 0;
+    double EstimatedBytes = 0.0;
+};
+
+using LiveTable = std::unordered_map<void*, LiveSample, std::hash<void*>, std::equal_to<void*>,
+                                     TMallocAllocator<std::pair<void* const, LiveSample>>>;
+
+struct ProfilerState
+{
+    std::mutex Mutex;
+    StackTable Stacks;
+    LiveTable Live;
+    std::uint64_t SampleCount = 0;
+    std::size_t SampleIntervalBytes = 512ull * 1024ull;
+    std::uint32_t MaxStackDepth = 24;
+    char ShutdownDumpPath[512] = {};
+    MemoryProfileFormat ShutdownDumpFormat = MemoryProfileFormat::Pprof;
+};
+
+ProfilerState& GetState()
+{
+    // 不析构：进程退出阶段仍可能有线程在释放内存
+    static ProfilerState* state = new (std::malloc(sizeof(ProfilerState))) ProfilerState();
+    return *state;
+}
+
+// 采样热路径只读这两项，避免为读配置加锁
+std::atomic<std::size_t> g_sampleIntervalBytes{512ull * 1024ull};
+std::atomic<std::uint32_t> g_maxStackDepth{24};
+
+struct ThreadSamplerState
+{
+    std::uint64_t Rng = 0;
+    std::int64_t BytesUntilSample = 0;
+    bool Initialized = false;
+    bool InProfiler = false; // 采样过程中（栈回溯/建表）可能再次分配，防止重入
+};
+
+thread_local ThreadSamplerState t_sampler{};
+
+std::uint64_t NextRandom(std::uint64_t& state)
+{
+    // xorshift64*
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ull;
+}
+
+// 下一个采样点的间距：均值为 interval 的指数分布（泊松过程）
+std::int64_t DrawSampleDistance(ThreadSamplerState& sampler, std::size_t interval)
+{
+    const double u = (static_cast<double>(NextRandom(sampler.Rng) >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+    const double distance = -std::log(u) * static_cast<double>(interval);
+    return static_cast<std::int64_t>(std::min(distance, 1.0e15)) + 1;
+}
+
+// 按泊松采样概率 1 - exp(-size / interval) 反推该样本代表的字节数
+double EstimateBytes(std::size_t size, std::size_t interval)
+{
+    const double ratio = static_cast<double>(size) / static_cast<double>(interval);
+    const double probability = 1.0 - std::exp(-ratio);
+    return probability > 0.0 ? static_cast<double>(size) / probability : static_cast<double>(interval);
+}
+
+std::uint32_t CaptureStack(void** frames, std::uint32_t maxDepth)
+{
+    void* raw[MemoryProfilerMaxStackDepth + SkipFrames];
+    const std::uint32_t want = std::min(maxDepth, MemoryProfilerMaxStackDepth) + SkipFrames;
+#if defined(_WIN32)
+    const auto captured = static_cast<std::uint32_t>(::RtlCaptureStackBackTrace(0, want, raw, nullptr));
+#elif defined(TE_MEMORY_PROFILER_EXECINFO)
+    const int frameCount = ::backtrace(raw, static_cast<int>(want));
+    const auto captured = static_cast<std::uint32_t>(std::max(frameCount, 0));
+#else
+    (void)raw;
+    (void)want;
+    const std::uint32_t captured = 0;
+#endif
+    if (captured <= SkipFrames)
+    {
+        return 0;
+    }
+    const std::uint32_t depth = captured - SkipFrames;
+    std::memcpy(frames, raw + SkipFrames, sizeof(void*) * depth);
+    return depth;
+}
+
+void RecordSample(void* ptr, std::size_t size, MemoryTag tag, std::size_t interval, std::uint32_t maxDepth)
+{
+    StackKey key;
+    key.Tag = tag;
+    key.Depth = CaptureStack(key.Frames, maxDepth);
+
+    const double estimated = EstimateBytes(size, interval);
+
+    auto& state = GetState();
+    std::scoped_lock lock(state.Mutex);
+    StackStats& stack = state.Stacks[key];
+    stack.AllocCount += 1;
+    stack.AllocBytes += size;
+    stack.LiveCount += 1;
+    stack.LiveBytes += size;
+    stack.EstimatedAllocBytes += estimated;
+    stack.EstimatedLiveBytes += estimated;
+    state.Live[ptr] = LiveSample{ &stack, size, estimated };
+    state.SampleCount += 1;
+
+    SetAllocationSampled(ptr, true);
+}
+
+// ==================== 输出 ====================
+
+// 把一帧符号化为折叠栈中的名字（去掉分号与空白，避免破坏格式）
+void FormatFrame(void* frame, const char* symbol, char* out, std::size_t outSize)
+{
+    out[0] = '\0';
+#if defined(TE_MEMORY_PROFILER_EXECINFO)
+    // backtrace_symbols 格式："module(symbol+0xoff) [0xaddr]"，无符号时为 "module(+0xoff) [0xaddr]"
+    if (symbol)
+    {
+        const char* open = std::strchr(symbol, '(');
+        const char* plus = open ? std::strchr(open, '+') : nullptr;
+        const char* close = open ? std::strchr(open, ')') : nullptr;
+        if (open && plus && close && plus > open + 1 && plus < close)
+        {
+            char mangled[512];
+            const std::size_t len = std::min<std::size_t>(static_cast<std::size_t>(plus - open - 1), sizeof(mangled) - 1);
+            std::memcpy(mangled, open + 1, len);
+            mangled[len] = '\0';
+#if defined(TE_MEMORY_PROFILER_DEMANGLE)
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+            if (status == 0 && demangled)
+            {
+                std::snprintf(out, outSize, "%s", demangled);
+                std::free(demangled);
+            }
+            else
+#endif
+            {
+                std::snprintf(out, outSize, "%s", mangled);
+            }
+        }
+        else if (open && plus && close && plus < close)
+        {
+            // 无符号：模块名 + 模块内偏移，可用 addr2line 离线还原
+            const char* slash = symbol;
+            for (const char* p = symbol; p < open; ++p)
+            {
+                if (*p == '/')
+                {
+                    slash = p + 1;
+                }
+            }
+            std::snprintf(out, outSize, "%.*s+%.*s", static_cast<int>(open - slash), slash,
+                          static_cast<int>(close - plus - 1), plus + 1);
+        }
+    }
+#else
+    (void)symbol;
+#endif
+    if (out[0] == '\0')
+    {
+        std::snprintf(out, outSize, "0x%llx",
+                      static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(frame)));
+    }
+
+    for (char* p = out; *p; ++p)
+    {
+        if (*p == ';' || *p == ' ' || *p == '\n')
+        {
+            *p = '_';
+        }
+    }
+}
+
+void WriteFolded(std::FILE* file, const ProfilerState& state, MemoryProfileMetric metric)
+{
+    char frameName[1024];
+    for (const auto& [key, stats] : state.Stacks)
+    {
+        const double value = (metric == MemoryProfileMetric::AllocatedBytes) ? stats.EstimatedAllocBytes
+                                                                              : stats.EstimatedLiveBytes;
+        if (value < 0.5)
+        {
+            continue;
+        }
+
+        char** symbols = nullptr;
+#if defined(TE_MEMORY_PROFILER_EXECINFO)
+        if (key.Depth > 0)
+        {
+            symbols = ::backtrace_symbols(key.Frames, static_cast<int>(key.Depth));
+        }
+#endif
+        // 根在前：先写 tag，再从最外层帧写到分配点
+        std::fputs(MemoryTagName(key.Tag), file);
+        for (std::uint32_t i = key.Depth; i > 0; --i)
+        {
+            FormatFrame(key.Frames[i - 1], symbols ? symbols[i - 1] : nullptr, frameName, sizeof(frameName));
+            std::fputc(';', file);
+            std::fputs(frameName, file);
+        }
+        std::fprintf(file, " %llu\n", static_cast<unsigned long long>(value + 0.5));
+        std::free(symbols);
+    }
+}
+
+void WritePprof(std::FILE* file, const ProfilerState& state)
+{
+    std::uint64_t liveCount = 0;
+    std::uint64_t liveBytes = 0;
+    std::uint64_t allocCount = 0;
+    std::uint64_t allocBytes = 0;
+    for (const auto& [key, stats] : state.Stacks)
+    {
+        (void)key;
+        liveCount += stats.LiveCount;
+        liveBytes += stats.LiveBytes;
+        allocCount += stats.AllocCount;
+        allocBytes += stats.AllocBytes;
+    }
+
+    // 样本为原始计数，pprof 依据 heap_v2/<间隔> 自行还原估计值
+    std::fprintf(file, "heap profile: %llu: %llu [%llu: %llu] @ heap_v2/%llu\n",
+                 static_cast<unsigned long long>(liveCount), static_cast<unsigned long long>(liveBytes),
+                 static_cast<unsigned long long>(allocCount), static_cast<unsigned long long>(allocBytes),
+                 static_cast<unsigned long long>(state.SampleIntervalBytes));
+
+    for (const auto& [key, stats] : state.Stacks)
+    {
+        std::fprintf(file, "%llu: %llu [%llu: %llu] @",
+                     static_cast<unsigned long long>(stats.LiveCount), static_cast<unsigned long long>(stats.LiveBytes),
+                     static_cast<unsigned long long>(stats.AllocCount), static_cast<unsigned long long>(stats.AllocBytes));
+        for (std::uint32_t i = 0; i < key.Depth; ++i)
+        {
+            std::fprintf(file, " 0x%llx", static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(key.Frames[i])));
+        }
+        std::fputc('\n', file);
+    }
+
+#if defined(__linux__)
+    // pprof 用映射表把地址还原到模块与符号
+    std::fputs("\nMAPPED_LIBRARIES:\n", file);
+    if (std::FILE* maps = std::fopen("/proc/self/maps", "r"))
+    {
+        char buffer[4096];
+        std::size_t n = 0;
+        while ((n = std::fread(buffer, 1, sizeof(buffer), maps)) > 0)
+        {
+            std::fwrite(buffer, 1, n, file);
+        }
+        std::fclose(maps);
+    }
+#endif
+}
+
+} // namespace
+
+// ==================== 内部钩子（Memory.cpp 调用） ====================
+
+void MemoryProfilerOnAlloc(void* ptr, std::size_t size, MemoryTag tag)
+{
+    auto& sampler = t_sampler;
+    if (!ptr || sampler.InProfiler)
+    {
+        return;
+    }
+
+    const std::size_t interval = g_sampleIntervalBytes.load(std::memory_order_relaxed);
+    if (!sampler.Initialized)
+    {
+        sampler.Initialized = true;
+        sampler.Rng = (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&sampler)) * 0x9E3779B97F4A7C15ull) | 1ull;
+        sampler.BytesUntilSample = DrawSampleDistance(sampler, interval);
+    }
+
+    sampler.BytesUntilSample -= static_cast<std::int64_t>(size);
+    if (sampler.BytesUntilSample > 0)
+    {
+        return;
+    }
+
+    sampler.InProfiler = true;
+    do
+    {
+        sampler.BytesUntilSample += DrawSampleDistance(sampler, interval);
+    } while (sampler.BytesUntilSample <= 0);
+
+    RecordSample(ptr, size, tag, interval, g_maxStackDepth.load(std::memory_order_relaxed));
+    sampler.InProfiler = false;
+}
+
+void MemoryProfilerOnFree(void* ptr)
+{
+    MemoryBlockInfo info;
+    if (!ptr || !QueryAllocation(ptr, info) || !info.Sampled)
+    {
+        return;
+    }
+
+    auto& state = GetState();
+    std::scoped_lock lock(state.Mutex);
+    const auto it = state.Live.find(ptr);
+    if (it != state.Live.end())
+    {
+        StackStats* stack = it->second.Stack;
+        stack->LiveCount -= 1;
+        stack->LiveBytes -= it->second.Bytes;
+        stack->EstimatedLiveBytes = std::max(0.0, stack->EstimatedLiveBytes - it->second.EstimatedBytes);
+        state.Live.erase(it);
+        // slab 页上的标记是计数，只能与记录过的采样一一抵消
+        SetAllocationSampled(ptr, false);
+    }
+}
+
+void MemoryProfilerOnShutdown()
+{
+    if (!g_memoryProfilerActive.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    char path[sizeof(ProfilerState::ShutdownDumpPath)] = {};
+    MemoryProfileFormat format = MemoryProfileFormat::Pprof;
+    {
+        auto& state = GetState();
+        std::scoped_lock lock(state.Mutex);
+        std::memcpy(path, state.ShutdownDumpPath, sizeof(path));
+        format = state.ShutdownDumpFormat;
+    }
+
+    MemoryProfilerStop();
+    if (path[0] != '\0')
+    {
+        (void)MemoryProfilerDump(path, format);
+    }
+}
+
+// ==================== 公共接口 ====================
+
+void MemoryProfilerStart(const MemoryProfilerConfig& config)
+{
+    auto& state = GetState();
+    {
+        std::scoped_lock lock(state.Mutex);
+        state.Stacks.clear();
+        state.Live.clear();
+        state.SampleCount = 0;
+        state.SampleIntervalBytes = std::max<std::size_t>(config.SampleIntervalBytes, 1);
+        state.MaxStackDepth = std::min(config.MaxStackDepth, MemoryProfilerMaxStackDepth);
+        state.ShutdownDumpFormat = config.ShutdownDumpFormat;
+        std::snprintf(state.ShutdownDumpPath, sizeof(state.ShutdownDumpPath), "%s",
+                      config.ShutdownDumpPath ? config.ShutdownDumpPath : "");
+        g_sampleIntervalBytes.store(state.SampleIntervalBytes, std::memory_order_relaxed);
+        g_maxStackDepth.store(state.MaxStackDepth, std::memory_order_relaxed);
+    }
+
+#if defined(TE_MEMORY_PROFILER_EXECINFO)
+    // 首次 backtrace 会加载 unwinder（内部 malloc），提前在采样路径之外完成
+    void* warmup[1];
+    (void)::backtrace(warmup, 1);
+#endif
+
+    g_memoryProfilerActive.store(true, std::memory_order_release);
+}
+
+void MemoryProfilerStop()
+{
+    g_memoryProfilerActive.store(false, std::memory_order_release);
+}
+
+bool MemoryProfilerIsActive()
+{
+    return g_memoryProfilerActive.load(std::memory_order_acquire);
+}
+
+bool MemoryProfilerDump(const char* path, MemoryProfileFormat format, MemoryProfileMetric metric)
+{
+    if (!path || path[0] == '\0')
+    {
+        return false;
+    }
+
+    // 输出过程中的 C 运行时分配不应被本线程采样
+    auto& sampler = t_sampler;
+    const bool wasInProfiler = sampler.InProfiler;
+    sampler.InProfiler = true;
+
+    bool ok = false;
+    if (std::FILE* file = std::fopen(path, "w"))
+    {
+        auto& state = GetState();
+        std::scoped_lock lock(state.Mutex);
+        if (format == MemoryProfileFormat::Folded)
+        {
+            WriteFolded(file, state, metric);
+        }
+        else
+        {
+            WritePprof(file, state);
+        }
+        ok = std::fclose(file) == 0;
+    }
+
+    sampler.InProfiler = wasInProfiler;
+    return ok;
+}
+
+MemoryProfilerSummary MemoryProfilerGetSummary()
+{
+    MemoryProfilerSummary summary;
+    auto& state = GetState();
+    std::scoped_lock lock(state.Mutex);
+    summary.SampleCount = state.SampleCount;
+    summary.LiveSampleCount = state.Live.size();
+    summary.UniqueStacks = state.Stacks.size();
+    double allocated = 0.0;
+    double live = 0.0;
+    for (const auto& [key, stats] : state.Stacks)
+    {
+        (void)key;
+        allocated += stats.EstimatedAllocBytes;
+        live += stats.EstimatedLiveBytes;
+    }
+    summary.EstimatedAllocatedBytes = static_cast<std::uint64_t>(allocated + 0.5);
+    summary.EstimatedLiveBytes = static_cast<std::uint64_t>(live + 0.5);
+    return summary;
+}
+
+} // namespace TE
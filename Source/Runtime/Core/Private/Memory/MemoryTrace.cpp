@@ -0,0 +1,257 @@
+// ToyEngine Core Module
+// 分配轨迹记录实现
+
+#include "Memory/MemoryTrace.h"
+
+#include "Memory/MemoryInternal.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace TE {
+
+std::atomic<bool> g_memoryTraceActive{false};
+
+namespace {
+
+constexpr std::uint32_t BufferEvents = 256;
+constexpr std::size_t FileBufferBytes = 1ull * 1024ull * 1024ull;
+
+// 每线程事件缓冲：只有写满、线程退出与 Stop 时才写文件。
+// 直接向 C 运行时申请：开启全局 new/delete 覆盖时不能回到 MemAlloc。
+// 锁顺序：g_registryMutex -> Buffer.Mutex -> g_fileMutex
+struct ThreadTraceBuffer
+{
+    std::mutex Mutex;
+    ThreadTraceBuffer* Next = nullptr;
+    std::uint64_t Session = 0;
+    std::uint16_t ThreadId = 0;
+    std::uint32_t Count = 0;
+    MemoryTraceEvent Events[BufferEvents];
+};
+
+std::mutex g_registryMutex;
+ThreadTraceBuffer* g_buffers = nullptr;
+std::uint16_t g_nextThreadId = 0;
+
+std::mutex g_fileMutex;
+std::FILE* g_file = nullptr;
+char* g_fileBuffer = nullptr;
+
+std::atomic<std::uint64_t> g_session{0};
+std::atomic<std::uint64_t> g_eventCount{0};
+std::atomic<std::int64_t> g_startTicks{0}; // steady_clock 纪元起的纳秒
+
+thread_local ThreadTraceBuffer* t_buffer = nullptr;
+
+// 调用方需持有 Buffer.Mutex
+void FlushBufferLocked(ThreadTraceBuffer& buffer)
+{
+    if (buffer.Count == 0)
+    {
+        return;
+    }
+    {
+        std::scoped_lock lock(g_fileMutex);
+        if (g_file && buffer.Session == g_session.load(std::memory_order_relaxed))
+        {
+            std::fwrite(buffer.Events, sizeof(MemoryTraceEvent), buffer.Count, g_file);
+        }
+    }
+    buffer.Count = 0;
+}
+
+// 线程退出：写出剩余事件并注销缓冲
+struct TraceThreadExitHook
+{
+    ~TraceThreadExitHook()
+    {
+        ThreadTraceBuffer* buffer = t_buffer;
+        if (!buffer)
+        {
+            return;
+        }
+        t_buffer = nullptr;
+
+        std::scoped_lock registryLock(g_registryMutex);
+        {
+            std::scoped_lock bufferLock(buffer->Mutex);
+            FlushBufferLocked(*buffer);
+        }
+        for (ThreadTraceBuffer** link = &g_buffers; *link; link = &(*link)->Next)
+        {
+            if (*link == buffer)
+            {
+                *link = buffer->Next;
+                break;
+            }
+        }
+        buffer->~ThreadTraceBuffer();
+        std::free(buffer);
+    }
+};
+
+thread_local TraceThreadExitHook t_exitHook;
+
+ThreadTraceBuffer* GetThreadBuffer()
+{
+    if (t_buffer)
+    {
+        return t_buffer;
+    }
+
+    void* storage = std::malloc(sizeof(ThreadTraceBuffer));
+    if (!storage)
+    {
+        return nullptr;
+    }
+    auto* buffer = new (storage) ThreadTraceBuffer();
+    {
+        std::scoped_lock lock(g_registryMutex);
+        buffer->ThreadId = g_nextThreadId++;
+        buffer->Next = g_buffers;
+        g_buffers = buffer;
+    }
+    t_buffer = buffer;
+    (void)&t_exitHook; // 触发 thread_local 钩子的构造，使线程退出时写出缓冲
+    return buffer;
+}
+
+void Record(MemoryTraceOp op, std::uint64_t timestampNs, void* ptr, void* oldPtr,
+            std::size_t size, std::size_t align, MemoryTag tag)
+{
+    ThreadTraceBuffer* buffer = GetThreadBuffer();
+    if (!buffer)
+    {
+        return;
+    }
+
+    std::scoped_lock lock(buffer->Mutex);
+    const std::uint64_t session = g_session.load(std::memory_order_relaxed);
+    if (buffer->Session != session)
+    {
+        buffer->Session = session;
+        buffer->Count = 0;
+    }
+
+    MemoryTraceEvent& event = buffer->Events[buffer->Count++];
+    event = {};
+    event.TimestampNs = timestampNs;
+    event.Ptr = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr));
+    event.OldPtr = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(oldPtr));
+    event.Size = static_cast<std::uint64_t>(size);
+    event.Align = static_cast<std::uint32_t>(align);
+    event.ThreadId = buffer->ThreadId;
+    event.Tag = tag;
+    event.Op = op;
+    g_eventCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (buffer->Count == BufferEvents)
+    {
+        FlushBufferLocked(*buffer);
+    }
+}
+
+} // namespace
+
+std::uint64_t MemoryTraceNow()
+{
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return static_cast<std::uint64_t>(now - g_startTicks.load(std::memory_order_relaxed));
+}
+
+void MemoryTraceOnAlloc(void* ptr, std::size_t size, std::size_t align, MemoryTag tag)
+{
+    Record(MemoryTraceOp::Alloc, MemoryTraceNow(), ptr, nullptr, size, align, tag);
+}
+
+void MemoryTraceOnRealloc(std::uint64_t startNs, void* oldPtr, void* newPtr,
+                          std::size_t size, std::size_t align, MemoryTag tag)
+{
+    Record(MemoryTraceOp::Realloc, startNs, newPtr, oldPtr, size, align, tag);
+}
+
+void MemoryTraceOnFree(void* ptr)
+{
+    Record(MemoryTraceOp::Free, MemoryTraceNow(), ptr, nullptr, 0, 0, MemoryTag::Unknown);
+}
+
+bool MemoryTraceStart(const char* path)
+{
+    if (!path || !*path)
+    {
+        return false;
+    }
+
+    std::scoped_lock lock(g_fileMutex);
+    if (g_file)
+    {
+        return false;
+    }
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (!file)
+    {
+        return false;
+    }
+    g_fileBuffer = static_cast<char*>(std::malloc(FileBufferBytes));
+    if (g_fileBuffer)
+    {
+        std::setvbuf(file, g_fileBuffer, _IOFBF, FileBufferBytes);
+    }
+
+    MemoryTraceFileHeader header;
+    header.EventBytes = static_cast<std::uint32_t>(sizeof(MemoryTraceEvent));
+    std::fwrite(&header, sizeof(header), 1, file);
+
+    g_file = file;
+    g_startTicks.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+    g_eventCount.store(0, std::memory_order_relaxed);
+    g_session.fetch_add(1, std::memory_order_relaxed);
+    g_memoryTraceActive.store(true, std::memory_order_release);
+    return true;
+}
+
+void MemoryTraceStop()
+{
+    if (!g_memoryTraceActive.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // 收集所有线程（含仍在运行的 worker）缓冲中的事件
+    std::scoped_lock registryLock(g_registryMutex);
+    for (ThreadTraceBuffer* buffer = g_buffers; buffer; buffer = buffer->Next)
+    {
+        std::scoped_lock bufferLock(buffer->Mutex);
+        FlushBufferLocked(*buffer);
+    }
+
+    std::scoped_lock fileLock(g_fileMutex);
+    if (g_file)
+    {
+        std::fclose(g_file);
+        g_file = nullptr;
+    }
+    std::free(g_fileBuffer);
+    g_fileBuffer = nullptr;
+    // 之后仍在途的记录属于已结束的会话，写出时被丢弃
+    g_session.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MemoryTraceIsActive()
+{
+    return g_memoryTraceActive.load(std::memory_order_relaxed);
+}
+
+std::uint64_t MemoryTraceGetEventCount()
+{
+    return g_eventCount.load(std::memory_order_relaxed);
+}
+
+} // namespace TE
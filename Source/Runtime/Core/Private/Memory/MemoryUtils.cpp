@@ -5,8 +5,17 @@
 
 #include "Log/Log.h"
 
+#include <atomic>
+
 namespace TE {
 
+namespace {
+
+std::atomic<std::uint32_t> g_fragmentationDumpInterval{1};
+std::atomic<std::uint32_t> g_memoryDumpCount{0};
+
+} // namespace
+
 const char* MemoryTagName(MemoryTag tag)
 {
     switch (tag)
@@ -20,6 +29,7 @@ const char* MemoryTagName(MemoryTag tag)
     case MemoryTag::Asset:     return "Asset";
     case MemoryTag::Scene:     return "Scene";
     case MemoryTag::Sandbox:   return "Sandbox";
+    case MemoryTag::Frame:     return "Frame";
     default:                   return "???";
     }
 }
@@ -41,6 +51,23 @@ FormattedBytes FormatBytes(std::uint64_t bytes)
     return { static_cast<double>(bytes), "B" };
 }
 
+void LogMemoryBudgetEvent(MemoryTag tag, MemoryBudgetEvent event,
+                          std::uint64_t currentBytes, std::uint64_t budgetBytes, void* /*userData*/)
+{
+    auto current = FormatBytes(currentBytes);
+    auto budget = FormatBytes(budgetBytes);
+    if (event == MemoryBudgetEvent::OverBudget)
+    {
+        TE_LOG_ERROR("[Memory] {} over budget: {:.2f} {} / {:.2f} {}",
+            MemoryTagName(tag), current.Value, current.Unit, budget.Value, budget.Unit);
+    }
+    else
+    {
+        TE_LOG_WARN("[Memory] {} reached high watermark: {:.2f} {} / {:.2f} {}",
+            MemoryTagName(tag), current.Value, current.Unit, budget.Value, budget.Unit);
+    }
+}
+
 void DumpMemoryStats()
 {
     MemoryStats stats = GetMemoryStats();
@@ -55,6 +82,20 @@ void DumpMemoryStats()
         stats.AllocCount, stats.FreeCount,
         stats.AllocCount - stats.FreeCount);
 
+    auto committed = FormatBytes(stats.CommittedBytes);
+    auto reserved = FormatBytes(stats.ReservedBytes);
+    auto trimmed = FormatBytes(stats.LastTrimBytes);
+    TE_LOG_INFO("  Heap:   committed {:.2f} {} / reserved {:.2f} {}  (last trim returned {:.2f} {})",
+        committed.Value, committed.Unit, reserved.Value, reserved.Unit, trimmed.Value, trimmed.Unit);
+
+    if (stats.SlabLiveBlocks != 0)
+    {
+        auto slabCommitted = FormatBytes(stats.SlabCommittedBytes);
+        auto slabSaved = FormatBytes(stats.SlabSavedBytes);
+        TE_LOG_INFO("  Slabs:  {} small blocks, committed {:.2f} {}  (saved {:.2f} {} vs header blocks)",
+            stats.SlabLiveBlocks, slabCommitted.Value, slabCommitted.Unit, slabSaved.Value, slabSaved.Unit);
+    }
+
     for (std::size_t i = 0; i < static_cast<std::size_t>(MemoryTag::Count); ++i)
     {
         const auto& tagStats = stats.PerTag[i];
@@ -67,12 +108,75 @@ void DumpMemoryStats()
         auto peakTag = FormatBytes(tagStats.PeakBytes);
         const char* name = MemoryTagName(static_cast<MemoryTag>(i));
 
+        if (tagStats.BudgetBytes != 0)
+        {
+            auto budget = FormatBytes(tagStats.BudgetBytes);
+            TE_LOG_INFO("  [{:<10}] {:.2f} {} (peak {:.2f} {}, budget {:.2f} {})  allocs: {}  frees: {}",
+                name, current.Value, current.Unit, peakTag.Value, peakTag.Unit, budget.Value, budget.Unit,
+                tagStats.AllocCount, tagStats.FreeCount);
+            continue;
+        }
         TE_LOG_INFO("  [{:<10}] {:.2f} {} (peak {:.2f} {})  allocs: {}  frees: {}",
             name, current.Value, current.Unit, peakTag.Value, peakTag.Unit,
             tagStats.AllocCount, tagStats.FreeCount);
     }
 
     TE_LOG_INFO("====================");
+
+    const std::uint32_t interval = g_fragmentationDumpInterval.load(std::memory_order_relaxed);
+    const std::uint32_t dumpIndex = g_memoryDumpCount.fetch_add(1, std::memory_order_relaxed);
+    if (interval != 0 && dumpIndex % interval == 0)
+    {
+        DumpHeapFragmentationReport();
+    }
+}
+
+void DumpHeapFragmentationReport()
+{
+    const HeapFragmentationReport report = GetHeapFragmentationReport();
+
+    auto used = FormatBytes(report.UsedBytes);
+    auto free = FormatBytes(report.FreeBytes);
+    auto largest = FormatBytes(report.LargestFreeBlock);
+    auto nextGrow = FormatBytes(report.NextGrowBytes);
+
+    TE_LOG_INFO("=== Heap Fragmentation ===");
+    TE_LOG_INFO("  Used:   {:.2f} {} in {} blocks  Free: {:.2f} {} in {} blocks",
+        used.Value, used.Unit, report.UsedBlocks, free.Value, free.Unit, report.FreeBlocks);
+    TE_LOG_INFO("  Largest free block: {:.2f} {}  fragmentation: {:.1f}%  next grow: {:.2f} {}",
+        largest.Value, largest.Unit, report.FragmentationRatio * 100.0, nextGrow.Value, nextGrow.Unit);
+
+    for (std::size_t i = 0; i < HeapFragmentationReport::HistogramBuckets; ++i)
+    {
+        if (report.FreeBlockCount[i] == 0)
+        {
+            continue; // 跳过空桶
+        }
+        auto minBytes = FormatBytes(HeapFragmentationReport::BucketMinBytes(i));
+        auto bucketBytes = FormatBytes(report.FreeBlockBytes[i]);
+        TE_LOG_INFO("  free >= {:>7.2f} {:<2}: {:>8} blocks  {:.2f} {}",
+            minBytes.Value, minBytes.Unit, report.FreeBlockCount[i], bucketBytes.Value, bucketBytes.Unit);
+    }
+
+    for (std::uint32_t i = 0; i < report.PoolCount; ++i)
+    {
+        const MemoryPoolReport& pool = report.Pools[i];
+        auto poolBytes = FormatBytes(pool.Bytes);
+        auto poolLargest = FormatBytes(pool.LargestFreeBlock);
+        const double utilization = pool.Bytes != 0
+            ? static_cast<double>(pool.UsedBytes) / static_cast<double>(pool.Bytes) * 100.0
+            : 0.0;
+        TE_LOG_INFO("  [pool {:>2}] {:.2f} {}  used {:.1f}%  {} used / {} free blocks  largest free {:.2f} {}",
+            i, poolBytes.Value, poolBytes.Unit, utilization, pool.UsedBlocks, pool.FreeBlocks,
+            poolLargest.Value, poolLargest.Unit);
+    }
+
+    TE_LOG_INFO("==========================");
+}
+
+void SetHeapFragmentationDumpInterval(std::uint32_t interval)
+{
+    g_fragmentationDumpInterval.store(interval, std::memory_order_relaxed);
 }
 
 } // namespace TE
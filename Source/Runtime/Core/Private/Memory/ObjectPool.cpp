@@ -0,0 +1,171 @@
+// ToyEngine Core Module
+// 定长对象池实现
+
+#include "Memory/MemoryNew.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace TE {
+
+namespace {
+
+std::size_t AlignUp(std::size_t x, std::size_t align)
+{
+    return (x + (align - 1)) & ~(align - 1);
+}
+
+// 全局对象池注册表（常量初始化，不依赖静态构造顺序）
+std::mutex g_poolRegistryMutex;
+FixedSizePool* g_poolRegistryHead = nullptr;
+
+} // namespace
+
+FixedSizePool::FixedSizePool(std::size_t objectSize, std::size_t objectAlign, MemoryTag tag, std::size_t slotsPerChunk)
+    : m_slotSize(AlignUp(std::max(objectSize, sizeof(FreeSlot)), std::max(objectAlign, CacheLineSize)))
+    , m_slotAlign(std::max(objectAlign, CacheLineSize))
+    , m_slotsPerChunk(slotsPerChunk != 0 ? slotsPerChunk
+                                         : std::max<std::size_t>(DefaultChunkBytes / m_slotSize, 8))
+    , m_headerBytes(AlignUp(sizeof(Chunk), m_slotAlign))
+    , m_tag(tag)
+{
+    std::scoped_lock lock(g_poolRegistryMutex);
+    m_nextPool = g_poolRegistryHead;
+    if (g_poolRegistryHead)
+    {
+        g_poolRegistryHead->m_prevPool = this;
+    }
+    g_poolRegistryHead = this;
+}
+
+FixedSizePool::~FixedSizePool()
+{
+    {
+        std::scoped_lock lock(g_poolRegistryMutex);
+        if (m_prevPool)
+        {
+            m_prevPool->m_nextPool = m_nextPool;
+        }
+        else
+        {
+            g_poolRegistryHead = m_nextPool;
+        }
+        if (m_nextPool)
+        {
+            m_nextPool->m_prevPool = m_prevPool;
+        }
+    }
+
+    std::scoped_lock lock(m_mutex);
+    ReleaseChunksLocked();
+}
+
+void* FixedSizePool::Allocate()
+{
+    std::scoped_lock lock(m_mutex);
+
+    if (m_freeList)
+    {
+        FreeSlot* slot = m_freeList;
+        m_freeList = slot->Next;
+        ++m_liveCount;
+        return slot;
+    }
+
+    if (m_bumpCursor == m_bumpEnd && !AddChunkLocked())
+    {
+        return nullptr;
+    }
+
+    void* slot = m_bumpCursor;
+    m_bumpCursor += m_slotSize;
+    ++m_liveCount;
+    return slot;
+}
+
+void FixedSizePool::Free(void* slot)
+{
+    if (!slot)
+    {
+        return;
+    }
+
+    std::scoped_lock lock(m_mutex);
+    assert(m_liveCount > 0 && "FixedSizePool::Free: more frees than allocations");
+
+    auto* node = static_cast<FreeSlot*>(slot);
+    node->Next = m_freeList;
+    m_freeList = node;
+    --m_liveCount;
+}
+
+bool FixedSizePool::Trim()
+{
+    std::scoped_lock lock(m_mutex);
+    if (m_liveCount != 0 || !m_chunks)
+    {
+        return false;
+    }
+    ReleaseChunksLocked();
+    return true;
+}
+
+std::size_t FixedSizePool::GetLiveCount() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_liveCount;
+}
+
+std::size_t FixedSizePool::GetChunkCount() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_chunkCount;
+}
+
+void FixedSizePool::ReleaseAllPools()
+{
+    std::scoped_lock registryLock(g_poolRegistryMutex);
+    for (FixedSizePool* pool = g_poolRegistryHead; pool; pool = pool->m_nextPool)
+    {
+        std::scoped_lock lock(pool->m_mutex);
+        pool->ReleaseChunksLocked();
+    }
+}
+
+bool FixedSizePool::AddChunkLocked()
+{
+    const std::size_t chunkBytes = m_headerBytes + m_slotSize * m_slotsPerChunk;
+    void* mem = MemAlignedAlloc(chunkBytes, m_slotAlign, m_tag);
+    if (!mem)
+    {
+        return false;
+    }
+
+    auto* chunk = ::new (mem) Chunk{m_chunks};
+    m_chunks = chunk;
+    ++m_chunkCount;
+
+    m_bumpCursor = static_cast<std::byte*>(mem) + m_headerBytes;
+    m_bumpEnd = m_bumpCursor + m_slotSize * m_slotsPerChunk;
+    return true;
+}
+
+void FixedSizePool::ReleaseChunksLocked()
+{
+    Chunk* chunk = m_chunks;
+    while (chunk)
+    {
+        Chunk* next = chunk->Next;
+        MemFree(chunk);
+        chunk = next;
+    }
+
+    m_chunks = nullptr;
+    m_freeList = nullptr;
+    m_bumpCursor = nullptr;
+    m_bumpEnd = nullptr;
+    m_liveCount = 0;
+    m_chunkCount = 0;
+}
+
+} // namespace TE
@@ -0,0 +1,341 @@
+// ToyEngine Core Module
+// 小块 slab 层实现
+
+#include "Memory/SmallSlabAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace TE {
+
+namespace {
+
+// 保留区不足一页时视为关闭；提交按块推进，避免每切一页就调用一次 mprotect
+constexpr std::size_t MinReserveBytes = 4ull * 1024ull * 1024ull;
+constexpr std::size_t CommitChunkBytes = 1ull * 1024ull * 1024ull;
+
+} // namespace
+
+SmallSlabAllocator::SmallSlabAllocator(const MemoryHeapConfig& config)
+{
+    if (config.SmallSlabReserveBytes == 0)
+    {
+        return;
+    }
+
+    // 多保留一页用于把起点对齐到 PageBytes；地址空间受限时逐级减半
+    std::size_t bytes = std::max(config.SmallSlabReserveBytes, MinReserveBytes);
+    while (!m_region.Reserve(bytes + PageBytes, config.HugePages))
+    {
+        if (bytes <= MinReserveBytes)
+        {
+            return;
+        }
+        bytes = std::max(bytes / 2, MinReserveBytes);
+    }
+
+    const auto base = reinterpret_cast<std::uintptr_t>(m_region.Base());
+    m_begin = (base + PageBytes - 1) & ~static_cast<std::uintptr_t>(PageBytes - 1);
+    const std::size_t usable = m_region.ReservedBytes() - static_cast<std::size_t>(m_begin - base);
+    m_span = usable & ~(PageBytes - 1);
+}
+
+SmallSlabAllocator::~SmallSlabAllocator()
+{
+    std::scoped_lock lock(m_mutex);
+    m_region.Release();
+}
+
+void SmallSlabAllocator::Retire()
+{
+    std::scoped_lock lock(m_mutex);
+    m_retired = true;
+    m_region.Release();
+    m_freePages = nullptr;
+    m_partial = {};
+    m_outstanding = {};
+    m_pageCount = 0;
+    m_usedPages = 0;
+    PublishLocked();
+}
+
+void SmallSlabAllocator::QueryBlock(const void* ptr, MemoryBlockInfo& outInfo)
+{
+    const SlabPage* page = PageOf(ptr);
+    assert(page->Magic == PageMagic && "pointer is not inside an initialized slab page");
+    outInfo.Tag = page->Tag;
+    outInfo.RequestedBytes = page->BlockBytes;
+    outInfo.Alignment = TlsfAllocator::CachedBlockAlign;
+    outInfo.SizeClass = static_cast<std::uint16_t>(page->ClassIndex + 1);
+    outInfo.Sampled = page->SampledCount.load(std::memory_order_relaxed) != 0;
+}
+
+void SmallSlabAllocator::SetBlockSampled(const void* ptr, bool sampled)
+{
+    auto& count = PageOf(ptr)->SampledCount;
+    if (sampled)
+    {
+        count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    std::uint32_t current = count.load(std::memory_order_relaxed);
+    while (current != 0 && !count.compare_exchange_weak(current, current - 1, std::memory_order_relaxed))
+    {
+    }
+}
+
+SmallSlabAllocator::SlabPage* SmallSlabAllocator::AcquirePageLocked(std::size_t sizeClass, MemoryTag tag)
+{
+    SlabPage* page = m_freePages;
+    if (page)
+    {
+        m_freePages = page->Next;
+    }
+    else
+    {
+        const std::size_t pageEnd = (m_pageCount + 1) * PageBytes;
+        if (pageEnd > m_span)
+        {
+            m_exhausted.store(true, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        const std::size_t pad = static_cast<std::size_t>(m_begin - reinterpret_cast<std::uintptr_t>(m_region.Base()));
+        if (pad + pageEnd > m_region.CommittedBytes())
+        {
+            const std::size_t target = std::min(std::max(pad + pageEnd, m_region.CommittedBytes() + CommitChunkBytes),
+                                                m_region.ReservedBytes());
+            if (!m_region.Commit(target))
+            {
+                m_exhausted.store(true, std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+
+        page = new (reinterpret_cast<void*>(m_begin + m_pageCount * PageBytes)) SlabPage();
+        ++m_pageCount;
+    }
+
+    const std::size_t blockBytes = ClassToSize(sizeClass);
+    page->Magic = PageMagic;
+    page->Tag = tag;
+    page->ClassIndex = static_cast<std::uint16_t>(sizeClass);
+    page->BlockBytes = static_cast<std::uint32_t>(blockBytes);
+    page->Capacity = static_cast<std::uint32_t>((PageBytes - PageHeaderBytes) / blockBytes);
+    page->LiveCount = 0;
+    page->BumpIndex = 0;
+    page->FreeList = nullptr;
+    page->Prev = nullptr;
+    page->Next = nullptr;
+    page->SampledCount.store(0, std::memory_order_relaxed);
+    page->InPartialList = false;
+    page->Discarded = false;
+    page->TrimMarked = false;
+    ++m_usedPages;
+    return page;
+}
+
+void SmallSlabAllocator::LinkPartialLocked(SlabPage* page)
+{
+    SlabPage*& head = m_partial[page->ClassIndex][static_cast<std::size_t>(page->Tag)];
+    page->Prev = nullptr;
+    page->Next = head;
+    if (head)
+    {
+        head->Prev = page;
+    }
+    head = page;
+    page->InPartialList = true;
+}
+
+void SmallSlabAllocator::UnlinkPartialLocked(SlabPage* page)
+{
+    SlabPage*& head = m_partial[page->ClassIndex][static_cast<std::size_t>(page->Tag)];
+    if (page->Prev)
+    {
+        page->Prev->Next = page->Next;
+    }
+    else
+    {
+        head = page->Next;
+    }
+    if (page->Next)
+    {
+        page->Next->Prev = page->Prev;
+    }
+    page->Prev = nullptr;
+    page->Next = nullptr;
+    page->InPartialList = false;
+}
+
+std::size_t SmallSlabAllocator::AllocateBatch(std::size_t sizeClass, MemoryTag tag, void** outBlocks, std::size_t count)
+{
+    if (sizeClass >= ClassCount || static_cast<std::size_t>(tag) >= TagCount || !outBlocks)
+    {
+        return 0;
+    }
+
+    std::scoped_lock lock(m_mutex);
+    if (m_retired || m_span == 0)
+    {
+        return 0;
+    }
+
+    std::size_t produced = 0;
+    while (produced < count)
+    {
+        SlabPage* page = m_partial[sizeClass][static_cast<std::size_t>(tag)];
+        if (!page)
+        {
+            page = AcquirePageLocked(sizeClass, tag);
+            if (!page)
+            {
+                break;
+            }
+            LinkPartialLocked(page);
+        }
+
+        // 先复用归还过的块（缓存里更热），再顺序切出新块
+        while (produced < count && page->FreeList)
+        {
+            void* block = page->FreeList;
+            page->FreeList = *static_cast<void**>(block);
+            outBlocks[produced++] = block;
+            ++page->LiveCount;
+        }
+        auto* blocks = reinterpret_cast<std::byte*>(page) + PageHeaderBytes;
+        while (produced < count && page->BumpIndex < page->Capacity)
+        {
+            outBlocks[produced++] = blocks + static_cast<std::size_t>(page->BumpIndex) * page->BlockBytes;
+            ++page->BumpIndex;
+            ++page->LiveCount;
+        }
+
+        if (!page->FreeList && page->BumpIndex == page->Capacity)
+        {
+            UnlinkPartialLocked(page);
+        }
+    }
+
+    m_outstanding[sizeClass] += produced;
+    PublishLocked();
+    return produced;
+}
+
+void SmallSlabAllocator::FreeBatch(void* const* blocks, std::size_t count)
+{
+    std::scoped_lock lock(m_mutex);
+    if (m_retired)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        void* block = blocks[i];
+        if (!Contains(block))
+        {
+            assert(false && "invalid pointer passed to SmallSlabAllocator::FreeBatch");
+            continue;
+        }
+
+        SlabPage* page = PageOf(block);
+        assert(page->Magic == PageMagic && page->LiveCount != 0);
+        *static_cast<void**>(block) = page->FreeList;
+        page->FreeList = block;
+        --page->LiveCount;
+        --m_outstanding[page->ClassIndex];
+
+        if (page->LiveCount == 0)
+        {
+            // 整页空闲：退回空闲页栈，之后可改作任意 (档位, tag)
+            if (page->InPartialList)
+            {
+                UnlinkPartialLocked(page);
+            }
+            page->Magic = 0;
+            page->Next = m_freePages;
+            m_freePages = page;
+            --m_usedPages;
+            m_exhausted.store(false, std::memory_order_relaxed);
+        }
+        else if (!page->InPartialList)
+        {
+            LinkPartialLocked(page);
+        }
+    }
+    PublishLocked();
+}
+
+std::size_t SmallSlabAllocator::Trim()
+{
+    std::scoped_lock lock(m_mutex);
+    return TrimLocked(false);
+}
+
+std::size_t SmallSlabAllocator::TrimIdle()
+{
+    std::scoped_lock lock(m_mutex);
+    return TrimLocked(true);
+}
+
+std::size_t SmallSlabAllocator::TrimLocked(bool confirmIdle)
+{
+    if (m_retired || m_span == 0)
+    {
+        return 0;
+    }
+
+    // 页首描述符（含空闲页栈链接）所在的粒度页必须保留
+    const std::size_t keep = std::max(PageHeaderBytes, m_region.Granularity());
+    if (keep >= PageBytes)
+    {
+        return 0;
+    }
+
+    std::size_t returned = 0;
+    for (SlabPage* page = m_freePages; page; page = page->Next)
+    {
+        if (page->Discarded)
+        {
+            continue;
+        }
+        // 页被重新取用时清除标记，因此带标记的页自上一遍起一直空闲
+        if (confirmIdle && !page->TrimMarked)
+        {
+            page->TrimMarked = true;
+            continue;
+        }
+        returned += m_region.Discard(reinterpret_cast<std::byte*>(page) + keep, PageBytes - keep);
+        page->Discarded = true;
+    }
+    return returned;
+}
+
+void SmallSlabAllocator::PublishLocked()
+{
+    m_committedBytes.store(m_region.CommittedBytes(), std::memory_order_relaxed);
+
+    // 节省量：同样数量的块走带块头的线程缓存档位时的 TLSF 占用，减去 slab 实际占用的页
+    std::uint64_t live = 0;
+    std::uint64_t headerFootprint = 0;
+    for (std::size_t sizeClass = 0; sizeClass < ClassCount; ++sizeClass)
+    {
+        live += m_outstanding[sizeClass];
+        headerFootprint += m_outstanding[sizeClass] * TlsfAllocator::CachedBlockFootprint(ClassToSize(sizeClass));
+    }
+    const std::uint64_t slabFootprint = static_cast<std::uint64_t>(m_usedPages) * PageBytes;
+    m_liveBlocks.store(live, std::memory_order_relaxed);
+    m_savedBytes.store(headerFootprint > slabFootprint ? headerFootprint - slabFootprint : 0,
+                       std::memory_order_relaxed);
+}
+
+void SmallSlabAllocator::FillStats(MemoryStats& outStats) const
+{
+    outStats.SlabCommittedBytes = m_committedBytes.load(std::memory_order_relaxed);
+    outStats.SlabLiveBlocks = m_liveBlocks.load(std::memory_order_relaxed);
+    outStats.SlabSavedBytes = m_savedBytes.load(std::memory_order_relaxed);
+}
+
+} // namespace TE
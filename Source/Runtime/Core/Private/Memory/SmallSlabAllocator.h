@@ -0,0 +1,137 @@
+// ToyEngine Core Module
+// 小块 slab 层 —— 不带块头的定长小块（线程缓存的后端之一）
+
+#pragma once
+
+#include "Memory/Memory.h"
+#include "Memory/MemoryCounters.h"
+#include "Memory/TlsfAllocator.h"
+#include "Memory/VirtualMemory.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace TE {
+
+/// <summary>
+/// 小块 slab 层：
+/// - 独占一段保留地址，按 PageBytes 对齐切成页；每页只服务一个 (尺寸档位, tag)，
+///   块本身不带 AllocHeader，tag 与大小都取自页首的描述符；
+/// - 判断指针归属只需一次地址区间比较，页描述符由指针按页对齐取整得到；
+/// - 只提供批量接口，由线程缓存按 (档位, tag) 的 magazine 补货/归还；
+/// - 块按档位大小记账（不保留请求大小），对齐固定为 TlsfAllocator::CachedBlockAlign。
+/// 内部一把锁，只在批量补货/归还与 Trim 时持有。
+/// </summary>
+class SmallSlabAllocator final
+{
+public:
+    static constexpr std::size_t PageBytes = 64ull * 1024ull;
+    static constexpr std::size_t ClassCount = 4; // 16 / 32 / 48 / 64，与线程缓存前 4 档一致
+    static constexpr std::size_t MaxBlockBytes = ClassCount * 16;
+    static constexpr std::size_t TagCount = MemoryCounters::TagCount;
+
+    explicit SmallSlabAllocator(const MemoryHeapConfig& config);
+    ~SmallSlabAllocator();
+
+    SmallSlabAllocator(const SmallSlabAllocator&) = delete;
+    SmallSlabAllocator& operator=(const SmallSlabAllocator&) = delete;
+
+    [[nodiscard]] static std::size_t ClassToSize(std::size_t sizeClass) { return (sizeClass + 1) * 16; }
+
+    // 保留失败 / 地址用尽时返回 false，线程缓存回退到带块头的 TLSF 档位
+    [[nodiscard]] bool IsEnabled() const
+    {
+        return m_span != 0 && !m_exhausted.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool Contains(const void* ptr) const
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) - m_begin < m_span;
+    }
+
+    // 以下查询要求 Contains(ptr) 为真且块处于已分配状态（页描述符在块存活期间不变）
+    [[nodiscard]] static MemoryTag GetBlockTag(const void* ptr) { return PageOf(ptr)->Tag; }
+    [[nodiscard]] static std::size_t GetBlockClass(const void* ptr) { return PageOf(ptr)->ClassIndex; }
+    static void QueryBlock(const void* ptr, MemoryBlockInfo& outInfo);
+
+    // 采样标记记在页上（页内被采样块的计数），非零时释放才去查采样表
+    static void SetBlockSampled(const void* ptr, bool sampled);
+
+    /// <summary>
+    /// 一次加锁为 (sizeClass, tag) 批量切出 count 个块，返回实际数量。
+    /// 交付的块不计入统计，由线程缓存交付给用户时记账。
+    /// </summary>
+    [[nodiscard]] std::size_t AllocateBatch(std::size_t sizeClass, MemoryTag tag, void** outBlocks, std::size_t count);
+
+    // 一次加锁批量归还（块可来自不同页、不同档位）
+    void FreeBatch(void* const* blocks, std::size_t count);
+
+    // 丢弃完全空闲页的物理内存（页首描述符所在的粒度页保留），返回归还的字节数
+    std::size_t Trim();
+
+    // 策略回收：只丢弃上一遍起一直在空闲页栈中的页，本遍新空闲的页只做标记
+    std::size_t TrimIdle();
+
+    // 释放保留区，此后批量接口返回 0 / 直接忽略；调用方须先等过纪元宽限期
+    void Retire();
+
+    // 填写 MemoryStats 中的 Slab* 字段（无锁读取最近一次发布的值）
+    void FillStats(MemoryStats& outStats) const;
+
+private:
+    struct alignas(64) SlabPage
+    {
+        std::uint32_t Magic = 0;
+        MemoryTag Tag = MemoryTag::Unknown;
+        std::uint16_t ClassIndex = 0;
+        std::uint32_t BlockBytes = 0;
+        std::uint32_t Capacity = 0;   // 本页可切出的块数
+        std::uint32_t LiveCount = 0;  // 已交付给线程缓存的块数（含仍在 magazine 中的）
+        std::uint32_t BumpIndex = 0;  // 从未切出过的第一个块
+        void* FreeList = nullptr;     // 已归还块的侵入式单链表
+        SlabPage* Prev = nullptr;     // 部分空闲页链表 / 空闲页栈
+        SlabPage* Next = nullptr;
+        std::atomic<std::uint32_t> SampledCount{0};
+        bool InPartialList = false;
+        bool Discarded = false;       // 空闲页的块区物理页已丢弃
+        bool TrimMarked = false;      // 上一遍 TrimIdle 时已在空闲页栈中
+    };
+
+    static constexpr std::uint32_t PageMagic = 0x54455342; // 'T''E''S''B'
+    static constexpr std::size_t PageHeaderBytes = sizeof(SlabPage);
+
+    [[nodiscard]] static SlabPage* PageOf(const void* ptr)
+    {
+        return reinterpret_cast<SlabPage*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(PageBytes - 1));
+    }
+
+    [[nodiscard]] SlabPage* AcquirePageLocked(std::size_t sizeClass, MemoryTag tag);
+    void LinkPartialLocked(SlabPage* page);
+    void UnlinkPartialLocked(SlabPage* page);
+    void PublishLocked();
+    std::size_t TrimLocked(bool confirmIdle);
+
+private:
+    // 区间判断在热路径上无锁读取：构造后不再改变（退役只释放物理映射）
+    std::uintptr_t m_begin = 0;
+    std::size_t m_span = 0;
+
+    mutable std::mutex m_mutex;
+    VirtualMemoryRegion m_region;
+    bool m_retired = false;
+    std::size_t m_pageCount = 0;       // 已初始化过的页（地址从 m_begin 向上连续）
+    std::size_t m_usedPages = 0;       // 至少有一个块在外的页
+    SlabPage* m_freePages = nullptr;   // 完全空闲、可改作任意档位的页
+    std::array<std::array<SlabPage*, TagCount>, ClassCount> m_partial{};
+    std::array<std::uint64_t, ClassCount> m_outstanding{};
+
+    std::atomic<bool> m_exhausted{false};
+    std::atomic<std::uint64_t> m_committedBytes{0};
+    std::atomic<std::uint64_t> m_liveBlocks{0};
+    std::atomic<std::uint64_t> m_savedBytes{0};
+};
+
+} // namespace TE
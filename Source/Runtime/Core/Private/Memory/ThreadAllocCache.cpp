@@ -0,0 +1,394 @@
+// ToyEngine Core Module
+// 线程本地小块缓存实现
+
+#include "Memory/ThreadAllocCache.h"
+
+#include "Memory/MemoryInternal.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace TE {
+
+namespace {
+
+// 每个线程在多少次缓存命中后主动折算一次统计（避免长期只命中缓存时统计停滞）
+constexpr std::uint32_t FoldInterval = 4096;
+
+struct Magazine
+{
+    std::uint32_t Count = 0;
+    void* Blocks[ThreadAllocCache::MagazineCapacity] = {};
+};
+
+struct SlabMagazine
+{
+    std::uint32_t Count = 0;
+    void* Blocks[ThreadAllocCache::SlabMagazineCapacity] = {};
+};
+
+// 平凡析构 + 常量初始化：线程退出后（钩子析构之后）再被访问也安全
+struct ThreadCacheState
+{
+    AllocatorEpoch* Epoch = nullptr;
+    bool HookArmed = false;
+    bool Dead = false;
+    std::uint32_t OpsSinceFold = 0;
+    Magazine Magazines[ThreadAllocCache::ClassCount] = {};
+    SlabMagazine SlabMagazines[SmallSlabAllocator::ClassCount][SmallSlabAllocator::TagCount] = {};
+    MemoryStatsDelta Delta{};
+};
+
+thread_local ThreadCacheState t_state{};
+
+// 线程退出钩子：归还缓存块并把状态标记为不可用
+struct ThreadCacheExitHook
+{
+    bool Armed = false;
+
+    ~ThreadCacheExitHook()
+    {
+        if (Armed)
+        {
+            AllocatorEpochReadScope epochScope;
+            ThreadAllocCache::Flush();
+        }
+        t_state.Dead = true;
+    }
+};
+
+thread_local ThreadCacheExitHook t_exitHook;
+
+// 切换到新的分配器纪元：旧块属于已退役的分配器（池已释放），直接丢弃
+void Rebind(ThreadCacheState& state, AllocatorEpoch* epoch)
+{
+    for (auto& mag : state.Magazines)
+    {
+        mag.Count = 0;
+    }
+    for (auto& perTag : state.SlabMagazines)
+    {
+        for (auto& mag : perTag)
+        {
+            mag.Count = 0;
+        }
+    }
+    state.Delta = {};
+    state.OpsSinceFold = 0;
+    state.Epoch = epoch;
+
+    if (!state.HookArmed)
+    {
+        state.HookArmed = true;
+        t_exitHook.Armed = true;
+    }
+}
+
+// 把本线程累积的增量折算进当前纪元的分片计数器（无锁）
+void FoldDelta(ThreadCacheState& state)
+{
+    state.OpsSinceFold = 0;
+    if (state.Delta.IsEmpty())
+    {
+        return;
+    }
+    state.Epoch->Allocator.GetCounters().Apply(state.Delta);
+    state.Delta = {};
+}
+
+// 补货前确认纪元：未初始化时惰性创建，纪元变化时丢弃旧块
+AllocatorEpoch* BindEpoch(ThreadCacheState& state, AllocatorEpoch* epoch)
+{
+    if (!epoch)
+    {
+        epoch = LoadOrCreateAllocatorEpoch();
+        if (!epoch)
+        {
+            return nullptr;
+        }
+    }
+    if (state.Epoch != epoch)
+    {
+        Rebind(state, epoch);
+    }
+    return epoch;
+}
+
+bool Refill(ThreadCacheState& state, AllocatorEpoch* epoch, std::size_t sizeClass)
+{
+    epoch = BindEpoch(state, epoch);
+    if (!epoch)
+    {
+        return false;
+    }
+
+    auto& mag = state.Magazines[sizeClass];
+    if (mag.Count != 0)
+    {
+        return true;
+    }
+
+    FoldDelta(state);
+    const std::size_t produced = epoch->Allocator.AllocateCachedBatch(
+        static_cast<std::uint16_t>(sizeClass), ThreadAllocCache::ClassToSize(sizeClass),
+        mag.Blocks, ThreadAllocCache::BatchCount);
+
+    mag.Count = static_cast<std::uint32_t>(produced);
+    return produced != 0;
+}
+
+// 归还 magazine 底部（最久未用）的 count 个块，栈顶的热块留在本线程
+void Drain(ThreadCacheState& state, std::size_t sizeClass, std::uint32_t count)
+{
+    auto& mag = state.Magazines[sizeClass];
+    count = (count < mag.Count) ? count : mag.Count;
+
+    FoldDelta(state);
+    state.Epoch->Allocator.FreeCachedBatch(mag.Blocks, count);
+
+    mag.Count -= count;
+    std::memmove(mag.Blocks, mag.Blocks + count, sizeof(void*) * mag.Count);
+}
+
+bool RefillSlab(ThreadCacheState& state, AllocatorEpoch* epoch, std::size_t sizeClass, MemoryTag tag)
+{
+    epoch = BindEpoch(state, epoch);
+    if (!epoch)
+    {
+        return false;
+    }
+
+    auto& mag = state.SlabMagazines[sizeClass][static_cast<std::size_t>(tag)];
+    if (mag.Count != 0)
+    {
+        return true;
+    }
+    if (!epoch->Slabs.IsEnabled())
+    {
+        return false;
+    }
+
+    FoldDelta(state);
+    mag.Count = static_cast<std::uint32_t>(epoch->Slabs.AllocateBatch(
+        sizeClass, tag, mag.Blocks, ThreadAllocCache::SlabBatchCount));
+    return mag.Count != 0;
+}
+
+void DrainSlab(ThreadCacheState& state, SlabMagazine& mag, std::uint32_t count)
+{
+    count = (count < mag.Count) ? count : mag.Count;
+
+    FoldDelta(state);
+    state.Epoch->Slabs.FreeBatch(mag.Blocks, count);
+
+    mag.Count -= count;
+    std::memmove(mag.Blocks, mag.Blocks + count, sizeof(void*) * mag.Count);
+}
+
+void CountOp(ThreadCacheState& state)
+{
+    if (++state.OpsSinceFold >= FoldInterval)
+    {
+        ThreadAllocCache::FoldStats();
+    }
+}
+
+void* AllocateSlab(ThreadCacheState& state, AllocatorEpoch* epoch, std::size_t sizeClass, MemoryTag tag)
+{
+    auto& mag = state.SlabMagazines[sizeClass][static_cast<std::size_t>(tag)];
+    if (state.Epoch != epoch || mag.Count == 0)
+    {
+        if (!RefillSlab(state, epoch, sizeClass, tag))
+        {
+            return nullptr;
+        }
+    }
+
+    void* ptr = mag.Blocks[--mag.Count];
+    state.Delta.OnAlloc(tag, SmallSlabAllocator::ClassToSize(sizeClass));
+    CountOp(state);
+    return ptr;
+}
+
+// slab 块不带块头：tag 取自页描述符，档位由调用方按 size 或页描述符给出
+void FreeSlab(ThreadCacheState& state, AllocatorEpoch* epoch, void* ptr, std::size_t sizeClass)
+{
+    const MemoryTag tag = SmallSlabAllocator::GetBlockTag(ptr);
+    const std::size_t bytes = SmallSlabAllocator::ClassToSize(sizeClass);
+
+    if (state.Dead)
+    {
+        epoch->Allocator.GetCounters().OnFree(tag, bytes);
+        epoch->Slabs.FreeBatch(&ptr, 1);
+        return;
+    }
+
+    if (state.Epoch != epoch)
+    {
+        Rebind(state, epoch);
+    }
+
+    state.Delta.OnFree(tag, bytes);
+
+    auto& mag = state.SlabMagazines[sizeClass][static_cast<std::size_t>(tag)];
+    if (mag.Count == ThreadAllocCache::SlabMagazineCapacity)
+    {
+        DrainSlab(state, mag, ThreadAllocCache::SlabBatchCount);
+    }
+    mag.Blocks[mag.Count++] = ptr;
+    CountOp(state);
+}
+
+} // namespace
+
+std::size_t ThreadAllocCache::SizeToClass(std::size_t size)
+{
+    // 档位：16..128 步长 16，160..256 步长 32，320..512 步长 64
+    if (size <= 128)
+    {
+        return (size + 15) / 16 - 1;
+    }
+    if (size <= 256)
+    {
+        return 8 + (size - 129) / 32;
+    }
+    return 12 + (size - 257) / 64;
+}
+
+std::size_t ThreadAllocCache::ClassToSize(std::size_t sizeClass)
+{
+    if (sizeClass < 8)
+    {
+        return (sizeClass + 1) * 16;
+    }
+    if (sizeClass < 12)
+    {
+        return 128 + (sizeClass - 7) * 32;
+    }
+    return 256 + (sizeClass - 11) * 64;
+}
+
+void* ThreadAllocCache::Allocate(AllocatorEpoch* epoch, std::size_t size, MemoryTag tag)
+{
+    auto& state = t_state;
+    if (state.Dead)
+    {
+        return nullptr;
+    }
+
+    const std::size_t sizeClass = SizeToClass(size);
+    if (sizeClass < SmallSlabAllocator::ClassCount && static_cast<std::size_t>(tag) < SmallSlabAllocator::TagCount)
+    {
+        if (void* ptr = AllocateSlab(state, epoch, sizeClass, tag))
+        {
+            return ptr;
+        }
+    }
+
+    auto& mag = state.Magazines[sizeClass];
+    if (state.Epoch != epoch || mag.Count == 0)
+    {
+        if (!Refill(state, epoch, sizeClass))
+        {
+            return nullptr;
+        }
+    }
+
+    void* ptr = mag.Blocks[--mag.Count];
+    TlsfAllocator::StampCachedBlock(ptr, tag, size);
+    state.Delta.OnAlloc(tag, size);
+    CountOp(state);
+    return ptr;
+}
+
+bool ThreadAllocCache::Free(AllocatorEpoch* epoch, void* ptr, std::size_t size)
+{
+    // 已知大小超出 slab 档位时不必做区间判断
+    if (size <= SmallSlabAllocator::MaxBlockBytes && epoch->Slabs.Contains(ptr))
+    {
+        const std::size_t sizeClass = (size != 0) ? SizeToClass(size) : SmallSlabAllocator::GetBlockClass(ptr);
+        assert(sizeClass == SmallSlabAllocator::GetBlockClass(ptr) && "sized free does not match the allocation");
+        FreeSlab(t_state, epoch, ptr, sizeClass);
+        return true;
+    }
+
+    MemoryBlockInfo info;
+    if (!TlsfAllocator::QueryBlock(ptr, info) || info.SizeClass == 0)
+    {
+        return false;
+    }
+
+    auto& state = t_state;
+    if (state.Dead)
+    {
+        // 线程已进入退出阶段：直接逐块归还
+        epoch->Allocator.GetCounters().OnFree(info.Tag, info.RequestedBytes);
+        epoch->Allocator.FreeCachedBatch(&ptr, 1);
+        return true;
+    }
+
+    if (state.Epoch != epoch)
+    {
+        Rebind(state, epoch);
+    }
+
+    state.Delta.OnFree(info.Tag, info.RequestedBytes);
+
+    const std::size_t sizeClass = info.SizeClass - 1u;
+    auto& mag = state.Magazines[sizeClass];
+    if (mag.Count == MagazineCapacity)
+    {
+        Drain(state, sizeClass, BatchCount);
+    }
+    mag.Blocks[mag.Count++] = ptr;
+    CountOp(state);
+    return true;
+}
+
+void ThreadAllocCache::Flush()
+{
+    auto& state = t_state;
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (!epoch || state.Epoch != epoch)
+    {
+        Rebind(state, epoch);
+        return;
+    }
+
+    for (std::size_t sizeClass = 0; sizeClass < ClassCount; ++sizeClass)
+    {
+        auto& mag = state.Magazines[sizeClass];
+        if (mag.Count == 0)
+        {
+            continue;
+        }
+        epoch->Allocator.FreeCachedBatch(mag.Blocks, mag.Count);
+        mag.Count = 0;
+    }
+    for (auto& perTag : state.SlabMagazines)
+    {
+        for (auto& mag : perTag)
+        {
+            if (mag.Count != 0)
+            {
+                epoch->Slabs.FreeBatch(mag.Blocks, mag.Count);
+                mag.Count = 0;
+            }
+        }
+    }
+    FoldDelta(state);
+}
+
+void ThreadAllocCache::FoldStats()
+{
+    auto& state = t_state;
+    AllocatorEpoch* epoch = LoadAllocatorEpoch();
+    if (!epoch || state.Epoch != epoch)
+    {
+        state.OpsSinceFold = 0;
+        return;
+    }
+    FoldDelta(state);
+}
+
+} // namespace TE
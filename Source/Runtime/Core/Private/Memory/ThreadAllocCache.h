@@ -0,0 +1,58 @@
+// ToyEngine Core Module
+// 线程本地小块缓存（magazine）—— TlsfAllocator 前端
+
+#pragma once
+
+#include "Memory/MemoryTag.h"
+#include "Memory/TlsfAllocator.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TE {
+
+struct AllocatorEpoch;
+
+/// <summary>
+/// 线程本地小块缓存：
+/// - 每个线程按尺寸档位持有一组空闲块（magazine），命中时分配/释放无锁；
+/// - 空/满时才加锁向 TlsfAllocator 批量补货/归还；
+/// - <= 64 字节的档位另按 (档位, tag) 持有 slab magazine，由 SmallSlabAllocator 供货（块不带块头），
+///   slab 层关闭或地址用尽时回退到上面带块头的档位；
+/// - 统计在线程本地累积增量，于补货/归还、定期折算点或 GetMemoryStats 时无锁折算进分片计数器。
+/// </summary>
+class ThreadAllocCache final
+{
+public:
+    static constexpr std::size_t MaxSmallBytes = 512;
+    static constexpr std::size_t ClassCount = 16;
+    static constexpr std::uint32_t MagazineCapacity = 64;
+    static constexpr std::uint32_t BatchCount = MagazineCapacity / 2;
+    // slab magazine 按 (档位, tag) 分开，容量减半以控制每线程的 TLS 占用
+    static constexpr std::uint32_t SlabMagazineCapacity = 32;
+    static constexpr std::uint32_t SlabBatchCount = SlabMagazineCapacity / 2;
+
+    [[nodiscard]] static bool CanServe(std::size_t size, std::size_t align)
+    {
+        return size != 0 && size <= MaxSmallBytes && align <= TlsfAllocator::CachedBlockAlign;
+    }
+
+    [[nodiscard]] static std::size_t SizeToClass(std::size_t size);
+    [[nodiscard]] static std::size_t ClassToSize(std::size_t sizeClass);
+
+    // 从调用线程的 magazine 分配；epoch 为调用方已加载的当前纪元（可为空，补货时惰性创建）。
+    // 失败（缓存不可用/内存不足）返回 nullptr，由调用方回退到普通路径
+    [[nodiscard]] static void* Allocate(AllocatorEpoch* epoch, std::size_t size, MemoryTag tag);
+
+    // 若 ptr 是线程缓存块（含 slab 块）则回收并返回 true；否则返回 false。epoch 必须非空。
+    // size 为分配时请求的大小（sized delete），0 表示未知
+    static bool Free(AllocatorEpoch* epoch, void* ptr, std::size_t size = 0);
+
+    // 把调用线程缓存的全部块与统计增量归还给分配器
+    static void Flush();
+
+    // 仅折算调用线程的统计增量
+    static void FoldStats();
+};
+
+} // namespace TE
@@ -9,15 +9,6 @@
 #include <cstring>
 #include <limits>
 
-#if defined(_WIN32)
-// 避免 Windows 头文件定义 min/max 宏，破坏 std::min/std::max
-#ifndef NOMINMAX
-#define NOMINMAX
-#endif
-#define WIN32_LEAN_AND_MEAN
-#include <windows.h>
-#endif
-
 namespace TE {
 
 static std::size_t ClampGrow(std::size_t bytes)
@@ -27,8 +18,9 @@ static std::size_t ClampGrow(std::size_t bytes)
     return std::clamp(bytes, MinGrow, MaxGrow);
 }
 
-TlsfAllocator::TlsfAllocator(std::size_t initialBytes)
+TlsfAllocator::TlsfAllocator(std::size_t initialBytes, const MemoryHeapConfig& config)
     : m_initialBytes(initialBytes)
+    , m_config(config)
     , m_nextGrowBytes(ClampGrow(initialBytes / 2))
 {
 }
@@ -36,7 +28,18 @@ TlsfAllocator::TlsfAllocator(std::size_t initialBytes)
 TlsfAllocator::~TlsfAllocator()
 {
     std::scoped_lock lock(m_mutex);
+    ReleasePoolsLocked();
+}
+
+void TlsfAllocator::Retire()
+{
+    std::scoped_lock lock(m_mutex);
+    m_retired = true;
+    ReleasePoolsLocked();
+}
 
+void TlsfAllocator::ReleasePoolsLocked()
+{
     // TLSF destroy 不做事，但调用以保持语义完整
     if (m_tlsf)
     {
@@ -44,14 +47,16 @@ TlsfAllocator::~TlsfAllocator()
         m_tlsf = nullptr;
     }
 
-    for (const auto& pool : m_pools)
+    for (std::size_t i = 0; i < m_regionCount; ++i)
     {
-        if (pool.Base && pool.Bytes)
-        {
-            OsRelease(pool.Base, pool.Bytes);
-        }
+        m_regions[i].Release();
     }
-    m_pools.clear();
+    m_regionCount = 0;
+    m_pools = {};
+    m_poolCount = 0;
+    m_trimSpanCount = 0;
+    m_trimPending.store(false, std::memory_order_relaxed);
+    PublishFootprintLocked();
 }
 
 std::size_t TlsfAllocator::DefaultAlign()
@@ -89,34 +94,51 @@ bool TlsfAllocator::CheckedAdd(std::size_t a, std::size_t b, std::size_t& out)
     return true;
 }
 
-void* TlsfAllocator::OsReserveCommit(std::size_t bytes, std::size_t align)
+VirtualMemoryRegion* TlsfAllocator::ReserveRegionLocked(std::size_t minBytes)
 {
-#if defined(_WIN32)
-    // VirtualAlloc 返回的地址通常满足页对齐（>= 4KB），足以覆盖 tlsf_align_size(4/8)。
-    (void)align;
-    return ::VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
-#else
-    if (!IsPowerOfTwo(align) || bytes == 0)
+    if (m_regionCount >= MaxRegions)
     {
         return nullptr;
     }
-    void* ptr = nullptr;
-    if (posix_memalign(&ptr, align, bytes) != 0)
+
+    // 地址空间受限（ulimit -v / 32 位）时逐级减半，直到刚好容纳本次所需
+    auto& region = m_regions[m_regionCount];
+    std::size_t bytes = std::max(m_config.ReserveBytes, minBytes);
+    while (!region.Reserve(bytes, m_config.HugePages))
     {
-        return nullptr;
+        if (bytes <= minBytes)
+        {
+            return nullptr;
+        }
+        bytes = std::max(bytes / 2, minBytes);
     }
-    return ptr;
-#endif
+
+    ++m_regionCount;
+    return &region;
 }
 
-void TlsfAllocator::OsRelease(void* ptr, std::size_t bytes)
+bool TlsfAllocator::IsPoolEmpty(pool_t pool, void*& outFreeBlock, std::size_t& outFreeBytes)
 {
-    (void)bytes;
-#if defined(_WIN32)
-    ::VirtualFree(ptr, 0, MEM_RELEASE);
-#else
-    std::free(ptr);
-#endif
+    struct WalkState
+    {
+        std::size_t Blocks = 0;
+        bool AnyUsed = false;
+        void* Ptr = nullptr;
+        std::size_t Bytes = 0;
+    } state;
+
+    tlsf_walk_pool(pool, [](void* ptr, std::size_t size, int used, void* user) {
+        auto* walk = static_cast<WalkState*>(user);
+        walk->Blocks += 1;
+        walk->AnyUsed = walk->AnyUsed || (used != 0);
+        walk->Ptr = ptr;
+        walk->Bytes = size;
+    }, &state);
+
+    // 完全空闲的池段只剩一个覆盖全段的空闲块
+    outFreeBlock = state.Ptr;
+    outFreeBytes = state.Bytes;
+    return state.Blocks == 1 && !state.AnyUsed;
 }
 
 bool TlsfAllocator::EnsureInitializedLocked()
@@ -125,6 +147,10 @@ bool TlsfAllocator::EnsureInitializedLocked()
     {
         return true;
     }
+    if (m_retired)
+    {
+        return false;
+    }
 
     const std::size_t align = DefaultAlign();
     if (!IsPowerOfTwo(align))
@@ -132,108 +158,298 @@ bool TlsfAllocator::EnsureInitializedLocked()
         return false;
     }
 
-    // 第一块：control + pool 一起放在同一块大内存里
+    // 第一段：control + pool 一起放在保留区起始的已提交部分
     const std::size_t bytes = std::max<std::size_t>(m_initialBytes, 64ull * 1024ull * 1024ull);
-    void* base = OsReserveCommit(bytes, align);
-    if (!base)
+    VirtualMemoryRegion* region = ReserveRegionLocked(bytes);
+    if (!region)
+    {
+        return false;
+    }
+    if (!region->Commit(bytes))
     {
+        region->Release();
+        --m_regionCount;
         return false;
     }
 
-    tlsf_t tlsf = tlsf_create_with_pool(base, bytes);
+    tlsf_t tlsf = tlsf_create_with_pool(region->Base(), region->CommittedBytes());
     if (!tlsf)
     {
-        OsRelease(base, bytes);
+        region->Release();
+        --m_regionCount;
         return false;
     }
 
     m_tlsf = tlsf;
     {
         PoolRecord rec;
-        rec.Base = base;
-        rec.Bytes = bytes;
+        rec.Base = region->Base();
+        rec.Bytes = region->CommittedBytes();
         rec.Pool = tlsf_get_pool(m_tlsf);
-        m_pools.push_back(rec);
+        rec.Region = static_cast<std::uint32_t>(m_regionCount - 1);
+        m_pools[m_poolCount++] = rec;
     }
 
+    PublishFootprintLocked();
     return true;
 }
 
 bool TlsfAllocator::AddPoolLocked(std::size_t bytes)
 {
-    if (!m_tlsf)
+    if (!m_tlsf || m_poolCount >= MaxPools)
     {
         return false;
     }
 
-    const std::size_t align = DefaultAlign();
     const std::size_t growBytes = ClampGrow(bytes > 0 ? bytes : (16ull * 1024ull * 1024ull));
 
-    void* base = OsReserveCommit(growBytes, align);
-    if (!base)
+    // 优先在当前保留区内紧接已提交部分原地提交；剩余地址不足时才另开保留区
+    VirtualMemoryRegion* region = (m_regionCount > 0) ? &m_regions[m_regionCount - 1] : nullptr;
+    if (!region || region->ReservedBytes() - region->CommittedBytes() < growBytes)
+    {
+        region = ReserveRegionLocked(growBytes);
+        if (!region)
+        {
+            return false;
+        }
+    }
+
+    const std::size_t oldCommitted = region->CommittedBytes();
+    if (!region->Commit(oldCommitted + growBytes))
     {
         return false;
     }
 
-    pool_t pool = tlsf_add_pool(m_tlsf, base, growBytes);
+    void* base = region->Base() + oldCommitted;
+    const std::size_t segmentBytes = region->CommittedBytes() - oldCommitted;
+    pool_t pool = tlsf_add_pool(m_tlsf, base, segmentBytes);
     if (!pool)
     {
-        OsRelease(base, growBytes);
+        region->ShrinkCommit(oldCommitted);
         return false;
     }
 
     {
         PoolRecord rec;
         rec.Base = base;
-        rec.Bytes = growBytes;
+        rec.Bytes = segmentBytes;
         rec.Pool = pool;
-        m_pools.push_back(rec);
+        rec.Region = static_cast<std::uint32_t>(region - m_regions.data());
+        m_pools[m_poolCount++] = rec;
     }
 
     // 下一次按几何增长
     m_nextGrowBytes = ClampGrow(growBytes * 2);
+    PublishFootprintLocked();
     return true;
 }
 
-TlsfAllocator::AllocHeader* TlsfAllocator::HeaderFromUserPtr(void* userPtr)
+std::size_t TlsfAllocator::Trim()
 {
-    if (!userPtr)
+    std::scoped_lock lock(m_mutex);
+    return TrimLocked(false);
+}
+
+std::size_t TlsfAllocator::TrimIdle()
+{
+    if (!m_trimPending.load(std::memory_order_relaxed))
     {
-        return nullptr;
+        return 0;
     }
-    auto* header = reinterpret_cast<AllocHeader*>(
-        static_cast<std::byte*>(userPtr) - sizeof(AllocHeader));
-    return header;
+    std::scoped_lock lock(m_mutex);
+    return TrimLocked(true);
+}
+
+std::size_t TlsfAllocator::TrimLocked(bool confirmIdle)
+{
+    m_freedSinceTrim = 0;
+    m_trimPending.store(false, std::memory_order_relaxed);
+    if (!m_tlsf)
+    {
+        return 0;
+    }
+
+    // 上一遍的记录（之后被分配切分过的已由 ForgetTrimSpansLocked 移除）；本遍重新生成
+    const std::array<TrimSpan, MaxTrimSpans> previous = m_trimSpans;
+    const std::size_t previousCount = m_trimSpanCount;
+    m_trimSpanCount = 0;
+
+    std::size_t returned = 0;
+
+    // 1) 尾部整段空闲：从 TLSF 摘除并缩短提交区（首段承载控制结构，始终保留）
+    while (m_poolCount > 1)
+    {
+        PoolRecord& rec = m_pools[m_poolCount - 1];
+        void* freeBlock = nullptr;
+        std::size_t freeBytes = 0;
+        if (!IsPoolEmpty(rec.Pool, freeBlock, freeBytes))
+        {
+            break;
+        }
+        // 策略回收时整段须在上一遍就已空闲；否则留到下面记为候选
+        if (confirmIdle && !FindTrimSpan(previous.data(), previousCount, freeBlock, freeBytes))
+        {
+            break;
+        }
+
+        tlsf_remove_pool(m_tlsf, rec.Pool);
+        auto& region = m_regions[rec.Region];
+        const auto offset = static_cast<std::size_t>(static_cast<std::byte*>(rec.Base) - region.Base());
+        if (offset == 0)
+        {
+            region.Release();
+            --m_regionCount;
+        }
+        else
+        {
+            region.ShrinkCommit(offset);
+        }
+
+        returned += rec.Bytes;
+        // 回落到被摘除段的大小，避免下一次增长直接翻倍
+        m_nextGrowBytes = ClampGrow(rec.Bytes);
+        rec = {};
+        --m_poolCount;
+    }
+
+    // 2) 其余段内的大空闲块：丢弃物理页，地址保持可用。
+    //    已丢弃且未再被切分的跨度不重复 madvise；策略回收时新出现的跨度只记为候选
+    struct DiscardState
+    {
+        TlsfAllocator* Self = nullptr;
+        const VirtualMemoryRegion* Region = nullptr;
+        std::size_t MinSpan = 0;
+        std::size_t Returned = 0;
+        const TrimSpan* Previous = nullptr;
+        std::size_t PreviousCount = 0;
+        bool ConfirmIdle = false;
+    };
+
+    for (std::size_t i = 0; i < m_poolCount; ++i)
+    {
+        DiscardState state;
+        state.Self = this;
+        state.Region = &m_regions[m_pools[i].Region];
+        state.MinSpan = std::max<std::size_t>(m_config.TrimMinSpanBytes, state.Region->Granularity());
+        state.Previous = previous.data();
+        state.PreviousCount = previousCount;
+        state.ConfirmIdle = confirmIdle;
+
+        tlsf_walk_pool(m_pools[i].Pool, [](void* ptr, std::size_t size, int used, void* user) {
+            auto* discard = static_cast<DiscardState*>(user);
+            if (used || size < discard->MinSpan)
+            {
+                return;
+            }
+
+            TrimSpan span{ ptr, size, false };
+            const TrimSpan* previous = FindTrimSpan(discard->Previous, discard->PreviousCount, ptr, size);
+            if (previous && previous->Discarded)
+            {
+                span.Discarded = true;
+            }
+            else if (!discard->ConfirmIdle || previous)
+            {
+                // 空闲块数据区开头存放空闲链表指针，末尾是下一块的 prev_phys 字段，二者必须保留
+                constexpr std::size_t FreeLinks = 2 * sizeof(void*);
+                constexpr std::size_t NextPrevPhys = sizeof(void*);
+                discard->Returned += discard->Region->Discard(static_cast<std::byte*>(ptr) + FreeLinks,
+                                                              size - FreeLinks - NextPrevPhys);
+                span.Discarded = true;
+            }
+
+            // 记录表满时多出的跨度本遍不记录：显式回收照常丢弃，策略回收留到之后的遍次
+            TlsfAllocator& self = *discard->Self;
+            if (self.m_trimSpanCount < MaxTrimSpans)
+            {
+                self.m_trimSpans[self.m_trimSpanCount++] = span;
+            }
+        }, &state);
+
+        returned += state.Returned;
+    }
+
+    bool pendingCandidates = false;
+    for (std::size_t i = 0; i < m_trimSpanCount; ++i)
+    {
+        pendingCandidates = pendingCandidates || !m_trimSpans[i].Discarded;
+    }
+    // 还有待确认的候选时，下一次 TrimIdle 需要再走一遍
+    m_trimPending.store(pendingCandidates, std::memory_order_relaxed);
+
+    m_lastTrimBytes.store(returned, std::memory_order_relaxed);
+    PublishFootprintLocked();
+    return returned;
 }
 
-void TlsfAllocator::OnAllocLocked(MemoryTag tag, std::uint64_t bytes)
+void TlsfAllocator::NoteFreedLocked(std::size_t bytes)
 {
-    const auto idx = static_cast<std::size_t>(tag);
-    if (idx < m_stats.PerTag.size())
+    // 释放路径只置待办标记：遍历池段与 madvise 留给 TrimIdle（Engine 每隔几秒在帧末调用），不在分配器锁内拖住其它线程
+    if (m_config.TrimThresholdBytes == 0)
+    {
+        return;
+    }
+    m_freedSinceTrim += bytes;
+    if (m_freedSinceTrim >= m_config.TrimThresholdBytes)
     {
-        auto& t = m_stats.PerTag[idx];
-        t.CurrentBytes += bytes;
-        t.PeakBytes = std::max(t.PeakBytes, t.CurrentBytes);
-        t.AllocCount += 1;
+        m_freedSinceTrim = 0;
+        m_trimPending.store(true, std::memory_order_relaxed);
     }
+}
 
-    m_stats.CurrentBytes += bytes;
-    m_stats.PeakBytes = std::max(m_stats.PeakBytes, m_stats.CurrentBytes);
-    m_stats.AllocCount += 1;
+const TlsfAllocator::TrimSpan* TlsfAllocator::FindTrimSpan(const TrimSpan* spans, std::size_t count,
+                                                          const void* ptr, std::size_t bytes)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (spans[i].Ptr == ptr && spans[i].Bytes == bytes)
+        {
+            return &spans[i];
+        }
+    }
+    return nullptr;
 }
 
-void TlsfAllocator::OnFreeLocked(MemoryTag tag, std::uint64_t bytes)
+void TlsfAllocator::ForgetTrimSpansLocked(const void* raw, std::size_t bytes)
 {
-    const auto idx = static_cast<std::size_t>(tag);
-    if (idx < m_stats.PerTag.size())
+    const auto begin = reinterpret_cast<std::uintptr_t>(raw);
+    const auto end = begin + bytes;
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_trimSpanCount; ++i)
+    {
+        const auto spanBegin = reinterpret_cast<std::uintptr_t>(m_trimSpans[i].Ptr);
+        const auto spanEnd = spanBegin + m_trimSpans[i].Bytes;
+        if (begin < spanEnd && spanBegin < end)
+        {
+            continue;
+        }
+        m_trimSpans[kept++] = m_trimSpans[i];
+    }
+    m_trimSpanCount = kept;
+}
+
+TlsfAllocator::AllocHeader* TlsfAllocator::HeaderFromUserPtr(void* userPtr)
+{
+    if (!userPtr)
     {
-        auto& t = m_stats.PerTag[idx];
-        t.CurrentBytes = (t.CurrentBytes >= bytes) ? (t.CurrentBytes - bytes) : 0;
-        t.FreeCount += 1;
+        return nullptr;
     }
+    auto* header = reinterpret_cast<AllocHeader*>(
+        static_cast<std::byte*>(userPtr) - sizeof(AllocHeader));
+    return header;
+}
 
-    m_stats.CurrentBytes = (m_stats.CurrentBytes >= bytes) ? (m_stats.CurrentBytes - bytes) : 0;
-    m_stats.FreeCount += 1;
+void TlsfAllocator::PublishFootprintLocked()
+{
+    std::uint64_t reserved = 0;
+    std::uint64_t committed = 0;
+    for (std::size_t i = 0; i < m_regionCount; ++i)
+    {
+        reserved += m_regions[i].ReservedBytes();
+        committed += m_regions[i].CommittedBytes();
+    }
+    m_reservedBytes.store(reserved, std::memory_order_relaxed);
+    m_committedBytes.store(committed, std::memory_order_relaxed);
 }
 
 void* TlsfAllocator::AllocateLocked(std::size_t size, std::size_t align, MemoryTag tag)
@@ -281,6 +497,10 @@ void* TlsfAllocator::AllocateLocked(std::size_t size, std::size_t align, MemoryT
     {
         return nullptr;
     }
+    if (m_trimSpanCount != 0)
+    {
+        ForgetTrimSpansLocked(raw, total);
+    }
 
     const auto rawAddr = reinterpret_cast<std::uintptr_t>(raw);
     const auto userAddr = AlignUp(rawAddr + sizeof(AllocHeader), align);
@@ -291,9 +511,11 @@ void* TlsfAllocator::AllocateLocked(std::size_t size, std::size_t align, MemoryT
     header->Magic = HeaderMagic;
     header->Alignment = static_cast<std::uint32_t>(align);
     header->Tag = tag;
+    header->SizeClass = 0;
+    header->Flags = 0;
     header->RequestedBytes = static_cast<std::uint64_t>(size);
 
-    OnAllocLocked(tag, header->RequestedBytes);
+    m_counters.OnAlloc(tag, header->RequestedBytes);
     return userPtr;
 }
 
@@ -365,6 +587,10 @@ void TlsfAllocator::Free(void* userPtr)
     }
 
     std::scoped_lock lock(m_mutex);
+    if (!m_tlsf)
+    {
+        return; // 已退役：池已归还 OS
+    }
     FreeLocked(userPtr);
 }
 
@@ -376,6 +602,7 @@ void TlsfAllocator::FreeLocked(void* userPtr)
         assert(false && "invalid pointer passed to TlsfAllocator::FreeLocked");
         return;
     }
+    assert(header->SizeClass == 0 && "thread-cached block must be returned through FreeCachedBatch");
 
     void* raw = header->RawPtr;
     const auto tag = header->Tag;
@@ -385,14 +612,192 @@ void TlsfAllocator::FreeLocked(void* userPtr)
     header->RawPtr = nullptr;
     header->RequestedBytes = 0;
 
-    OnFreeLocked(tag, bytes);
+    m_counters.OnFree(tag, bytes);
+    const std::size_t blockBytes = tlsf_block_size(raw);
     tlsf_free(m_tlsf, raw);
+    NoteFreedLocked(blockBytes);
+}
+
+std::size_t TlsfAllocator::AllocateCachedBatch(std::uint16_t sizeClass, std::size_t blockBytes,
+                                              void** outBlocks, std::size_t count)
+{
+    std::scoped_lock lock(m_mutex);
+
+    if (!EnsureInitializedLocked() || blockBytes == 0 || !outBlocks)
+    {
+        return 0;
+    }
+
+    // TLSF 原生对齐只有 tlsf_align_size()，额外预留把用户区对齐到 CachedBlockAlign
+    const std::size_t total = blockBytes + sizeof(AllocHeader) + (CachedBlockAlign - 1);
+
+    std::size_t produced = 0;
+    for (; produced < count; ++produced)
+    {
+        void* raw = tlsf_malloc(m_tlsf, total);
+        if (!raw)
+        {
+            if (!AddPoolLocked(m_nextGrowBytes))
+            {
+                break;
+            }
+            raw = tlsf_malloc(m_tlsf, total);
+            if (!raw)
+            {
+                break;
+            }
+        }
+        if (m_trimSpanCount != 0)
+        {
+            ForgetTrimSpansLocked(raw, total);
+        }
+
+        const auto rawAddr = reinterpret_cast<std::uintptr_t>(raw);
+        const auto userAddr = AlignUp(rawAddr + sizeof(AllocHeader), CachedBlockAlign);
+
+        auto* header = reinterpret_cast<AllocHeader*>(userAddr - sizeof(AllocHeader));
+        header->RawPtr = raw;
+        header->Magic = HeaderMagic;
+        header->Alignment = static_cast<std::uint32_t>(CachedBlockAlign);
+        header->Tag = MemoryTag::Unknown;
+        header->SizeClass = static_cast<std::uint16_t>(sizeClass + 1);
+        header->Flags = 0;
+        header->RequestedBytes = 0;
+
+        outBlocks[produced] = reinterpret_cast<void*>(userAddr);
+    }
+    return produced;
+}
+
+void TlsfAllocator::FreeCachedBatch(void* const* blocks, std::size_t count)
+{
+    std::scoped_lock lock(m_mutex);
+
+    if (!m_tlsf)
+    {
+        return;
+    }
+
+    std::size_t freedBytes = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto* header = HeaderFromUserPtr(blocks[i]);
+        if (!header || header->Magic != HeaderMagic || header->SizeClass == 0)
+        {
+            assert(false && "invalid pointer passed to TlsfAllocator::FreeCachedBatch");
+            continue;
+        }
+
+        void* raw = header->RawPtr;
+        header->Magic = 0;
+        header->RawPtr = nullptr;
+        freedBytes += tlsf_block_size(raw);
+        tlsf_free(m_tlsf, raw);
+    }
+    NoteFreedLocked(freedBytes);
+}
+
+std::size_t TlsfAllocator::CachedBlockFootprint(std::size_t blockBytes)
+{
+    const std::size_t total = blockBytes + sizeof(AllocHeader) + (CachedBlockAlign - 1);
+    return static_cast<std::size_t>(AlignUp(total, DefaultAlign())) + tlsf_alloc_overhead();
+}
+
+void TlsfAllocator::StampCachedBlock(void* userPtr, MemoryTag tag, std::size_t bytes)
+{
+    auto* header = HeaderFromUserPtr(userPtr);
+    header->Tag = tag;
+    header->Flags = 0;
+    header->RequestedBytes = static_cast<std::uint64_t>(bytes);
+}
+
+void TlsfAllocator::SetBlockSampled(void* userPtr, bool sampled)
+{
+    auto* header = HeaderFromUserPtr(userPtr);
+    if (!header || header->Magic != HeaderMagic)
+    {
+        return;
+    }
+    header->Flags = sampled ? static_cast<std::uint16_t>(header->Flags | BlockFlagSampled)
+                            : static_cast<std::uint16_t>(header->Flags & ~BlockFlagSampled);
 }
 
-MemoryStats TlsfAllocator::GetStats() const
+bool TlsfAllocator::QueryBlock(void* userPtr, MemoryBlockInfo& outInfo)
 {
+    const auto* header = HeaderFromUserPtr(userPtr);
+    if (!header || header->Magic != HeaderMagic)
+    {
+        return false;
+    }
+    outInfo.Tag = header->Tag;
+    outInfo.RequestedBytes = header->RequestedBytes;
+    outInfo.Alignment = header->Alignment;
+    outInfo.SizeClass = header->SizeClass;
+    outInfo.Sampled = (header->Flags & BlockFlagSampled) != 0;
+    return true;
+}
+
+void TlsfAllocator::BuildFragmentationReport(HeapFragmentationReport& outReport)
+{
+    struct WalkState
+    {
+        HeapFragmentationReport* Report = nullptr;
+        MemoryPoolReport* Pool = nullptr;
+    };
+
     std::scoped_lock lock(m_mutex);
-    return m_stats;
+    outReport.NextGrowBytes = m_nextGrowBytes;
+    outReport.PoolCount = static_cast<std::uint32_t>(m_poolCount);
+
+    for (std::size_t i = 0; i < m_poolCount; ++i)
+    {
+        MemoryPoolReport& pool = outReport.Pools[i];
+        pool.Bytes = m_pools[i].Bytes;
+
+        WalkState state{ &outReport, &pool };
+        tlsf_walk_pool(m_pools[i].Pool, [](void* /*ptr*/, std::size_t size, int used, void* user) {
+            auto* walk = static_cast<WalkState*>(user);
+            if (used)
+            {
+                walk->Pool->UsedBytes += size;
+                walk->Pool->UsedBlocks += 1;
+                return;
+            }
+            walk->Pool->FreeBytes += size;
+            walk->Pool->FreeBlocks += 1;
+            walk->Pool->LargestFreeBlock = std::max<std::uint64_t>(walk->Pool->LargestFreeBlock, size);
+
+            // 桶 i 覆盖 [16 << i, 32 << i)
+            std::size_t bucket = 0;
+            for (std::size_t bytes = size >> 5; bytes != 0; bytes >>= 1)
+            {
+                ++bucket;
+            }
+            bucket = std::min(bucket, HeapFragmentationReport::HistogramBuckets - 1);
+            walk->Report->FreeBlockCount[bucket] += 1;
+            walk->Report->FreeBlockBytes[bucket] += size;
+        }, &state);
+
+        outReport.UsedBytes += pool.UsedBytes;
+        outReport.FreeBytes += pool.FreeBytes;
+        outReport.UsedBlocks += pool.UsedBlocks;
+        outReport.FreeBlocks += pool.FreeBlocks;
+        outReport.LargestFreeBlock = std::max(outReport.LargestFreeBlock, pool.LargestFreeBlock);
+    }
+
+    outReport.FragmentationRatio = outReport.FreeBytes != 0
+        ? 1.0 - static_cast<double>(outReport.LargestFreeBlock) / static_cast<double>(outReport.FreeBytes)
+        : 0.0;
+}
+
+MemoryStats TlsfAllocator::GetStats()
+{
+    MemoryStats stats;
+    m_counters.Snapshot(stats);
+    stats.ReservedBytes = m_reservedBytes.load(std::memory_order_relaxed);
+    stats.CommittedBytes = m_committedBytes.load(std::memory_order_relaxed);
+    stats.LastTrimBytes = m_lastTrimBytes.load(std::memory_order_relaxed);
+    return stats;
 }
 
 } // namespace TE
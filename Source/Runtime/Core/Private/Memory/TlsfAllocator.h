@@ -4,11 +4,14 @@
 #pragma once
 
 #include "Memory/Memory.h"
+#include "Memory/MemoryCounters.h"
+#include "Memory/VirtualMemory.h"
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
-#include <vector>
 
 // Tlsf 是 C 实现
 extern "C" {
@@ -17,10 +20,20 @@ extern "C" {
 
 namespace TE {
 
+// 分配块的只读信息（由 AllocHeader 解析得到）
+struct MemoryBlockInfo
+{
+    MemoryTag Tag = MemoryTag::Unknown;
+    std::uint64_t RequestedBytes = 0;
+    std::size_t Alignment = 0;
+    std::uint16_t SizeClass = 0; // 0 = 普通块；否则为线程缓存尺寸档位 + 1
+    bool Sampled = false;        // 是否被采样分析器记录
+};
+
 class TlsfAllocator final
 {
 public:
-    explicit TlsfAllocator(std::size_t initialBytes);
+    TlsfAllocator(std::size_t initialBytes, const MemoryHeapConfig& config);
     ~TlsfAllocator();
 
     TlsfAllocator(const TlsfAllocator&) = delete;
@@ -30,14 +43,72 @@ public:
     [[nodiscard]] void* Reallocate(void* userPtr, std::size_t newSize, std::size_t align, MemoryTag tag);
     void  Free(void* userPtr);
 
-    [[nodiscard]] MemoryStats GetStats() const;
+    // 不持有分配器锁：计数器各分片原子汇总，堆占用字段为最近一次池变化时发布的值
+    [[nodiscard]] MemoryStats GetStats();
+
+    // 持锁遍历全部池段填写碎片报告
+    void BuildFragmentationReport(HeapFragmentationReport& outReport);
+
+    // 分片计数器（线程缓存直接向其折算统计增量）
+    [[nodiscard]] MemoryCounters& GetCounters() { return m_counters; }
+
+    /// <summary>
+    /// 退役：释放全部 TLSF 池，此后分配失败、释放被忽略。
+    /// 调用方须先等过纪元宽限期（没有线程仍在读区间内使用本分配器），池内存随即归还 OS。
+    /// </summary>
+    void Retire();
+
+    /// <summary>
+    /// 显式回收：立即丢弃不小于 TrimMinSpanBytes 的空闲跨度的物理页，并摘除完全空闲的尾部段、缩短提交区。
+    /// 返回本次归还给 OS 的字节数。
+    /// </summary>
+    std::size_t Trim();
+
+    /// <summary>
+    /// 按策略回收一遍：只处理上一遍起一直空闲、期间没有被分配切分过的跨度 / 尾部段，
+    /// 本遍新出现的空闲跨度只记为候选。释放路径只在累计释放达到 TrimThresholdBytes 时置待办标记，
+    /// 没有待办且没有候选时直接返回 0（不加锁）。
+    /// </summary>
+    std::size_t TrimIdle();
+
+    // ==================== 线程缓存（magazine）批量接口 ====================
+    // 以下接口交付/回收的块不计入统计，由线程缓存在交付给用户时自行记账，
+    // 并通过 GetCounters().Apply 批量折算。
+
+    /// <summary>
+    /// 一次加锁批量分配 count 个固定档位块（用户区 blockBytes，对齐 CachedBlockAlign）。
+    /// 返回实际分配到的数量。
+    /// </summary>
+    [[nodiscard]] std::size_t AllocateCachedBatch(std::uint16_t sizeClass, std::size_t blockBytes,
+                                                  void** outBlocks, std::size_t count);
+
+    /// <summary>
+    /// 一次加锁批量归还线程缓存块。
+    /// </summary>
+    void FreeCachedBatch(void* const* blocks, std::size_t count);
+
+    // 线程缓存块在交付给用户时写入本次请求的 tag / 大小
+    static void StampCachedBlock(void* userPtr, MemoryTag tag, std::size_t bytes);
+
+    // 解析块头；指针不是来自本分配器时返回 false
+    [[nodiscard]] static bool QueryBlock(void* userPtr, MemoryBlockInfo& outInfo);
+
+    // 采样分析器在块头上的标记（释放时据此决定是否查表）
+    static void SetBlockSampled(void* userPtr, bool sampled);
+
+    static constexpr std::size_t CachedBlockAlign = 16;
+
+    // 一个用户区 blockBytes 的线程缓存块在 TLSF 中实际占用的字节数（含块头、对齐余量与 TLSF 块开销）
+    [[nodiscard]] static std::size_t CachedBlockFootprint(std::size_t blockBytes);
 
 private:
+    // 一个 TLSF 池段：位于某个保留区已提交部分中的一段连续地址
     struct PoolRecord
     {
         void* Base = nullptr;
         std::size_t Bytes = 0;
         pool_t Pool = nullptr;
+        std::uint32_t Region = 0;
     };
 
     struct AllocHeader
@@ -46,10 +117,21 @@ private:
         std::uint32_t Magic = 0;          // 调试用
         std::uint32_t Alignment = 0;      // 用户请求对齐（realloc 时用于保留原语义）
         MemoryTag Tag = MemoryTag::Unknown;
+        std::uint16_t SizeClass = 0;      // 线程缓存档位 + 1（0 表示普通块）
+        std::uint16_t Flags = 0;          // BlockFlag*（占用原有填充，不改变头大小）
         std::uint64_t RequestedBytes = 0; // 用户请求大小（用于统计）
     };
 
+    // 上一遍 Trim 看到的大空闲跨度：Discarded 为 false 的是等待下一遍确认的候选
+    struct TrimSpan
+    {
+        void* Ptr = nullptr;
+        std::size_t Bytes = 0;
+        bool Discarded = false;
+    };
+
     static constexpr std::uint32_t HeaderMagic = 0x54454D4D; // 'T''E''M''M'
+    static constexpr std::uint16_t BlockFlagSampled = 1u << 0;
 
     [[nodiscard]] static std::size_t DefaultAlign();
     [[nodiscard]] static std::size_t NormalizeAlign(std::size_t align);
@@ -57,28 +139,59 @@ private:
     [[nodiscard]] static std::uintptr_t AlignUp(std::uintptr_t x, std::size_t align);
     [[nodiscard]] static bool CheckedAdd(std::size_t a, std::size_t b, std::size_t& out);
 
-    // OS 后备内存
-    [[nodiscard]] static void* OsReserveCommit(std::size_t bytes, std::size_t align);
-    static void  OsRelease(void* ptr, std::size_t bytes);
+    // OS 后备内存：先保留地址范围，池段在保留区内原地向上提交
+    [[nodiscard]] VirtualMemoryRegion* ReserveRegionLocked(std::size_t minBytes);
+    // 完全空闲时返回 true，并给出覆盖全段的空闲块
+    [[nodiscard]] static bool IsPoolEmpty(pool_t pool, void*& outFreeBlock, std::size_t& outFreeBytes);
 
     [[nodiscard]] bool EnsureInitializedLocked();
     [[nodiscard]] bool AddPoolLocked(std::size_t bytes);
+    // confirmIdle：只回收上一遍已记录且未被触碰的跨度（TrimIdle）；否则全部回收（Trim）
+    std::size_t TrimLocked(bool confirmIdle);
+    void NoteFreedLocked(std::size_t bytes);
+
+    // 分配从 raw 起的 bytes 字节：与之重叠的回收记录失效（跨度已被切分，不再视为空闲）
+    void ForgetTrimSpansLocked(const void* raw, std::size_t bytes);
+    [[nodiscard]] static const TrimSpan* FindTrimSpan(const TrimSpan* spans, std::size_t count,
+                                                      const void* ptr, std::size_t bytes);
+
     [[nodiscard]] void* AllocateLocked(std::size_t size, std::size_t align, MemoryTag tag);
     void  FreeLocked(void* userPtr);
 
     [[nodiscard]] static AllocHeader* HeaderFromUserPtr(void* userPtr);
 
-    void OnAllocLocked(MemoryTag tag, std::uint64_t bytes);
-    void OnFreeLocked(MemoryTag tag, std::uint64_t bytes);
+    // 池/提交区变化后发布保留量与提交量，供无锁的 GetStats 读取
+    void PublishFootprintLocked();
+
+    void ReleasePoolsLocked();
 
 private:
+    // 池表使用定长数组：开启全局 new/delete 覆盖时，持锁期间不能再经由 operator new 回到本分配器
+    static constexpr std::size_t MaxPools = 64;
+    static constexpr std::size_t MaxRegions = 8;
+    static constexpr std::size_t MaxTrimSpans = 64;
+    static_assert(MaxPools <= HeapFragmentationReport::MaxPools);
+
     const std::size_t m_initialBytes = 0;
+    const MemoryHeapConfig m_config;
     std::size_t m_nextGrowBytes = 0;
+    std::size_t m_freedSinceTrim = 0;
 
     mutable std::mutex m_mutex;
     tlsf_t m_tlsf = nullptr;
-    std::vector<PoolRecord> m_pools;
-    MemoryStats m_stats{};
+    bool m_retired = false;
+    std::array<PoolRecord, MaxPools> m_pools{};
+    std::size_t m_poolCount = 0;
+    std::array<VirtualMemoryRegion, MaxRegions> m_regions{};
+    std::size_t m_regionCount = 0;
+    std::array<TrimSpan, MaxTrimSpans> m_trimSpans{};
+    std::size_t m_trimSpanCount = 0;
+    std::atomic<bool> m_trimPending{false};
+
+    MemoryCounters m_counters;
+    std::atomic<std::uint64_t> m_reservedBytes{0};
+    std::atomic<std::uint64_t> m_committedBytes{0};
+    std::atomic<std::uint64_t> m_lastTrimBytes{0};
 };
 
 } // namespace TE
@@ -0,0 +1,322 @@
+// ToyEngine Core Module
+// 虚拟地址保留区实现
+
+#include "Memory/VirtualMemory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace TE {
+
+namespace {
+
+std::size_t AlignUpSize(std::size_t x, std::size_t align)
+{
+    return (x + (align - 1)) & ~(align - 1);
+}
+
+std::uintptr_t AlignUpAddr(std::uintptr_t x, std::size_t align)
+{
+    return (x + (align - 1)) & ~(static_cast<std::uintptr_t>(align - 1));
+}
+
+std::uintptr_t AlignDownAddr(std::uintptr_t x, std::size_t align)
+{
+    return x & ~(static_cast<std::uintptr_t>(align - 1));
+}
+
+#if !defined(_WIN32)
+constexpr int ReserveFlags = MAP_PRIVATE | MAP_ANONYMOUS
+#if defined(MAP_NORESERVE)
+    | MAP_NORESERVE
+#endif
+    ;
+
+// 普通页保留；需要透明大页时多保留一个大页，裁掉首尾使基址按大页对齐
+std::byte* ReserveAligned(std::size_t bytes, std::size_t align)
+{
+    const std::size_t span = (align > VirtualMemoryRegion::PageSize()) ? bytes + align : bytes;
+    void* raw = ::mmap(nullptr, span, PROT_NONE, ReserveFlags, -1, 0);
+    if (raw == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    if (span == bytes)
+    {
+        return static_cast<std::byte*>(raw);
+    }
+
+    const auto rawAddr = reinterpret_cast<std::uintptr_t>(raw);
+    const auto alignedAddr = AlignUpAddr(rawAddr, align);
+    const std::size_t head = alignedAddr - rawAddr;
+    const std::size_t tail = span - head - bytes;
+    if (head != 0)
+    {
+        ::munmap(raw, head);
+    }
+    if (tail != 0)
+    {
+        ::munmap(reinterpret_cast<void*>(alignedAddr + bytes), tail);
+    }
+    return reinterpret_cast<std::byte*>(alignedAddr);
+}
+#endif
+
+} // namespace
+
+std::size_t VirtualMemoryRegion::PageSize()
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    ::GetSystemInfo(&info);
+    return static_cast<std::size_t>(info.dwPageSize);
+#else
+    static const std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return pageSize;
+#endif
+}
+
+std::size_t VirtualMemoryRegion::HugePageSize()
+{
+    return 2ull * 1024ull * 1024ull;
+}
+
+bool VirtualMemoryRegion::Reserve(std::size_t bytes, MemoryHugePages hugePages)
+{
+    if (m_base || bytes == 0)
+    {
+        return false;
+    }
+
+#if defined(_WIN32)
+    // 大页在 Windows 上需要 SeLockMemoryPrivilege 且不可分段提交，这里统一使用普通页
+    (void)hugePages;
+    m_granularity = PageSize();
+    m_reserved = AlignUpSize(bytes, m_granularity);
+    m_base = static_cast<std::byte*>(::VirtualAlloc(nullptr, m_reserved, MEM_RESERVE, PAGE_NOACCESS));
+    m_hugePages = MemoryHugePages::Off;
+#else
+    // 大页模式下保留区与提交粒度都按 2MB 对齐；显式大页在 Commit 时逐段映射
+    const bool wantHugePages = hugePages != MemoryHugePages::Off;
+    m_granularity = wantHugePages ? HugePageSize() : PageSize();
+    m_reserved = AlignUpSize(bytes, m_granularity);
+    m_base = ReserveAligned(m_reserved, m_granularity);
+    m_hugePages = MemoryHugePages::Off;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (m_base && wantHugePages)
+    {
+        // 仅是提示：内核未开启 THP 时忽略失败。显式大页映射失败回退的普通页也能因此合并为大页
+        (void)::madvise(m_base, m_reserved, MADV_HUGEPAGE);
+        m_hugePages = MemoryHugePages::Transparent;
+#if defined(MAP_HUGETLB)
+        if (hugePages == MemoryHugePages::Explicit)
+        {
+            m_hugePages = MemoryHugePages::Explicit;
+        }
+#endif
+    }
+#endif
+#endif
+
+    if (!m_base)
+    {
+        m_reserved = 0;
+        m_granularity = 0;
+        return false;
+    }
+    m_committed = 0;
+    return true;
+}
+
+void VirtualMemoryRegion::Release()
+{
+    if (!m_base)
+    {
+        return;
+    }
+#if defined(_WIN32)
+    ::VirtualFree(m_base, 0, MEM_RELEASE);
+#else
+    ::munmap(m_base, m_reserved);
+#endif
+    m_base = nullptr;
+    m_reserved = 0;
+    m_committed = 0;
+    m_granularity = 0;
+    m_hugePages = MemoryHugePages::Off;
+}
+
+bool VirtualMemoryRegion::Commit(std::size_t bytes)
+{
+    if (!m_base)
+    {
+        return false;
+    }
+    const std::size_t target = std::min(AlignUpSize(bytes, m_granularity), m_reserved);
+    if (target <= m_committed)
+    {
+        return bytes <= m_committed;
+    }
+
+    std::byte* begin = m_base + m_committed;
+    const std::size_t delta = target - m_committed;
+#if defined(_WIN32)
+    if (!::VirtualAlloc(begin, delta, MEM_COMMIT, PAGE_READWRITE))
+    {
+        return false;
+    }
+#else
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    if (m_hugePages == MemoryHugePages::Explicit)
+    {
+        // hugetlb 页在 mmap 时按段记账：预留池不足会在这里干净地失败（而不是触碰时 SIGBUS），
+        // 此时该段回退为普通页（已有 MADV_HUGEPAGE 提示）。
+        // 始终以 MAP_FIXED 覆盖自己的 PROT_NONE 保留映射，不先 munmap：否则其它线程的 mmap 可能落进空洞
+        constexpr int CommitFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED;
+        void* ptr = ::mmap(begin, delta, PROT_READ | PROT_WRITE, CommitFlags | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED)
+        {
+            ptr = ::mmap(begin, delta, PROT_READ | PROT_WRITE, CommitFlags, -1, 0);
+            if (ptr == MAP_FAILED)
+            {
+                // 失败的 MAP_FIXED 可能已拆掉原映射：补回仅保留映射，保证保留区内没有空洞
+                (void)::mmap(begin, delta, PROT_NONE, ReserveFlags | MAP_FIXED, -1, 0);
+                return false;
+            }
+            (void)::madvise(begin, delta, MADV_HUGEPAGE);
+        }
+        m_committed = target;
+        return bytes <= m_committed;
+    }
+#endif
+    if (::mprotect(begin, delta, PROT_READ | PROT_WRITE) != 0)
+    {
+        return false;
+    }
+#endif
+    m_committed = target;
+    return bytes <= m_committed;
+}
+
+void VirtualMemoryRegion::ShrinkCommit(std::size_t bytes)
+{
+    if (!m_base)
+    {
+        return;
+    }
+    const std::size_t target = AlignUpSize(bytes, m_granularity);
+    if (target >= m_committed)
+    {
+        return;
+    }
+
+    std::byte* begin = m_base + target;
+    const std::size_t delta = m_committed - target;
+#if defined(_WIN32)
+    ::VirtualFree(begin, delta, MEM_DECOMMIT);
+#else
+    // 用新的仅保留映射原子替换尾部：普通页与 hugetlb 段的物理页都随之归还
+    if (::mmap(begin, delta, PROT_NONE, ReserveFlags | MAP_FIXED, -1, 0) == MAP_FAILED)
+    {
+        (void)::madvise(begin, delta, MADV_DONTNEED);
+        (void)::mprotect(begin, delta, PROT_NONE);
+    }
+#endif
+    m_committed = target;
+}
+
+std::size_t VirtualMemoryRegion::Discard(void* ptr, std::size_t bytes) const
+{
+    if (!m_base || !ptr || bytes == 0)
+    {
+        return 0;
+    }
+
+    const auto begin = AlignUpAddr(reinterpret_cast<std::uintptr_t>(ptr), m_granularity);
+    const auto end = AlignDownAddr(reinterpret_cast<std::uintptr_t>(ptr) + bytes, m_granularity);
+    if (end <= begin)
+    {
+        return 0;
+    }
+
+    const std::size_t span = end - begin;
+#if defined(_WIN32)
+    // MEM_RESET：保持提交状态但允许系统丢弃页面内容（与 MADV_DONTNEED 的用途一致）
+    if (!::VirtualAlloc(reinterpret_cast<void*>(begin), span, MEM_RESET, PAGE_READWRITE))
+    {
+        return 0;
+    }
+#else
+    if (::madvise(reinterpret_cast<void*>(begin), span, MADV_DONTNEED) != 0)
+    {
+        return 0;
+    }
+#endif
+    return span;
+}
+
+namespace {
+
+std::atomic<bool> g_processBarrierReady{false};
+
+} // namespace
+
+bool InitProcessMemoryBarrier()
+{
+    if (g_processBarrierReady.load(std::memory_order_acquire))
+    {
+        return true;
+    }
+#if defined(_WIN32)
+    g_processBarrierReady.store(true, std::memory_order_release);
+    return true;
+#elif defined(__linux__) && defined(__NR_membarrier)
+    // 进程须先注册才能使用 PRIVATE_EXPEDITED（内核 4.14+）；老内核或容器禁用时返回不可用
+    const long supported = ::syscall(__NR_membarrier, MEMBARRIER_CMD_QUERY, 0, 0);
+    if (supported < 0 || (supported & MEMBARRIER_CMD_PRIVATE_EXPEDITED) == 0)
+    {
+        return false;
+    }
+    if (::syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) != 0)
+    {
+        return false;
+    }
+    g_processBarrierReady.store(true, std::memory_order_release);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ProcessMemoryBarrier()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!g_processBarrierReady.load(std::memory_order_acquire))
+    {
+        return;
+    }
+#if defined(_WIN32)
+    ::FlushProcessWriteBuffers();
+#elif defined(__linux__) && defined(__NR_membarrier)
+    (void)::syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+#endif
+}
+
+} // namespace TE
@@ -0,0 +1,62 @@
+// ToyEngine Core Module
+// 虚拟地址保留区 — 先保留地址范围，再按需提交/回收物理页
+
+#pragma once
+
+#include "Memory/Memory.h"
+
+#include <cstddef>
+
+namespace TE {
+
+/// <summary>
+/// 一段连续保留的虚拟地址：
+/// - Reserve 只占地址空间（不计入提交量），Commit 从低地址向上扩展可读写前缀；
+/// - Discard 丢弃区间内的物理页（地址仍可访问，再次触碰时按需清零分配），用于空闲跨度回收；
+/// - ShrinkCommit 把已提交前缀缩短，尾部恢复为仅保留状态。
+/// Linux/POSIX 使用 mmap + mprotect + madvise，Windows 使用 VirtualAlloc。
+/// 不做内部加锁，由所属分配器串行调用。
+/// </summary>
+class VirtualMemoryRegion final
+{
+public:
+    [[nodiscard]] static std::size_t PageSize();
+    [[nodiscard]] static std::size_t HugePageSize();
+
+    // 保留 bytes（按提交粒度取整）；hugePages 仅在 Linux 上生效，失败时自动回退到普通页
+    [[nodiscard]] bool Reserve(std::size_t bytes, MemoryHugePages hugePages);
+    void Release();
+
+    // 把已提交前缀扩展到至少 bytes（按粒度取整、不超过保留大小）
+    [[nodiscard]] bool Commit(std::size_t bytes);
+
+    // 把已提交前缀缩短到 bytes（按粒度向上取整），尾部物理页归还 OS
+    void ShrinkCommit(std::size_t bytes);
+
+    // 丢弃 [ptr, ptr + bytes) 中完整粒度页的内容并归还物理页，返回实际丢弃的字节数
+    std::size_t Discard(void* ptr, std::size_t bytes) const;
+
+    [[nodiscard]] std::byte* Base() const { return m_base; }
+    [[nodiscard]] std::size_t ReservedBytes() const { return m_reserved; }
+    [[nodiscard]] std::size_t CommittedBytes() const { return m_committed; }
+    [[nodiscard]] std::size_t Granularity() const { return m_granularity; }
+    [[nodiscard]] bool IsHugePageBacked() const { return m_hugePages != MemoryHugePages::Off; }
+
+private:
+    std::byte* m_base = nullptr;
+    std::size_t m_reserved = 0;
+    std::size_t m_committed = 0;
+    std::size_t m_granularity = 0;
+    MemoryHugePages m_hugePages = MemoryHugePages::Off;
+};
+
+/// <summary>
+/// 进程级非对称内存屏障：ProcessMemoryBarrier 返回时，进程内每个线程都至少执行过一次完整内存屏障，
+/// 读端因此只需编译器屏障。Linux 使用 membarrier(PRIVATE_EXPEDITED)，Windows 使用 FlushProcessWriteBuffers。
+/// InitProcessMemoryBarrier 完成注册并返回是否可用；不可用时 ProcessMemoryBarrier 只是一次 seq_cst 栅栏，
+/// 读端必须自行使用 seq_cst 栅栏。
+/// </summary>
+[[nodiscard]] bool InitProcessMemoryBarrier();
+void ProcessMemoryBarrier();
+
+} // namespace TE
@@ -0,0 +1,273 @@
+// ToyEngine Core Module
+// 作业系统 —— 固定工作线程池 + 每线程 Chase–Lev 双端队列 + 工作窃取
+//
+// 用法：
+//   TE::JobCounter counter;
+//   TE::JobSystem::Get().Run([&]() { BuildVisibility(); }, &counter);
+//   TE::JobSystem::Get().Run([&]() { SortDrawCommands(); }, nullptr, &counter);  // counter 归零后才执行
+//   TE::JobSystem::Get().ParallelFor(count, 256, [&](uint32_t begin, uint32_t end) { ... });
+//   TE::JobSystem::Get().Wait(counter);
+//
+// 线程模型：
+// - 调用 Init 的线程是 0 号线程（通常是主线程），工作线程为 1..WorkerCount；每个线程拥有一个 deque，
+//   只有拥有者在底部压入 / 弹出（LIFO，缓存友好），其它线程从顶部窃取（FIFO，先拿大块）。
+// - 非作业线程提交的作业与 deque 溢出的作业进入加锁的全局队列。
+// - Wait 在计数器归零前帮忙执行作业（不会阻塞等待），因此作业内部也可以 Wait / ParallelFor。
+// - 空闲的工作线程短暂自旋后在条件变量上休眠，提交作业时唤醒一个。
+//
+// 与其它子系统的关系：
+// - 作业对象从引擎堆（MemAlloc，64 字节，命中线程本地小块缓存）分配；工作线程退出时线程缓存自动归还。
+//   因此须在 MemoryInit 之后 Init、在 MemoryShutdown 之前 Shutdown。作业内可以自由 MemAlloc / MemFree 与写日志，
+//   Log::Shutdown 同样须在 JobSystem::Shutdown 之后。
+// - 未初始化（或已 Shutdown）时 Run / ParallelFor 在调用线程上立即执行，单线程工具与测试无需特殊处理。
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace TE {
+
+class JobSystem;
+class JobCounter;
+
+namespace JobDetail {
+
+/// 闭包内联存储的大小；较大的状态请按引用 / 指针捕获
+inline constexpr std::size_t InlineBytes = 40;
+
+/// <summary>
+/// 作业：64 字节（一条缓存行），闭包就地构造在 Storage 中。
+/// 对齐保持 16，使分配命中线程本地小块缓存
+/// </summary>
+struct alignas(16) Job
+{
+    using InvokeFunction = void (*)(Job& job);
+
+    alignas(16) std::byte Storage[InlineBytes];
+    InvokeFunction Invoke = nullptr;   // 执行并析构闭包
+    JobCounter* Counter = nullptr;     // 完成时递减（可为空）
+    Job* Next = nullptr;               // 依赖等待链表 / 全局队列链表
+};
+
+static_assert(sizeof(Job) == 64, "Job 应恰好占一条缓存行");
+
+class WorkStealingQueue;
+
+} // namespace JobDetail
+
+/// <summary>
+/// 作业计数器：以它为 counter 提交的每个作业 +1，作业完成 -1；归零即所有作业完成。
+/// 作为 dependency 传给 Run 时，作业挂在计数器上，归零时才进入队列。
+/// 计数器须比引用它的作业活得久；不要在仍有作业依赖它时重新武装（作业会被推迟到下一次归零）
+/// </summary>
+class JobCounter
+{
+public:
+    JobCounter() = default;
+
+    // 最后一个作业在锁内归零并取走等待链表；析构时取一次锁，保证它已离开临界区
+    ~JobCounter() { std::lock_guard lock(m_WaitersMutex); }
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    [[nodiscard]] bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+    [[nodiscard]] uint32_t GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_Pending{0};
+    std::mutex m_WaitersMutex;
+    JobDetail::Job* m_Waiters = nullptr;
+};
+
+struct JobSystemConfig
+{
+    // 工作线程数（不含调用 Init 的线程）；0 表示 硬件线程数 - 1（至少 1）
+    uint32_t WorkerCount = 0;
+
+    // 每线程 deque 容量（向上取 2 的幂）；满时溢出到全局队列
+    uint32_t QueueCapacity = 4096;
+
+    // 工作线程 i 绑定到逻辑核 i（0 号核留给调用线程）；不支持的平台忽略
+    bool PinWorkers = false;
+
+    // 线程名前缀，工作线程命名为 "<前缀> <序号>"（Linux 上截断到 15 字节）
+    const char* NamePrefix = "TE Worker";
+};
+
+class JobSystem final
+{
+public:
+    [[nodiscard]] static JobSystem& Get();
+
+    JobSystem();
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /// <summary>
+    /// 启动工作线程，调用线程成为 0 号线程。已初始化时先 Shutdown
+    /// </summary>
+    void Init(const JobSystemConfig& config = {});
+
+    /// <summary>
+    /// 执行完所有已提交的作业后停止并回收工作线程。须由 Init 的线程调用，且不得与 Run / Wait 并发
+    /// </summary>
+    void Shutdown();
+
+    [[nodiscard]] bool IsInitialized() const { return m_Running.load(std::memory_order_acquire); }
+
+    /// 工作线程数（不含 0 号线程）
+    [[nodiscard]] uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    /// 参与执行作业的线程数（工作线程 + 0 号线程），可用于分配每线程的临时数据
+    [[nodiscard]] uint32_t GetThreadCount() const { return GetWorkerCount() + 1; }
+
+    /// <summary>
+    /// 调用线程在本作业系统中的序号：0 为 Init 的线程，1..WorkerCount 为工作线程，其它线程返回 -1
+    /// </summary>
+    [[nodiscard]] int32_t GetCurrentThreadIndex() const;
+
+    /// <summary>
+    /// 提交作业。counter 非空时计入计数；dependency 非空且未归零时，作业推迟到 dependency 归零后入队
+    /// </summary>
+    template<typename F>
+    void Run(F&& function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+    /// <summary>
+    /// 等待计数器归零；等待期间在调用线程上执行其它作业
+    /// </summary>
+    void Wait(JobCounter& counter);
+
+    /// <summary>
+    /// 把 [0, count) 切成不小于 grainSize 的区间并行执行 function(begin, end)，返回时全部完成。
+    /// 区间按二分递归拆分：每个作业把后半段作为新作业压入自己的 deque 再处理前半段，空闲线程窃取的总是较大的一块
+    /// </summary>
+    template<typename F>
+    void ParallelFor(uint32_t count, uint32_t grainSize, F&& function);
+
+private:
+    template<typename F>
+    struct TParallelForRange;
+
+    [[nodiscard]] JobDetail::Job* AllocateJob();
+    void Submit(JobDetail::Job* job, JobCounter* counter, JobCounter* dependency);
+    void Schedule(JobDetail::Job* job);
+    void Execute(JobDetail::Job* job);
+    void CompleteCounter(JobCounter& counter);
+
+    [[nodiscard]] JobDetail::Job* FindJob(int32_t threadIndex);
+    [[nodiscard]] JobDetail::Job* PopGlobal();
+    void PushGlobal(JobDetail::Job* job);
+    void WakeWorker();
+    void WorkerMain(uint32_t threadIndex);
+
+private:
+    std::vector<std::unique_ptr<JobDetail::WorkStealingQueue>> m_Queues; // 下标即线程序号
+    std::vector<std::thread> m_Workers;
+    JobSystemConfig m_Config{};
+
+    std::atomic<bool> m_Running{false};
+    std::atomic<bool> m_Stopping{false};
+
+    // 全局队列（非作业线程提交 / deque 溢出），链表 FIFO
+    std::mutex m_GlobalMutex;
+    JobDetail::Job* m_GlobalHead = nullptr;
+    JobDetail::Job* m_GlobalTail = nullptr;
+    std::atomic<uint32_t> m_GlobalCount{0};
+
+    // 休眠 / 唤醒：提交时递增 m_WorkGeneration，休眠线程以它判断是否有新作业
+    std::mutex m_SleepMutex;
+    std::condition_variable m_SleepCondition;
+    std::atomic<uint64_t> m_WorkGeneration{0};
+    std::atomic<uint32_t> m_SleepingWorkers{0};
+};
+
+// ==================== 模板实现 ====================
+
+template<typename F>
+void JobSystem::Run(F&& function, JobCounter* counter, JobCounter* dependency)
+{
+    using TFunction = std::decay_t<F>;
+    static_assert(sizeof(TFunction) <= JobDetail::InlineBytes,
+                  "作业闭包超出 JobDetail::InlineBytes，请按引用 / 指针捕获较大的状态");
+    static_assert(alignof(TFunction) <= 16, "作业闭包的对齐要求超过 16 字节");
+
+    if (!IsInitialized())
+    {
+        function();
+        return;
+    }
+
+    // 分配失败时退化为在调用线程上执行
+    JobDetail::Job* job = AllocateJob();
+    if (!job)
+    {
+        function();
+        return;
+    }
+    ::new (static_cast<void*>(job->Storage)) TFunction(std::forward<F>(function));
+    job->Invoke = [](JobDetail::Job& self) {
+        TFunction* closure = std::launder(reinterpret_cast<TFunction*>(self.Storage));
+        (*closure)();
+        closure->~TFunction();
+    };
+    Submit(job, counter, dependency);
+}
+
+template<typename F>
+struct JobSystem::TParallelForRange
+{
+    JobSystem* System;
+    const F* Function;
+    JobCounter* Counter;
+    uint32_t Begin;
+    uint32_t End;
+    uint32_t GrainSize;
+
+    void operator()() const
+    {
+        uint32_t end = End;
+        // 后半段作为新作业压入本线程 deque，前半段继续在本线程拆分；先压入的大区间位于 deque 顶端，最先被窃取
+        while (end - Begin > GrainSize)
+        {
+            const uint32_t middle = Begin + (end - Begin) / 2;
+            System->Run(TParallelForRange{System, Function, Counter, middle, end, GrainSize}, Counter);
+            end = middle;
+        }
+        (*Function)(Begin, end);
+    }
+};
+
+template<typename F>
+void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, F&& function)
+{
+    if (count == 0)
+        return;
+    const uint32_t grain = grainSize == 0 ? 1u : grainSize;
+    if (!IsInitialized() || count <= grain)
+    {
+        function(0u, count);
+        return;
+    }
+
+    using TFunction = std::remove_reference_t<F>;
+    JobCounter counter;
+    TParallelForRange<TFunction>{this, &function, &counter, 0u, count, grain}();
+    Wait(counter);
+}
+
+} // namespace TE
@@ -6,6 +6,10 @@
 #include "Geometry.h"
 #include "Matrix.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
 namespace TE {
 
 /// <summary>
@@ -22,6 +26,38 @@ enum class EFrustumPlane
     Count
 };
 
+/// <summary>
+/// 分级剔除的三态结果：Inside 时子节点无需再测，Intersect 时子节点只需测仍相交的平面
+/// </summary>
+enum class EFrustumCullResult : uint8_t
+{
+    Outside = 0,
+    Intersect,
+    Inside,
+};
+
+/// <summary>
+/// SoA 布局的 AABB 数组（调用方持有存储，6 个分量 span 长度必须一致）
+/// </summary>
+struct BoundingBoxSoA
+{
+    std::span<const float> MinX, MinY, MinZ;
+    std::span<const float> MaxX, MaxY, MaxZ;
+
+    [[nodiscard]] size_t Size() const { return MinX.size(); }
+};
+
+/// <summary>
+/// SoA 布局的包围球数组（4 个分量 span 长度必须一致）
+/// </summary>
+struct BoundingSphereSoA
+{
+    std::span<const float> CenterX, CenterY, CenterZ;
+    std::span<const float> Radius;
+
+    [[nodiscard]] size_t Size() const { return CenterX.size(); }
+};
+
 /// <summary>
 /// 视锥体 - 由 6 个平面组成，用于场景剔除
 /// 通常从相机的 View-Projection 矩阵提取
@@ -58,6 +94,56 @@ struct Frustum
     /// </summary>
     [[nodiscard]] bool IntersectsSphere(const BoundingSphere& sphere) const;
 
+    // ==================== 批量 / 分级剔除 ====================
+
+    /// 批量剔除按 8 个对象一块处理（SSE 两组 4 通道，AVX2 一组 8 通道）
+    static constexpr size_t CullBlockSize = 8;
+    static constexpr uint8_t AllPlanesMask = 0x3F;
+
+    /// 可见性位图需要的 uint64 个数
+    [[nodiscard]] static constexpr size_t VisibilityMaskWords(size_t count) { return (count + 63) / 64; }
+
+    /// 平面一致性缓存需要的字节数（每块 1 字节，记录上次整块被剔除的平面，初始化为 0 即可）
+    [[nodiscard]] static constexpr size_t CullBlockCount(size_t count) { return (count + CullBlockSize - 1) / CullBlockSize; }
+
+    /// <summary>
+    /// 批量 AABB 剔除：第 i 位为 1 表示与视锥体相交或在其内（语义同 IntersectsAABB）。
+    /// outVisibleMask 至少 VisibilityMaskWords(count) 个元素，函数会先清零；
+    /// 传入 inOutLastFailedPlane（CullBlockCount(count) 字节）时启用平面一致性：
+    /// 每块先测上一帧使整块出局的平面，静态场景下多数被剔除的块只需测一个平面
+    /// </summary>
+    void CullAABBs(const BoundingBoxSoA& boxes,
+                   std::span<uint64_t> outVisibleMask,
+                   std::span<uint8_t> inOutLastFailedPlane = {}) const;
+
+    /// <summary>
+    /// 批量包围球剔除，参数约定同 CullAABBs（语义同 IntersectsSphere）
+    /// </summary>
+    void CullSpheres(const BoundingSphereSoA& spheres,
+                     std::span<uint64_t> outVisibleMask,
+                     std::span<uint8_t> inOutLastFailedPlane = {}) const;
+
+    /// <summary>
+    /// 批量三态分类（Outside / Intersect / Inside），用于 BVH / 八叉树节点的分级剔除
+    /// </summary>
+    void ClassifyAABBs(const BoundingBoxSoA& boxes, std::span<EFrustumCullResult> outResults) const;
+
+    /// <summary>
+    /// 单个 AABB 的分级分类：只测 inOutPlaneMask 中置位的平面，AABB 完全位于某平面内侧时清除该位，
+    /// 子节点沿用更新后的掩码（根节点传 AllPlanesMask）；inOutLastFailedPlane 为该对象的平面一致性缓存，
+    /// 优先测试并在剔除时更新
+    /// </summary>
+    [[nodiscard]] EFrustumCullResult ClassifyAABB(const BoundingBox& box,
+                                                  uint8_t& inOutPlaneMask,
+                                                  uint8_t& inOutLastFailedPlane) const;
+
+    /// <summary>
+    /// 单个包围球的分级分类，参数约定同 ClassifyAABB
+    /// </summary>
+    [[nodiscard]] EFrustumCullResult ClassifySphere(const BoundingSphere& sphere,
+                                                    uint8_t& inOutPlaneMask,
+                                                    uint8_t& inOutLastFailedPlane) const;
+
     /// <summary>
     /// 获取指定索引的平面
     /// </summary>
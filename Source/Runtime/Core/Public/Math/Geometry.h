@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "Matrix.h"
 #include "Vector.h"
 #include "ScalarMath.h"
 
@@ -382,6 +383,29 @@ struct BoundingBox
         corners[7] = Vector3(Max.X, Max.Y, Max.Z);
     }
 
+    /// <summary>
+    /// 仿射变换后的轴对齐包围盒（Arvo）：中心按点变换，半边长乘以线性部分逐元素取绝对值后的矩阵。
+    /// 与变换 8 个角点再求包围盒的结果相同，但只需一次点变换加 9 次乘加，且没有分支
+    /// </summary>
+    [[nodiscard]] BoundingBox TransformBy(const Matrix3x4& matrix) const
+    {
+        const Vector3 center = matrix.TransformPoint(GetCenter());
+        const Vector3 extents = GetExtents();
+        const Vector3 worldExtents(
+            std::abs(matrix.M[0][0]) * extents.X + std::abs(matrix.M[0][1]) * extents.Y + std::abs(matrix.M[0][2]) * extents.Z,
+            std::abs(matrix.M[1][0]) * extents.X + std::abs(matrix.M[1][1]) * extents.Y + std::abs(matrix.M[1][2]) * extents.Z,
+            std::abs(matrix.M[2][0]) * extents.X + std::abs(matrix.M[2][1]) * extents.Y + std::abs(matrix.M[2][2]) * extents.Z);
+        return FromCenterExtents(center, worldExtents);
+    }
+
+    /// <summary>
+    /// 同上，调用方保证 affine 的最后一行为 0 0 0 1（投影矩阵请改用变换角点）
+    /// </summary>
+    [[nodiscard]] BoundingBox TransformBy(const Matrix4& affine) const
+    {
+        return TransformBy(Matrix3x4(affine));
+    }
+
     /// <summary>
     /// 获取最近点（在包围盒内的点或表面上的点）
     /// </summary>
@@ -558,6 +582,30 @@ struct BoundingSphere
         }
     }
 
+    /// <summary>
+    /// 仿射变换后的包围球：中心按点变换，半径乘以线性部分三列中的最大长度（非均匀缩放时取最大轴，结果保守）
+    /// </summary>
+    [[nodiscard]] BoundingSphere TransformBy(const Matrix3x4& matrix) const
+    {
+        float maxScaleSq = 0.0f;
+        for (int col = 0; col < 3; ++col)
+        {
+            const float lengthSq = matrix.M[0][col] * matrix.M[0][col] +
+                                   matrix.M[1][col] * matrix.M[1][col] +
+                                   matrix.M[2][col] * matrix.M[2][col];
+            maxScaleSq = std::max(maxScaleSq, lengthSq);
+        }
+        return {matrix.TransformPoint(Center), Radius * std::sqrt(maxScaleSq)};
+    }
+
+    /// <summary>
+    /// 同上，调用方保证 affine 的最后一行为 0 0 0 1
+    /// </summary>
+    [[nodiscard]] BoundingSphere TransformBy(const Matrix4& affine) const
+    {
+        return TransformBy(Matrix3x4(affine));
+    }
+
     /// <summary>
     /// 到点的距离（点在球外为正，球内为负）
     /// </summary>
@@ -594,6 +642,48 @@ struct BoundingSphere
     return Vector3::Cross(b - a, c - a).Normalize();
 }
 
+namespace Math {
+
+/// 射线与三角形求交时，行列式绝对值低于该值的三角形视为与射线平行 / 退化
+inline constexpr float RayTriangleEpsilon = 1e-12f;
+
+} // namespace Math
+
+/// <summary>
+/// 射线与三角形求交（Möller–Trumbore，双面）；命中条件 0 <= distance <= maxDistance，
+/// outU / outV 为重心坐标（命中点 = v0 + U * (v1 - v0) + V * (v2 - v0)）。批量版本见 RayIntersection.h
+/// </summary>
+[[nodiscard]] inline bool IntersectRayTriangle(const Ray& ray, const Vector3& v0, const Vector3& v1, const Vector3& v2,
+                                               float maxDistance, float& outDistance, float& outU, float& outV)
+{
+    const Vector3 edge1 = v1 - v0;
+    const Vector3 edge2 = v2 - v0;
+    const Vector3 pvec = Vector3::Cross(ray.Direction, edge2);
+    const float det = Vector3::Dot(edge1, pvec);
+    if (std::abs(det) < Math::RayTriangleEpsilon)
+        return false;
+
+    const float invDet = 1.0f / det;
+    const Vector3 tvec = ray.Origin - v0;
+    const float u = Vector3::Dot(tvec, pvec) * invDet;
+    if (u < 0.0f || u > 1.0f)
+        return false;
+
+    const Vector3 qvec = Vector3::Cross(tvec, edge1);
+    const float v = Vector3::Dot(ray.Direction, qvec) * invDet;
+    if (v < 0.0f || u + v > 1.0f)
+        return false;
+
+    const float distance = Vector3::Dot(edge2, qvec) * invDet;
+    if (distance < 0.0f || distance > maxDistance)
+        return false;
+
+    outDistance = distance;
+    outU = u;
+    outV = v;
+    return true;
+}
+
 /// <summary>
 /// 点到线段的最近点
 /// </summary>
@@ -46,4 +46,26 @@ inline Vector3 Slerp(const Vector3& a, const Vector3& b, float t)
     return a * std::cos(theta) + relativeVec * std::sin(theta);
 }
 
+/// <summary>
+/// 快速归一化：FastRsqrt（rsqrt + Newton）代替 sqrt 与除法，最大相对误差同 FastRsqrt；
+/// 零向量（及长度平方低于 float 规格化下限的向量）返回零向量，与 Normalize 一致
+/// </summary>
+inline Vector2 FastNormalize(const Vector2& v)
+{
+    const float lengthSquared = v.LengthSquared();
+    return lengthSquared > 1e-37f ? v * FastRsqrt(lengthSquared) : Vector2::Zero;
+}
+
+inline Vector3 FastNormalize(const Vector3& v)
+{
+    const float lengthSquared = v.LengthSquared();
+    return lengthSquared > 1e-37f ? v * FastRsqrt(lengthSquared) : Vector3::Zero;
+}
+
+inline Vector4 FastNormalize(const Vector4& v)
+{
+    const float lengthSquared = v.LengthSquared();
+    return lengthSquared > 1e-37f ? v * FastRsqrt(lengthSquared) : Vector4::Zero;
+}
+
 } // namespace TE::Math
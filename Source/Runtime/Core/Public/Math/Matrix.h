@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "MatrixKernels.h"
 #include "Vector.h"
 
 namespace TE {
@@ -71,7 +72,7 @@ struct [[nodiscard]] Matrix3
         return result;
     }
 
-    // 逆矩阵（使用 glm 实现）
+    // 逆矩阵（伴随矩阵 / 行列式）
     Matrix3 Inverse() const;
 
     /// <summary>
@@ -84,7 +85,8 @@ struct [[nodiscard]] Matrix3
 };
 
 // ==================== Matrix4 ====================
-struct [[nodiscard]] Matrix4
+// 16 字节对齐以便 MatrixKernels 直接按列做对齐 SIMD 读写
+struct [[nodiscard]] alignas(16) Matrix4
 {
     // 4x4 矩阵，按列主序存储（与 glm 一致）
     float M[4][4]{};
@@ -117,10 +119,7 @@ struct [[nodiscard]] Matrix4
     Matrix4 operator*(const Matrix4& other) const
     {
         Matrix4 result(0.0f);
-        for (int i = 0; i < 4; ++i)
-            for (int j = 0; j < 4; ++j)
-                for (int k = 0; k < 4; ++k)
-                    result.M[i][j] += M[k][j] * other.M[i][k];
+        MatrixKernels::Multiply(&M[0][0], &other.M[0][0], &result.M[0][0]);
         return result;
     }
 
@@ -128,27 +127,29 @@ struct [[nodiscard]] Matrix4
 
     Vector4 operator*(const Vector4& vec) const
     {
-        return {
-            M[0][0] * vec.X + M[1][0] * vec.Y + M[2][0] * vec.Z + M[3][0] * vec.W,
-            M[0][1] * vec.X + M[1][1] * vec.Y + M[2][1] * vec.Z + M[3][1] * vec.W,
-            M[0][2] * vec.X + M[1][2] * vec.Y + M[2][2] * vec.Z + M[3][2] * vec.W,
-            M[0][3] * vec.X + M[1][3] * vec.Y + M[2][3] * vec.Z + M[3][3] * vec.W
-        };
+        const float v[4] = {vec.X, vec.Y, vec.Z, vec.W};
+        float r[4];
+        MatrixKernels::TransformVector(&M[0][0], v, r);
+        return {r[0], r[1], r[2], r[3]};
     }
 
     // 转置
     Matrix4 Transpose() const
     {
-        Matrix4 result;
-        for (int i = 0; i < 4; ++i)
-            for (int j = 0; j < 4; ++j)
-                result.M[i][j] = M[j][i];
+        Matrix4 result(0.0f);
+        MatrixKernels::Transpose(&M[0][0], &result.M[0][0]);
         return result;
     }
 
-    // 逆矩阵（使用 glm 实现）
+    // 逆矩阵（MatrixKernels::Inverse，奇异矩阵结果为 inf / nan）
     Matrix4 Inverse() const;
 
+    /// <summary>
+    /// 仿射矩阵（最后一行为 0 0 0 1，如模型 / 视图矩阵）求逆，比 Inverse 快约一倍
+    /// 左上 3x3 奇异时返回单位矩阵；投影矩阵请使用 Inverse
+    /// </summary>
+    Matrix4 InverseAffine() const;
+
     // 获取原始数据指针（用于传递给图形 API）
     [[nodiscard]] const float* Data() const { return &M[0][0]; }
 
@@ -225,5 +226,103 @@ struct [[nodiscard]] Matrix4
     static Matrix4 OrthographicLH_ZO(float left, float right, float bottom, float top, float nearPlane, float farPlane);
 };
 
+// ==================== Matrix3x4 ====================
+// 仿射变换（最后一行恒为 0 0 0 1）的紧凑形式：3 行 x 4 列，按行主序存储，共 48 字节
+// 每行 = (线性部分的一行, 平移分量)，16 字节对齐以便 MatrixKernels 的 3x4 内核整行 SIMD 读写。
+// 场景代理与绘制命令用它保存世界矩阵，比 Matrix4 少 25% 的带宽；上传 GPU 时再用 ToMatrix4 展开
+struct [[nodiscard]] alignas(16) Matrix3x4
+{
+    // 行主序：M[row][column]，与 Matrix4 的列主序相反
+    float M[3][4]{};
+
+    Matrix3x4()
+    {
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 4; ++j)
+                M[i][j] = (i == j) ? 1.0f : 0.0f;
+    }
+
+    /// <summary>
+    /// 从仿射 Matrix4 截取前三行（调用方保证最后一行为 0 0 0 1）
+    /// </summary>
+    explicit Matrix3x4(const Matrix4& affine);
+
+    static const Matrix3x4 Identity;
+
+    // 元素访问（与 Matrix4 相同的 (column, row) 参数顺序）
+    float& operator()(int col, int row) { return M[row][col]; }
+    const float& operator()(int col, int row) const { return M[row][col]; }
+
+    // 仿射复合：(*this * other) 先应用 other 再应用 *this
+    Matrix3x4 operator*(const Matrix3x4& other) const
+    {
+        Matrix3x4 result;
+        MatrixKernels::Multiply3x4(&M[0][0], &other.M[0][0], &result.M[0][0]);
+        return result;
+    }
+
+    Matrix3x4& operator*=(const Matrix3x4& other) { *this = *this * other; return *this; }
+
+    /// <summary>
+    /// 变换点（包含平移）
+    /// </summary>
+    [[nodiscard]] Vector3 TransformPoint(const Vector3& point) const
+    {
+        return {
+            M[0][0] * point.X + M[0][1] * point.Y + M[0][2] * point.Z + M[0][3],
+            M[1][0] * point.X + M[1][1] * point.Y + M[1][2] * point.Z + M[1][3],
+            M[2][0] * point.X + M[2][1] * point.Y + M[2][2] * point.Z + M[2][3]
+        };
+    }
+
+    /// <summary>
+    /// 变换方向（忽略平移）；法线请用 GetNormalMatrix
+    /// </summary>
+    [[nodiscard]] Vector3 TransformVector(const Vector3& vector) const
+    {
+        return {
+            M[0][0] * vector.X + M[0][1] * vector.Y + M[0][2] * vector.Z,
+            M[1][0] * vector.X + M[1][1] * vector.Y + M[1][2] * vector.Z,
+            M[2][0] * vector.X + M[2][1] * vector.Y + M[2][2] * vector.Z
+        };
+    }
+
+    /// <summary>
+    /// 仿射求逆：线性部分用三行叉积求逆，平移取 -R^-1 t；线性部分奇异时返回单位矩阵（与 Matrix4::InverseAffine 一致）
+    /// </summary>
+    Matrix3x4 Inverse() const;
+
+    /// <summary>
+    /// 法线变换矩阵（线性部分的逆转置），等于 ToMatrix4().GetNormalMatrix()，
+    /// 但直接由三行叉积 / 行列式得到，不经过 Matrix3::Inverse 与 Transpose
+    /// </summary>
+    Matrix3 GetNormalMatrix() const;
+
+    /// <summary>
+    /// 展开为列主序 Matrix4（补最后一行 0 0 0 1）
+    /// </summary>
+    Matrix4 ToMatrix4() const;
+
+    /// <summary>
+    /// 提取线性部分（旋转 / 缩放）
+    /// </summary>
+    Matrix3 ToMatrix3() const;
+
+    [[nodiscard]] Vector3 GetTranslation() const { return {M[0][3], M[1][3], M[2][3]}; }
+
+    [[nodiscard]] float Determinant() const;
+
+    [[nodiscard]] const float* Data() const { return &M[0][0]; }
+};
+
+/// <summary>
+/// 4x4 乘仿射：如 viewProjection * world；隐含的最后一行只贡献平移列，比先展开再相乘少 4 次乘加
+/// </summary>
+inline Matrix4 operator*(const Matrix4& lhs, const Matrix3x4& rhs)
+{
+    Matrix4 result(0.0f);
+    MatrixKernels::Multiply4x4By3x4(&lhs.M[0][0], &rhs.M[0][0], &result.M[0][0]);
+    return result;
+}
 
 } // namespace TE
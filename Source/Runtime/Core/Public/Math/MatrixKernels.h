@@ -0,0 +1,373 @@
+// ToyEngine Core Module
+// 4x4 矩阵 / 四元数 SIMD 内核 —— 编译期按指令集分派（AVX2 > SSE > NEON > 标量）
+//
+// 所有矩阵参数均为列主序 16 个 float（与 Matrix4::M 一致），矩阵指针须 16 字节对齐；
+// 名称带 3x4 的内核处理仿射矩阵的紧凑形式：行主序 3 行 x 4 个 float（与 Matrix3x4::M 一致），同样 16 字节对齐。
+// 向量 / 四元数按 4 个 float 读写，不要求对齐。输出可以与输入重叠。
+// Scalar 命名空间保留逐元素的参考实现，供 MathTest 做等价校验。
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__AVX2__)
+#define TE_MATH_AVX2 1
+#else
+#define TE_MATH_AVX2 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TE_MATH_SSE 1
+#include <immintrin.h>
+#else
+#define TE_MATH_SSE 0
+#endif
+
+#if !TE_MATH_SSE && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+#define TE_MATH_NEON 1
+#include <arm_neon.h>
+#else
+#define TE_MATH_NEON 0
+#endif
+
+namespace TE::MatrixKernels {
+
+#if TE_MATH_AVX2
+// -mavx2 不隐含 FMA：未同时开启时退化为乘加两条指令
+inline __m256 MultiplyAdd256(__m256 a, __m256 b, __m256 c)
+{
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+#endif
+
+// ==================== 标量参考实现 ====================
+
+namespace Scalar {
+
+inline void Multiply(const float* a, const float* b, float* out)
+{
+    float result[16];
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+        {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k)
+                sum += a[k * 4 + j] * b[i * 4 + k];
+            result[i * 4 + j] = sum;
+        }
+    for (int i = 0; i < 16; ++i)
+        out[i] = result[i];
+}
+
+inline void TransformVector(const float* m, const float* v, float* out)
+{
+    float result[4];
+    for (int j = 0; j < 4; ++j)
+        result[j] = m[j] * v[0] + m[4 + j] * v[1] + m[8 + j] * v[2] + m[12 + j] * v[3];
+    for (int j = 0; j < 4; ++j)
+        out[j] = result[j];
+}
+
+inline void Transpose(const float* m, float* out)
+{
+    float result[16];
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            result[i * 4 + j] = m[j * 4 + i];
+    for (int i = 0; i < 16; ++i)
+        out[i] = result[i];
+}
+
+// 余子式展开；返回行列式（为 0 时输出为 inf / nan，与 glm::inverse 一致）
+float Inverse(const float* m, float* out);
+
+// 仿射矩阵（最后一行为 0 0 0 1）求逆；左上 3x3 奇异时返回 false 且不写输出
+bool InverseAffine(const float* m, float* out);
+
+// 单位四元数 (x, y, z, w) 转旋转矩阵（与 glm::mat4_cast 相同的公式）
+void QuatToMatrix(const float* q, float* out);
+
+// out = a * b（均为 3x4 仿射）；隐含的第 4 行 (0, 0, 0, 1) 只贡献平移列的 a[i][3]
+inline void Multiply3x4(const float* a, const float* b, float* out)
+{
+    float result[12];
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            result[i * 4 + j] = a[i * 4 + 0] * b[0 * 4 + j] + a[i * 4 + 1] * b[1 * 4 + j] + a[i * 4 + 2] * b[2 * 4 + j];
+        }
+        result[i * 4 + 3] += a[i * 4 + 3];
+    }
+    for (int i = 0; i < 12; ++i)
+        out[i] = result[i];
+}
+
+// out = m * a（m 为列主序 4x4，a 为 3x4 仿射，输出列主序 4x4）；如 viewProjection * world
+inline void Multiply4x4By3x4(const float* m, const float* a, float* out)
+{
+    float result[16];
+    for (int j = 0; j < 4; ++j)
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            result[j * 4 + row] = m[0 * 4 + row] * a[0 * 4 + j] + m[1 * 4 + row] * a[1 * 4 + j] + m[2 * 4 + row] * a[2 * 4 + j];
+        }
+    }
+    for (int row = 0; row < 4; ++row)
+        result[12 + row] += m[12 + row];
+    for (int i = 0; i < 16; ++i)
+        out[i] = result[i];
+}
+
+// 3x4 仿射求逆；线性部分奇异时返回 false 且不写输出
+bool Inverse3x4(const float* m, float* out);
+
+// 3x4 仿射的法线矩阵（线性部分的逆转置），输出为列主序 3x3（与 Matrix3::M 一致）；行列式为 0 时结果为 inf / nan
+void NormalMatrix3x4(const float* m, float* out);
+
+} // namespace Scalar
+
+// ==================== 指令集分派 ====================
+
+// 编译期选中的实现名称（"AVX2" / "SSE" / "NEON" / "Scalar"），用于日志与基准输出
+[[nodiscard]] constexpr const char* ActiveIsa()
+{
+#if TE_MATH_AVX2
+    return "AVX2";
+#elif TE_MATH_SSE
+    return "SSE";
+#elif TE_MATH_NEON
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+// out = a * b
+inline void Multiply(const float* a, const float* b, float* out)
+{
+#if TE_MATH_AVX2
+    // 一次算两列：a 的每一列广播到高低两个 128 位通道，b 的两列各自按通道取第 k 个元素
+    const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 0));
+    const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+    const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+    const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+    const __m256 b01 = _mm256_loadu_ps(b);
+    const __m256 b23 = _mm256_loadu_ps(b + 8);
+
+    __m256 r01 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b01, b01, _MM_SHUFFLE(0, 0, 0, 0)));
+    r01 = MultiplyAdd256(a1, _mm256_shuffle_ps(b01, b01, _MM_SHUFFLE(1, 1, 1, 1)), r01);
+    r01 = MultiplyAdd256(a2, _mm256_shuffle_ps(b01, b01, _MM_SHUFFLE(2, 2, 2, 2)), r01);
+    r01 = MultiplyAdd256(a3, _mm256_shuffle_ps(b01, b01, _MM_SHUFFLE(3, 3, 3, 3)), r01);
+
+    __m256 r23 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b23, b23, _MM_SHUFFLE(0, 0, 0, 0)));
+    r23 = MultiplyAdd256(a1, _mm256_shuffle_ps(b23, b23, _MM_SHUFFLE(1, 1, 1, 1)), r23);
+    r23 = MultiplyAdd256(a2, _mm256_shuffle_ps(b23, b23, _MM_SHUFFLE(2, 2, 2, 2)), r23);
+    r23 = MultiplyAdd256(a3, _mm256_shuffle_ps(b23, b23, _MM_SHUFFLE(3, 3, 3, 3)), r23);
+
+    _mm256_storeu_ps(out, r01);
+    _mm256_storeu_ps(out + 8, r23);
+#elif TE_MATH_SSE
+    const __m128 a0 = _mm_load_ps(a + 0);
+    const __m128 a1 = _mm_load_ps(a + 4);
+    const __m128 a2 = _mm_load_ps(a + 8);
+    const __m128 a3 = _mm_load_ps(a + 12);
+
+    __m128 columns[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        const __m128 bi = _mm_load_ps(b + i * 4);
+        __m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(bi, bi, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(bi, bi, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(bi, bi, _MM_SHUFFLE(2, 2, 2, 2))));
+        r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(bi, bi, _MM_SHUFFLE(3, 3, 3, 3))));
+        columns[i] = r;
+    }
+    for (int i = 0; i < 4; ++i)
+        _mm_store_ps(out + i * 4, columns[i]);
+#elif TE_MATH_NEON
+    const float32x4_t a0 = vld1q_f32(a + 0);
+    const float32x4_t a1 = vld1q_f32(a + 4);
+    const float32x4_t a2 = vld1q_f32(a + 8);
+    const float32x4_t a3 = vld1q_f32(a + 12);
+
+    float32x4_t columns[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        const float* bi = b + i * 4;
+        float32x4_t r = vmulq_n_f32(a0, bi[0]);
+        r = vmlaq_n_f32(r, a1, bi[1]);
+        r = vmlaq_n_f32(r, a2, bi[2]);
+        r = vmlaq_n_f32(r, a3, bi[3]);
+        columns[i] = r;
+    }
+    for (int i = 0; i < 4; ++i)
+        vst1q_f32(out + i * 4, columns[i]);
+#else
+    Scalar::Multiply(a, b, out);
+#endif
+}
+
+// out = m * v（v、out 为 4 个 float）
+inline void TransformVector(const float* m, const float* v, float* out)
+{
+#if TE_MATH_SSE
+    __m128 r = _mm_mul_ps(_mm_load_ps(m + 0), _mm_set1_ps(v[0]));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(m + 4), _mm_set1_ps(v[1])));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(m + 8), _mm_set1_ps(v[2])));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(m + 12), _mm_set1_ps(v[3])));
+    _mm_storeu_ps(out, r);
+#elif TE_MATH_NEON
+    float32x4_t r = vmulq_n_f32(vld1q_f32(m + 0), v[0]);
+    r = vmlaq_n_f32(r, vld1q_f32(m + 4), v[1]);
+    r = vmlaq_n_f32(r, vld1q_f32(m + 8), v[2]);
+    r = vmlaq_n_f32(r, vld1q_f32(m + 12), v[3]);
+    vst1q_f32(out, r);
+#else
+    Scalar::TransformVector(m, v, out);
+#endif
+}
+
+inline void Transpose(const float* m, float* out)
+{
+#if TE_MATH_SSE
+    __m128 c0 = _mm_load_ps(m + 0);
+    __m128 c1 = _mm_load_ps(m + 4);
+    __m128 c2 = _mm_load_ps(m + 8);
+    __m128 c3 = _mm_load_ps(m + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_store_ps(out + 0, c0);
+    _mm_store_ps(out + 4, c1);
+    _mm_store_ps(out + 8, c2);
+    _mm_store_ps(out + 12, c3);
+#elif TE_MATH_NEON
+    // 交错加载即转置：val[i] = (m[i], m[4 + i], m[8 + i], m[12 + i])
+    const float32x4x4_t rows = vld4q_f32(m);
+    vst1q_f32(out + 0, rows.val[0]);
+    vst1q_f32(out + 4, rows.val[1]);
+    vst1q_f32(out + 8, rows.val[2]);
+    vst1q_f32(out + 12, rows.val[3]);
+#else
+    Scalar::Transpose(m, out);
+#endif
+}
+
+// out = a * b（3x4 仿射）：结果第 i 行 = a[i][0] * b 行 0 + a[i][1] * b 行 1 + a[i][2] * b 行 2 + (0, 0, 0, a[i][3])
+inline void Multiply3x4(const float* a, const float* b, float* out)
+{
+#if TE_MATH_SSE
+    const __m128 b0 = _mm_load_ps(b + 0);
+    const __m128 b1 = _mm_load_ps(b + 4);
+    const __m128 b2 = _mm_load_ps(b + 8);
+    const __m128 translationMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+
+    __m128 rows[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const __m128 ai = _mm_load_ps(a + i * 4);
+        __m128 r = _mm_and_ps(ai, translationMask);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(ai, ai, _MM_SHUFFLE(0, 0, 0, 0)), b0));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(ai, ai, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(ai, ai, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+        rows[i] = r;
+    }
+    for (int i = 0; i < 3; ++i)
+        _mm_store_ps(out + i * 4, rows[i]);
+#elif TE_MATH_NEON
+    const float32x4_t b0 = vld1q_f32(b + 0);
+    const float32x4_t b1 = vld1q_f32(b + 4);
+    const float32x4_t b2 = vld1q_f32(b + 8);
+
+    float32x4_t rows[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const float* ai = a + i * 4;
+        float32x4_t r = vsetq_lane_f32(ai[3], vdupq_n_f32(0.0f), 3);
+        r = vmlaq_n_f32(r, b0, ai[0]);
+        r = vmlaq_n_f32(r, b1, ai[1]);
+        r = vmlaq_n_f32(r, b2, ai[2]);
+        rows[i] = r;
+    }
+    for (int i = 0; i < 3; ++i)
+        vst1q_f32(out + i * 4, rows[i]);
+#else
+    Scalar::Multiply3x4(a, b, out);
+#endif
+}
+
+// out = m * a（列主序 4x4 乘 3x4 仿射）：结果第 j 列 = m 的列 0..2 按 a 的第 j 列加权，平移列再加 m 的列 3；
+// 比展开成 4x4 后相乘少 4 次乘加
+inline void Multiply4x4By3x4(const float* m, const float* a, float* out)
+{
+#if TE_MATH_SSE
+    const __m128 m0 = _mm_load_ps(m + 0);
+    const __m128 m1 = _mm_load_ps(m + 4);
+    const __m128 m2 = _mm_load_ps(m + 8);
+    const __m128 m3 = _mm_load_ps(m + 12);
+    const __m128 a0 = _mm_load_ps(a + 0);
+    const __m128 a1 = _mm_load_ps(a + 4);
+    const __m128 a2 = _mm_load_ps(a + 8);
+
+    __m128 c0 = _mm_mul_ps(m0, _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 0, 0, 0)));
+    c0 = _mm_add_ps(c0, _mm_mul_ps(m1, _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 0, 0, 0))));
+    c0 = _mm_add_ps(c0, _mm_mul_ps(m2, _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(0, 0, 0, 0))));
+
+    __m128 c1 = _mm_mul_ps(m0, _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1, 1, 1, 1)));
+    c1 = _mm_add_ps(c1, _mm_mul_ps(m1, _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1, 1, 1, 1))));
+    c1 = _mm_add_ps(c1, _mm_mul_ps(m2, _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(1, 1, 1, 1))));
+
+    __m128 c2 = _mm_mul_ps(m0, _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(2, 2, 2, 2)));
+    c2 = _mm_add_ps(c2, _mm_mul_ps(m1, _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(2, 2, 2, 2))));
+    c2 = _mm_add_ps(c2, _mm_mul_ps(m2, _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 2, 2, 2))));
+
+    __m128 c3 = _mm_mul_ps(m0, _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(3, 3, 3, 3)));
+    c3 = _mm_add_ps(c3, _mm_mul_ps(m1, _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(3, 3, 3, 3))));
+    c3 = _mm_add_ps(c3, _mm_mul_ps(m2, _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(3, 3, 3, 3))));
+    c3 = _mm_add_ps(c3, m3);
+
+    _mm_store_ps(out + 0, c0);
+    _mm_store_ps(out + 4, c1);
+    _mm_store_ps(out + 8, c2);
+    _mm_store_ps(out + 12, c3);
+#elif TE_MATH_NEON
+    const float32x4_t m0 = vld1q_f32(m + 0);
+    const float32x4_t m1 = vld1q_f32(m + 4);
+    const float32x4_t m2 = vld1q_f32(m + 8);
+    const float32x4_t m3 = vld1q_f32(m + 12);
+
+    float32x4_t columns[4];
+    for (int j = 0; j < 4; ++j)
+    {
+        float32x4_t r = vmulq_n_f32(m0, a[0 * 4 + j]);
+        r = vmlaq_n_f32(r, m1, a[1 * 4 + j]);
+        r = vmlaq_n_f32(r, m2, a[2 * 4 + j]);
+        columns[j] = r;
+    }
+    columns[3] = vaddq_f32(columns[3], m3);
+    for (int j = 0; j < 4; ++j)
+        vst1q_f32(out + j * 4, columns[j]);
+#else
+    Scalar::Multiply4x4By3x4(m, a, out);
+#endif
+}
+
+// 3x4 仿射求逆：行主序下线性部分三行的两两叉积即逆矩阵的三列
+bool Inverse3x4(const float* m, float* out);
+
+// 3x4 仿射的法线矩阵：三行两两叉积除以行列式，写出列主序 3x3
+void NormalMatrix3x4(const float* m, float* out);
+
+// 通用 4x4 求逆，返回行列式（SSE 下为 2x2 分块法；NEON / 标量走余子式展开）
+float Inverse(const float* m, float* out);
+
+// 仿射矩阵求逆：R^-1 由三列叉积得到，平移取 -R^-1 t；比通用求逆少约一半运算
+bool InverseAffine(const float* m, float* out);
+
+void QuatToMatrix(const float* q, float* out);
+
+} // namespace TE::MatrixKernels
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "RandomStream.h"
 #include "Vector.h"
 #include <cstdint>
 
@@ -11,6 +12,8 @@ namespace TE {
 /// <summary>
 /// 随机数生成器 - PCG 算法的简单实现
 /// 提供高质量的伪随机数，用于游戏逻辑、粒子效果等
+/// 静态方法是线程局部 RandomStream 的门面：每个线程持有独立状态，互不竞争；
+/// 需要可复现的并行结果时，直接为每个任务构造 RandomStream(seed, jobIndex)
 /// </summary>
 class Random
 {
@@ -18,15 +21,20 @@ public:
     // ==================== 种子设置 ====================
 
     /// <summary>
-    /// 用指定种子初始化全局随机数生成器
+    /// 用指定种子初始化当前线程的随机数生成器（序列与 Random(seed) 相同）
     /// </summary>
     static void Seed(uint64_t seed);
 
     /// <summary>
-    /// 用当前时间初始化全局随机数生成器
+    /// 用当前时间初始化当前线程的随机数生成器
     /// </summary>
     static void SeedWithTime();
 
+    /// <summary>
+    /// 当前线程的随机数流；未调用 Seed 时以 DefaultSeed 与线程序号作为流 ID 初始化
+    /// </summary>
+    [[nodiscard]] static RandomStream& GetThreadStream();
+
     // ==================== 浮点范围随机 ====================
 
     /// <summary>
@@ -157,7 +165,7 @@ public:
     [[nodiscard]] static Random Create(uint64_t seed);
 
     /// <summary>
-    /// 默认构造函数 - 使用当前时间作为种子
+    /// 默认构造函数 - 使用当前时间作为种子（不影响线程随机数流）
     /// </summary>
     Random();
 
@@ -177,16 +185,10 @@ public:
     [[nodiscard]] int NextInt(int min, int max);
     [[nodiscard]] Vector3 NextUnitVector();
 
-private:
-    // PCG 随机数生成器状态
-    uint64_t m_State;
-    uint64_t m_Inc;
-
-    // PCG 核心算法
-    [[nodiscard]] uint32_t PCG32();
+    [[nodiscard]] RandomStream& GetStream() { return m_Stream; }
 
-    // 生成 0~1 的浮点数
-    [[nodiscard]] float PCGFloat();
+private:
+    RandomStream m_Stream;
 };
 
 } // namespace TE
@@ -0,0 +1,112 @@
+// ToyEngine Core Module
+// 值语义随机数流 - PCG32（XSH-RR），支持流 ID、O(log n) 跳跃与批量填充
+//
+// 每个实例独立持有状态，不共享任何全局 / 静态变量，可安全地在多线程中各自使用。
+// 确定性并行的推荐用法：同一 seed 下按任务序号取不同流 ID，
+//   RandomStream stream(seed, jobIndex);          // 或 baseStream.Fork(jobIndex)
+// 结果与线程调度顺序无关。同一条流内部也可用 Advance(n) 直接跳到第 n 个输出，按区间切分工作。
+//
+// 批量填充（FillUInt32 / FillUniform）与逐个调用 NextUInt32 / NextFloat 产生完全相同的序列；
+// AVX2 下 8 个通道分别从第 0..7 个输出出发，每步跳 8 个输出，向量化 LCG 与输出置换。
+
+#pragma once
+
+#include "Vector.h"
+
+#include <cstdint>
+#include <span>
+
+namespace TE {
+
+class RandomStream
+{
+public:
+    static constexpr uint64_t DefaultSeed = 0x853c49e6748fea9bULL;
+
+    /// <summary>
+    /// 默认流：DefaultSeed、流 ID 0
+    /// </summary>
+    RandomStream() : RandomStream(DefaultSeed, 0) {}
+
+    /// <summary>
+    /// 以种子与流 ID 初始化；相同 (seed, streamId) 产生相同序列，不同流 ID 之间序列互不相关
+    /// </summary>
+    explicit RandomStream(uint64_t seed, uint64_t streamId = 0);
+
+    void Reset(uint64_t seed, uint64_t streamId = 0);
+
+    /// <summary>
+    /// 同一种子下的另一条流（常用于按任务序号派生子流）
+    /// </summary>
+    [[nodiscard]] RandomStream Fork(uint64_t streamId) const { return RandomStream(m_Seed, streamId); }
+
+    /// <summary>
+    /// 向前跳过 delta 个输出，O(log delta)；等价于调用 delta 次 NextUInt32
+    /// </summary>
+    void Advance(uint64_t delta);
+
+    [[nodiscard]] uint64_t GetSeed() const { return m_Seed; }
+    [[nodiscard]] uint64_t GetStreamId() const { return m_StreamId; }
+
+    // ==================== 单个取值 ====================
+
+    [[nodiscard]] uint32_t NextUInt32();
+
+    /// <summary>
+    /// [0, 1) 浮点数（24 位精度）
+    /// </summary>
+    [[nodiscard]] float NextFloat() { return static_cast<float>(NextUInt32() >> 8) * (1.0f / 16777216.0f); }
+
+    /// <summary>
+    /// [min, max) 浮点数
+    /// </summary>
+    [[nodiscard]] float NextFloat(float min, float max) { return min + NextFloat() * (max - min); }
+
+    /// <summary>
+    /// [min, max] 整数（包含边界，拒绝采样消除取模偏差）
+    /// </summary>
+    [[nodiscard]] int NextInt(int min, int max);
+
+    [[nodiscard]] bool NextBool() { return (NextUInt32() & 1u) != 0; }
+    [[nodiscard]] bool NextBool(float probability) { return NextFloat() < probability; }
+
+    /// <summary>
+    /// 单位球面 / 单位圆上均匀分布（Marsaglia 拒绝采样）
+    /// </summary>
+    [[nodiscard]] Vector3 NextUnitVector();
+    [[nodiscard]] Vector2 NextUnitCircle();
+
+    /// <summary>
+    /// 半径为 radius 的球内均匀分布；每个点消耗 3 个 NextFloat，与 FillInsideSphere 消耗的随机序列相同
+    /// </summary>
+    [[nodiscard]] Vector3 NextInsideSphere(float radius);
+
+    /// <summary>
+    /// 正态分布（极坐标 Box-Muller）；成对生成的另一个值缓存在本实例中
+    /// </summary>
+    [[nodiscard]] float NextGaussian(float mean, float stdDev);
+
+    // ==================== 批量填充 ====================
+
+    void FillUInt32(std::span<uint32_t> outValues);
+
+    /// <summary>
+    /// [min, max) 均匀分布；与逐个 NextFloat(min, max) 序列一致
+    /// </summary>
+    void FillUniform(std::span<float> outValues, float min = 0.0f, float max = 1.0f);
+
+    /// <summary>
+    /// 球内均匀分布的点；先批量生成均匀数，再按 64 个一组用 Math::Fast* 批量求三角与立方根
+    /// </summary>
+    void FillInsideSphere(std::span<Vector3> outPoints, float radius);
+
+private:
+    uint64_t m_State = 0;
+    uint64_t m_Inc = 1;
+    uint64_t m_Seed = DefaultSeed;
+    uint64_t m_StreamId = 0;
+    float m_GaussianSpare = 0.0f;
+    bool m_HasGaussianSpare = false;
+};
+
+} // namespace TE
@@ -0,0 +1,158 @@
+// ToyEngine Core Module
+// 射线批量求交内核 —— 射线包 vs AABB、单条射线 vs SoA 三角形（Möller–Trumbore）
+//
+// 两类内核都是 4 / 8 通道：
+//   - RayPacket4 / RayPacket8：4 / 8 条射线同时与一个 AABB 做 slab 测试（BVH 节点遍历、拾取粗筛）
+//   - IntersectTriangles4 / 8：1 条射线同时与 TriangleSoA 中连续的 4 / 8 个三角形求交
+// SSE 下 8 通道内核拆成两组 4 通道，AVX2 下一次完成；无 SIMD 时逐通道走标量公式。
+// RaycastTriangles / AnyTriangleHit 在整个 TriangleSoA 上按最宽通道遍历，分别用于最近命中（拾取）与遮挡 / 视线查询。
+// 三角形双面求交，判定与 Geometry.h 的 IntersectRayTriangle 相同；退化三角形（|det| < Math::RayTriangleEpsilon）视为不相交。
+
+#pragma once
+
+#include "Geometry.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TE {
+
+/// <summary>
+/// 射线包：N 条射线按分量 SoA 存储，倒数方向在 SetRay 时预先算好
+/// 未设置的通道 MaxDistance 为 -1，永远不会命中
+/// </summary>
+template<size_t N>
+struct alignas(32) TRayPacket
+{
+    static constexpr size_t Width = N;
+
+    float OriginX[N]{}, OriginY[N]{}, OriginZ[N]{};
+    float DirectionX[N]{}, DirectionY[N]{}, DirectionZ[N]{};
+    float InvDirectionX[N]{}, InvDirectionY[N]{}, InvDirectionZ[N]{};
+    float MaxDistance[N]{};
+
+    TRayPacket()
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+            MaxDistance[lane] = -1.0f;
+    }
+
+    /// <summary>
+    /// 设置第 lane 条射线；方向分量接近 0 时用带符号的极小值代替，倒数保持有限，slab 测试不会出现 0 * inf
+    /// </summary>
+    void SetRay(size_t lane, const Ray& ray, float maxDistance = 1e30f)
+    {
+        auto safeInverse = [](float value) {
+            constexpr float Tiny = 1e-20f;
+            return 1.0f / (std::abs(value) < Tiny ? std::copysign(Tiny, value) : value);
+        };
+        OriginX[lane] = ray.Origin.X;
+        OriginY[lane] = ray.Origin.Y;
+        OriginZ[lane] = ray.Origin.Z;
+        DirectionX[lane] = ray.Direction.X;
+        DirectionY[lane] = ray.Direction.Y;
+        DirectionZ[lane] = ray.Direction.Z;
+        InvDirectionX[lane] = safeInverse(ray.Direction.X);
+        InvDirectionY[lane] = safeInverse(ray.Direction.Y);
+        InvDirectionZ[lane] = safeInverse(ray.Direction.Z);
+        MaxDistance[lane] = maxDistance;
+    }
+};
+
+using RayPacket4 = TRayPacket<4>;
+using RayPacket8 = TRayPacket<8>;
+
+/// <summary>
+/// SoA 三角形数组：每个三角形存 V0 与两条边 (V1 - V0, V2 - V0)，省去求交时的两次减法。
+/// 存储按 8 个补齐（补齐部分为零三角形，行列式为 0 必然不相交），内核可以整块读取而无需处理尾部
+/// </summary>
+class TriangleSoA
+{
+public:
+    /// 补齐粒度（与最宽的 8 通道内核一致）
+    static constexpr size_t Alignment = 8;
+
+    enum EComponent : uint32_t
+    {
+        V0X, V0Y, V0Z,
+        Edge1X, Edge1Y, Edge1Z,
+        Edge2X, Edge2Y, Edge2Z,
+        ComponentCount
+    };
+
+    void Reserve(size_t triangleCount);
+    void Clear();
+
+    /// <summary>
+    /// 追加一个三角形，返回其索引（即 RayTriangleHit::TriangleIndex）
+    /// </summary>
+    uint32_t Add(const Vector3& v0, const Vector3& v1, const Vector3& v2);
+
+    [[nodiscard]] size_t Size() const { return m_Count; }
+    [[nodiscard]] size_t PaddedSize() const { return m_Components[0].size(); }
+    [[nodiscard]] bool IsEmpty() const { return m_Count == 0; }
+
+    [[nodiscard]] const float* Data(EComponent component) const { return m_Components[component].data(); }
+
+    [[nodiscard]] Vector3 GetVertex0(size_t index) const;
+    [[nodiscard]] Vector3 GetEdge1(size_t index) const;
+    [[nodiscard]] Vector3 GetEdge2(size_t index) const;
+
+private:
+    std::vector<float> m_Components[ComponentCount];
+    size_t m_Count = 0;
+};
+
+/// <summary>
+/// 射线与三角形的命中结果；U / V 为重心坐标（命中点 = V0 + U * Edge1 + V * Edge2）
+/// </summary>
+struct RayTriangleHit
+{
+    float Distance = 0.0f;
+    float U = 0.0f;
+    float V = 0.0f;
+    uint32_t TriangleIndex = 0;
+};
+
+namespace Math {
+
+// ==================== 射线包 vs AABB ====================
+
+/// <summary>
+/// 射线包与单个 AABB 的 slab 测试；返回命中通道的位掩码（第 i 位对应第 i 条射线）。
+/// 命中条件为进入距离 <= 离开距离，且区间与 [0, MaxDistance] 相交；outNearDistances 非空时写入各通道的进入距离（下限为 0）
+/// </summary>
+[[nodiscard]] uint32_t IntersectAABB(const RayPacket4& rays, const BoundingBox& box, float* outNearDistances = nullptr);
+[[nodiscard]] uint32_t IntersectAABB(const RayPacket8& rays, const BoundingBox& box, float* outNearDistances = nullptr);
+
+// ==================== 单条射线 vs 三角形 ====================
+
+/// <summary>
+/// 射线与 triangles 中 [first, first + 4) 的三角形求交（first 须为 4 的倍数且小于 PaddedSize）。
+/// 返回命中位掩码，命中条件 0 <= t <= maxDistance；有命中时 outDistances 写入各通道的 t（未命中通道的值无意义），
+/// 掩码为 0 时不写入。区间判定在除以行列式之前完成，整块未命中时省去除法
+/// </summary>
+[[nodiscard]] uint32_t IntersectTriangles4(const Ray& ray, const TriangleSoA& triangles, size_t first,
+                                           float maxDistance, float outDistances[4]);
+
+/// <summary>
+/// 同上，一次 8 个三角形（first 须为 8 的倍数）
+/// </summary>
+[[nodiscard]] uint32_t IntersectTriangles8(const Ray& ray, const TriangleSoA& triangles, size_t first,
+                                           float maxDistance, float outDistances[8]);
+
+/// <summary>
+/// 最近命中：遍历全部三角形，随命中逐步收紧 maxDistance；未命中返回 false
+/// </summary>
+[[nodiscard]] bool RaycastTriangles(const Ray& ray, const TriangleSoA& triangles, float maxDistance,
+                                    RayTriangleHit& outHit);
+
+/// <summary>
+/// 任意命中：找到第一个 [0, maxDistance] 内的交点即返回（遮挡 / 视线查询）
+/// </summary>
+[[nodiscard]] bool AnyTriangleHit(const Ray& ray, const TriangleSoA& triangles, float maxDistance);
+
+} // namespace Math
+
+} // namespace TE
@@ -4,7 +4,17 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <span>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+#include <xmmintrin.h>
+#define TE_SCALAR_MATH_SSE 1
+#else
+#define TE_SCALAR_MATH_SSE 0
+#endif
 
 namespace TE::Math {
 
@@ -246,4 +256,213 @@ inline float Clamp01(float value)
     return Clamp(value, 0.0f, 1.0f);
 }
 
+// ==================== 快速近似 ====================
+// 以精度换速度的 Fast* 变体：无 libm 调用、无大范围规约，适合离线烘焙、批量采样等对误差不敏感的热路径。
+// 标注的最大误差由 MathTest::TestFastMath 在全定义域采样验证；超出标注输入范围时不保证精度。
+// 需要与 libm 逐位一致或处理 inf/nan 的场合继续使用上面的精确版本。
+
+namespace FastMathDetail {
+
+// 2π 拆成三段（Cody-Waite）：高、中两段的有效位足够短，|q| < 4096 时 q * 段 为精确乘积
+constexpr float TwoPiHigh = 6.28125f;
+constexpr float TwoPiMid = 0.0019354820251464844f;
+constexpr float TwoPiLow = -1.7484555e-7f;
+constexpr float InvTwoPi = 0.159154943f;
+
+// sin：[-π/2, π/2] 上 11 次奇极小极大多项式；cos：10 次偶多项式
+constexpr float SinC1 = -0.16666667f, SinC2 = 0.0083333310f, SinC3 = -0.00019840874f, SinC4 = 2.7525562e-6f, SinC5 = -2.3889859e-8f;
+constexpr float CosC1 = -0.5f, CosC2 = 0.041666638f, CosC3 = -0.0013888378f, CosC4 = 2.4760495e-5f, CosC5 = -2.6051615e-7f;
+
+// atan：[0, 1] 上 atan(a) / a 关于 a² 的 6 项多项式
+constexpr float AtanC0 = 0.99997726f, AtanC1 = -0.33262347f, AtanC2 = 0.19354346f, AtanC3 = -0.11643287f, AtanC4 = 0.05265332f, AtanC5 = -0.01172120f;
+
+// acos：Abramowitz & Stegun 4.4.46，acos(x) ≈ sqrt(1 - x) * P(x)，x ∈ [0, 1]
+constexpr float AcosC0 = 1.5707963050f, AcosC1 = -0.2145988016f, AcosC2 = 0.0889789874f, AcosC3 = -0.0501743046f;
+constexpr float AcosC4 = 0.0308918810f, AcosC5 = -0.0170881256f, AcosC6 = 0.0066700901f, AcosC7 = -0.0012624911f;
+
+// exp2：小数部分规约到 [-0.5, 0.5] 后的 6 次泰勒系数 ln2^k / k!
+constexpr float Exp2C1 = 0.69314718f, Exp2C2 = 0.24022651f, Exp2C3 = 0.055504109f, Exp2C4 = 0.0096181291f, Exp2C5 = 0.0013333558f, Exp2C6 = 0.00015403530f;
+
+// log2：尾数规约到 [√½, √2) 后 t = (m - 1) / (m + 1)，log2(m) = (2 / ln2) * atanh(t) 的奇级数
+constexpr float Log2C1 = 2.88539008f, Log2C3 = 0.961796694f, Log2C5 = 0.577078016f, Log2C7 = 0.412198583f, Log2C9 = 0.320598898f;
+constexpr float Sqrt2 = 1.41421356f;
+
+inline float SinPoly(float y)
+{
+    const float y2 = y * y;
+    return ((((SinC5 * y2 + SinC4) * y2 + SinC3) * y2 + SinC2) * y2 + SinC1) * y2 * y + y;
+}
+
+inline float CosPoly(float y)
+{
+    const float y2 = y * y;
+    return ((((CosC5 * y2 + CosC4) * y2 + CosC3) * y2 + CosC2) * y2 + CosC1) * y2 + 1.0f;
+}
+
+/// <summary>
+/// 规约到 [-π/2, π/2]：返回规约后的角度，outCosSign 为 cos 的符号（落在反射区间时为 -1）
+/// 全程无分支（取整用 1.5 * 2^23 加减，反射用条件选择），随机输入下不受分支预测失败影响
+/// </summary>
+inline float ReduceHalfPi(float radians, float& outCosSign)
+{
+    constexpr float RoundMagic = 12582912.0f;
+    const float q = (radians * InvTwoPi + RoundMagic) - RoundMagic;
+    const float y = ((radians - q * TwoPiHigh) - q * TwoPiMid) - q * TwoPiLow;
+    const bool reflect = std::abs(y) > HALF_PI;
+    outCosSign = reflect ? -1.0f : 1.0f;
+    return reflect ? std::copysign(PI, y) - y : y;
+}
+
+inline float AcosPositive(float x)
+{
+    const float p = ((((((AcosC7 * x + AcosC6) * x + AcosC5) * x + AcosC4) * x + AcosC3) * x + AcosC2) * x + AcosC1) * x + AcosC0;
+    return std::sqrt(1.0f - x) * p;
+}
+
+} // namespace FastMathDetail
+
+/// <summary>
+/// 1 / sqrt(x)：硬件 rsqrt 估计（SSE）或位技巧初值，再做 Newton 迭代
+/// 最大相对误差：SSE 路径 ≤ 5e-7，位技巧回退路径 ≤ 5e-6；x 须为正有限值
+/// </summary>
+inline float FastRsqrt(float value)
+{
+#if TE_SCALAR_MATH_SSE
+    const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+    return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#else
+    float estimate = std::bit_cast<float>(0x5F375A86u - (std::bit_cast<uint32_t>(value) >> 1));
+    estimate = estimate * (1.5f - 0.5f * value * estimate * estimate);
+    return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#endif
+}
+
+/// <summary>
+/// sin，|x| ≤ 2.5e4 时最大绝对误差 ≤ 5e-7；更大的输入规约会丢精度
+/// </summary>
+inline float FastSin(float radians)
+{
+    float cosSign = 1.0f;
+    return FastMathDetail::SinPoly(FastMathDetail::ReduceHalfPi(radians, cosSign));
+}
+
+/// <summary>
+/// cos，误差与输入范围同 FastSin
+/// </summary>
+inline float FastCos(float radians)
+{
+    float cosSign = 1.0f;
+    const float y = FastMathDetail::ReduceHalfPi(radians, cosSign);
+    return cosSign * FastMathDetail::CosPoly(y);
+}
+
+/// <summary>
+/// 同时求 sin 与 cos（共享一次规约）
+/// </summary>
+inline void FastSinCos(float radians, float& outSin, float& outCos)
+{
+    float cosSign = 1.0f;
+    const float y = FastMathDetail::ReduceHalfPi(radians, cosSign);
+    outSin = FastMathDetail::SinPoly(y);
+    outCos = cosSign * FastMathDetail::CosPoly(y);
+}
+
+/// <summary>
+/// atan2，全平面最大绝对误差 ≤ 3e-6 rad；(0, 0) 返回 0，y 为 ±0 时按符号返回 ±0 / ±π
+/// </summary>
+inline float FastAtan2(float y, float x)
+{
+    using namespace FastMathDetail;
+    const float ax = std::abs(x);
+    const float ay = std::abs(y);
+    const float maxValue = std::max(ax, ay);
+    const float a = maxValue > 0.0f ? std::min(ax, ay) / maxValue : 0.0f;
+    const float s = a * a;
+    float r = (((((AtanC5 * s + AtanC4) * s + AtanC3) * s + AtanC2) * s + AtanC1) * s + AtanC0) * a;
+    if (ay > ax)
+        r = HALF_PI - r;
+    if (x < 0.0f)
+        r = PI - r;
+    return std::copysign(r, y);
+}
+
+/// <summary>
+/// atan，最大绝对误差同 FastAtan2
+/// </summary>
+inline float FastAtan(float value)
+{
+    return FastAtan2(value, 1.0f);
+}
+
+/// <summary>
+/// acos，输入先钳制到 [-1, 1]；最大绝对误差 ≤ 1e-6 rad
+/// </summary>
+inline float FastAcos(float value)
+{
+    const float x = Clamp(value, -1.0f, 1.0f);
+    const float r = FastMathDetail::AcosPositive(std::abs(x));
+    return x < 0.0f ? PI - r : r;
+}
+
+/// <summary>
+/// asin，输入先钳制到 [-1, 1]；最大绝对误差 ≤ 1e-6 rad
+/// </summary>
+inline float FastAsin(float value)
+{
+    const float x = Clamp(value, -1.0f, 1.0f);
+    return std::copysign(HALF_PI - FastMathDetail::AcosPositive(std::abs(x)), x);
+}
+
+/// <summary>
+/// 2^x，x 钳制到 [-126, 127]；最大相对误差 ≤ 5e-7
+/// </summary>
+inline float FastExp2(float value)
+{
+    using namespace FastMathDetail;
+    const float x = Clamp(value, -126.0f, 127.0f);
+    const int32_t i = static_cast<int32_t>(x + (x >= 0.0f ? 0.5f : -0.5f));
+    const float f = x - static_cast<float>(i);
+    const float p = (((((Exp2C6 * f + Exp2C5) * f + Exp2C4) * f + Exp2C3) * f + Exp2C2) * f + Exp2C1) * f + 1.0f;
+    return p * std::bit_cast<float>(static_cast<uint32_t>(i + 127) << 23);
+}
+
+/// <summary>
+/// log2(x)，x 须为正的规格化有限值；最大绝对误差 ≤ 5e-7
+/// </summary>
+inline float FastLog2(float value)
+{
+    using namespace FastMathDetail;
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    float exponent = static_cast<float>(static_cast<int32_t>((bits >> 23) & 0xFFu) - 127);
+    float m = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u);
+    if (m > Sqrt2)
+    {
+        m *= 0.5f;
+        exponent += 1.0f;
+    }
+    const float t = (m - 1.0f) / (m + 1.0f);
+    const float t2 = t * t;
+    return exponent + ((((Log2C9 * t2 + Log2C7) * t2 + Log2C5) * t2 + Log2C3) * t2 + Log2C1) * t;
+}
+
+/// <summary>
+/// e^x 与 ln(x) 的快速版本，经由 exp2 / log2 换底
+/// </summary>
+inline float FastExp(float value) { return FastExp2(value * 1.44269504f); }
+inline float FastLog(float value) { return FastLog2(value) * 0.693147181f; }
+
+// ---------- 批量（SIMD 宽度）----------
+// 与上面的标量版本同一算法、同一误差上界；AVX2 每次 8 个、SSE 每次 4 个，尾部走标量版本。
+// 输入输出 span 长度必须一致（Debug 下断言），允许原地计算（输出与输入为同一段内存）。
+
+void FastRsqrt(std::span<const float> values, std::span<float> outValues);
+void FastSin(std::span<const float> radians, std::span<float> outValues);
+void FastCos(std::span<const float> radians, std::span<float> outValues);
+void FastSinCos(std::span<const float> radians, std::span<float> outSin, std::span<float> outCos);
+void FastAtan2(std::span<const float> y, std::span<const float> x, std::span<float> outValues);
+void FastAsin(std::span<const float> values, std::span<float> outValues);
+void FastAcos(std::span<const float> values, std::span<float> outValues);
+void FastExp2(std::span<const float> values, std::span<float> outValues);
+void FastLog2(std::span<const float> values, std::span<float> outValues);
+
 } // namespace TE::Math
@@ -49,6 +49,11 @@ public:
     /// </summary>
     [[nodiscard]] Matrix4 ToMatrix() const;
 
+    /// <summary>
+    /// 转换为紧凑的 3x4 仿射矩阵（与 ToMatrix 的前三行相同）
+    /// </summary>
+    [[nodiscard]] Matrix3x4 ToMatrix3x4() const;
+
     /// <summary>
     /// 从矩阵还原变换（缩放假设为正）
     /// </summary>
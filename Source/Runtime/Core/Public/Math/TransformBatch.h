@@ -0,0 +1,76 @@
+// ToyEngine Core Module
+// 批量变换内核 —— 一次处理成千上万个对象的世界矩阵 / MVP / 法线矩阵
+//
+// 输入为 SoA 分量数组（位置、旋转、缩放各占一段连续内存）或矩阵数组，
+// SSE 路径每次处理 4 个对象：分量按通道转置后逐元素计算，再转置回列主序（Matrix4）或行主序（Matrix3x4）写出。
+// 世界矩阵优先使用 Matrix3x4 重载：读写量少 25%，与 VP 相乘、求法线矩阵都省去恒为 0 0 0 1 的最后一行。
+// 所有 span 的长度必须一致（输出不足时只处理前 min 个并在 Debug 下断言）。
+
+#pragma once
+
+#include "Geometry.h"
+#include "Matrix.h"
+#include "Quat.h"
+#include "Transform.h"
+
+#include <span>
+
+namespace TE::Math {
+
+/// <summary>
+/// 批量 TRS -> 世界矩阵（等价于逐个 Transform(p, r, s).ToMatrix()）
+/// </summary>
+void TransformsToMatrices(std::span<const Vector3> positions,
+                          std::span<const Quat> rotations,
+                          std::span<const Vector3> scales,
+                          std::span<Matrix4> outMatrices);
+
+/// <summary>
+/// 批量 TRS -> 3x4 仿射世界矩阵（等价于逐个 Transform(p, r, s).ToMatrix3x4()）
+/// </summary>
+void TransformsToMatrices(std::span<const Vector3> positions,
+                          std::span<const Quat> rotations,
+                          std::span<const Vector3> scales,
+                          std::span<Matrix3x4> outMatrices);
+
+/// <summary>
+/// AoS 便捷重载：内部按 4 个一组拆成 SoA 处理
+/// </summary>
+void TransformsToMatrices(std::span<const Transform> transforms, std::span<Matrix4> outMatrices);
+void TransformsToMatrices(std::span<const Transform> transforms, std::span<Matrix3x4> outMatrices);
+
+/// <summary>
+/// 批量左乘：out[i] = lhs * rhs[i]（如 viewProjection * world[i] 得到 MVP）；lhs 只加载一次
+/// </summary>
+void MultiplyMatrices(const Matrix4& lhs, std::span<const Matrix4> rhs, std::span<Matrix4> outMatrices);
+
+/// <summary>
+/// 批量左乘仿射矩阵：out[i] = lhs * rhs[i]，结果为完整 4x4（如 MVP）
+/// </summary>
+void MultiplyMatrices(const Matrix4& lhs, std::span<const Matrix3x4> rhs, std::span<Matrix4> outMatrices);
+
+/// <summary>
+/// 批量法线矩阵：out[i] = matrices[i].GetNormalMatrix()（左上 3x3 的逆转置）
+/// 用伴随矩阵直接求得，行列式为 0 时结果为 inf / nan，与逐个调用一致
+/// </summary>
+void NormalMatrices(std::span<const Matrix4> matrices, std::span<Matrix3> outNormalMatrices);
+
+/// <summary>
+/// 批量法线矩阵：out[i] = matrices[i].GetNormalMatrix()；行主序的三行可直接做叉积，无需先提取 3x3
+/// </summary>
+void NormalMatrices(std::span<const Matrix3x4> matrices, std::span<Matrix3> outNormalMatrices);
+
+/// <summary>
+/// 用同一个仿射矩阵批量变换点：out[i] = matrix.TransformPoint(points[i])；允许原地变换
+/// </summary>
+void TransformPoints(const Matrix3x4& matrix, std::span<const Vector3> points, std::span<Vector3> outPoints);
+
+/// <summary>
+/// 批量世界包围盒：out[i] = localBounds[i].TransformBy(worldMatrices[i])（Arvo 绝对值矩阵法）
+/// 每帧为移动物体刷新剔除 / 空间索引用的 AABB；允许 out 与 localBounds 为同一数组
+/// </summary>
+void TransformBounds(std::span<const BoundingBox> localBounds,
+                     std::span<const Matrix3x4> worldMatrices,
+                     std::span<BoundingBox> outWorldBounds);
+
+} // namespace TE::Math
@@ -0,0 +1,225 @@
+// ToyEngine Core Module
+// 顶点量化与打包 —— 半精度浮点、snorm / unorm、八面体单位向量编码与 RGBA8 颜色
+//
+// 这些函数是压缩顶点格式的组成部分。以 FStaticMeshVertex（56 字节）为例：
+//   Position float3(12) + Normal Oct16(4) + Tangent Oct16(4) + TexCoord Half2(4) + Color RGBA8(4) = 28 字节，
+// 顶点带宽减半；法线 / 切线降到 Oct8 时为 24 字节。
+//
+// 约定：
+// - 打包结果的分量按内存顺序从低位到高位排列（x 在最低位），与 GPU 的 R8G8B8A8 / R16G16 格式及 GLSL packUnorm4x8 等一致；
+//   注意 Color::ToPackedRGBA 是把 R 放在最高字节的整数表示，两者不能混用。
+// - unorm 按 [0, 1]、snorm 按 [-1, 1] 截断后就近舍入；snorm 解码遵循 D3D / GL 规则（-128 与 -127 都解为 -1）。
+// - 半精度转换就近舍入到偶数，溢出为 inf，保留 NaN。开启 F16C（TE_ENABLE_AVX2）时走硬件指令，
+//   Scalar 命名空间为逐位等价的软件实现（MathTest 对全部 65536 个半精度值及随机浮点数校验两者一致）。
+// - 八面体编码把单位向量映射到 [-1, 1]^2 再做 snorm 量化，编码时在 4 个相邻量化点中选择解码误差最小的一个；
+//   最大角度误差：Oct16 约 0.0025°（上界 0.003°），Oct8 约 0.64°（上界 0.7°），由 MathTest::TestVertexPacking 采样验证。
+
+#pragma once
+
+#include "Color.h"
+#include "MatrixKernels.h"
+#include "ScalarMath.h"
+#include "Vector.h"
+
+#include <cstdint>
+#include <span>
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define TE_MATH_F16C 1
+#else
+#define TE_MATH_F16C 0
+#endif
+
+namespace TE::Math {
+
+// ==================== 半精度浮点 ====================
+
+namespace Scalar {
+
+/// <summary>
+/// 软件实现的 float -> half（就近舍入到偶数），与 F16C 的 vcvtps2ph 逐位一致
+/// </summary>
+[[nodiscard]] uint16_t FloatToHalf(float value);
+
+/// <summary>
+/// 软件实现的 half -> float（精确），NaN 置为 quiet NaN，与 vcvtph2ps 一致
+/// </summary>
+[[nodiscard]] float HalfToFloat(uint16_t half);
+
+} // namespace Scalar
+
+[[nodiscard]] inline uint16_t FloatToHalf(float value)
+{
+#if TE_MATH_F16C
+    return static_cast<uint16_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+#else
+    return Scalar::FloatToHalf(value);
+#endif
+}
+
+[[nodiscard]] inline float HalfToFloat(uint16_t half)
+{
+#if TE_MATH_F16C
+    return _cvtsh_ss(half);
+#else
+    return Scalar::HalfToFloat(half);
+#endif
+}
+
+/// <summary>
+/// 批量 float -> half；F16C 下每次 8 个。两个 span 长度须一致（输出不足时只处理前 min 个并在 Debug 下断言）
+/// </summary>
+void FloatsToHalves(std::span<const float> values, std::span<uint16_t> outHalves);
+
+/// <summary>
+/// 批量 half -> float，参数约定同 FloatsToHalves
+/// </summary>
+void HalvesToFloats(std::span<const uint16_t> halves, std::span<float> outValues);
+
+/// <summary>
+/// 两个半精度打包到 32 位（x 在低 16 位），常用于纹理坐标
+/// </summary>
+[[nodiscard]] inline uint32_t PackHalf2x16(const Vector2& value)
+{
+    return static_cast<uint32_t>(FloatToHalf(value.X)) | (static_cast<uint32_t>(FloatToHalf(value.Y)) << 16);
+}
+
+[[nodiscard]] inline Vector2 UnpackHalf2x16(uint32_t packed)
+{
+    return {HalfToFloat(static_cast<uint16_t>(packed & 0xFFFFu)), HalfToFloat(static_cast<uint16_t>(packed >> 16))};
+}
+
+// ==================== unorm / snorm ====================
+
+[[nodiscard]] inline uint8_t FloatToUnorm8(float value)
+{
+    return static_cast<uint8_t>(Clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+[[nodiscard]] inline float Unorm8ToFloat(uint8_t value)
+{
+    return static_cast<float>(value) * (1.0f / 255.0f);
+}
+
+[[nodiscard]] inline uint16_t FloatToUnorm16(float value)
+{
+    return static_cast<uint16_t>(Clamp(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+[[nodiscard]] inline float Unorm16ToFloat(uint16_t value)
+{
+    return static_cast<float>(value) * (1.0f / 65535.0f);
+}
+
+[[nodiscard]] inline int8_t FloatToSnorm8(float value)
+{
+    const float scaled = Clamp(value, -1.0f, 1.0f) * 127.0f;
+    return static_cast<int8_t>(scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+}
+
+[[nodiscard]] inline float Snorm8ToFloat(int8_t value)
+{
+    return Max(static_cast<float>(value) * (1.0f / 127.0f), -1.0f);
+}
+
+[[nodiscard]] inline int16_t FloatToSnorm16(float value)
+{
+    const float scaled = Clamp(value, -1.0f, 1.0f) * 32767.0f;
+    return static_cast<int16_t>(scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+}
+
+[[nodiscard]] inline float Snorm16ToFloat(int16_t value)
+{
+    return Max(static_cast<float>(value) * (1.0f / 32767.0f), -1.0f);
+}
+
+[[nodiscard]] inline uint32_t PackUnorm4x8(const Vector4& value)
+{
+    return static_cast<uint32_t>(FloatToUnorm8(value.X)) |
+           (static_cast<uint32_t>(FloatToUnorm8(value.Y)) << 8) |
+           (static_cast<uint32_t>(FloatToUnorm8(value.Z)) << 16) |
+           (static_cast<uint32_t>(FloatToUnorm8(value.W)) << 24);
+}
+
+[[nodiscard]] inline Vector4 UnpackUnorm4x8(uint32_t packed)
+{
+    return {Unorm8ToFloat(static_cast<uint8_t>(packed)), Unorm8ToFloat(static_cast<uint8_t>(packed >> 8)),
+            Unorm8ToFloat(static_cast<uint8_t>(packed >> 16)), Unorm8ToFloat(static_cast<uint8_t>(packed >> 24))};
+}
+
+[[nodiscard]] inline uint32_t PackSnorm4x8(const Vector4& value)
+{
+    return static_cast<uint32_t>(static_cast<uint8_t>(FloatToSnorm8(value.X))) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(FloatToSnorm8(value.Y))) << 8) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(FloatToSnorm8(value.Z))) << 16) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(FloatToSnorm8(value.W))) << 24);
+}
+
+[[nodiscard]] inline Vector4 UnpackSnorm4x8(uint32_t packed)
+{
+    return {Snorm8ToFloat(static_cast<int8_t>(packed)), Snorm8ToFloat(static_cast<int8_t>(packed >> 8)),
+            Snorm8ToFloat(static_cast<int8_t>(packed >> 16)), Snorm8ToFloat(static_cast<int8_t>(packed >> 24))};
+}
+
+[[nodiscard]] inline uint32_t PackUnorm2x16(const Vector2& value)
+{
+    return static_cast<uint32_t>(FloatToUnorm16(value.X)) | (static_cast<uint32_t>(FloatToUnorm16(value.Y)) << 16);
+}
+
+[[nodiscard]] inline Vector2 UnpackUnorm2x16(uint32_t packed)
+{
+    return {Unorm16ToFloat(static_cast<uint16_t>(packed)), Unorm16ToFloat(static_cast<uint16_t>(packed >> 16))};
+}
+
+[[nodiscard]] inline uint32_t PackSnorm2x16(const Vector2& value)
+{
+    return static_cast<uint32_t>(static_cast<uint16_t>(FloatToSnorm16(value.X))) |
+           (static_cast<uint32_t>(static_cast<uint16_t>(FloatToSnorm16(value.Y))) << 16);
+}
+
+[[nodiscard]] inline Vector2 UnpackSnorm2x16(uint32_t packed)
+{
+    return {Snorm16ToFloat(static_cast<int16_t>(packed)), Snorm16ToFloat(static_cast<int16_t>(packed >> 16))};
+}
+
+// ==================== 颜色 ====================
+
+/// <summary>
+/// 颜色按 R8G8B8A8_UNORM 的内存顺序打包（R 在最低字节），分量截断到 [0, 1] 后就近舍入
+/// </summary>
+[[nodiscard]] inline uint32_t PackColorRGBA8(const Color& color)
+{
+    return PackUnorm4x8(Vector4(color.R, color.G, color.B, color.A));
+}
+
+[[nodiscard]] inline Color UnpackColorRGBA8(uint32_t packed)
+{
+    const Vector4 value = UnpackUnorm4x8(packed);
+    return {value.X, value.Y, value.Z, value.W};
+}
+
+// ==================== 八面体单位向量编码 ====================
+
+/// <summary>
+/// 单位向量 -> 八面体参数 [-1, 1]^2（未量化）；输入无需严格归一化，但不能为零向量
+/// </summary>
+[[nodiscard]] Vector2 OctahedralEncode(const Vector3& direction);
+
+/// <summary>
+/// 八面体参数 -> 单位向量（结果已归一化）
+/// </summary>
+[[nodiscard]] Vector3 OctahedralDecode(const Vector2& encoded);
+
+/// <summary>
+/// 单位向量（法线 / 切线）编码为 2 x snorm16（x 在低 16 位）；与 UnpackOctahedral16 配对
+/// </summary>
+[[nodiscard]] uint32_t PackOctahedral16(const Vector3& direction);
+[[nodiscard]] Vector3 UnpackOctahedral16(uint32_t packed);
+
+/// <summary>
+/// 单位向量（法线 / 切线）编码为 2 x snorm8（x 在低 8 位）；与 UnpackOctahedral8 配对
+/// </summary>
+[[nodiscard]] uint16_t PackOctahedral8(const Vector3& direction);
+[[nodiscard]] Vector3 UnpackOctahedral8(uint16_t packed);
+
+} // namespace TE::Math
@@ -0,0 +1,774 @@
+// ToyEngine Core Module
+// 开放寻址扁平哈希表（Swiss table 风格）— 元素连续存放在一块引擎分配的内存中，查找不追指针
+//
+// 用法：
+//   TE::TFlatHashMap<const StaticMesh*, FRenderData> cache(MemoryTag::Renderer);
+//   cache[mesh] = data;
+//   if (auto it = cache.find(mesh); it != cache.end()) { ... }
+//   TE::TFlatHashSet<int> keys;
+//
+// 布局：每个槽位一个控制字节（空 / 已删除 / 哈希低 7 位），按 16 字节分组；查找时一次比较整组控制字节
+// （SSE2 下为一条 pcmpeqb + pmovmskb），只有 7 位指纹命中的槽位才比较键。
+//
+// 与 std::unordered_map 的差异：
+// - 扩容（rehash）会移动元素，所有迭代器、指针、引用随之失效；erase 只使当前元素失效
+// - 元素类型为 std::pair<const K, V>，rehash 时 const 键按拷贝构造搬移
+// - 不提供桶接口与 max_load_factor；负载上限固定为 7/8
+
+#pragma once
+
+#include "Memory.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TE_FLAT_HASH_SSE2 1
+#include <emmintrin.h>
+#else
+#define TE_FLAT_HASH_SSE2 0
+#endif
+
+namespace TE {
+
+namespace FlatHashDetail {
+
+using CtrlByte = std::int8_t;
+
+inline constexpr CtrlByte CtrlEmpty = -128;  // 0b1000'0000
+inline constexpr CtrlByte CtrlDeleted = -2;  // 0b1111'1110
+// 满槽：0b0xxx'xxxx，低 7 位为哈希指纹（H2）
+
+inline constexpr std::size_t GroupWidth = 16;
+inline constexpr std::size_t MinCapacity = GroupWidth;
+
+[[nodiscard]] inline bool IsFull(CtrlByte ctrl) noexcept
+{
+    return ctrl >= 0;
+}
+
+// std::hash 对整数与指针通常是恒等映射，先混合再拆出 H1 / H2
+[[nodiscard]] inline std::uint64_t MixHash(std::size_t hash) noexcept
+{
+    const std::uint64_t h = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 32);
+}
+
+[[nodiscard]] inline std::size_t H1(std::uint64_t mixed) noexcept
+{
+    return static_cast<std::size_t>(mixed >> 7);
+}
+
+[[nodiscard]] inline CtrlByte H2(std::uint64_t mixed) noexcept
+{
+    return static_cast<CtrlByte>(mixed & 0x7F);
+}
+
+// 最大负载 7/8
+[[nodiscard]] inline std::size_t CapacityToGrowth(std::size_t capacity) noexcept
+{
+    return capacity - capacity / 8;
+}
+
+[[nodiscard]] inline std::size_t CapacityForSize(std::size_t size) noexcept
+{
+    std::size_t capacity = MinCapacity;
+    while (CapacityToGrowth(capacity) < size)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/// 一组 16 个控制字节；匹配结果为位掩码，第 i 位对应组内第 i 个槽位
+class Group
+{
+public:
+    explicit Group(const CtrlByte* ctrl) noexcept
+    {
+#if TE_FLAT_HASH_SSE2
+        m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        std::memcpy(m_ctrl, ctrl, GroupWidth);
+#endif
+    }
+
+    [[nodiscard]] std::uint32_t Match(CtrlByte h2) const noexcept
+    {
+#if TE_FLAT_HASH_SSE2
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+#else
+        return MatchScalar([h2](CtrlByte c) { return c == h2; });
+#endif
+    }
+
+    [[nodiscard]] std::uint32_t MatchEmpty() const noexcept
+    {
+#if TE_FLAT_HASH_SSE2
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(CtrlEmpty), m_ctrl)));
+#else
+        return MatchScalar([](CtrlByte c) { return c == CtrlEmpty; });
+#endif
+    }
+
+    // 空与已删除的最高位都为 1，直接取符号位
+    [[nodiscard]] std::uint32_t MatchEmptyOrDeleted() const noexcept
+    {
+#if TE_FLAT_HASH_SSE2
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(m_ctrl));
+#else
+        return MatchScalar([](CtrlByte c) { return c < 0; });
+#endif
+    }
+
+private:
+#if TE_FLAT_HASH_SSE2
+    __m128i m_ctrl;
+#else
+    template<typename Pred>
+    [[nodiscard]] std::uint32_t MatchScalar(Pred pred) const noexcept
+    {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < GroupWidth; ++i)
+        {
+            mask |= static_cast<std::uint32_t>(pred(m_ctrl[i])) << i;
+        }
+        return mask;
+    }
+
+    CtrlByte m_ctrl[GroupWidth];
+#endif
+};
+
+/// 映射表策略：元素为 pair<const K, V>
+template<typename K, typename V>
+struct MapPolicy
+{
+    using key_type = K;
+    using value_type = std::pair<const K, V>;
+
+    static const K& KeyOf(const value_type& value) noexcept { return value.first; }
+};
+
+/// 集合策略：元素即键，迭代时只读
+template<typename K>
+struct SetPolicy
+{
+    using key_type = K;
+    using value_type = K;
+
+    static const K& KeyOf(const value_type& value) noexcept { return value; }
+};
+
+} // namespace FlatHashDetail
+
+// ============================================================
+// TFlatHashTable — TFlatHashMap / TFlatHashSet 的公共实现
+// ============================================================
+
+template<typename Policy, typename Hash, typename KeyEqual>
+class TFlatHashTable
+{
+protected:
+    using CtrlByte = FlatHashDetail::CtrlByte;
+    using Group = FlatHashDetail::Group;
+    static constexpr std::size_t GroupWidth = FlatHashDetail::GroupWidth;
+
+public:
+    using key_type = typename Policy::key_type;
+    using value_type = typename Policy::value_type;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    template<bool IsConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Policy::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        TIterator() noexcept = default;
+
+        /// iterator 可隐式转换为 const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        TIterator(const TIterator<OtherConst>& other) noexcept
+            : m_ctrl(other.m_ctrl)
+            , m_ctrlEnd(other.m_ctrlEnd)
+            , m_slot(other.m_slot)
+        {
+        }
+
+        reference operator*() const noexcept { return *m_slot; }
+        pointer operator->() const noexcept { return m_slot; }
+
+        TIterator& operator++() noexcept
+        {
+            ++m_ctrl;
+            ++m_slot;
+            SkipEmpty();
+            return *this;
+        }
+
+        TIterator operator++(int) noexcept
+        {
+            TIterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const TIterator& lhs, const TIterator& rhs) noexcept
+        {
+            return lhs.m_ctrl == rhs.m_ctrl;
+        }
+
+    private:
+        friend class TFlatHashTable;
+        template<bool> friend class TIterator;
+
+        TIterator(const CtrlByte* ctrl, const CtrlByte* ctrlEnd, pointer slot) noexcept
+            : m_ctrl(ctrl)
+            , m_ctrlEnd(ctrlEnd)
+            , m_slot(slot)
+        {
+        }
+
+        void SkipEmpty() noexcept
+        {
+            while (m_ctrl != m_ctrlEnd && !FlatHashDetail::IsFull(*m_ctrl))
+            {
+                ++m_ctrl;
+                ++m_slot;
+            }
+        }
+
+        const CtrlByte* m_ctrl = nullptr;
+        const CtrlByte* m_ctrlEnd = nullptr;
+        pointer m_slot = nullptr;
+    };
+
+    using iterator = TIterator<std::is_same_v<value_type, key_type>>;
+    using const_iterator = TIterator<true>;
+
+    TFlatHashTable() noexcept = default;
+
+    /// 指定元素存储使用的 tag
+    explicit TFlatHashTable(MemoryTag tag) noexcept
+        : m_tag(tag)
+    {
+    }
+
+    TFlatHashTable(const TFlatHashTable& other)
+        : m_hash(other.m_hash)
+        , m_equal(other.m_equal)
+        , m_tag(other.m_tag)
+    {
+        CopyFrom(other);
+    }
+
+    TFlatHashTable(TFlatHashTable&& other) noexcept
+        : m_hash(std::move(other.m_hash))
+        , m_equal(std::move(other.m_equal))
+        , m_tag(other.m_tag)
+    {
+        StealFrom(other);
+    }
+
+    ~TFlatHashTable()
+    {
+        DestroyAll();
+        Deallocate();
+    }
+
+    TFlatHashTable& operator=(const TFlatHashTable& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            m_hash = other.m_hash;
+            m_equal = other.m_equal;
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& other) noexcept
+    {
+        if (this != &other)
+        {
+            DestroyAll();
+            Deallocate();
+            m_hash = std::move(other.m_hash);
+            m_equal = std::move(other.m_equal);
+            m_tag = other.m_tag;
+            StealFrom(other);
+        }
+        return *this;
+    }
+
+    // ---------- 容量 ----------
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] MemoryTag GetTag() const noexcept { return m_tag; }
+
+    /// 预留至少容纳 count 个元素的槽位，之后插入到 count 个元素前不会 rehash
+    void reserve(std::size_t count)
+    {
+        const std::size_t capacity = FlatHashDetail::CapacityForSize(count);
+        if (capacity > m_capacity)
+        {
+            Rehash(capacity);
+        }
+    }
+
+    // ---------- 迭代 ----------
+
+    iterator begin() noexcept { return MakeIterator<iterator>(0); }
+    iterator end() noexcept { return MakeEndIterator<iterator>(); }
+    const_iterator begin() const noexcept { return MakeIterator<const_iterator>(0); }
+    const_iterator end() const noexcept { return MakeEndIterator<const_iterator>(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // ---------- 查找 ----------
+
+    iterator find(const key_type& key)
+    {
+        const std::size_t index = FindIndex(key);
+        return index == NotFound ? end() : MakeIteratorAt<iterator>(index);
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        const std::size_t index = FindIndex(key);
+        return index == NotFound ? end() : MakeIteratorAt<const_iterator>(index);
+    }
+
+    [[nodiscard]] bool contains(const key_type& key) const { return FindIndex(key) != NotFound; }
+    [[nodiscard]] std::size_t count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+    // ---------- 修改 ----------
+
+    /// 销毁全部元素并把槽位标为空；保留已分配的容量
+    void clear() noexcept
+    {
+        DestroyAll();
+        if (m_capacity != 0)
+        {
+            std::memset(m_ctrl, static_cast<unsigned char>(FlatHashDetail::CtrlEmpty), m_capacity + GroupWidth);
+            m_growthLeft = FlatHashDetail::CapacityToGrowth(m_capacity);
+        }
+    }
+
+    /// 删除 it 指向的元素，返回下一个元素的迭代器（删除不会 rehash，其余迭代器保持有效）
+    iterator erase(const_iterator it)
+    {
+        const auto index = static_cast<std::size_t>(it.m_ctrl - m_ctrl);
+        EraseAt(index);
+        iterator next = MakeIteratorAt<iterator>(index);
+        next.SkipEmpty();
+        return next;
+    }
+
+    iterator erase(iterator it) requires (!std::is_same_v<iterator, const_iterator>)
+    {
+        return erase(const_iterator(it));
+    }
+
+    std::size_t erase(const key_type& key)
+    {
+        const std::size_t index = FindIndex(key);
+        if (index == NotFound)
+        {
+            return 0;
+        }
+        EraseAt(index);
+        return 1;
+    }
+
+protected:
+    static constexpr std::size_t NotFound = ~std::size_t(0);
+
+    [[nodiscard]] std::uint64_t HashOf(const key_type& key) const
+    {
+        return FlatHashDetail::MixHash(m_hash(key));
+    }
+
+    [[nodiscard]] std::size_t FindIndex(const key_type& key) const
+    {
+        return m_size == 0 ? NotFound : FindIndex(key, HashOf(key));
+    }
+
+    [[nodiscard]] std::size_t FindIndex(const key_type& key, std::uint64_t hash) const
+    {
+        if (m_size == 0)
+        {
+            return NotFound;
+        }
+
+        const CtrlByte h2 = FlatHashDetail::H2(hash);
+        const std::size_t mask = m_capacity - 1;
+        std::size_t pos = FlatHashDetail::H1(hash) & mask;
+        std::size_t step = 0;
+        while (true)
+        {
+            const Group group(m_ctrl + pos);
+            for (std::uint32_t match = group.Match(h2); match != 0; match &= match - 1)
+            {
+                const std::size_t index = (pos + static_cast<std::size_t>(std::countr_zero(match))) & mask;
+                if (m_equal(Policy::KeyOf(m_slots[index]), key))
+                {
+                    return index;
+                }
+            }
+            if (group.MatchEmpty() != 0)
+            {
+                return NotFound;
+            }
+            // 三角数步长：容量为 2 的幂时恰好遍历所有分组
+            step += GroupWidth;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    /// 查找键；不存在时以 construct(slot) 原位构造新元素。返回 {槽位下标, 是否新插入}
+    template<typename Construct>
+    std::pair<std::size_t, bool> FindOrInsert(const key_type& key, Construct&& construct)
+    {
+        const std::uint64_t hash = HashOf(key);
+        const std::size_t existing = FindIndex(key, hash);
+        if (existing != NotFound)
+        {
+            return {existing, false};
+        }
+
+        std::size_t index = m_capacity == 0 ? NotFound : FindInsertSlot(hash);
+        if (index == NotFound || (m_growthLeft == 0 && m_ctrl[index] == FlatHashDetail::CtrlEmpty))
+        {
+            GrowForInsert();
+            index = FindInsertSlot(hash);
+        }
+
+        construct(m_slots + index);
+        if (m_ctrl[index] == FlatHashDetail::CtrlEmpty)
+        {
+            --m_growthLeft;
+        }
+        SetCtrl(index, FlatHashDetail::H2(hash));
+        ++m_size;
+        return {index, true};
+    }
+
+    template<typename It>
+    It MakeIteratorAt(std::size_t index) const noexcept
+    {
+        return It(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+    }
+
+private:
+    template<typename It>
+    It MakeIterator(std::size_t index) const noexcept
+    {
+        It it = MakeIteratorAt<It>(index);
+        it.SkipEmpty();
+        return it;
+    }
+
+    template<typename It>
+    It MakeEndIterator() const noexcept
+    {
+        return MakeIteratorAt<It>(m_capacity);
+    }
+
+    // 沿探测序列找第一个空或已删除的槽位
+    [[nodiscard]] std::size_t FindInsertSlot(std::uint64_t hash) const noexcept
+    {
+        const std::size_t mask = m_capacity - 1;
+        std::size_t pos = FlatHashDetail::H1(hash) & mask;
+        std::size_t step = 0;
+        while (true)
+        {
+            const std::uint32_t available = Group(m_ctrl + pos).MatchEmptyOrDeleted();
+            if (available != 0)
+            {
+                return (pos + static_cast<std::size_t>(std::countr_zero(available))) & mask;
+            }
+            step += GroupWidth;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // 前 GroupWidth 个控制字节在末尾镜像一份，使任意位置起的整组读取无需回绕
+    void SetCtrl(std::size_t index, CtrlByte value) noexcept
+    {
+        m_ctrl[index] = value;
+        if (index < GroupWidth)
+        {
+            m_ctrl[m_capacity + index] = value;
+        }
+    }
+
+    void EraseAt(std::size_t index) noexcept
+    {
+        std::destroy_at(m_slots + index);
+        // 保留墓碑以维持其它键的探测链；墓碑占用的增长额度在下次 rehash 时回收
+        SetCtrl(index, FlatHashDetail::CtrlDeleted);
+        --m_size;
+    }
+
+    // 墓碑较多时原容量重建，否则翻倍
+    void GrowForInsert()
+    {
+        if (m_capacity == 0)
+        {
+            Rehash(FlatHashDetail::MinCapacity);
+        }
+        else if (m_size < FlatHashDetail::CapacityToGrowth(m_capacity) / 2)
+        {
+            Rehash(m_capacity);
+        }
+        else
+        {
+            Rehash(m_capacity * 2);
+        }
+    }
+
+    [[nodiscard]] static std::size_t SlotOffset(std::size_t capacity) noexcept
+    {
+        const std::size_t ctrlBytes = capacity + GroupWidth;
+        return (ctrlBytes + alignof(value_type) - 1) / alignof(value_type) * alignof(value_type);
+    }
+
+    void Rehash(std::size_t newCapacity)
+    {
+        const std::size_t bytes = SlotOffset(newCapacity) + newCapacity * sizeof(value_type);
+        void* block = MemAlignedAlloc(bytes, std::max<std::size_t>(alignof(value_type), GroupWidth), m_tag);
+        if (!block)
+        {
+            throw std::bad_alloc{};
+        }
+
+        CtrlByte* oldCtrl = m_ctrl;
+        value_type* oldSlots = m_slots;
+        const std::size_t oldCapacity = m_capacity;
+
+        m_ctrl = static_cast<CtrlByte*>(block);
+        m_slots = reinterpret_cast<value_type*>(static_cast<std::byte*>(block) + SlotOffset(newCapacity));
+        m_capacity = newCapacity;
+        std::memset(m_ctrl, static_cast<unsigned char>(FlatHashDetail::CtrlEmpty), newCapacity + GroupWidth);
+
+        for (std::size_t i = 0; i < oldCapacity; ++i)
+        {
+            if (!FlatHashDetail::IsFull(oldCtrl[i]))
+            {
+                continue;
+            }
+            const std::uint64_t hash = HashOf(Policy::KeyOf(oldSlots[i]));
+            const std::size_t index = FindInsertSlot(hash);
+            ::new (static_cast<void*>(m_slots + index)) value_type(std::move(oldSlots[i]));
+            std::destroy_at(oldSlots + i);
+            SetCtrl(index, FlatHashDetail::H2(hash));
+        }
+        m_growthLeft = FlatHashDetail::CapacityToGrowth(newCapacity) - m_size;
+
+        if (oldCtrl)
+        {
+            MemFree(oldCtrl);
+        }
+    }
+
+    void DestroyAll() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (std::size_t i = 0; i < m_capacity && m_size != 0; ++i)
+            {
+                if (FlatHashDetail::IsFull(m_ctrl[i]))
+                {
+                    std::destroy_at(m_slots + i);
+                    --m_size;
+                }
+            }
+        }
+        m_size = 0;
+    }
+
+    void Deallocate() noexcept
+    {
+        if (m_ctrl)
+        {
+            MemFree(m_ctrl);
+        }
+        m_ctrl = nullptr;
+        m_slots = nullptr;
+        m_capacity = 0;
+        m_growthLeft = 0;
+    }
+
+    // 前置条件：本表为空
+    void CopyFrom(const TFlatHashTable& other)
+    {
+        reserve(other.m_size);
+        for (const value_type& value : other)
+        {
+            FindOrInsert(Policy::KeyOf(value),
+                         [&value](value_type* slot) { ::new (static_cast<void*>(slot)) value_type(value); });
+        }
+    }
+
+    // 前置条件：本表未持有存储
+    void StealFrom(TFlatHashTable& other) noexcept
+    {
+        m_ctrl = std::exchange(other.m_ctrl, nullptr);
+        m_slots = std::exchange(other.m_slots, nullptr);
+        m_capacity = std::exchange(other.m_capacity, 0);
+        m_size = std::exchange(other.m_size, 0);
+        m_growthLeft = std::exchange(other.m_growthLeft, 0);
+    }
+
+private:
+    CtrlByte* m_ctrl = nullptr;     // capacity + GroupWidth 个控制字节，槽位数组紧随其后
+    value_type* m_slots = nullptr;
+    std::size_t m_capacity = 0;     // 槽位数，0 或 2 的幂（>= GroupWidth）
+    std::size_t m_size = 0;
+    std::size_t m_growthLeft = 0;   // 还能占用多少个空槽而不触发 rehash
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] KeyEqual m_equal;
+    MemoryTag m_tag = MemoryTag::Core;
+};
+
+// ============================================================
+// TFlatHashMap<K, V>
+// ============================================================
+
+template<typename K, typename V,
+         typename Hash = std::hash<K>,
+         typename KeyEqual = std::equal_to<K>>
+class TFlatHashMap : public TFlatHashTable<FlatHashDetail::MapPolicy<K, V>, Hash, KeyEqual>
+{
+    using Super = TFlatHashTable<FlatHashDetail::MapPolicy<K, V>, Hash, KeyEqual>;
+
+public:
+    using typename Super::iterator;
+    using typename Super::value_type;
+    using mapped_type = V;
+
+    TFlatHashMap() noexcept = default;
+
+    /// 指定元素存储使用的 tag
+    explicit TFlatHashMap(MemoryTag tag) noexcept
+        : Super(tag)
+    {
+    }
+
+    /// 键不存在时以 args 构造值；已存在时不修改
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return Emplace(key, key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        const K& lookup = key;
+        return Emplace(lookup, std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename KeyArg, typename... Args>
+    std::pair<iterator, bool> emplace(KeyArg&& key, Args&&... args)
+    {
+        return try_emplace(std::forward<KeyArg>(key), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    V& operator[](const K& key) { return try_emplace(key).first->second; }
+    V& operator[](K&& key) { return try_emplace(std::move(key)).first->second; }
+
+private:
+    template<typename KeyArg, typename... Args>
+    std::pair<iterator, bool> Emplace(const K& lookup, KeyArg&& key, Args&&... args)
+    {
+        const auto [index, inserted] = this->FindOrInsert(lookup, [&](value_type* slot) {
+            ::new (static_cast<void*>(slot)) value_type(std::piecewise_construct,
+                                                        std::forward_as_tuple(std::forward<KeyArg>(key)),
+                                                        std::forward_as_tuple(std::forward<Args>(args)...));
+        });
+        return {this->template MakeIteratorAt<iterator>(index), inserted};
+    }
+};
+
+// ============================================================
+// TFlatHashSet<K>
+// ============================================================
+
+template<typename K,
+         typename Hash = std::hash<K>,
+         typename KeyEqual = std::equal_to<K>>
+class TFlatHashSet : public TFlatHashTable<FlatHashDetail::SetPolicy<K>, Hash, KeyEqual>
+{
+    using Super = TFlatHashTable<FlatHashDetail::SetPolicy<K>, Hash, KeyEqual>;
+
+public:
+    using typename Super::iterator;
+
+    TFlatHashSet() noexcept = default;
+
+    /// 指定元素存储使用的 tag
+    explicit TFlatHashSet(MemoryTag tag) noexcept
+        : Super(tag)
+    {
+    }
+
+    std::pair<iterator, bool> insert(const K& key)
+    {
+        return Insert(key, key);
+    }
+
+    std::pair<iterator, bool> insert(K&& key)
+    {
+        const K& lookup = key;
+        return Insert(lookup, std::move(key));
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(K(std::forward<Args>(args)...));
+    }
+
+private:
+    template<typename KeyArg>
+    std::pair<iterator, bool> Insert(const K& lookup, KeyArg&& key)
+    {
+        const auto [index, inserted] = this->FindOrInsert(lookup, [&](K* slot) {
+            ::new (static_cast<void*>(slot)) K(std::forward<KeyArg>(key));
+        });
+        return {this->template MakeIteratorAt<iterator>(index), inserted};
+    }
+};
+
+} // namespace TE
@@ -0,0 +1,91 @@
+// ToyEngine Core Module
+// 帧分配守卫 —— 统计 BeginFrame / EndFrame 之间的堆分配，稳态帧（预热之后）出现分配时报告或断言
+//
+// 用法（Engine::TickRenderThread 已接入，应用只需在 Engine::Init 之前配置）：
+//   TE::FrameAllocationGuardConfig config;
+//   config.Policy = TE::FrameAllocationPolicy::Assert;
+//   TE::MemorySetFrameAllocationGuard(config);
+//
+// 统计范围是守卫打开期间所有线程经由 MemAlloc / MemAlignedAlloc / MemRealloc 的分配（含全局 new 覆盖），
+// 扩容的 realloc 计为一次分配；FrameArena 的 bump 分配不经过堆，不计入（其 chunk 扩容仍计入）。
+
+#pragma once
+
+#include "Memory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TE {
+
+enum class FrameAllocationPolicy : std::uint8_t
+{
+    Off,    // 不统计（热路径只有一次 relaxed 读取）
+    Count,  // 只统计，结果通过 MemoryEndFrameAllocationGuard 返回
+    Log,    // 稳态帧出现分配时输出错误日志
+    Assert, // 在 Log 的基础上触发断言（Release 构建中等同于 Log）
+};
+
+struct FrameAllocationGuardConfig
+{
+    FrameAllocationPolicy Policy = FrameAllocationPolicy::Off;
+
+    // 前若干帧视为预热（缓存填充、管线/BindGroup 创建、FrameArena 扩容），不判定违规
+    std::uint32_t WarmupFrames = 8;
+};
+
+struct FrameAllocationReport
+{
+    std::uint64_t FrameIndex = 0;       // 自配置 / 重置预热以来守卫过的帧序号（从 0 开始）
+    std::uint64_t Allocations = 0;
+    std::uint64_t Bytes = 0;            // 请求字节数之和
+    MemoryTag FirstTag = MemoryTag::Unknown; // 本帧第一次分配的 tag 与大小，便于定位
+    std::uint64_t FirstBytes = 0;
+    bool SteadyState = false;           // 已过预热期
+    bool Violation = false;             // 稳态帧且 Allocations != 0
+};
+
+// 设置策略与预热帧数，并重新开始预热计数
+void MemorySetFrameAllocationGuard(const FrameAllocationGuardConfig& config);
+[[nodiscard]] FrameAllocationGuardConfig MemoryGetFrameAllocationGuard();
+
+// 场景加载、窗口尺寸变化等会合理地重建资源时调用：重新开始预热计数
+void MemoryResetFrameAllocationWarmup();
+
+// 打开守卫并清零本帧计数；Policy 为 Off 时什么也不做。不可嵌套，须与 End 成对调用
+void MemoryBeginFrameAllocationGuard();
+
+// 关闭守卫并按策略处理本帧结果（Off 时返回全零报告）
+FrameAllocationReport MemoryEndFrameAllocationGuard();
+
+/// <summary>
+/// RAII 帧守卫：构造时 MemoryBeginFrameAllocationGuard，析构时 MemoryEndFrameAllocationGuard。
+/// 便于覆盖带多个提前返回的帧函数；需要报告时直接调用 End 即可（析构不会重复处理）。
+/// </summary>
+class FrameAllocationGuardScope final
+{
+public:
+    FrameAllocationGuardScope() { MemoryBeginFrameAllocationGuard(); }
+
+    ~FrameAllocationGuardScope()
+    {
+        if (!m_ended)
+        {
+            (void)MemoryEndFrameAllocationGuard();
+        }
+    }
+
+    FrameAllocationGuardScope(const FrameAllocationGuardScope&) = delete;
+    FrameAllocationGuardScope& operator=(const FrameAllocationGuardScope&) = delete;
+
+    FrameAllocationReport End()
+    {
+        m_ended = true;
+        return MemoryEndFrameAllocationGuard();
+    }
+
+private:
+    bool m_ended = false;
+};
+
+} // namespace TE
@@ -0,0 +1,160 @@
+// ToyEngine Core Module
+// 帧线性分配器（FrameArena）— 每帧瞬态数据的 bump 分配，帧末整体回收
+//
+// 用法：
+//   TE::TFrameArray<FMeshDrawCommand> drawCommands;   // 内部分配走当前帧的 arena
+//   auto* block = TE::FrameArena::Get().AllocateArray<Vector4>(16);
+//
+// 生命周期：第 N 帧分配的内存在之后 framesInFlight - 1 次 EndFrame 内保持有效，
+// 随后所在的帧缓冲被复位。帧数据不得跨越该窗口持有（容器也不例外）。
+
+#pragma once
+
+#include "Memory.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace TE {
+
+class FrameArena final
+{
+public:
+    static constexpr std::uint32_t MaxFramesInFlight = 3;
+    static constexpr std::size_t DefaultChunkBytes = 1ull * 1024ull * 1024ull;
+
+    [[nodiscard]] static FrameArena& Get();
+
+    FrameArena() = default;
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /// <summary>
+    /// 按 RHI 的 framesInFlight 配置帧缓冲数量（钳制到 [1, MaxFramesInFlight]）。
+    /// 未调用时首次分配按 2 个帧缓冲、DefaultChunkBytes 惰性初始化。
+    /// </summary>
+    void Init(std::uint32_t framesInFlight, std::size_t chunkBytes = DefaultChunkBytes);
+
+    /// <summary>
+    /// 释放全部帧缓冲（须在 MemoryShutdown 之前调用）
+    /// </summary>
+    void Shutdown();
+
+    /// <summary>
+    /// 帧边界：切换到下一帧缓冲并复位它。不得与 Allocate 并发调用。
+    /// 若上一轮该缓冲用到了多个 chunk，则合并为一个足够大的 chunk，稳态下每帧只有一次 bump。
+    /// </summary>
+    void EndFrame();
+
+    /// <summary>
+    /// 从当前帧缓冲分配（无锁 bump；chunk 用尽时才加锁追加新 chunk）。失败返回 nullptr。
+    /// </summary>
+    [[nodiscard]] void* Allocate(std::size_t size, std::size_t align = alignof(std::max_align_t));
+
+    template<typename T>
+    [[nodiscard]] T* AllocateArray(std::size_t count)
+    {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    [[nodiscard]] std::uint32_t GetFramesInFlight() const { return m_framesInFlight; }
+    [[nodiscard]] std::uint32_t GetCurrentFrameIndex() const { return m_frameIndex.load(std::memory_order_relaxed); }
+
+    // 当前帧缓冲已用字节（含对齐填充）
+    [[nodiscard]] std::size_t GetUsedBytes() const;
+
+private:
+    // 按缓存行对齐，使紧随其后的数据区满足常见的 SIMD / uniform 对齐
+    struct alignas(64) Chunk
+    {
+        Chunk* Next = nullptr;
+        std::size_t Capacity = 0;
+        std::atomic<std::size_t> Offset{0};
+
+        [[nodiscard]] std::byte* Data() { return reinterpret_cast<std::byte*>(this + 1); }
+    };
+
+    struct FrameBuffer
+    {
+        std::atomic<Chunk*> Current{nullptr};
+        Chunk* Head = nullptr; // 本帧缓冲持有的全部 chunk（Current 位于链表头）
+    };
+
+    [[nodiscard]] Chunk* CreateChunk(std::size_t capacity) const;
+    static void DestroyChunks(Chunk* head);
+    [[nodiscard]] bool Grow(FrameBuffer& frame, Chunk* observed, std::size_t minBytes);
+    void ResetFrame(FrameBuffer& frame);
+
+private:
+    std::mutex m_growMutex;
+    FrameBuffer m_frames[MaxFramesInFlight];
+    std::atomic<std::uint32_t> m_frameIndex{0};
+    std::uint32_t m_framesInFlight = 2;
+    std::size_t m_chunkBytes = DefaultChunkBytes;
+};
+
+// ============================================================
+// TFrameAllocator<T> — 从当前帧 arena 分配的 STL Allocator
+// ============================================================
+
+template<typename T>
+class TFrameAllocator
+{
+public:
+    using value_type = T;
+
+    TFrameAllocator() noexcept = default;
+
+    /// 拷贝转换构造（支持 rebind）
+    template<typename U>
+    TFrameAllocator(const TFrameAllocator<U>& /*other*/) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n == 0)
+        {
+            return nullptr;
+        }
+        void* p = FrameArena::Get().Allocate(n * sizeof(T), alignof(T));
+        if (!p)
+        {
+            throw std::bad_alloc{};
+        }
+        return static_cast<T*>(p);
+    }
+
+    /// 单块不回收，帧缓冲复位时统一回收
+    void deallocate(T* /*ptr*/, std::size_t /*n*/) noexcept
+    {
+    }
+
+    template<typename U>
+    bool operator==(const TFrameAllocator<U>& /*other*/) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const TFrameAllocator<U>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+};
+
+// ============================================================
+// 帧容器别名 — 仅用于帧内瞬态数据
+// ============================================================
+
+/// 帧内动态数组（扩容时旧缓冲留在 arena 中直到帧缓冲复位，已知数量时应先 reserve）
+template<typename T>
+using TFrameArray = std::vector<T, TFrameAllocator<T>>;
+
+} // namespace TE
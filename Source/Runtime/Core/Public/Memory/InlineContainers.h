@@ -0,0 +1,520 @@
+// ToyEngine Core Module
+// 内联容器 — 前 N 个元素存放在对象内部，超出后才溢出到引擎分配器
+//
+// 用法：
+//   TE::TInlineArray<RHIBindGroupEntry, 8> entries;     // 不超过 8 个元素时零堆分配
+//   TE::TInlineArray<int, 4> ids(MemoryTag::Renderer);   // 指定溢出时使用的 tag
+//   TE::TSmallString<> name = "GBuffer_BindGroup";       // 不超过 47 个字符时零堆分配
+//
+// 适用于描述符、绑定列表等元素个数通常很少的短生命周期对象。
+// 与 std::vector 不同：移动内联状态的容器会逐个移动元素，迭代器即原始指针。
+
+#pragma once
+
+#include "Memory.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace TE {
+
+// ============================================================
+// TInlineArray<T, N> — 小缓冲优化的动态数组
+// ============================================================
+
+template<typename T, std::size_t N>
+class TInlineArray
+{
+    static_assert(N > 0, "TInlineArray requires a non-zero inline capacity");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr std::size_t InlineCapacity = N;
+
+    TInlineArray() noexcept = default;
+
+    /// 指定溢出分配使用的 tag
+    explicit TInlineArray(MemoryTag tag) noexcept
+        : m_tag(tag)
+    {
+    }
+
+    TInlineArray(std::initializer_list<T> values)
+    {
+        AssignRange(values.begin(), values.size());
+    }
+
+    TInlineArray(const TInlineArray& other)
+        : m_tag(other.m_tag)
+    {
+        AssignRange(other.data(), other.size());
+    }
+
+    TInlineArray(TInlineArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : m_tag(other.m_tag)
+    {
+        MoveFrom(other);
+    }
+
+    ~TInlineArray()
+    {
+        clear();
+        ReleaseHeap();
+    }
+
+    TInlineArray& operator=(const TInlineArray& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            AssignRange(other.data(), other.size());
+        }
+        return *this;
+    }
+
+    TInlineArray& operator=(TInlineArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            ReleaseHeap();
+            m_tag = other.m_tag;
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    TInlineArray& operator=(std::initializer_list<T> values)
+    {
+        clear();
+        AssignRange(values.begin(), values.size());
+        return *this;
+    }
+
+    // ---------- 访问 ----------
+
+    [[nodiscard]] T* data() noexcept { return m_data; }
+    [[nodiscard]] const T* data() const noexcept { return m_data; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    /// 元素是否仍位于对象内部（未溢出到堆）
+    [[nodiscard]] bool IsInline() const noexcept { return m_data == InlineData(); }
+
+    [[nodiscard]] MemoryTag GetTag() const noexcept { return m_tag; }
+
+    T& operator[](std::size_t index) noexcept { return m_data[index]; }
+    const T& operator[](std::size_t index) const noexcept { return m_data[index]; }
+
+    [[nodiscard]] T& front() noexcept { return m_data[0]; }
+    [[nodiscard]] const T& front() const noexcept { return m_data[0]; }
+    [[nodiscard]] T& back() noexcept { return m_data[m_size - 1]; }
+    [[nodiscard]] const T& back() const noexcept { return m_data[m_size - 1]; }
+
+    iterator begin() noexcept { return m_data; }
+    iterator end() noexcept { return m_data + m_size; }
+    const_iterator begin() const noexcept { return m_data; }
+    const_iterator end() const noexcept { return m_data + m_size; }
+    const_iterator cbegin() const noexcept { return m_data; }
+    const_iterator cend() const noexcept { return m_data + m_size; }
+
+    operator std::span<T>() noexcept { return {m_data, m_size}; }
+    operator std::span<const T>() const noexcept { return {m_data, m_size}; }
+
+    // ---------- 修改 ----------
+
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            Reallocate(capacity);
+        }
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity)
+        {
+            return GrowAndEmplace(std::forward<Args>(args)...);
+        }
+        T* slot = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+        ++m_size;
+        return *slot;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() noexcept
+    {
+        --m_size;
+        std::destroy_at(m_data + m_size);
+    }
+
+    void resize(std::size_t count)
+    {
+        ResizeImpl(count, [](T* slot) { std::construct_at(slot); });
+    }
+
+    void resize(std::size_t count, const T& value)
+    {
+        ResizeImpl(count, [&value](T* slot) { std::construct_at(slot, value); });
+    }
+
+    /// 销毁全部元素；已溢出的堆缓冲保留以便复用
+    void clear() noexcept
+    {
+        std::destroy_n(m_data, m_size);
+        m_size = 0;
+    }
+
+private:
+    [[nodiscard]] T* InlineData() noexcept { return reinterpret_cast<T*>(m_inline); }
+    [[nodiscard]] const T* InlineData() const noexcept { return reinterpret_cast<const T*>(m_inline); }
+
+    [[nodiscard]] T* AllocateHeap(std::size_t capacity) const
+    {
+        void* p = MemAlignedAlloc(capacity * sizeof(T), alignof(T), m_tag);
+        if (!p)
+        {
+            throw std::bad_alloc{};
+        }
+        return static_cast<T*>(p);
+    }
+
+    void ReleaseHeap() noexcept
+    {
+        if (!IsInline())
+        {
+            MemFree(m_data);
+            m_data = InlineData();
+            m_capacity = N;
+        }
+    }
+
+    [[nodiscard]] std::size_t GrowCapacity(std::size_t minCapacity) const noexcept
+    {
+        return std::max(minCapacity, m_capacity * 2);
+    }
+
+    // 把现有元素搬到新的堆缓冲
+    void Reallocate(std::size_t capacity)
+    {
+        T* newData = AllocateHeap(capacity);
+        std::uninitialized_move_n(m_data, m_size, newData);
+        std::destroy_n(m_data, m_size);
+        ReleaseHeap();
+        m_data = newData;
+        m_capacity = capacity;
+    }
+
+    // 先在新缓冲中构造新元素，参数引用自身元素时依然有效
+    template<typename... Args>
+    T& GrowAndEmplace(Args&&... args)
+    {
+        const std::size_t newCapacity = GrowCapacity(m_size + 1);
+        T* newData = AllocateHeap(newCapacity);
+        T* slot = std::construct_at(newData + m_size, std::forward<Args>(args)...);
+        std::uninitialized_move_n(m_data, m_size, newData);
+        std::destroy_n(m_data, m_size);
+        ReleaseHeap();
+        m_data = newData;
+        m_capacity = newCapacity;
+        ++m_size;
+        return *slot;
+    }
+
+    template<typename Construct>
+    void ResizeImpl(std::size_t count, Construct&& construct)
+    {
+        if (count < m_size)
+        {
+            std::destroy(m_data + count, m_data + m_size);
+            m_size = count;
+            return;
+        }
+        if (count > m_capacity)
+        {
+            Reallocate(GrowCapacity(count));
+        }
+        for (; m_size < count; ++m_size)
+        {
+            construct(m_data + m_size);
+        }
+    }
+
+    // 前置条件：本对象为空
+    void AssignRange(const T* values, std::size_t count)
+    {
+        reserve(count);
+        std::uninitialized_copy_n(values, count, m_data);
+        m_size = count;
+    }
+
+    // 前置条件：本对象为空且未持有堆缓冲
+    void MoveFrom(TInlineArray& other)
+    {
+        if (other.IsInline())
+        {
+            std::uninitialized_move_n(other.m_data, other.m_size, m_data);
+            m_size = other.m_size;
+            other.clear();
+            return;
+        }
+
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        other.m_data = other.InlineData();
+        other.m_size = 0;
+        other.m_capacity = N;
+    }
+
+private:
+    T* m_data = InlineData();
+    std::size_t m_size = 0;
+    std::size_t m_capacity = N;
+    MemoryTag m_tag = MemoryTag::Core;
+    alignas(T) std::byte m_inline[N * sizeof(T)];
+};
+
+// ============================================================
+// TSmallString<N> — 小缓冲优化的字符串（N 含结尾 '\0'）
+// ============================================================
+
+template<std::size_t N = 48>
+class TSmallString
+{
+    static_assert(N > 1, "TSmallString requires room for at least one character");
+
+public:
+    static constexpr std::size_t InlineCapacity = N - 1;
+
+    TSmallString() noexcept
+    {
+        m_inline[0] = '\0';
+    }
+
+    /// 指定溢出分配使用的 tag
+    explicit TSmallString(MemoryTag tag) noexcept
+        : m_tag(tag)
+    {
+        m_inline[0] = '\0';
+    }
+
+    TSmallString(const char* text)
+        : TSmallString()
+    {
+        assign(text ? std::string_view(text) : std::string_view());
+    }
+
+    TSmallString(std::string_view text)
+        : TSmallString()
+    {
+        assign(text);
+    }
+
+    TSmallString(const std::string& text)
+        : TSmallString()
+    {
+        assign(std::string_view(text));
+    }
+
+    TSmallString(const TSmallString& other)
+        : m_tag(other.m_tag)
+    {
+        m_inline[0] = '\0';
+        assign(other.view());
+    }
+
+    TSmallString(TSmallString&& other) noexcept
+        : m_tag(other.m_tag)
+    {
+        m_inline[0] = '\0';
+        MoveFrom(other);
+    }
+
+    ~TSmallString()
+    {
+        ReleaseHeap();
+    }
+
+    TSmallString& operator=(const TSmallString& other)
+    {
+        if (this != &other)
+        {
+            assign(other.view());
+        }
+        return *this;
+    }
+
+    TSmallString& operator=(TSmallString&& other) noexcept
+    {
+        if (this != &other)
+        {
+            ReleaseHeap();
+            m_tag = other.m_tag;
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    TSmallString& operator=(const char* text)
+    {
+        return assign(text ? std::string_view(text) : std::string_view());
+    }
+
+    TSmallString& operator=(std::string_view text) { return assign(text); }
+    TSmallString& operator=(const std::string& text) { return assign(std::string_view(text)); }
+
+    TSmallString& assign(std::string_view text)
+    {
+        // text 可能指向自身缓冲：扩容前不能释放旧缓冲，memmove 处理重叠
+        if (text.size() > m_capacity)
+        {
+            char* newData = AllocateHeap(text.size());
+            std::memcpy(newData, text.data(), text.size());
+            ReleaseHeap();
+            m_data = newData;
+            m_capacity = text.size();
+        }
+        else if (!text.empty())
+        {
+            std::memmove(m_data, text.data(), text.size());
+        }
+        m_size = text.size();
+        m_data[m_size] = '\0';
+        return *this;
+    }
+
+    TSmallString& append(std::string_view text)
+    {
+        const std::size_t newSize = m_size + text.size();
+        if (newSize > m_capacity)
+        {
+            const std::size_t newCapacity = std::max(newSize, m_capacity * 2);
+            char* newData = AllocateHeap(newCapacity);
+            std::memcpy(newData, m_data, m_size);
+            std::memcpy(newData + m_size, text.data(), text.size());
+            ReleaseHeap();
+            m_data = newData;
+            m_capacity = newCapacity;
+        }
+        else if (!text.empty())
+        {
+            std::memmove(m_data + m_size, text.data(), text.size());
+        }
+        m_size = newSize;
+        m_data[m_size] = '\0';
+        return *this;
+    }
+
+    TSmallString& operator+=(std::string_view text) { return append(text); }
+
+    void clear() noexcept
+    {
+        m_size = 0;
+        m_data[0] = '\0';
+    }
+
+    [[nodiscard]] const char* c_str() const noexcept { return m_data; }
+    [[nodiscard]] const char* data() const noexcept { return m_data; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] std::size_t length() const noexcept { return m_size; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] bool IsInline() const noexcept { return m_data == m_inline; }
+
+    [[nodiscard]] std::string_view view() const noexcept { return {m_data, m_size}; }
+    operator std::string_view() const noexcept { return view(); }
+
+    friend bool operator==(const TSmallString& lhs, const TSmallString& rhs) noexcept
+    {
+        return lhs.view() == rhs.view();
+    }
+
+    friend bool operator==(const TSmallString& lhs, std::string_view rhs) noexcept
+    {
+        return lhs.view() == rhs;
+    }
+
+private:
+    [[nodiscard]] char* AllocateHeap(std::size_t capacity) const
+    {
+        void* p = MemAlignedAlloc(capacity + 1, alignof(char), m_tag);
+        if (!p)
+        {
+            throw std::bad_alloc{};
+        }
+        return static_cast<char*>(p);
+    }
+
+    void ReleaseHeap() noexcept
+    {
+        if (!IsInline())
+        {
+            MemFree(m_data);
+            m_data = m_inline;
+            m_capacity = InlineCapacity;
+        }
+    }
+
+    // 前置条件：本对象未持有堆缓冲
+    void MoveFrom(TSmallString& other) noexcept
+    {
+        if (other.IsInline())
+        {
+            std::memcpy(m_inline, other.m_inline, other.m_size + 1);
+            m_size = other.m_size;
+            other.clear();
+            return;
+        }
+
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        other.m_data = other.m_inline;
+        other.m_capacity = InlineCapacity;
+        other.clear();
+    }
+
+private:
+    char* m_data = m_inline;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = InlineCapacity;
+    MemoryTag m_tag = MemoryTag::Core;
+    char m_inline[N];
+};
+
+} // namespace TE
+
+/// 支持直接用于 std::format / TE_LOG 参数
+template<std::size_t N>
+struct std::formatter<TE::TSmallString<N>> : std::formatter<std::string_view>
+{
+    auto format(const TE::TSmallString<N>& value, std::format_context& ctx) const
+    {
+        return std::formatter<std::string_view>::format(value.view(), ctx);
+    }
+};
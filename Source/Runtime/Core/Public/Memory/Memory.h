@@ -17,6 +17,7 @@ struct MemoryTagStats
     std::uint64_t PeakBytes = 0;
     std::uint64_t AllocCount = 0;
     std::uint64_t FreeCount = 0;
+    std::uint64_t BudgetBytes = 0; // MemorySetTagBudget 设置的预算（0 = 未设置）
 };
 
 struct MemoryStats
@@ -26,17 +27,150 @@ struct MemoryStats
     std::uint64_t AllocCount = 0;
     std::uint64_t FreeCount = 0;
 
+    // 堆向 OS 申请的地址空间：保留量 / 已提交量，以及最近一次 Trim 归还的字节数
+    std::uint64_t ReservedBytes = 0;
+    std::uint64_t CommittedBytes = 0;
+    std::uint64_t LastTrimBytes = 0;
+
+    // 小块 slab 层（不带块头的 16..64 字节块）：已提交字节数、交付在外的块数（含线程缓存中的），
+    // 以及相对同样数量的带块头线程缓存块少占用的字节数
+    std::uint64_t SlabCommittedBytes = 0;
+    std::uint64_t SlabLiveBlocks = 0;
+    std::uint64_t SlabSavedBytes = 0;
+
     std::array<MemoryTagStats, static_cast<std::size_t>(MemoryTag::Count)> PerTag{};
 };
 
+// 单个 TLSF 池段的占用（tlsf_walk_pool 遍历所得，字节数为 TLSF 块大小，不含块开销）
+struct MemoryPoolReport
+{
+    std::uint64_t Bytes = 0;            // 池段提交大小（首段含 TLSF 控制结构）
+    std::uint64_t UsedBytes = 0;
+    std::uint64_t FreeBytes = 0;
+    std::uint64_t LargestFreeBlock = 0;
+    std::uint32_t UsedBlocks = 0;
+    std::uint32_t FreeBlocks = 0;
+};
+
+/// <summary>
+/// 堆碎片报告：遍历全部 TLSF 池段得到空闲块分布。
+/// - 空闲块直方图按 2 的幂分桶：桶 0 为 [0, 32)，桶 i 为 [16 << i, 32 << i)，最后一桶不设上限；
+/// - 碎片率 = 1 - 最大空闲块 / 空闲总量（0 表示空闲空间完全连续）；
+/// - 线程缓存 magazine 中的块与 slab 页都计为已用块。
+/// </summary>
+struct HeapFragmentationReport
+{
+    static constexpr std::size_t HistogramBuckets = 28;
+    static constexpr std::size_t MaxPools = 64;
+
+    [[nodiscard]] static constexpr std::uint64_t BucketMinBytes(std::size_t bucket)
+    {
+        return bucket == 0 ? 0 : (16ull << bucket);
+    }
+
+    std::uint64_t UsedBytes = 0;
+    std::uint64_t FreeBytes = 0;
+    std::uint64_t LargestFreeBlock = 0;
+    std::uint64_t UsedBlocks = 0;
+    std::uint64_t FreeBlocks = 0;
+    double FragmentationRatio = 0.0;
+
+    // 下一次扩容将提交的池段大小（用于调整增长策略）
+    std::uint64_t NextGrowBytes = 0;
+
+    std::array<std::uint64_t, HistogramBuckets> FreeBlockCount{};
+    std::array<std::uint64_t, HistogramBuckets> FreeBlockBytes{};
+
+    std::uint32_t PoolCount = 0;
+    std::array<MemoryPoolReport, MaxPools> Pools{};
+};
+
+// 堆后备内存的大页策略（仅 Linux 生效，其它平台按 Off 处理）
+enum class MemoryHugePages : std::uint8_t
+{
+    Off,          // 普通页
+    Transparent,  // 保留区按 2MB 对齐并 madvise(MADV_HUGEPAGE)，由内核透明大页按需合并
+    Explicit,     // 每次提交以 MAP_HUGETLB 映射（需预先配置 hugetlbfs 页）；页池不足的段回退为 Transparent
+};
+
+struct MemoryHeapConfig
+{
+    MemoryHugePages HugePages = MemoryHugePages::Off;
+
+    // 虚拟地址保留区大小：堆在其中原地向上提交，保留本身不占物理内存；用尽时另开保留区
+    std::size_t ReserveBytes = 64ull * 1024ull * 1024ull * 1024ull;
+
+    // 累计释放达到该字节数后标记待回收，由下一次 MemoryTrimIdle 处理（释放路径本身不回收）；
+    // 0 表示 MemoryTrimIdle 不做事，只在显式调用 MemoryTrim 时回收
+    std::size_t TrimThresholdBytes = 64ull * 1024ull * 1024ull;
+
+    // Trim 只丢弃不小于该值的空闲跨度，避免对零散小空洞反复 madvise
+    std::size_t TrimMinSpanBytes = 1ull * 1024ull * 1024ull;
+
+    // 小块 slab 层的地址保留大小；0 表示关闭（<= 64 字节的小块改回带块头的线程缓存档位）
+    std::size_t SmallSlabReserveBytes = 1ull * 1024ull * 1024ull * 1024ull;
+};
+
+// 标签预算事件：当前字节数向上越过水位线 / 预算时各触发一次，回落到阈值的 15/16 以下后重新武装
+enum class MemoryBudgetEvent : std::uint8_t
+{
+    HighWatermark, // 越过 BudgetBytes * HighWatermark
+    OverBudget,    // 越过 BudgetBytes
+};
+
+// 回调在触发分配的线程上、分配器锁之外调用；回调内的分配不会再次触发回调
+using MemoryBudgetCallback = void (*)(MemoryTag tag, MemoryBudgetEvent event,
+                                      std::uint64_t currentBytes, std::uint64_t budgetBytes, void* userData);
+
+struct MemoryTagBudget
+{
+    std::uint64_t BudgetBytes = 0;  // 0 表示不设预算
+    float HighWatermark = 0.85f;    // 水位线占预算的比例（钳制到 [0, 1]）
+    MemoryBudgetCallback Callback = nullptr;
+    void* UserData = nullptr;
+};
+
+// 设置堆配置，对之后创建的分配器生效（应在 MemoryInit 之前调用）
+void MemorySetHeapConfig(const MemoryHeapConfig& config);
+[[nodiscard]] MemoryHeapConfig MemoryGetHeapConfig();
+
 // 初始化默认内存系统（建议在引擎启动早期调用）
 void MemoryInit(std::size_t initialBytes = 256ull * 1024ull * 1024ull);
 
 // 关闭默认内存系统。
 // 调用前必须保证所有可能使用 MemAlloc/MemFree 的 worker 线程已经停止，
 // 且由本内存系统分配的裸指针都已经释放；该接口不支持与分配/释放并发调用。
+// 对象池（TPool）的 chunk 在此一并归还，池中对象须先销毁。
 void MemoryShutdown();
 
+// 线程本地小块缓存（<= 512 字节、对齐 <= 16 的分配走每线程 magazine，命中时无锁）。
+// 默认开启；关闭后新的分配直接走 TLSF，已缓存的块仍可正常释放。
+// 其中 <= 64 字节的分配由小块 slab 层供货：块不带 AllocHeader，tag 与大小取自所在页，按档位大小记账。
+// 缓存命中路径的统计在线程本地累积，于批量补货/归还或线程退出时折算，GetMemoryStats 只会即时折算调用线程。
+// 统计本身是按线程分片的原子计数器，GetMemoryStats 汇总各分片，不与分配争用分配器锁。
+void MemorySetThreadCacheEnabled(bool enabled);
+[[nodiscard]] bool MemoryIsThreadCacheEnabled();
+
+// 把调用线程缓存的空闲块与统计增量归还给全局分配器（如 worker 长时间空闲前）
+void MemoryFlushThreadCache();
+
+// 把堆中空闲的大跨度物理页归还 OS（MADV_DONTNEED），并收缩完全空闲的尾部提交区；
+// 立即生效（如卸载关卡后），返回本次归还的字节数
+std::size_t MemoryTrim();
+
+// 按策略回收一遍，供周期调用（Engine 每隔几秒在帧末调用）：
+// - 只有累计释放达到 MemoryHeapConfig::TrimThresholdBytes、或上一遍留下待确认的候选时才遍历堆，否则直接返回 0；
+// - 空闲跨度 / 空闲 slab 页须连续两遍都空闲、且其间没有被分配切分过才归还，
+//   每帧分配又释放的稳态跨度因此不会被反复丢弃再缺页
+std::size_t MemoryTrimIdle();
+
+// 设置 / 查询标签预算（可随时调用，设置后立即按当前用量检查一次）。
+// 预算按分片计数器的检查点评估：大分配、分片用量每跨过 64KB、线程缓存折算以及 MemoryCheckBudgets，
+// 因此越线通知可能滞后少量字节；需要逐帧精确时可在帧末调用 MemoryCheckBudgets。
+void MemorySetTagBudget(MemoryTag tag, const MemoryTagBudget& budget);
+[[nodiscard]] MemoryTagBudget MemoryGetTagBudget(MemoryTag tag);
+void MemoryCheckBudgets();
+
 // 全局分配接口（返回值必须保存或交给 MemFree，否则泄漏）
 [[nodiscard]] void* MemAlloc(std::size_t size, MemoryTag tag = MemoryTag::Unknown);
 [[nodiscard]] void* MemAlignedAlloc(std::size_t size, std::size_t align, MemoryTag tag = MemoryTag::Unknown);
@@ -44,6 +178,13 @@ void MemoryShutdown();
 [[nodiscard]] void* MemRealloc(void* ptr, std::size_t newSize, MemoryTag tag = MemoryTag::Unknown);
 void  MemFree(void* ptr);
 
+// 已知分配大小的释放（sized operator delete）：size 必须等于分配时请求的大小。
+// 大块直接跳过 slab 区间判断，小块的档位由 size 得出
+void  MemFreeSized(void* ptr, std::size_t size);
+
 [[nodiscard]] MemoryStats GetMemoryStats();
 
+// 持分配器锁遍历全部池段生成碎片报告（开销与堆中块数成正比，不宜逐帧调用）；未初始化时返回空报告
+[[nodiscard]] HeapFragmentationReport GetHeapFragmentationReport();
+
 } // namespace TE
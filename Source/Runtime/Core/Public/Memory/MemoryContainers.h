@@ -67,9 +67,9 @@ public:
         return static_cast<T*>(p);
     }
 
-    void deallocate(T* ptr, std::size_t /*n*/) noexcept
+    void deallocate(T* ptr, std::size_t n) noexcept
     {
-        MemFree(ptr);
+        MemFreeSized(ptr, n * sizeof(T));
     }
 
     /// 同 tag 的 allocator 视为相等（可互相 deallocate）
@@ -7,13 +7,18 @@
 //
 //   auto ptr = TE::MakeUnique<TActor>(MemoryTag::Core, "Enemy");
 //   TUniquePtr<TActor> ptr2 = std::move(ptr);
+//
+//   // 高频创建/销毁的定长对象走对象池（同类型槽位连续、按缓存行对齐）
+//   auto pooled = TE::MakePoolUnique<TActor, MemoryTag::Scene>("Enemy");
 
 #pragma once
 
 #include "Memory.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
 #include <utility>
@@ -155,4 +160,219 @@ template<typename T, typename... Args>
 template<typename T>
 using TWeakPtr = std::weak_ptr<T>;
 
+// ============================================================
+// FixedSizePool — 定长槽位的分块空闲链表（TPool<T> 的非模板内核）
+// ============================================================
+
+/// <summary>
+/// 定长对象池：
+/// - 槽位按 chunk 成批从 TLSF 申请，同一 chunk 内槽位连续，步长按缓存行取整；
+/// - 分配优先复用空闲链表，其次在最新 chunk 内顺序切分，O(1)；
+/// - 释放只把槽位挂回空闲链表，地址在对象存活期间稳定，chunk 不随单个对象释放归还；
+/// - 全部对象释放后可 Trim() 归还 chunk；MemoryShutdown 会统一释放所有池的 chunk。
+/// 线程安全（内部互斥锁）。
+/// </summary>
+class FixedSizePool
+{
+public:
+    static constexpr std::size_t CacheLineSize = 64;
+    static constexpr std::size_t DefaultChunkBytes = 16ull * 1024ull;
+
+    /// slotsPerChunk 为 0 时按 DefaultChunkBytes 推算（至少 8 个槽位）
+    FixedSizePool(std::size_t objectSize, std::size_t objectAlign, MemoryTag tag, std::size_t slotsPerChunk = 0);
+    ~FixedSizePool();
+
+    FixedSizePool(const FixedSizePool&) = delete;
+    FixedSizePool& operator=(const FixedSizePool&) = delete;
+
+    /// 分配一个未构造的槽位；内存不足返回 nullptr
+    [[nodiscard]] void* Allocate();
+
+    /// 归还由 Allocate 得到的槽位（对象须已析构）
+    void Free(void* slot);
+
+    /// 无存活对象时归还全部 chunk，返回是否执行了归还
+    bool Trim();
+
+    [[nodiscard]] std::size_t GetSlotSize() const { return m_slotSize; }
+    [[nodiscard]] std::size_t GetSlotsPerChunk() const { return m_slotsPerChunk; }
+    [[nodiscard]] std::size_t GetLiveCount() const;
+    [[nodiscard]] std::size_t GetChunkCount() const;
+
+    /// 释放所有已注册对象池的 chunk（由 MemoryShutdown 调用；存活对象随之失效）
+    static void ReleaseAllPools();
+
+private:
+    struct FreeSlot
+    {
+        FreeSlot* Next;
+    };
+
+    struct Chunk
+    {
+        Chunk* Next;
+    };
+
+    [[nodiscard]] bool AddChunkLocked();
+    void ReleaseChunksLocked();
+
+private:
+    mutable std::mutex m_mutex;
+    const std::size_t m_slotSize;
+    const std::size_t m_slotAlign;
+    const std::size_t m_slotsPerChunk;
+    const std::size_t m_headerBytes; // chunk 头部占用（按槽位对齐取整），槽位紧随其后
+    const MemoryTag m_tag;
+
+    Chunk* m_chunks = nullptr;
+    FreeSlot* m_freeList = nullptr;
+    std::byte* m_bumpCursor = nullptr; // 最新 chunk 中尚未切分过的区域
+    std::byte* m_bumpEnd = nullptr;
+    std::size_t m_liveCount = 0;
+    std::size_t m_chunkCount = 0;
+
+    // 全局注册链表（供 ReleaseAllPools 遍历）
+    FixedSizePool* m_prevPool = nullptr;
+    FixedSizePool* m_nextPool = nullptr;
+};
+
+// ============================================================
+// TPoolDeleter<T> / TPoolUniquePtr<T> — 归还到对象池的 unique_ptr
+// ============================================================
+
+/// 可从 TPoolDeleter<Derived> 隐式转换（要求基类虚析构），
+/// 也可从 std::default_delete 转换：此时 Pool 为空，按普通 delete 释放，
+/// 便于从 std::unique_ptr 过渡。
+template<typename T>
+struct TPoolDeleter
+{
+    FixedSizePool* Pool = nullptr;
+
+    TPoolDeleter() noexcept = default;
+
+    explicit TPoolDeleter(FixedSizePool* pool) noexcept
+        : Pool(pool)
+    {
+    }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    TPoolDeleter(const TPoolDeleter<U>& other) noexcept
+        : Pool(other.Pool)
+    {
+        static_assert(std::is_same_v<T, U> || std::has_virtual_destructor_v<T>,
+                      "TPoolDeleter: converting to a base pointer requires a virtual destructor");
+    }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    TPoolDeleter(const std::default_delete<U>& /*other*/) noexcept
+    {
+    }
+
+    void operator()(T* ptr) const
+    {
+        if (!Pool)
+        {
+            delete ptr;
+            return;
+        }
+
+        // 槽位起点是完整对象的地址（经基类指针释放时需回到派生类起点）
+        void* slot = nullptr;
+        if constexpr (std::is_polymorphic_v<T>)
+        {
+            slot = dynamic_cast<void*>(ptr);
+        }
+        else
+        {
+            slot = ptr;
+        }
+        ptr->~T();
+        Pool->Free(slot);
+    }
+};
+
+template<typename T>
+using TPoolUniquePtr = std::unique_ptr<T, TPoolDeleter<T>>;
+
+// ============================================================
+// TPool<T> — 类型化对象池
+// ============================================================
+
+template<typename T>
+class TPool
+{
+public:
+    explicit TPool(MemoryTag tag, std::size_t slotsPerChunk = 0)
+        : m_pool(sizeof(T), alignof(T), tag, slotsPerChunk)
+    {
+    }
+
+    /// 在池中构造一个 T；分配失败抛 std::bad_alloc
+    template<typename... Args>
+    [[nodiscard]] T* New(Args&&... args)
+    {
+        void* slot = m_pool.Allocate();
+        if (!slot)
+        {
+            throw std::bad_alloc{};
+        }
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>)
+        {
+            return ::new (slot) T(std::forward<Args>(args)...);
+        }
+        else
+        {
+            try
+            {
+                return ::new (slot) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                m_pool.Free(slot);
+                throw;
+            }
+        }
+    }
+
+    /// 析构并归还由 New 构造的对象
+    void Delete(T* ptr)
+    {
+        if (ptr)
+        {
+            ptr->~T();
+            m_pool.Free(ptr);
+        }
+    }
+
+    template<typename... Args>
+    [[nodiscard]] TPoolUniquePtr<T> MakeUnique(Args&&... args)
+    {
+        return TPoolUniquePtr<T>(New(std::forward<Args>(args)...), TPoolDeleter<T>(&m_pool));
+    }
+
+    bool Trim() { return m_pool.Trim(); }
+
+    [[nodiscard]] std::size_t GetLiveCount() const { return m_pool.GetLiveCount(); }
+    [[nodiscard]] std::size_t GetChunkCount() const { return m_pool.GetChunkCount(); }
+    [[nodiscard]] std::size_t GetSlotSize() const { return m_pool.GetSlotSize(); }
+
+private:
+    FixedSizePool m_pool;
+};
+
+/// 进程级共享池：每个 (T, Tag) 组合一个实例
+template<typename T, MemoryTag Tag = MemoryTag::Core>
+[[nodiscard]] TPool<T>& GetObjectPool()
+{
+    static TPool<T> pool(Tag);
+    return pool;
+}
+
+/// 在 (T, Tag) 共享池中构造对象，返回可向基类转换的 TPoolUniquePtr
+template<typename T, MemoryTag Tag = MemoryTag::Core, typename... Args>
+[[nodiscard]] TPoolUniquePtr<T> MakePoolUnique(Args&&... args)
+{
+    return GetObjectPool<T, Tag>().MakeUnique(std::forward<Args>(args)...);
+}
+
 } // namespace TE
@@ -0,0 +1,76 @@
+// ToyEngine Core Module
+// 采样式分配分析器 — 按分配字节数做泊松采样，记录调用栈并导出火焰图 / pprof 文件
+//
+// 用法：
+//   TE::MemoryProfilerConfig config;
+//   config.SampleIntervalBytes = 256 * 1024;
+//   config.ShutdownDumpPath = "Saved/Profiling/heap.prof";
+//   TE::MemoryProfilerStart(config);
+//   ...
+//   TE::MemoryProfilerDump("Saved/Profiling/churn.folded", TE::MemoryProfileFormat::Folded);
+//
+// 查看：
+//   pprof -http=: <可执行文件> heap.prof      （heap_v2 格式，pprof 按采样间隔自动还原估计值）
+//   flamegraph.pl churn.folded > churn.svg
+
+#pragma once
+
+#include "Memory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TE {
+
+enum class MemoryProfileFormat : std::uint8_t
+{
+    Folded, // 折叠栈文本：每行 "Tag;外层帧;...;内层帧 字节数"，可直接喂给 flamegraph.pl / speedscope
+    Pprof,  // gperftools 兼容的 heap_v2 文本（附 /proc/self/maps），pprof 可直接读取
+};
+
+// 折叠栈输出的取值（pprof 格式同时包含两者）
+enum class MemoryProfileMetric : std::uint8_t
+{
+    AllocatedBytes, // 开始采样以来累计分配（用于定位每帧分配热点 / churn）
+    LiveBytes,      // 当前仍存活的分配（用于定位常驻占用）
+};
+
+struct MemoryProfilerConfig
+{
+    // 平均每分配多少字节采一个样（采样点间距服从指数分布，大分配必然被采到）
+    std::size_t SampleIntervalBytes = 512ull * 1024ull;
+
+    // 每个样本最多记录的栈帧数（上限 MemoryProfilerMaxStackDepth）
+    std::uint32_t MaxStackDepth = 24;
+
+    // 非空时 MemoryShutdown 会按 ShutdownDumpFormat 自动写出一次（路径会被复制保存）
+    const char* ShutdownDumpPath = nullptr;
+    MemoryProfileFormat ShutdownDumpFormat = MemoryProfileFormat::Pprof;
+};
+
+inline constexpr std::uint32_t MemoryProfilerMaxStackDepth = 32;
+
+struct MemoryProfilerSummary
+{
+    std::uint64_t SampleCount = 0;     // 累计采样次数
+    std::uint64_t LiveSampleCount = 0; // 仍存活的采样分配数
+    std::uint64_t UniqueStacks = 0;    // 不同调用栈数
+    std::uint64_t EstimatedAllocatedBytes = 0;
+    std::uint64_t EstimatedLiveBytes = 0;
+};
+
+// 开始采样（清空之前的数据）。未开启时分配热路径只多一次 relaxed 原子读
+void MemoryProfilerStart(const MemoryProfilerConfig& config = {});
+
+// 停止采样；已收集的数据保留，仍可 Dump
+void MemoryProfilerStop();
+
+[[nodiscard]] bool MemoryProfilerIsActive();
+
+// 写出当前数据，失败（无法打开文件）返回 false
+bool MemoryProfilerDump(const char* path, MemoryProfileFormat format,
+                        MemoryProfileMetric metric = MemoryProfileMetric::AllocatedBytes);
+
+[[nodiscard]] MemoryProfilerSummary MemoryProfilerGetSummary();
+
+} // namespace TE
@@ -0,0 +1,62 @@
+// ToyEngine Core Module
+// 线程本地内存作用域 —— 未指定 tag 的分配按最内层作用域归属
+
+#pragma once
+
+#include "MemoryTag.h"
+
+// 未在构建选项中显式关闭时默认开启（CMake: TE_ENABLE_MEMORY_SCOPES）
+#ifndef TE_ENABLE_MEMORY_SCOPES
+#define TE_ENABLE_MEMORY_SCOPES 1
+#endif
+
+namespace TE {
+
+// 进入作用域：把调用线程的当前作用域 tag 设为 tag，返回进入前的值
+[[nodiscard]] MemoryTag MemoryPushScopeTag(MemoryTag tag);
+
+// 离开作用域：恢复进入前的值（必须与 MemoryPushScopeTag 成对、按栈序调用）
+void MemoryPopScopeTag(MemoryTag previous);
+
+// 调用线程最内层作用域的 tag；不在任何作用域内时为 Unknown
+[[nodiscard]] MemoryTag MemoryGetScopeTag();
+
+/// <summary>
+/// RAII 内存作用域：
+/// - 作用域内 tag 为 Unknown 或 STL 的分配（含全局 operator new 覆盖）改记到作用域 tag；
+/// - 显式指定其它 tag 的分配不受影响，realloc 沿用原块 tag 的语义也不变；
+/// - 作用域按线程嵌套，析构时恢复外层 tag。
+/// 一般通过 TE_MEMORY_SCOPE 使用，关闭 TE_ENABLE_MEMORY_SCOPES 时宏展开为空。
+/// </summary>
+class MemoryTagScope final
+{
+public:
+    explicit MemoryTagScope(MemoryTag tag)
+        : m_previous(MemoryPushScopeTag(tag))
+    {
+    }
+
+    ~MemoryTagScope()
+    {
+        MemoryPopScopeTag(m_previous);
+    }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag m_previous = MemoryTag::Unknown;
+};
+
+} // namespace TE
+
+#define TE_MEMORY_SCOPE_CONCAT_INNER(a, b) a##b
+#define TE_MEMORY_SCOPE_CONCAT(a, b) TE_MEMORY_SCOPE_CONCAT_INNER(a, b)
+
+// 用法：TE_MEMORY_SCOPE(Renderer); —— 参数为 MemoryTag 枚举名
+#if TE_ENABLE_MEMORY_SCOPES
+#define TE_MEMORY_SCOPE(TagName) \
+    ::TE::MemoryTagScope TE_MEMORY_SCOPE_CONCAT(teMemoryScope_, __LINE__)(::TE::MemoryTag::TagName)
+#else
+#define TE_MEMORY_SCOPE(TagName) static_cast<void>(::TE::MemoryTag::TagName)
+#endif
@@ -17,6 +17,7 @@ enum class MemoryTag : std::uint16_t
     Asset,
     Scene,
     Sandbox,
+    Frame,      // FrameArena 帧缓冲
 
     Count,
 };
@@ -0,0 +1,66 @@
+// ToyEngine Core Module
+// 分配轨迹记录 — 把每次 MemAlloc / MemRealloc / MemFree 以定长二进制事件写入文件，供 AllocReplayBench 回放
+//
+// 用法：
+//   TE::MemoryTraceStart("Saved/Profiling/sandbox.memtrace");
+//   ...
+//   TE::MemoryTraceStop();
+// 或设置环境变量 TE_MEMORY_TRACE=<路径>，MemoryInit 时自动开始、MemoryShutdown 时结束。
+//
+// 文件格式：MemoryTraceFileHeader + 若干 MemoryTraceEvent（小端、按线程批量写出，整体不保证时间有序，
+// 回放方应按 TimestampNs 稳定排序）。指针只作为块标识，用于把 Free / Realloc 与之前的分配配对。
+
+#pragma once
+
+#include "Memory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TE {
+
+inline constexpr std::uint32_t MemoryTraceMagic = 0x52544554; // 'T''E''T''R'
+inline constexpr std::uint32_t MemoryTraceVersion = 1;
+
+enum class MemoryTraceOp : std::uint8_t
+{
+    Alloc,   // Ptr = 返回的块
+    Realloc, // OldPtr -> Ptr（OldPtr 为空等价于分配；Size 为 0 且 Ptr 为空等价于释放）
+    Free,    // Ptr = 被释放的块
+};
+
+struct MemoryTraceFileHeader
+{
+    std::uint32_t Magic = MemoryTraceMagic;
+    std::uint32_t Version = MemoryTraceVersion;
+    std::uint32_t EventBytes = 0; // sizeof(MemoryTraceEvent)，读取方据此校验
+    std::uint32_t Reserved = 0;
+};
+
+struct MemoryTraceEvent
+{
+    std::uint64_t TimestampNs = 0; // 自 MemoryTraceStart 起的单调时钟纳秒
+    std::uint64_t Ptr = 0;
+    std::uint64_t OldPtr = 0;
+    std::uint64_t Size = 0;
+    std::uint32_t Align = 0;       // 调用方传入的对齐（0 = 默认）
+    std::uint16_t ThreadId = 0;    // 按线程首次记录的顺序编号
+    MemoryTag Tag = MemoryTag::Unknown;
+    MemoryTraceOp Op = MemoryTraceOp::Alloc;
+    std::uint8_t Reserved[7] = {};
+};
+
+static_assert(sizeof(MemoryTraceEvent) == 48, "MemoryTraceEvent layout is part of the trace file format");
+
+// 开始记录（清空已有文件）；已在记录或无法打开文件时返回 false
+bool MemoryTraceStart(const char* path);
+
+// 停止记录：写出全部线程的缓冲并关闭文件
+void MemoryTraceStop();
+
+[[nodiscard]] bool MemoryTraceIsActive();
+
+// 本次记录已写出的事件数（含尚在线程缓冲中的事件）
+[[nodiscard]] std::uint64_t MemoryTraceGetEventCount();
+
+} // namespace TE
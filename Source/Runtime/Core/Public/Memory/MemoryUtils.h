@@ -6,6 +6,7 @@
 #include "Memory.h"
 
 #include <cstddef>
+#include <cstdint>
 
 namespace TE {
 
@@ -27,10 +28,26 @@ struct FormattedBytes
 
 FormattedBytes FormatBytes(std::uint64_t bytes);
 
+// ============================================================
+// LogMemoryBudgetEvent — 可直接作为 MemoryTagBudget::Callback 的日志回调
+// ============================================================
+
+void LogMemoryBudgetEvent(MemoryTag tag, MemoryBudgetEvent event,
+                          std::uint64_t currentBytes, std::uint64_t budgetBytes, void* userData);
+
 // ============================================================
 // DumpMemoryStats — 打印完整内存统计到日志
 // ============================================================
 
 void DumpMemoryStats();
 
+// ============================================================
+// DumpHeapFragmentationReport — 打印堆碎片报告（空闲块直方图、最大空闲块、碎片率、各池段占用）
+// ============================================================
+
+void DumpHeapFragmentationReport();
+
+// DumpMemoryStats 每调用 interval 次附带打印一次碎片报告；0 表示从不（默认 1，即每次都打印）
+void SetHeapFragmentationDumpInterval(std::uint32_t interval);
+
 } // namespace TE
@@ -5,7 +5,12 @@
 #include "Engine.h"
 
 #include "Window.h"
+#include "Jobs/JobSystem.h"
+#include "Memory/FrameAllocationGuard.h"
+#include "Memory/FrameArena.h"
 #include "Memory/Memory.h"
+#include "Memory/MemoryScope.h"
+#include "Memory/MemoryUtils.h"
 #include "Log/Log.h"
 #include "Math/ScalarMath.h"
 #include "RHI.h"
@@ -17,10 +22,81 @@
 #include "SceneRenderer.h"
 #include "InputManager.h"
 
+#include <cstdlib>
+#include <cstring>
 #include <thread>
 
 namespace TE {
 
+namespace {
+
+// 默认标签预算：越过水位线/预算时记录日志，用于在 OOM 之前发现失控的缓存（如纹理缓存）。
+// 应用在 Engine::Init 之前调用 MemorySetTagBudget 设置的预算优先。
+void ApplyDefaultMemoryBudgets()
+{
+    struct DefaultBudget
+    {
+        MemoryTag Tag;
+        std::uint64_t Bytes;
+    };
+    constexpr std::uint64_t MB = 1024ull * 1024ull;
+    constexpr DefaultBudget defaults[] = {
+        { MemoryTag::RHI,      1024 * MB },
+        { MemoryTag::Renderer, 512 * MB },
+        { MemoryTag::Asset,    2048 * MB },
+    };
+
+    for (const auto& entry : defaults)
+    {
+        if (MemoryGetTagBudget(entry.Tag).BudgetBytes != 0)
+        {
+            continue;
+        }
+        MemoryTagBudget budget;
+        budget.BudgetBytes = entry.Bytes;
+        budget.Callback = &LogMemoryBudgetEvent;
+        MemorySetTagBudget(entry.Tag, budget);
+    }
+}
+
+// 帧分配守卫：TE_FRAME_ALLOC_GUARD=off|count|log|assert 优先；
+// 未设置时 Debug 构建默认 Log，应用在 Engine::Init 之前设置的非 Off 策略保留。
+void ApplyFrameAllocationGuardDefaults()
+{
+    FrameAllocationGuardConfig config = MemoryGetFrameAllocationGuard();
+
+    const char* value = std::getenv("TE_FRAME_ALLOC_GUARD");
+    if (value && *value)
+    {
+        if (std::strcmp(value, "count") == 0)
+        {
+            config.Policy = FrameAllocationPolicy::Count;
+        }
+        else if (std::strcmp(value, "log") == 0)
+        {
+            config.Policy = FrameAllocationPolicy::Log;
+        }
+        else if (std::strcmp(value, "assert") == 0)
+        {
+            config.Policy = FrameAllocationPolicy::Assert;
+        }
+        else
+        {
+            config.Policy = FrameAllocationPolicy::Off;
+        }
+    }
+#ifndef NDEBUG
+    else if (config.Policy == FrameAllocationPolicy::Off)
+    {
+        config.Policy = FrameAllocationPolicy::Log;
+    }
+#endif
+
+    MemorySetFrameAllocationGuard(config);
+}
+
+} // namespace
+
 Engine& Engine::Get()
 {
     static Engine instance;
@@ -44,9 +120,14 @@ void Engine::Init()
 
     // 2. 初始化内存系统
     MemoryInit();
+    ApplyDefaultMemoryBudgets();
+    ApplyFrameAllocationGuardDefaults();
     TE_LOG_INFO("Memory system initialized");
 
-    // 3. 创建窗口；OpenGL 后端创建 Context，其它后端使用 No-API 窗口。
+    // 3. 启动作业系统（工作线程使用引擎堆与日志：在二者之后启动、之前关闭）
+    JobSystem::Get().Init();
+
+    // 4. 创建窗口；OpenGL 后端创建 Context，其它后端使用 No-API 窗口。
     FWindowConfig config{
         "ToyEngine - Model Loading (UE5 Architecture)",
         1280,
@@ -72,7 +153,7 @@ void Engine::Init()
     // 关闭 VSync，观察真实渲染性能（发布时建议开启）
     m_Window->SetVSync(true);
 
-    // 4. 初始化 RHI
+    // 5. 初始化 RHI
     if (!InitRHI())
     {
         TE_LOG_ERROR("Failed to initialize RHI!");
@@ -80,7 +161,7 @@ void Engine::Init()
         return;
     }
 
-    // 5. 创建 UE5 架构核心模块
+    // 6. 创建 UE5 架构核心模块
     m_Scene = std::make_unique<FScene>(m_RHIDevice.get());
     m_SceneRenderer = std::make_unique<FSceneRenderer>();
     m_SceneRenderer->SetRenderPath(m_RenderPathType);
@@ -92,7 +173,7 @@ void Engine::Init()
 
     TE_LOG_INFO("UE5 architecture modules created: World + FScene + SceneRenderer");
 
-    // 6. 初始化输入系统
+    // 7. 初始化输入系统
     m_InputManager = std::make_unique<FInputManager>();
     m_InputManager->Init(m_Window.get());
 
@@ -108,7 +189,7 @@ void Engine::Init()
     m_ShouldExit = false;
     m_CameraComponent = nullptr;
 
-    // 7. 完整 Renderer 可用时才搭建应用场景；阶段性后端使用内部验证路径。
+    // 8. 完整 Renderer 可用时才搭建应用场景；阶段性后端使用内部验证路径。
     if (!m_RHIDevice->GetBackendTraits().bSupportsFullSceneRendering)
     {
         TE_LOG_INFO("RHI backend is running in staged validation mode; application scene setup is deferred");
@@ -148,6 +229,9 @@ bool Engine::InitRHI()
         return false;
     }
 
+    // 帧 arena 与 RHI 同步多缓冲：帧数据在 GPU 仍可能引用它的帧数内保持有效
+    FrameArena::Get().Init(deviceDesc.framesInFlight);
+
     TE_LOG_INFO("RHI initialized - Device frame lifecycle ready");
     return true;
 }
@@ -261,8 +345,9 @@ void Engine::SendAllEndOfFrameUpdates() const {
     }
 }
 
-void Engine::TickRenderThread(const float deltaTime) const {
+void Engine::TickRenderThread(const float deltaTime) {
     (void)deltaTime;
+    TE_MEMORY_SCOPE(Renderer);
 
     if (!m_SceneRenderer || !m_Scene || !m_RHIDevice || !m_Window)
     {
@@ -274,6 +359,18 @@ void Engine::TickRenderThread(const float deltaTime) const {
     beginInfo.framebufferHeight = m_Window->GetFramebufferHeight();
     beginInfo.vsync = m_Window->IsVSyncEnabled();
 
+    // 尺寸变化会重建交换链与渲染目标（以及依赖它们的 BindGroup），重新预热后再判定稳态
+    if (beginInfo.framebufferWidth != m_GuardedFramebufferWidth ||
+        beginInfo.framebufferHeight != m_GuardedFramebufferHeight)
+    {
+        m_GuardedFramebufferWidth = beginInfo.framebufferWidth;
+        m_GuardedFramebufferHeight = beginInfo.framebufferHeight;
+        MemoryResetFrameAllocationWarmup();
+    }
+
+    // 覆盖 RHI BeginFrame 到 EndFrame：稳态帧不应触碰通用堆
+    FrameAllocationGuardScope allocationGuard;
+
     RHIFrameContext frameContext;
     const RHIFrameStatus beginStatus = m_RHIDevice->BeginFrame(beginInfo, frameContext);
     if (beginStatus != RHIFrameStatus::Ready)
@@ -337,6 +434,17 @@ void Engine::EndFrame(float deltaTime)
     }
 
     UpdateFrameStats(deltaTime);
+
+    // 帧内瞬态数据（DrawCommand 数组、LightBlock 快照等）整体回收
+    FrameArena::Get().EndFrame();
+
+    // 释放路径只标记待回收，遍历堆与 madvise 集中在这里按固定间隔执行
+    m_MemoryTrimAccumulatedTime += deltaTime;
+    if (m_MemoryTrimAccumulatedTime >= MEMORY_TRIM_INTERVAL)
+    {
+        m_MemoryTrimAccumulatedTime = 0.0f;
+        (void)MemoryTrimIdle();
+    }
 }
 
 void Engine::UpdateFrameStats(float deltaTime)
@@ -363,6 +471,9 @@ void Engine::Shutdown()
 {
     TE_LOG_INFO("Shutting down ToyEngine...");
 
+    // 场景仍在时记录一次内存概况（含小块 slab 层相对带块头分配省下的内存）
+    DumpMemoryStats();
+
     if (m_InputManager)
     {
         m_InputManager->Shutdown();
@@ -377,7 +488,10 @@ void Engine::Shutdown()
         m_Window.reset();
     }
 
+    JobSystem::Get().Shutdown();
+
     TE_LOG_INFO("Shutting down memory system...");
+    FrameArena::Get().Shutdown();
     MemoryShutdown();
 
     TE_LOG_INFO("ToyEngine shutdown complete");
@@ -408,6 +522,7 @@ void Engine::SetFrameUpdateCallback(std::function<void(Engine&, float)> callback
 void Engine::SetRenderPath(ERenderPathType type)
 {
     m_RenderPathType = type;
+    MemoryResetFrameAllocationWarmup();
     if (m_SceneRenderer)
     {
         m_SceneRenderer->SetRenderPath(type);
@@ -417,6 +532,7 @@ void Engine::SetRenderPath(ERenderPathType type)
 void Engine::SetRenderDebugView(ERenderDebugView mode)
 {
     m_RenderDebugViewMode = mode;
+    MemoryResetFrameAllocationWarmup();
     if (m_SceneRenderer)
     {
         m_SceneRenderer->SetDebugView(mode);
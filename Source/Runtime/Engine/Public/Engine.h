@@ -33,7 +33,7 @@ namespace TE {
 ///   → TickGameThread(deltaTime)       // 应用层逻辑 + World Tick
 ///   → SendAllEndOfFrameUpdates()      // 游戏侧状态同步到渲染侧
 ///   → TickRenderThread(deltaTime)     // 当前仍在主线程中模拟渲染阶段
-///   → EndFrame(deltaTime)             // 输入收尾、统计
+///   → EndFrame(deltaTime)             // 输入收尾、统计、帧 arena 复位
 class Engine
 {
 public:
@@ -46,7 +46,7 @@ public:
 
     /**
      * 初始化所有子系统。
-     * @note 顺序为 Log → Memory → Window → RHI → World/FScene/SceneRenderer；仅完整场景后端执行应用层场景回调。
+     * @note 顺序为 Log → Memory → JobSystem → Window → RHI → World/FScene/SceneRenderer；仅完整场景后端执行应用层场景回调。
      */
     void Init();
 
@@ -110,7 +110,7 @@ private:
     void TickInput(float deltaTime) const;
     void TickGameThread(float deltaTime);
     void SendAllEndOfFrameUpdates() const;
-    void TickRenderThread(float deltaTime) const;
+    void TickRenderThread(float deltaTime);
     void EndFrame(float deltaTime);
     void UpdateFrameStats(float deltaTime);
 
@@ -133,6 +133,10 @@ private:
     ERenderPathType m_RenderPathType = ERenderPathType::Forward;
     ERenderDebugView m_RenderDebugViewMode = ERenderDebugView::Lit;
 
+    // 上一帧的帧缓冲尺寸（变化时重新开始帧分配守卫的预热）
+    uint32_t m_GuardedFramebufferWidth = 0;
+    uint32_t m_GuardedFramebufferHeight = 0;
+
     // 运行状态
     bool m_Running = false;
     bool m_ShouldExit = false;
@@ -150,6 +154,10 @@ private:
     uint32_t m_FPSAccumulatedFrames = 0; // 窗口内累计帧数
     float m_CurrentFPS = 0.0f;           // 最近一次计算出的平均 FPS
     static constexpr float FPS_UPDATE_INTERVAL = 0.5f; // 每 0.5 秒更新一次
+
+    // 堆的策略回收（MemoryTrimIdle）：空闲跨度须连续两遍空闲才归还 OS
+    float m_MemoryTrimAccumulatedTime = 0.0f;
+    static constexpr float MEMORY_TRIM_INTERVAL = 5.0f;
 };
 
 } // namespace TE
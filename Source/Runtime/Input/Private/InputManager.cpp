@@ -202,7 +202,7 @@ void FInputManager::OnScrollEvent(double xoffset, double yoffset)
     m_ScrollDelta += Vector2(static_cast<float>(xoffset), static_cast<float>(yoffset));
 }
 
-bool FInputManager::GetState(const std::unordered_map<int, bool>& states, int code)
+bool FInputManager::GetState(const TFlatHashMap<int, bool>& states, int code)
 {
     const auto it = states.find(code);
     return it != states.end() ? it->second : false;
@@ -4,7 +4,7 @@
 #pragma once
 
 #include "Math/MathTypes.h"
-#include <unordered_map>
+#include "Memory/FlatHashMap.h"
 
 namespace TE
 {
@@ -44,19 +44,19 @@ private:
     void OnCursorPosEvent(double xpos, double ypos);
     void OnScrollEvent(double xoffset, double yoffset);
 
-    [[nodiscard]] static bool GetState(const std::unordered_map<int, bool>& states, int code);
+    [[nodiscard]] static bool GetState(const TFlatHashMap<int, bool>& states, int code);
 
 private:
     IWindow* m_Window = nullptr;
     bool m_Initialized = false;
 
-    std::unordered_map<int, bool> m_KeyStates;
-    std::unordered_map<int, bool> m_KeyJustPressed;
-    std::unordered_map<int, bool> m_KeyJustReleased;
+    TFlatHashMap<int, bool> m_KeyStates{MemoryTag::Platform};
+    TFlatHashMap<int, bool> m_KeyJustPressed{MemoryTag::Platform};
+    TFlatHashMap<int, bool> m_KeyJustReleased{MemoryTag::Platform};
 
-    std::unordered_map<int, bool> m_MouseButtonStates;
-    std::unordered_map<int, bool> m_MouseButtonJustPressed;
-    std::unordered_map<int, bool> m_MouseButtonJustReleased;
+    TFlatHashMap<int, bool> m_MouseButtonStates{MemoryTag::Platform};
+    TFlatHashMap<int, bool> m_MouseButtonJustPressed{MemoryTag::Platform};
+    TFlatHashMap<int, bool> m_MouseButtonJustReleased{MemoryTag::Platform};
 
     Vector2 m_MousePosition = Vector2::Zero;
     Vector2 m_LastMousePosition = Vector2::Zero;
@@ -21,7 +21,7 @@ struct RHIRenderTargetDesc
 {
     uint32_t width = 0;
     uint32_t height = 0;
-    std::vector<RHIAttachmentDesc> colorAttachments;
+    TInlineArray<RHIAttachmentDesc, RHIInlineColorAttachments> colorAttachments{MemoryTag::RHI};
     RHIAttachmentDesc              depthStencilAttachment;
     bool                           hasDepthStencil = true;
     RHISampleCount                 sampleCount = RHISampleCount::Count1;
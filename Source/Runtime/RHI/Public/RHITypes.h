@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "Memory/InlineContainers.h"
+
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -24,6 +26,16 @@ class RHIPipelineLayout;
 
 using RHIPlatformPresentCallback = void(*)(void* userData);
 
+// 描述符内联容量：常见情况下描述符本身不触发堆分配，超出时溢出到 RHI tag
+inline constexpr std::size_t RHIInlineBindGroupEntries = 8;
+inline constexpr std::size_t RHIInlineBindGroups = 8;
+inline constexpr std::size_t RHIInlineColorAttachments = 8;
+inline constexpr std::size_t RHIInlineVertexBindings = 4;
+inline constexpr std::size_t RHIInlineVertexAttributes = 8;
+
+/// 描述符调试名称（短名称内联存储）
+using RHIDebugName = TSmallString<48>;
+
 // ============================================================
 // 枚举类型
 // ============================================================
@@ -246,8 +258,8 @@ struct RHIVertexBindingDesc
 /// 对应 Vulkan 的 VkPipelineVertexInputStateCreateInfo
 struct RHIVertexInputDesc
 {
-    std::vector<RHIVertexBindingDesc>   bindings;
-    std::vector<RHIVertexAttribute>     attributes;
+    TInlineArray<RHIVertexBindingDesc, RHIInlineVertexBindings>     bindings{MemoryTag::RHI};
+    TInlineArray<RHIVertexAttribute, RHIInlineVertexAttributes>     attributes{MemoryTag::RHI};
 };
 
 /// 光栅化状态描述
@@ -321,10 +333,10 @@ struct RHIColorBlendAttachmentDesc
 
 struct RHIPipelineRenderingDesc
 {
-    std::vector<RHIFormat> colorAttachmentFormats;
+    TInlineArray<RHIFormat, RHIInlineColorAttachments> colorAttachmentFormats{MemoryTag::RHI};
     RHIFormat depthStencilFormat = RHIFormat::Undefined;
     RHISampleCount sampleCount = RHISampleCount::Count1;
-    std::vector<RHIColorBlendAttachmentDesc> colorBlendAttachments;
+    TInlineArray<RHIColorBlendAttachmentDesc, RHIInlineColorAttachments> colorBlendAttachments{MemoryTag::RHI};
 };
 
 /// 缓冲区创建描述符
@@ -567,8 +579,8 @@ struct RHIBindGroupLayoutEntry
 /// BindGroup 布局描述
 struct RHIBindGroupLayoutDesc
 {
-    std::vector<RHIBindGroupLayoutEntry> entries;
-    std::string debugName;
+    TInlineArray<RHIBindGroupLayoutEntry, RHIInlineBindGroupEntries> entries{MemoryTag::RHI};
+    RHIDebugName debugName{MemoryTag::RHI};
 };
 
 /// BindGroup 中单条绑定的资源引用
@@ -587,8 +599,8 @@ struct RHIBindGroupEntry
 struct RHIBindGroupDesc
 {
     RHIBindGroupLayout* layout = nullptr;
-    std::vector<RHIBindGroupEntry> entries;
-    std::string debugName;
+    TInlineArray<RHIBindGroupEntry, RHIInlineBindGroupEntries> entries{MemoryTag::RHI};
+    RHIDebugName debugName{MemoryTag::RHI};
 };
 
 /// Pipeline 中单个 BindGroupLayout 的声明。
@@ -602,8 +614,8 @@ struct RHIPipelineBindGroupLayout
 /// Vulkan 后端可映射为 VkPipelineLayout，D3D12 后端可映射为 Root Signature。
 struct RHIPipelineLayoutDesc
 {
-    std::vector<RHIPipelineBindGroupLayout> bindGroupLayouts;
-    std::string debugName;
+    TInlineArray<RHIPipelineBindGroupLayout, RHIInlineBindGroups> bindGroupLayouts{MemoryTag::RHI};
+    RHIDebugName debugName{MemoryTag::RHI};
 };
 
 // ============================================================
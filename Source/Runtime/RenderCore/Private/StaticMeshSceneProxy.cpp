@@ -10,6 +10,10 @@ namespace TE {
 FStaticMeshSceneProxy::FStaticMeshSceneProxy(std::shared_ptr<StaticMesh> staticMesh)
     : m_StaticMesh(std::move(staticMesh))
 {
+    if (m_StaticMesh)
+    {
+        SetLocalBounds(m_StaticMesh->GetLocalBounds());
+    }
 }
 
 FStaticMeshSceneProxy::~FStaticMeshSceneProxy() = default;
@@ -25,7 +29,7 @@ bool FStaticMeshSceneProxy::SetRenderResources(std::shared_ptr<const FStaticMesh
     return true;
 }
 
-void FStaticMeshSceneProxy::GetMeshDrawCommands(std::vector<FMeshDrawCommand>& outCommands) const
+void FStaticMeshSceneProxy::GetMeshDrawCommands(TFrameArray<FMeshDrawCommand>& outCommands) const
 {
     if (!IsValid())
     {
@@ -76,7 +76,8 @@ struct FMeshDrawCommand
     uint32_t FirstIndex = 0;
     uint32_t IndexCount = 0;
     uint32_t MaterialIndex = 0;
-    Matrix4 WorldMatrix = Matrix4::Identity;
+    // 世界矩阵恒为仿射，以 3x4 紧凑形式保存（48 字节），上传常量时再展开
+    Matrix3x4 WorldMatrix = Matrix3x4::Identity;
 };
 
 } // namespace TE
@@ -5,9 +5,9 @@
 #pragma once
 
 #include "MeshDrawCommand.h"
+#include "Math/Geometry.h"
 #include "Math/MathTypes.h"
-
-#include <vector>
+#include "Memory/FrameArena.h"
 
 namespace TE {
 
@@ -16,15 +16,33 @@ class FPrimitiveSceneProxy
 public:
     virtual ~FPrimitiveSceneProxy() = default;
 
-    void SetWorldMatrix(const Matrix4& matrix) { m_WorldMatrix = matrix; }
-    [[nodiscard]] const Matrix4& GetWorldMatrix() const { return m_WorldMatrix; }
+    // 世界包围盒随世界矩阵一起刷新（Arvo 变换局部包围盒），供剔除 / 空间索引直接读取
+    void SetWorldMatrix(const Matrix3x4& matrix)
+    {
+        m_WorldMatrix = matrix;
+        m_WorldBounds = m_LocalBounds.TransformBy(matrix);
+    }
+    [[nodiscard]] const Matrix3x4& GetWorldMatrix() const { return m_WorldMatrix; }
+
+    [[nodiscard]] const BoundingBox& GetLocalBounds() const { return m_LocalBounds; }
+    [[nodiscard]] const BoundingBox& GetWorldBounds() const { return m_WorldBounds; }
 
-    virtual void GetMeshDrawCommands(std::vector<FMeshDrawCommand>& outCommands) const = 0;
+    // 命令写入帧 arena 中的数组，仅在当前帧有效
+    virtual void GetMeshDrawCommands(TFrameArray<FMeshDrawCommand>& outCommands) const = 0;
 
 protected:
     FPrimitiveSceneProxy() = default;
 
-    Matrix4 m_WorldMatrix = Matrix4::Identity;
+    // 子类在构造时设置模型空间包围盒
+    void SetLocalBounds(const BoundingBox& bounds)
+    {
+        m_LocalBounds = bounds;
+        m_WorldBounds = bounds.TransformBy(m_WorldMatrix);
+    }
+
+    Matrix3x4 m_WorldMatrix = Matrix3x4::Identity;
+    BoundingBox m_LocalBounds;
+    BoundingBox m_WorldBounds;
 };
 
 } // namespace TE
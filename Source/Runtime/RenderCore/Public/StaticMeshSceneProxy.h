@@ -23,7 +23,7 @@ public:
     [[nodiscard]] bool HasStaticMeshAsset() const { return m_StaticMesh != nullptr; }
     [[nodiscard]] bool SetRenderResources(std::shared_ptr<const FStaticMeshRenderData> renderData);
 
-    void GetMeshDrawCommands(std::vector<FMeshDrawCommand>& outCommands) const override;
+    void GetMeshDrawCommands(TFrameArray<FMeshDrawCommand>& outCommands) const override;
 
     [[nodiscard]] bool IsValid() const;
 
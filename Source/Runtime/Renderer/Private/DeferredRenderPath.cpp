@@ -132,7 +132,7 @@ std::unique_ptr<RHIBindGroupLayout> CreateEnvironmentTexturesLayout(RHIDevice* d
 template <typename TPipelineCache>
 bool BuildPipelineLayout(RHIDevice* device,
                          TPipelineCache& pipeline,
-                         std::vector<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>> layouts,
+                         TInlineArray<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>, RHIInlineBindGroups> layouts,
                          const char* debugName)
 {
     if (!device)
@@ -223,7 +223,7 @@ void FDeferredRenderPath::Render(const FScene* scene,
         return;
     }
 
-    std::vector<FMeshDrawCommand> drawCommands;
+    TFrameArray<FMeshDrawCommand> drawCommands;
     m_GBufferPassProcessor.BuildDrawCommands(scene, drawCommands);
     SortDrawCommands(drawCommands);
 
@@ -379,7 +379,7 @@ bool FDeferredRenderPath::BuildGBufferPipeline(RHIDevice* device)
         return false;
     }
 
-    std::vector<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>> layouts;
+    TInlineArray<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>, RHIInlineBindGroups> layouts;
     layouts.push_back({
         RendererBindGroups::PassBlock,
         CreateSingleUniformLayout(device,
@@ -452,7 +452,7 @@ bool FDeferredRenderPath::BuildLightingPipeline(RHIDevice* device)
         return false;
     }
 
-    std::vector<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>> layouts;
+    TInlineArray<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>, RHIInlineBindGroups> layouts;
     layouts.push_back({
         RendererBindGroups::LightBlock,
         CreateSingleUniformLayout(device,
@@ -499,7 +499,7 @@ bool FDeferredRenderPath::BuildLightingPipeline(RHIDevice* device)
     return m_LightingPipeline.Pipeline && m_LightingPipeline.Pipeline->IsValid();
 }
 
-void FDeferredRenderPath::SortDrawCommands(std::vector<FMeshDrawCommand>& commands) const
+void FDeferredRenderPath::SortDrawCommands(TFrameArray<FMeshDrawCommand>& commands) const
 {
     std::sort(commands.begin(), commands.end(),
         [](const FMeshDrawCommand& a, const FMeshDrawCommand& b)
@@ -517,7 +517,7 @@ void FDeferredRenderPath::SortDrawCommands(std::vector<FMeshDrawCommand>& comman
         });
 }
 
-void FDeferredRenderPath::SubmitGBufferPass(const std::vector<FMeshDrawCommand>& commands,
+void FDeferredRenderPath::SubmitGBufferPass(const TFrameArray<FMeshDrawCommand>& commands,
                                             const FScene* scene,
                                             RHIDevice* device,
                                             RHICommandBuffer* cmdBuf,
@@ -533,14 +533,25 @@ void FDeferredRenderPath::SubmitGBufferPass(const std::vector<FMeshDrawCommand>&
     const Matrix4 adjustedProjection = device->AdjustProjectionMatrix(renderProjection);
     const Matrix4 adjustedVP = adjustedProjection * viewInfo.ViewMatrix;
 
+    FObjectTransformBatch objectTransforms;
+    BuildObjectTransformBatch(commands, adjustedVP, objectTransforms);
+
+    BeginMaterialTextureBindingFrame(*m_MaterialTextureBindingState);
+
     cmdBuf->BindPipeline(m_GBufferPipeline.Pipeline.get());
     ++outStats.PipelineBindCount;
 
     RHIBuffer* lastVBO = nullptr;
     RHIBuffer* lastIBO = nullptr;
+    auto* defaultSampler = scene->ResolveDefaultSampler();
+    const StaticMesh* lastMeshAsset = nullptr;
+    uint32_t lastMaterialIndex = 0;
+    const FMaterial* material = nullptr;
+    const FPreparedMaterialTextures* materialTextures = nullptr;
 
-    for (const auto& cmd : commands)
+    for (size_t commandIndex = 0; commandIndex < commands.size(); ++commandIndex)
     {
+        const auto& cmd = commands[commandIndex];
         if (cmd.VertexBuffer != lastVBO)
         {
             cmdBuf->BindVertexBuffer(cmd.VertexBuffer);
@@ -555,9 +566,14 @@ void FDeferredRenderPath::SubmitGBufferPass(const std::vector<FMeshDrawCommand>&
             ++outStats.IBOBindCount;
         }
 
-        const auto* material = scene->ResolveMaterial(cmd.StaticMeshAsset, cmd.MaterialIndex);
-        const auto* materialTextures = scene->ResolvePreparedMaterialTextures(cmd.StaticMeshAsset, cmd.MaterialIndex);
-        auto* defaultSampler = scene->ResolveDefaultSampler();
+        // 排序后同一网格的绘制相邻：同一 (网格, 材质槽) 的连续绘制只解析一次
+        if (cmd.StaticMeshAsset != lastMeshAsset || cmd.MaterialIndex != lastMaterialIndex)
+        {
+            material = scene->ResolveMaterial(cmd.StaticMeshAsset, cmd.MaterialIndex);
+            materialTextures = scene->ResolvePreparedMaterialTextures(cmd.StaticMeshAsset, cmd.MaterialIndex);
+            lastMeshAsset = cmd.StaticMeshAsset;
+            lastMaterialIndex = cmd.MaterialIndex;
+        }
         if (materialTextures)
         {
             UpdateAndBindMaterialTextures(device,
@@ -568,9 +584,12 @@ void FDeferredRenderPath::SubmitGBufferPass(const std::vector<FMeshDrawCommand>&
         }
         UpdateAndBindMaterialUniforms(device, cmdBuf, *m_MaterialBindingState, material, viewInfo.CameraPosition);
 
-        Matrix4 mvp = adjustedVP * cmd.WorldMatrix;
-        Matrix3 normalMatrix = cmd.WorldMatrix.GetNormalMatrix();
-        UpdateAndBindObjectUniforms(device, cmdBuf, *m_ObjectBindingState, mvp, cmd.WorldMatrix, normalMatrix);
+        UpdateAndBindObjectUniforms(device,
+                                    cmdBuf,
+                                    *m_ObjectBindingState,
+                                    objectTransforms.MVPs[commandIndex],
+                                    cmd.WorldMatrix,
+                                    objectTransforms.NormalMatrices[commandIndex]);
 
         cmdBuf->DrawIndexed(cmd.IndexCount, cmd.FirstIndex);
         ++outStats.DrawCallCount;
@@ -615,7 +634,7 @@ void FDeferredRenderPath::SubmitLightingPass(const FScene* scene,
                                       m_DebugViewMode,
                                       viewInfo.CameraPosition,
                                       invViewProjection);
-    UpdateAndBindSceneLightUniforms(scene, device, cmdBuf, *m_LightBindingState);
+    UpdateAndBindSceneLightUniforms(BuildSceneLightBlock(scene), device, cmdBuf, *m_LightBindingState);
 
     cmdBuf->Draw(3);
     ++outStats.DrawCallCount;
@@ -55,7 +55,7 @@ std::unique_ptr<RHIBindGroupLayout> CreateEnvironmentTexturesLayout(RHIDevice* d
 template <typename TPipelineCache>
 bool BuildPipelineLayout(RHIDevice* device,
                          TPipelineCache& pipeline,
-                         std::vector<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>> layouts,
+                         TInlineArray<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>, RHIInlineBindGroups> layouts,
                          const char* debugName)
 {
     if (!device)
@@ -117,7 +117,7 @@ void FForwardRenderPath::Render(const FScene* scene,
         return;
     }
 
-    std::vector<FMeshDrawCommand> drawCommands;
+    TFrameArray<FMeshDrawCommand> drawCommands;
     m_BasePassProcessor.BuildDrawCommands(scene, drawCommands);
     if (drawCommands.empty())
     {
@@ -179,7 +179,7 @@ bool FForwardRenderPath::BuildSkyPipeline(RHIDevice* device)
         return false;
     }
 
-    std::vector<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>> layouts;
+    TInlineArray<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>, RHIInlineBindGroups> layouts;
     layouts.push_back({
         RendererBindGroups::PassBlock,
         CreateSingleUniformLayout(device,
@@ -245,7 +245,7 @@ void FForwardRenderPath::SubmitSkyPass(const FScene* scene, RHIDevice* device, R
     cmdBuf->Draw(3);
 }
 
-void FForwardRenderPath::SortDrawCommands(std::vector<FMeshDrawCommand>& commands)
+void FForwardRenderPath::SortDrawCommands(TFrameArray<FMeshDrawCommand>& commands)
 {
     std::ranges::sort(commands,
                       [](const FMeshDrawCommand& a, const FMeshDrawCommand& b)
@@ -266,7 +266,7 @@ void FForwardRenderPath::SortDrawCommands(std::vector<FMeshDrawCommand>& command
                       });
 }
 
-void FForwardRenderPath::SubmitDrawCommands(const std::vector<FMeshDrawCommand>& commands,
+void FForwardRenderPath::SubmitDrawCommands(const TFrameArray<FMeshDrawCommand>& commands,
                                             const FScene* scene,
                                             RHIDevice* device,
                                             RHICommandBuffer* cmdBuf,
@@ -278,15 +278,27 @@ void FForwardRenderPath::SubmitDrawCommands(const std::vector<FMeshDrawCommand>&
     const Matrix4 adjustedProjection = device->AdjustProjectionMatrix(renderProjection);
     const Matrix4 adjustedVP = adjustedProjection * viewInfo.ViewMatrix;
 
+    FObjectTransformBatch objectTransforms;
+    BuildObjectTransformBatch(commands, adjustedVP, objectTransforms);
+
+    BeginMaterialTextureBindingFrame(*m_MaterialTextureBindingState);
+
     RHIPipeline* lastPipeline = nullptr;
     RHIBuffer* lastVBO = nullptr;
     RHIBuffer* lastIBO = nullptr;
 
     const auto* environmentResources = scene->ResolveEnvironmentIBLResources();
     auto* environmentSampler = scene->ResolveEnvironmentSampler();
-
-    for (const auto& cmd : commands)
+    const FLightBlockCPU* lightBlock = BuildSceneLightBlock(scene);
+    auto* defaultSampler = scene->ResolveDefaultSampler();
+    const StaticMesh* lastMeshAsset = nullptr;
+    uint32_t lastMaterialIndex = 0;
+    const FMaterial* material = nullptr;
+    const FPreparedMaterialTextures* materialTextures = nullptr;
+
+    for (size_t commandIndex = 0; commandIndex < commands.size(); ++commandIndex)
     {
+        const auto& cmd = commands[commandIndex];
         auto* pipeline = scene->ResolvePreparedPipeline(cmd.PipelineKey);
         if (!pipeline || !pipeline->IsValid())
         {
@@ -317,9 +329,14 @@ void FForwardRenderPath::SubmitDrawCommands(const std::vector<FMeshDrawCommand>&
             ++outStats.IBOBindCount;
         }
 
-        const auto* material = scene->ResolveMaterial(cmd.StaticMeshAsset, cmd.MaterialIndex);
-        const auto* materialTextures = scene->ResolvePreparedMaterialTextures(cmd.StaticMeshAsset, cmd.MaterialIndex);
-        auto* defaultSampler = scene->ResolveDefaultSampler();
+        // 排序后同一网格的绘制相邻：同一 (网格, 材质槽) 的连续绘制只解析一次
+        if (cmd.StaticMeshAsset != lastMeshAsset || cmd.MaterialIndex != lastMaterialIndex)
+        {
+            material = scene->ResolveMaterial(cmd.StaticMeshAsset, cmd.MaterialIndex);
+            materialTextures = scene->ResolvePreparedMaterialTextures(cmd.StaticMeshAsset, cmd.MaterialIndex);
+            lastMeshAsset = cmd.StaticMeshAsset;
+            lastMaterialIndex = cmd.MaterialIndex;
+        }
         if (materialTextures)
         {
             UpdateAndBindMaterialTextures(device,
@@ -335,12 +352,14 @@ void FForwardRenderPath::SubmitDrawCommands(const std::vector<FMeshDrawCommand>&
                                          environmentResources,
                                          environmentSampler);
 
-        Matrix4 mvp = adjustedVP * cmd.WorldMatrix;
-        Matrix3 normalMatrix = cmd.WorldMatrix.GetNormalMatrix();
-
-        UpdateAndBindObjectUniforms(device, cmdBuf, *m_ObjectBindingState, mvp, cmd.WorldMatrix, normalMatrix);
+        UpdateAndBindObjectUniforms(device,
+                                    cmdBuf,
+                                    *m_ObjectBindingState,
+                                    objectTransforms.MVPs[commandIndex],
+                                    cmd.WorldMatrix,
+                                    objectTransforms.NormalMatrices[commandIndex]);
 
-        UpdateAndBindSceneLightUniforms(scene, device, cmdBuf, *m_LightBindingState);
+        UpdateAndBindSceneLightUniforms(lightBlock, device, cmdBuf, *m_LightBindingState);
 
         cmdBuf->DrawIndexed(cmd.IndexCount, cmd.FirstIndex);
         ++outStats.DrawCallCount;
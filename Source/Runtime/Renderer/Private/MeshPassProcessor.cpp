@@ -13,7 +13,7 @@ FMeshPassProcessor::FMeshPassProcessor(EMeshPassType passType)
 {
 }
 
-void FMeshPassProcessor::BuildDrawCommands(const FScene* scene, std::vector<FMeshDrawCommand>& outCommands) const
+void FMeshPassProcessor::BuildDrawCommands(const FScene* scene, TFrameArray<FMeshDrawCommand>& outCommands) const
 {
     if (!scene)
     {
@@ -17,6 +17,7 @@
 #include "RHITypes.h"
 #include "StaticMesh.h"
 #include "Log/Log.h"
+#include "Math/MathUtils.h"
 #include "Math/ScalarMath.h"
 
 #include <algorithm>
@@ -88,11 +89,12 @@ struct FHDRImage
     return ClampColor(Vector3::Lerp(cx0, cx1, ty));
 }
 
+// 离线烘焙路径使用 Math::Fast* 近似：角度误差 < 3e-6 rad，远小于最小 IBL 贴图的一个纹素
 [[nodiscard]] Vector3 SampleEquirectangularHDR(const FHDRImage& image, const Vector3& direction)
 {
-    const Vector3 dir = direction.Normalize();
-    const float u = std::atan2(dir.Z, dir.X) / Math::TWO_PI + 0.5f;
-    const float v = 0.5f - std::asin(Math::Clamp(dir.Y, -1.0f, 1.0f)) / Math::PI;
+    const Vector3 dir = Math::FastNormalize(direction);
+    const float u = Math::FastAtan2(dir.Z, dir.X) / Math::TWO_PI + 0.5f;
+    const float v = 0.5f - Math::FastAsin(dir.Y) / Math::PI;
     return SampleHDRBilinear(image, u, v);
 }
 
@@ -102,12 +104,12 @@ struct FHDRImage
     const float y = 2.0f * v - 1.0f;
     switch (face)
     {
-    case 0: return Vector3(1.0f, -y, -x).Normalize();   // +X
-    case 1: return Vector3(-1.0f, -y, x).Normalize();   // -X
-    case 2: return Vector3(x, 1.0f, y).Normalize();     // +Y
-    case 3: return Vector3(x, -1.0f, -y).Normalize();   // -Y
-    case 4: return Vector3(x, -y, 1.0f).Normalize();    // +Z
-    default: return Vector3(-x, -y, -1.0f).Normalize(); // -Z
+    case 0: return Math::FastNormalize(Vector3(1.0f, -y, -x));   // +X
+    case 1: return Math::FastNormalize(Vector3(-1.0f, -y, x));   // -X
+    case 2: return Math::FastNormalize(Vector3(x, 1.0f, y));     // +Y
+    case 3: return Math::FastNormalize(Vector3(x, -1.0f, -y));   // -Y
+    case 4: return Math::FastNormalize(Vector3(x, -y, 1.0f));    // +Z
+    default: return Math::FastNormalize(Vector3(-x, -y, -1.0f)); // -Z
     }
 }
 
@@ -123,17 +125,31 @@ void StoreRGBA(std::vector<float>& pixels, size_t pixelIndex, const Vector3& col
 [[nodiscard]] std::vector<float> GenerateEnvironmentCubePixels(const FHDRImage& image, uint32_t size)
 {
     std::vector<float> pixels(static_cast<size_t>(size) * size * 6 * 4, 0.0f);
+
+    // 按行批量求经纬度：一行方向先写入 SoA，再用 SIMD 宽度的 FastAtan2 / FastAsin 一次算完
+    std::vector<float> dirX(size), dirY(size), dirZ(size), longitude(size), latitude(size);
     for (uint32_t face = 0; face < 6; ++face)
     {
         for (uint32_t y = 0; y < size; ++y)
         {
+            const float v = (static_cast<float>(y) + 0.5f) / static_cast<float>(size);
             for (uint32_t x = 0; x < size; ++x)
             {
                 const float u = (static_cast<float>(x) + 0.5f) / static_cast<float>(size);
-                const float v = (static_cast<float>(y) + 0.5f) / static_cast<float>(size);
                 const Vector3 dir = GetCubeFaceDirection(face, u, v);
+                dirX[x] = dir.X;
+                dirY[x] = dir.Y;
+                dirZ[x] = dir.Z;
+            }
+            Math::FastAtan2(dirZ, dirX, longitude);
+            Math::FastAsin(dirY, latitude);
+
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                const float sampleU = longitude[x] / Math::TWO_PI + 0.5f;
+                const float sampleV = 0.5f - latitude[x] / Math::PI;
                 const size_t pixelIndex = (static_cast<size_t>(face) * size * size) + (static_cast<size_t>(y) * size + x);
-                StoreRGBA(pixels, pixelIndex, SampleEquirectangularHDR(image, dir));
+                StoreRGBA(pixels, pixelIndex, SampleHDRBilinear(image, sampleU, sampleV));
             }
         }
     }
@@ -150,6 +166,25 @@ void BuildTangentBasis(const Vector3& n, Vector3& outTangent, Vector3& outBitang
 [[nodiscard]] std::vector<float> GenerateIrradianceCubePixels(const FHDRImage& image, uint32_t size)
 {
     std::vector<float> pixels(static_cast<size_t>(size) * size * 6 * 4, 0.0f);
+
+    // 采样角只取决于采样序号，与像素无关：sin / cos 表在进入像素循环前批量算好
+    std::array<float, IrradiancePhiSamples> phis{};
+    std::array<float, IrradiancePhiSamples> sinPhis{};
+    std::array<float, IrradiancePhiSamples> cosPhis{};
+    std::array<float, IrradianceThetaSamples> thetas{};
+    std::array<float, IrradianceThetaSamples> sinThetas{};
+    std::array<float, IrradianceThetaSamples> cosThetas{};
+    for (uint32_t phiIndex = 0; phiIndex < IrradiancePhiSamples; ++phiIndex)
+    {
+        phis[phiIndex] = (static_cast<float>(phiIndex) + 0.5f) / static_cast<float>(IrradiancePhiSamples) * Math::TWO_PI;
+    }
+    for (uint32_t thetaIndex = 0; thetaIndex < IrradianceThetaSamples; ++thetaIndex)
+    {
+        thetas[thetaIndex] = (static_cast<float>(thetaIndex) + 0.5f) / static_cast<float>(IrradianceThetaSamples) * Math::HALF_PI;
+    }
+    Math::FastSinCos(phis, sinPhis, cosPhis);
+    Math::FastSinCos(thetas, sinThetas, cosThetas);
+
     for (uint32_t face = 0; face < 6; ++face)
     {
         for (uint32_t y = 0; y < size; ++y)
@@ -167,15 +202,13 @@ void BuildTangentBasis(const Vector3& n, Vector3& outTangent, Vector3& outBitang
                 float weight = 0.0f;
                 for (uint32_t phiIndex = 0; phiIndex < IrradiancePhiSamples; ++phiIndex)
                 {
-                    const float phi = (static_cast<float>(phiIndex) + 0.5f) / static_cast<float>(IrradiancePhiSamples) * Math::TWO_PI;
                     for (uint32_t thetaIndex = 0; thetaIndex < IrradianceThetaSamples; ++thetaIndex)
                     {
-                        const float theta = (static_cast<float>(thetaIndex) + 0.5f) / static_cast<float>(IrradianceThetaSamples) * Math::HALF_PI;
-                        const float sinTheta = std::sin(theta);
-                        const float cosTheta = std::cos(theta);
-                        const Vector3 sampleDir = (tangent * (std::cos(phi) * sinTheta) +
-                                                   bitangent * (std::sin(phi) * sinTheta) +
-                                                   n * cosTheta).Normalize();
+                        const float sinTheta = sinThetas[thetaIndex];
+                        const float cosTheta = cosThetas[thetaIndex];
+                        const Vector3 sampleDir = tangent * (cosPhis[phiIndex] * sinTheta) +
+                                                  bitangent * (sinPhis[phiIndex] * sinTheta) +
+                                                  n * cosTheta;
                         const float sampleWeight = cosTheta * sinTheta;
                         irradiance += SampleEquirectangularHDR(image, sampleDir) * sampleWeight;
                         weight += sampleWeight;
@@ -218,9 +251,12 @@ float RadicalInverseVdc(uint32_t bits)
     Vector3 tangent;
     Vector3 bitangent;
     BuildTangentBasis(n, tangent, bitangent);
-    return (tangent * (std::cos(phi) * sinTheta) +
-            bitangent * (std::sin(phi) * sinTheta) +
-            n * cosTheta).Normalize();
+    float sinPhi = 0.0f;
+    float cosPhi = 0.0f;
+    Math::FastSinCos(phi, sinPhi, cosPhi);
+    return Math::FastNormalize(tangent * (cosPhi * sinTheta) +
+                               bitangent * (sinPhi * sinTheta) +
+                               n * cosTheta);
 }
 
 float GeometrySchlickGGX(float nDotV, float roughness)
@@ -345,7 +381,7 @@ std::unique_ptr<RHIBindGroupLayout> CreateEnvironmentTexturesLayout(RHIDevice* d
 
 bool BuildPipelineLayout(RHIDevice* device,
                          FPreparedPipeline& pipeline,
-                         std::vector<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>> layouts,
+                         TInlineArray<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>, RHIInlineBindGroups> layouts,
                          const char* debugName)
 {
     if (!device)
@@ -386,6 +422,10 @@ bool BuildPipelineLayout(RHIDevice* device,
 
 FRenderResourceManager::FRenderResourceManager(RHIDevice* device)
     : m_Device(device)
+    , m_StaticMeshRenderDataCache(MemoryTag::Renderer)
+    , m_StaticMeshMaterialTextureCache(MemoryTag::Renderer)
+    , m_TextureCache(MemoryTag::Renderer)
+    , m_PipelineCache(MemoryTag::Renderer)
 {
 }
 
@@ -909,7 +949,7 @@ bool FRenderResourceManager::BuildStaticMeshBasePassPipeline(FPreparedPipeline&
         return false;
     }
 
-    std::vector<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>> layouts;
+    TInlineArray<std::pair<uint32_t, std::unique_ptr<RHIBindGroupLayout>>, RHIInlineBindGroups> layouts;
     layouts.push_back({
         RendererBindGroups::LightBlock,
         CreateSingleUniformLayout(m_Device,
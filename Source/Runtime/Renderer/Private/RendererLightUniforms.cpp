@@ -8,9 +8,11 @@
 #include "RendererScene.h"
 #include "RHICommandBuffer.h"
 #include "RHIDevice.h"
+#include "Memory/FrameArena.h"
 
 #include <array>
 #include <cstdint>
+#include <new>
 
 namespace TE {
 
@@ -18,6 +20,9 @@ namespace {
 
 constexpr uint32_t MaxDirectionalLights = 4;
 constexpr uint32_t MaxPointLights = 8;
+
+} // namespace
+
 struct alignas(16) FLightBlockCPU
 {
     std::array<int32_t, 4> Counts = {0, 0, 0, 0};
@@ -29,6 +34,8 @@ struct alignas(16) FLightBlockCPU
 
 static_assert(sizeof(FLightBlockCPU) % 16 == 0);
 
+namespace {
+
 void FillLightBlockFromScene(const FScene* scene, FLightBlockCPU& outBlock)
 {
     uint32_t directionalCount = 0;
@@ -81,24 +88,34 @@ void FillLightBlockFromScene(const FScene* scene, FLightBlockCPU& outBlock)
 
 } // namespace
 
-bool UpdateAndBindSceneLightUniforms(const FScene* scene,
+const FLightBlockCPU* BuildSceneLightBlock(const FScene* scene)
+{
+    void* mem = FrameArena::Get().Allocate(sizeof(FLightBlockCPU), alignof(FLightBlockCPU));
+    if (!mem)
+    {
+        return nullptr;
+    }
+
+    auto* lightBlock = ::new (mem) FLightBlockCPU();
+    FillLightBlockFromScene(scene, *lightBlock);
+    return lightBlock;
+}
+
+bool UpdateAndBindSceneLightUniforms(const FLightBlockCPU* lightBlock,
                                      RHIDevice* device,
                                      RHICommandBuffer* cmdBuf,
                                      FLightUniformBindingState& state)
 {
-    if (!cmdBuf)
+    if (!cmdBuf || !lightBlock)
     {
         return false;
     }
 
-    FLightBlockCPU lightBlock;
-    FillLightBlockFromScene(scene, lightBlock);
-
     return AllocateAndBindTransientUniform(device,
                                            cmdBuf,
                                            state,
-                                           &lightBlock,
-                                           sizeof(lightBlock),
+                                           lightBlock,
+                                           sizeof(FLightBlockCPU),
                                            RendererBindGroups::LightBlock,
                                            RendererBindings::LightBlock,
                                            RHIShaderStage::Fragment,
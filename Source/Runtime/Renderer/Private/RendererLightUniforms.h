@@ -15,10 +15,14 @@ class FScene;
 class RHIBindGroupLayout;
 class RHICommandBuffer;
 class RHIDevice;
+struct FLightBlockCPU;
 
 struct FLightUniformBindingState : FTransientUniformBindingState {};
 
-bool UpdateAndBindSceneLightUniforms(const FScene* scene,
+// 每帧构建一次 LightBlock CPU 快照（位于 FrameArena，当前帧内有效），逐 draw 只做上传与绑定
+[[nodiscard]] const FLightBlockCPU* BuildSceneLightBlock(const FScene* scene);
+
+bool UpdateAndBindSceneLightUniforms(const FLightBlockCPU* lightBlock,
                                      RHIDevice* device,
                                      RHICommandBuffer* cmdBuf,
                                      FLightUniformBindingState& state);
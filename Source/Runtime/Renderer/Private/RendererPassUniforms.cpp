@@ -5,6 +5,7 @@
 
 #include "RendererBindingSlots.h"
 #include "RenderPathTypes.h"
+#include "Math/TransformBatch.h"
 #include "RHICommandBuffer.h"
 #include "RHIDevice.h"
 
@@ -71,11 +72,29 @@ Matrix4 ExpandNormalMatrixToMatrix4(const Matrix3& normalMatrix)
 
 } // namespace
 
+void BuildObjectTransformBatch(const TFrameArray<FMeshDrawCommand>& commands,
+                               const Matrix4& viewProjection,
+                               FObjectTransformBatch& outBatch)
+{
+    // 命令为 AoS 布局，先把 3x4 世界矩阵收集为连续数组再交给批量内核
+    TFrameArray<Matrix3x4> worldMatrices;
+    worldMatrices.reserve(commands.size());
+    for (const auto& cmd : commands)
+    {
+        worldMatrices.push_back(cmd.WorldMatrix);
+    }
+
+    outBatch.MVPs.resize(commands.size());
+    outBatch.NormalMatrices.resize(commands.size());
+    Math::MultiplyMatrices(viewProjection, worldMatrices, outBatch.MVPs);
+    Math::NormalMatrices(worldMatrices, outBatch.NormalMatrices);
+}
+
 bool UpdateAndBindObjectUniforms(RHIDevice* device,
                                  RHICommandBuffer* cmdBuf,
                                  FObjectUniformBindingState& state,
                                  const Matrix4& mvp,
-                                 const Matrix4& model,
+                                 const Matrix3x4& model,
                                  const Matrix3& normalMatrix)
 {
     if (!cmdBuf)
@@ -85,7 +104,7 @@ bool UpdateAndBindObjectUniforms(RHIDevice* device,
 
     FObjectBlockCPU objectBlock{};
     objectBlock.MVP = mvp;
-    objectBlock.Model = model;
+    objectBlock.Model = model.ToMatrix4();
     objectBlock.NormalMatrix = ExpandNormalMatrixToMatrix4(normalMatrix);
 
     return AllocateAndBindTransientUniform(device,
@@ -5,6 +5,8 @@
 
 #include "Material.h"
 #include "Math/MathTypes.h"
+#include "MeshDrawCommand.h"
+#include "Memory/FrameArena.h"
 #include "RendererTransientUniforms.h"
 
 #include <memory>
@@ -26,11 +28,25 @@ struct FMaterialUniformBindingState : FTransientUniformBindingState {};
 
 struct FSkyUniformBindingState : FTransientUniformBindingState {};
 
+/// <summary>
+/// 一批绘制命令的对象变换：MVP 与法线矩阵在提交循环之前用 Math::TransformBatch 批量计算，
+/// 下标与命令一一对应；数组分配自当前帧 arena
+/// </summary>
+struct FObjectTransformBatch
+{
+    TFrameArray<Matrix4> MVPs;
+    TFrameArray<Matrix3> NormalMatrices;
+};
+
+void BuildObjectTransformBatch(const TFrameArray<FMeshDrawCommand>& commands,
+                               const Matrix4& viewProjection,
+                               FObjectTransformBatch& outBatch);
+
 bool UpdateAndBindObjectUniforms(RHIDevice* device,
                                  RHICommandBuffer* cmdBuf,
                                  FObjectUniformBindingState& state,
                                  const Matrix4& mvp,
-                                 const Matrix4& model,
+                                 const Matrix3x4& model,
                                  const Matrix3& normalMatrix);
 
 bool UpdateAndBindDeferredPassUniforms(RHIDevice* device,
@@ -59,7 +59,7 @@ void FScene::RemovePrimitive(FPrimitiveComponentId primitiveComponentId)
                 primitiveComponentId.Value, m_PrimitiveStorage.size());
 }
 
-void FScene::UpdatePrimitiveTransform(FPrimitiveComponentId primitiveComponentId, const Matrix4& worldMatrix)
+void FScene::UpdatePrimitiveTransform(FPrimitiveComponentId primitiveComponentId, const Matrix3x4& worldMatrix)
 {
     if (!primitiveComponentId.IsValid())
     {
@@ -82,7 +82,7 @@ void FScene::UpdatePrimitiveTransform(FPrimitiveComponentId primitiveComponentId
 
 bool FScene::AddLight(const LightComponent* lightComponent,
                       FLightComponentId lightComponentId,
-                      std::unique_ptr<FLightSceneProxy> proxy)
+                      TPoolUniquePtr<FLightSceneProxy> proxy)
 {
     if (!lightComponent || !proxy || !lightComponentId.IsValid())
     {
@@ -98,7 +98,7 @@ bool FScene::AddLight(const LightComponent* lightComponent,
     return true;
 }
 
-void FScene::UpdateLight(FLightComponentId lightComponentId, std::unique_ptr<FLightSceneProxy> proxy)
+void FScene::UpdateLight(FLightComponentId lightComponentId, TPoolUniquePtr<FLightSceneProxy> proxy)
 {
     if (!lightComponentId.IsValid() || !proxy)
     {
@@ -111,8 +111,8 @@ void FScene::UpdateLight(FLightComponentId lightComponentId, std::unique_ptr<FLi
         return;
     }
 
-    it->second = std::move(proxy);
-    RebuildLightView();
+    // 原地覆盖：代理地址保持稳定，光源视图无需重建，新代理的槽位随即归还池
+    *it->second = *proxy;
 }
 
 void FScene::RemoveLight(FLightComponentId lightComponentId)
@@ -239,7 +239,7 @@ bool FScene::InsertPrimitive(FPrimitiveComponentId primitiveComponentId,
         return false;
     }
 
-    auto sceneInfo = std::make_unique<FPrimitiveSceneInfo>(primitiveComponentId, primitiveComponent, std::move(proxy));
+    auto sceneInfo = m_PrimitiveInfoPool.MakeUnique(primitiveComponentId, primitiveComponent, std::move(proxy));
     m_PrimitiveStorage[primitiveComponentId] = std::move(sceneInfo);
     RebuildPrimitiveView();
     TE_LOG_INFO("[Renderer] FScene::InsertPrimitive id={}, component={}, total primitives: {}",
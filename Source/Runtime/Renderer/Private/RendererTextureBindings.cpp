@@ -189,10 +189,35 @@ bool RebuildGBufferBindGroup(RHIDevice* device,
     return true;
 }
 
-bool RebuildMaterialTexturesBindGroup(RHIDevice* device,
-                                      FMaterialTextureBindingState& state,
-                                      const FPreparedMaterialTextures& textures,
-                                      RHISampler* sampler)
+void EvictLeastRecentlyUsedMaterialBindGroups(FMaterialTextureBindingState& state)
+{
+    // 从最久未用的开始淘汰，直到低于上限；工作集超过上限后缓存曾增长，换场景后在这里回落
+    while (state.BindGroups.size() >= FMaterialTextureBindingState::MaxCachedBindGroups)
+    {
+        auto oldest = state.BindGroups.end();
+        for (auto it = state.BindGroups.begin(); it != state.BindGroups.end(); ++it)
+        {
+            if (oldest == state.BindGroups.end() || it->second.LastUsedFrame < oldest->second.LastUsedFrame)
+            {
+                oldest = it;
+            }
+        }
+
+        // 最久未用的项也还在最近几帧里用过：整个工作集都在用，留着它们让缓存增长
+        if (oldest == state.BindGroups.end() ||
+            oldest->second.LastUsedFrame + FMaterialTextureBindingState::MinIdleFramesToEvict > state.Frame)
+        {
+            return;
+        }
+        state.BindGroups.erase(oldest);
+    }
+}
+
+RHIBindGroup* CreateMaterialTexturesBindGroup(RHIDevice* device,
+                                              FMaterialTextureBindingState& state,
+                                              const FMaterialTextureBindGroupKey& key,
+                                              const FPreparedMaterialTextures& textures,
+                                              RHISampler* sampler)
 {
     if (!device ||
         !textures.BaseColor ||
@@ -202,7 +227,7 @@ bool RebuildMaterialTexturesBindGroup(RHIDevice* device,
         !textures.AmbientOcclusion ||
         !textures.Emissive)
     {
-        return false;
+        return nullptr;
     }
 
     if (!state.Layout)
@@ -218,7 +243,7 @@ bool RebuildMaterialTexturesBindGroup(RHIDevice* device,
         state.Layout = device->CreateBindGroupLayout(layoutDesc);
         if (!state.Layout || !state.Layout->IsValid())
         {
-            return false;
+            return nullptr;
         }
     }
 
@@ -232,21 +257,22 @@ bool RebuildMaterialTexturesBindGroup(RHIDevice* device,
     bindGroupDesc.entries.push_back({RendererBindings::AOTexture, RHIBindingType::Texture2D, nullptr, 0, 0, textures.AmbientOcclusion.get(), sampler});
     bindGroupDesc.entries.push_back({RendererBindings::EmissiveTexture, RHIBindingType::Texture2D, nullptr, 0, 0, textures.Emissive.get(), sampler});
 
-    state.BindGroup = device->CreateBindGroup(bindGroupDesc);
-    if (!state.BindGroup || !state.BindGroup->IsValid())
+    auto bindGroup = device->CreateBindGroup(bindGroupDesc);
+    if (!bindGroup || !bindGroup->IsValid())
     {
-        state.BindGroup.reset();
-        return false;
+        return nullptr;
     }
 
-    state.BaseColor = textures.BaseColor.get();
-    state.Normal = textures.Normal.get();
-    state.Metallic = textures.Metallic.get();
-    state.Roughness = textures.Roughness.get();
-    state.AmbientOcclusion = textures.AmbientOcclusion.get();
-    state.Emissive = textures.Emissive.get();
-    state.Sampler = sampler;
-    return true;
+    EvictLeastRecentlyUsedMaterialBindGroups(state);
+
+    FCachedMaterialTextureBindGroup cached;
+    cached.Textures = {textures.BaseColor, textures.Normal, textures.Metallic,
+                       textures.Roughness, textures.AmbientOcclusion, textures.Emissive};
+    cached.BindGroup = std::move(bindGroup);
+    cached.LastUsedFrame = state.Frame;
+    RHIBindGroup* result = cached.BindGroup.get();
+    state.BindGroups.try_emplace(key, std::move(cached));
+    return result;
 }
 
 bool RebuildEnvironmentTexturesBindGroup(RHIDevice* device,
@@ -322,6 +348,12 @@ bool UpdateAndBindBaseColorTexture(RHIDevice* device,
     return true;
 }
 
+void BeginMaterialTextureBindingFrame(FMaterialTextureBindingState& state)
+{
+    ++state.Frame;
+    state.Current = nullptr;
+}
+
 bool UpdateAndBindMaterialTextures(RHIDevice* device,
                                    RHICommandBuffer* cmdBuf,
                                    FMaterialTextureBindingState& state,
@@ -333,22 +365,35 @@ bool UpdateAndBindMaterialTextures(RHIDevice* device,
         return false;
     }
 
-    if (!state.BindGroup ||
-        state.BaseColor != textures->BaseColor.get() ||
-        state.Normal != textures->Normal.get() ||
-        state.Metallic != textures->Metallic.get() ||
-        state.Roughness != textures->Roughness.get() ||
-        state.AmbientOcclusion != textures->AmbientOcclusion.get() ||
-        state.Emissive != textures->Emissive.get() ||
-        state.Sampler != sampler)
+    FMaterialTextureBindGroupKey key;
+    key.Textures = {textures->BaseColor.get(), textures->Normal.get(), textures->Metallic.get(),
+                    textures->Roughness.get(), textures->AmbientOcclusion.get(), textures->Emissive.get()};
+    key.Sampler = sampler;
+
+    // 连续绘制同一材质时不查表；切换材质时命中缓存，只有首次出现的纹理组合才创建 BindGroup
+    if (!state.Current || !(state.CurrentKey == key))
     {
-        if (!RebuildMaterialTexturesBindGroup(device, state, *textures, sampler))
+        RHIBindGroup* bindGroup = nullptr;
+        const auto found = state.BindGroups.find(key);
+        if (found != state.BindGroups.end())
+        {
+            found->second.LastUsedFrame = state.Frame;
+            bindGroup = found->second.BindGroup.get();
+        }
+        else
         {
+            bindGroup = CreateMaterialTexturesBindGroup(device, state, key, *textures, sampler);
+        }
+        if (!bindGroup)
+        {
+            state.Current = nullptr;
             return false;
         }
+        state.Current = bindGroup;
+        state.CurrentKey = key;
     }
 
-    cmdBuf->SetBindGroup(RendererBindGroups::MaterialTextures, state.BindGroup.get());
+    cmdBuf->SetBindGroup(RendererBindGroups::MaterialTextures, state.Current);
     return true;
 }
 
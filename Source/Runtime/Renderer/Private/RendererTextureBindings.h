@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include "Memory/FlatHashMap.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace TE {
@@ -25,17 +30,52 @@ struct FBaseColorTextureBindingState
     std::unique_ptr<RHIBindGroup> BindGroup;
 };
 
-struct FMaterialTextureBindingState
+// 材质纹理 BindGroup 的缓存键：6 张纹理（BaseColor / Normal / Metallic / Roughness / AO / Emissive）+ 采样器
+struct FMaterialTextureBindGroupKey
 {
-    RHITexture* BaseColor = nullptr;
-    RHITexture* Normal = nullptr;
-    RHITexture* Metallic = nullptr;
-    RHITexture* Roughness = nullptr;
-    RHITexture* AmbientOcclusion = nullptr;
-    RHITexture* Emissive = nullptr;
+    std::array<RHITexture*, 6> Textures{};
     RHISampler* Sampler = nullptr;
-    std::unique_ptr<RHIBindGroupLayout> Layout;
+
+    bool operator==(const FMaterialTextureBindGroupKey&) const = default;
+};
+
+struct FMaterialTextureBindGroupKeyHash
+{
+    [[nodiscard]] std::size_t operator()(const FMaterialTextureBindGroupKey& key) const
+    {
+        std::uintptr_t hash = reinterpret_cast<std::uintptr_t>(key.Sampler);
+        for (RHITexture* texture : key.Textures)
+        {
+            hash = (hash << 5 | hash >> (sizeof(hash) * 8 - 5)) ^ reinterpret_cast<std::uintptr_t>(texture);
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+struct FCachedMaterialTextureBindGroup
+{
+    // 持有纹理引用：缓存项存活期间纹理地址不会被复用，键不会误命中
+    std::array<std::shared_ptr<RHITexture>, 6> Textures;
     std::unique_ptr<RHIBindGroup> BindGroup;
+    // 最近一次绑定时的 FMaterialTextureBindingState::Frame，用于 LRU 淘汰
+    std::uint64_t LastUsedFrame = 0;
+};
+
+/// 按纹理组合缓存 BindGroup：多个材质交替绘制时稳态帧不再创建 BindGroup（不触碰堆）。
+/// 缓存项数达到 MaxCachedBindGroups 后，新建前按最久未用的顺序淘汰到上限以下（同时释放对纹理的引用）；
+/// 只淘汰已空闲 MinIdleFramesToEvict 帧以上的项，否则缓存越过上限继续增长，
+/// 因此纹理组合多于上限的静态场景在预热后仍然全部命中。
+struct FMaterialTextureBindingState
+{
+    static constexpr std::size_t MaxCachedBindGroups = 256;
+    // 大于任何 framesInFlight 配置：被淘汰的 BindGroup 不会仍被 GPU 上未完成的帧引用
+    static constexpr std::uint64_t MinIdleFramesToEvict = 8;
+
+    std::uint64_t Frame = 0;
+    FMaterialTextureBindGroupKey CurrentKey;
+    RHIBindGroup* Current = nullptr;
+    std::unique_ptr<RHIBindGroupLayout> Layout;
+    TFlatHashMap<FMaterialTextureBindGroupKey, FCachedMaterialTextureBindGroup, FMaterialTextureBindGroupKeyHash> BindGroups;
 };
 
 struct FGBufferTextureBindingState
@@ -66,6 +106,9 @@ bool UpdateAndBindBaseColorTexture(RHIDevice* device,
                                    RHITexture* texture,
                                    RHISampler* sampler);
 
+/// 每帧提交绘制前调用一次：推进帧序号并清掉“当前组合”快捷路径，让本帧首次绑定刷新 LRU 标记。
+void BeginMaterialTextureBindingFrame(FMaterialTextureBindingState& state);
+
 bool UpdateAndBindMaterialTextures(RHIDevice* device,
                                    RHICommandBuffer* cmdBuf,
                                    FMaterialTextureBindingState& state,
@@ -45,7 +45,7 @@ private:
     {
         std::unique_ptr<RHIShader> VertexShader;
         std::unique_ptr<RHIShader> FragmentShader;
-        std::vector<std::unique_ptr<RHIBindGroupLayout>> BindGroupLayouts;
+        TInlineArray<std::unique_ptr<RHIBindGroupLayout>, RHIInlineBindGroups> BindGroupLayouts;
         std::unique_ptr<RHIPipelineLayout> PipelineLayout;
         std::unique_ptr<RHIPipeline> Pipeline;
     };
@@ -56,8 +56,8 @@ private:
     [[nodiscard]] bool BuildGBufferPipeline(RHIDevice* device);
     [[nodiscard]] bool BuildLightingPipeline(RHIDevice* device);
 
-    void SortDrawCommands(std::vector<FMeshDrawCommand>& commands) const;
-    void SubmitGBufferPass(const std::vector<FMeshDrawCommand>& commands,
+    void SortDrawCommands(TFrameArray<FMeshDrawCommand>& commands) const;
+    void SubmitGBufferPass(const TFrameArray<FMeshDrawCommand>& commands,
                            const FScene* scene,
                            RHIDevice* device,
                            RHICommandBuffer* cmdBuf,
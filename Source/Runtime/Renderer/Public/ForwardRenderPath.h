@@ -6,6 +6,7 @@
 #include "IRenderPath.h"
 #include "MeshDrawCommand.h"
 #include "MeshPassProcessor.h"
+#include "RHITypes.h"
 
 #include <memory>
 #include <vector>
@@ -41,7 +42,7 @@ private:
     {
         std::unique_ptr<RHIShader> VertexShader;
         std::unique_ptr<RHIShader> FragmentShader;
-        std::vector<std::unique_ptr<RHIBindGroupLayout>> BindGroupLayouts;
+        TInlineArray<std::unique_ptr<RHIBindGroupLayout>, RHIInlineBindGroups> BindGroupLayouts;
         std::unique_ptr<RHIPipelineLayout> PipelineLayout;
         std::unique_ptr<RHIPipeline> Pipeline;
     };
@@ -50,8 +51,8 @@ private:
     [[nodiscard]] bool BuildSkyPipeline(RHIDevice* device);
     void SubmitSkyPass(const FScene* scene, RHIDevice* device, RHICommandBuffer* cmdBuf);
 
-    static void SortDrawCommands(std::vector<FMeshDrawCommand>& commands) ;
-    void SubmitDrawCommands(const std::vector<FMeshDrawCommand>& commands,
+    static void SortDrawCommands(TFrameArray<FMeshDrawCommand>& commands) ;
+    void SubmitDrawCommands(const TFrameArray<FMeshDrawCommand>& commands,
                             const FScene* scene,
                             RHIDevice* device,
                             RHICommandBuffer* cmdBuf,
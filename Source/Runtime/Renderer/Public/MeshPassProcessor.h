@@ -4,8 +4,7 @@
 #pragma once
 
 #include "MeshDrawCommand.h"
-
-#include <vector>
+#include "Memory/FrameArena.h"
 
 namespace TE {
 
@@ -16,7 +15,7 @@ class FMeshPassProcessor
 public:
     explicit FMeshPassProcessor(EMeshPassType passType);
 
-    void BuildDrawCommands(const FScene* scene, std::vector<FMeshDrawCommand>& outCommands) const;
+    void BuildDrawCommands(const FScene* scene, TFrameArray<FMeshDrawCommand>& outCommands) const;
 
 private:
     EMeshPassType m_PassType = EMeshPassType::BasePass;
@@ -7,10 +7,10 @@
 #include "RHIBindGroup.h"
 #include "RHIPipeline.h"
 #include "Material.h"
+#include "Memory/FlatHashMap.h"
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace TE {
@@ -32,7 +32,7 @@ struct FPreparedPipeline
 {
     std::unique_ptr<RHIShader> VertexShader;
     std::unique_ptr<RHIShader> FragmentShader;
-    std::vector<std::unique_ptr<RHIBindGroupLayout>> BindGroupLayouts;
+    TInlineArray<std::unique_ptr<RHIBindGroupLayout>, RHIInlineBindGroups> BindGroupLayouts;
     std::unique_ptr<RHIPipelineLayout> PipelineLayout;
     std::unique_ptr<RHIPipeline> Pipeline;
 };
@@ -87,10 +87,11 @@ private:
     [[nodiscard]] bool BuildStaticMeshBasePassPipeline(FPreparedPipeline& outPipeline);
 
     RHIDevice* m_Device = nullptr;
-    std::unordered_map<const StaticMesh*, std::weak_ptr<const FStaticMeshRenderData>> m_StaticMeshRenderDataCache;
-    std::unordered_map<const StaticMesh*, std::vector<FPreparedMaterialTextures>> m_StaticMeshMaterialTextureCache;
-    std::unordered_map<std::string, std::weak_ptr<RHITexture>> m_TextureCache;
-    std::unordered_map<FPipelineKey, FPreparedPipeline, FPipelineKeyHash> m_PipelineCache;
+    // 每个绘制命令都会查询以下缓存：扁平哈希表，查找不追链表节点
+    TFlatHashMap<const StaticMesh*, std::weak_ptr<const FStaticMeshRenderData>> m_StaticMeshRenderDataCache;
+    TFlatHashMap<const StaticMesh*, std::vector<FPreparedMaterialTextures>> m_StaticMeshMaterialTextureCache;
+    TFlatHashMap<std::string, std::weak_ptr<RHITexture>> m_TextureCache;
+    TFlatHashMap<FPipelineKey, FPreparedPipeline, FPipelineKeyHash> m_PipelineCache;
     std::shared_ptr<RHITexture> m_DefaultWhiteTexture;
     std::shared_ptr<RHITexture> m_DefaultBlackTexture;
     std::shared_ptr<RHITexture> m_DefaultNormalTexture;
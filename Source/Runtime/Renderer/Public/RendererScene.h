@@ -11,9 +11,9 @@
 #include "MeshDrawCommand.h"
 #include "RenderScene.h"
 #include "ViewInfo.h"
+#include "Memory/FlatHashMap.h"
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 namespace TE {
@@ -40,12 +40,12 @@ public:
                                     FPrimitiveComponentId primitiveComponentId,
                                     std::unique_ptr<FPrimitiveSceneProxy> proxy) override;
     void RemovePrimitive(FPrimitiveComponentId primitiveComponentId) override;
-    void UpdatePrimitiveTransform(FPrimitiveComponentId primitiveComponentId, const Matrix4& worldMatrix) override;
+    void UpdatePrimitiveTransform(FPrimitiveComponentId primitiveComponentId, const Matrix3x4& worldMatrix) override;
 
     [[nodiscard]] bool AddLight(const LightComponent* lightComponent,
                                 FLightComponentId lightComponentId,
-                                std::unique_ptr<FLightSceneProxy> proxy) override;
-    void UpdateLight(FLightComponentId lightComponentId, std::unique_ptr<FLightSceneProxy> proxy) override;
+                                TPoolUniquePtr<FLightSceneProxy> proxy) override;
+    void UpdateLight(FLightComponentId lightComponentId, TPoolUniquePtr<FLightSceneProxy> proxy) override;
     void RemoveLight(FLightComponentId lightComponentId) override;
 
     [[nodiscard]] const std::vector<FPrimitiveSceneProxy*>& GetPrimitives() const { return m_Primitives; }
@@ -72,8 +72,10 @@ private:
     void RebuildLightView();
 
     std::unique_ptr<FRenderResourceManager> m_RenderResourceManager;
-    std::unordered_map<FPrimitiveComponentId, std::unique_ptr<FPrimitiveSceneInfo>, FPrimitiveComponentIdHash> m_PrimitiveStorage;
-    std::unordered_map<FLightComponentId, std::unique_ptr<FLightSceneProxy>, FLightComponentIdHash> m_LightStorage;
+    // 须先于 m_PrimitiveStorage 声明：存储析构时节点归还到池
+    TPool<FPrimitiveSceneInfo> m_PrimitiveInfoPool{MemoryTag::Renderer};
+    TFlatHashMap<FPrimitiveComponentId, TPoolUniquePtr<FPrimitiveSceneInfo>, FPrimitiveComponentIdHash> m_PrimitiveStorage{MemoryTag::Renderer};
+    TFlatHashMap<FLightComponentId, TPoolUniquePtr<FLightSceneProxy>, FLightComponentIdHash> m_LightStorage{MemoryTag::Renderer};
     std::vector<FPrimitiveSceneProxy*> m_Primitives;
     std::vector<FLightSceneProxy*> m_Lights;
     FViewInfo m_ViewInfo;
@@ -18,7 +18,7 @@ void CameraComponent::LookAt(const Vector3& target, const Vector3& worldUp)
 
     // 相机约定：局部 -Z 为“看向前方”，因此直接从视图矩阵反解世界旋转。
     const Matrix4 view = Matrix4::LookAtRH(eye, target, worldUp);
-    const Transform worldTransform = Transform::FromMatrix(view.Inverse());
+    const Transform worldTransform = Transform::FromMatrix(view.InverseAffine());
     m_Transform.Rotation = worldTransform.Rotation.Normalize();
 }
 
@@ -35,9 +35,9 @@ LightComponent::~LightComponent()
     m_IsRegisteredToRenderScene = false;
 }
 
-std::unique_ptr<FLightSceneProxy> LightComponent::CreateLightSceneProxy() const
+TPoolUniquePtr<FLightSceneProxy> LightComponent::CreateLightSceneProxy() const
 {
-    auto proxy = std::make_unique<FLightSceneProxy>();
+    auto proxy = MakePoolUnique<FLightSceneProxy, MemoryTag::Renderer>();
     proxy->Color = m_Color;
     proxy->Intensity = m_Intensity;
     proxy->Direction = GetWorldForward();
@@ -100,14 +100,14 @@ Vector3 LightComponent::GetWorldForward() const
     return normalized.LengthSquared() > 0.0f ? normalized : Vector3::Forward;
 }
 
-std::unique_ptr<FLightSceneProxy> DirectionalLightComponent::CreateLightSceneProxy() const
+TPoolUniquePtr<FLightSceneProxy> DirectionalLightComponent::CreateLightSceneProxy() const
 {
     auto proxy = LightComponent::CreateLightSceneProxy();
     proxy->Type = ELightType::Directional;
     return proxy;
 }
 
-std::unique_ptr<FLightSceneProxy> PointLightComponent::CreateLightSceneProxy() const
+TPoolUniquePtr<FLightSceneProxy> PointLightComponent::CreateLightSceneProxy() const
 {
     auto proxy = LightComponent::CreateLightSceneProxy();
     proxy->Type = ELightType::Point;
@@ -57,7 +57,7 @@ void PrimitiveComponent::RegisterToRenderScene(IRenderScene* renderScene)
         return;
     }
 
-    proxy->SetWorldMatrix(GetWorldMatrix());
+    proxy->SetWorldMatrix(Matrix3x4(GetWorldMatrix()));
     if (!renderScene->AddPrimitive(this, m_PrimitiveComponentId, std::move(proxy)))
     {
         TE_LOG_WARN("[Scene] Render scene failed to add primitive");
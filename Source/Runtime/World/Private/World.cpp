@@ -6,11 +6,13 @@
 #include "LightComponent.h"
 #include "PrimitiveComponent.h"
 #include "Log/Log.h"
+#include "Math/TransformBatch.h"
+#include "Memory/MemoryScope.h"
 #include <algorithm>
 
 namespace TE {
 
-Actor* World::AddActor(std::unique_ptr<Actor> actor)
+Actor* World::AddActor(TPoolUniquePtr<Actor> actor)
 {
     if (!actor)
     {
@@ -52,6 +54,8 @@ Actor* World::AddActor(std::unique_ptr<Actor> actor)
 
 void World::Tick(float deltaTime)
 {
+    TE_MEMORY_SCOPE(Scene);
+
     // 遍历所有 Actor 更新逻辑
     for (auto& actor : m_Actors)
     {
@@ -65,14 +69,35 @@ void World::SyncToScene()
         return;
 
     // 遍历所有已注册的 PrimitiveComponent
-    // 如果标记为脏，将 WorldMatrix 同步到渲染场景接口
+    // 如果标记为脏，收集其 TRS 分量，批量计算 WorldMatrix 后同步到渲染场景接口
+    m_DirtyPrimitives.clear();
+    m_DirtyPositions.clear();
+    m_DirtyRotations.clear();
+    m_DirtyScales.clear();
     for (auto* comp : m_PrimitiveComponents)
     {
         if (comp->IsRenderStateDirty() && comp->IsRegisteredToRenderScene())
+        {
+            // 与 SceneComponent::GetWorldMatrix 一致：当前简化版的世界矩阵即自身 Transform
+            const Transform& transform = comp->GetTransform();
+            m_DirtyPrimitives.push_back(comp);
+            m_DirtyPositions.push_back(transform.Position);
+            m_DirtyRotations.push_back(transform.Rotation);
+            m_DirtyScales.push_back(transform.Scale);
+        }
+    }
+
+    if (!m_DirtyPrimitives.empty())
+    {
+        m_DirtyWorldMatrices.resize(m_DirtyPrimitives.size());
+        Math::TransformsToMatrices(m_DirtyPositions, m_DirtyRotations, m_DirtyScales, m_DirtyWorldMatrices);
+
+        for (size_t i = 0; i < m_DirtyPrimitives.size(); ++i)
         {
             // 单线程版本：直接更新（安全）
             // 将来双线程：改为 Enqueue 命令
-            m_RenderScene->UpdatePrimitiveTransform(comp->GetPrimitiveComponentId(), comp->GetWorldMatrix());
+            PrimitiveComponent* comp = m_DirtyPrimitives[i];
+            m_RenderScene->UpdatePrimitiveTransform(comp->GetPrimitiveComponentId(), m_DirtyWorldMatrices[i]);
             comp->ClearRenderStateDirty();
         }
     }
@@ -9,6 +9,7 @@
 
 #include "Component.h"
 #include "Math/Transform.h"
+#include "Memory/MemoryNew.h"
 #include <vector>
 #include <memory>
 #include <string>
@@ -25,7 +26,7 @@ class SceneComponent;
 /// - 拥有多个 Component 列表
 ///
 /// ToyEngine 简化版：
-/// - 持有 Component 列表（vector of unique_ptr<TComponent>）
+/// - 持有 Component 列表（vector of TPoolUniquePtr<TComponent>，按组件类型走对象池）
 /// - 第一个 TSceneComponent 自动成为 RootComponent
 /// - Tick() 遍历所有组件调用其 Tick()
 class Actor
@@ -42,7 +43,7 @@ public:
     template<typename T, typename... Args>
     [[nodiscard]] T* AddComponent(Args&&... args)
     {
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
+        auto component = MakePoolUnique<T, MemoryTag::Scene>(std::forward<Args>(args)...);
         T* ptr = component.get();
         ptr->SetOwner(this);
 
@@ -63,7 +64,7 @@ public:
     virtual void Tick(float deltaTime);
 
     /// 获取所有组件
-    [[nodiscard]] const std::vector<std::unique_ptr<Component>>& GetComponents() const { return m_Components; }
+    [[nodiscard]] const std::vector<TPoolUniquePtr<Component>>& GetComponents() const { return m_Components; }
 
     /// 获取 RootComponent 的 Transform（Actor 的位置/旋转/缩放）
     [[nodiscard]] Transform& GetTransform();
@@ -78,7 +79,7 @@ public:
     [[nodiscard]] const std::string& GetName() const { return m_Name; }
 
 private:
-    std::vector<std::unique_ptr<Component>>    m_Components;
+    std::vector<TPoolUniquePtr<Component>>     m_Components;
     SceneComponent*                            m_RootComponent = nullptr;
     std::string                                 m_Name;
 
@@ -5,6 +5,7 @@
 
 #include "LightComponentId.h"
 #include "LightSceneProxy.h"
+#include "Memory/MemoryNew.h"
 #include "RenderScene.h"
 #include "SceneComponent.h"
 
@@ -18,7 +19,7 @@ public:
     LightComponent();
     ~LightComponent() override;
 
-    [[nodiscard]] virtual std::unique_ptr<FLightSceneProxy> CreateLightSceneProxy() const;
+    [[nodiscard]] virtual TPoolUniquePtr<FLightSceneProxy> CreateLightSceneProxy() const;
 
     void RegisterToRenderScene(IRenderScene* renderScene);
     void UnregisterFromRenderScene(IRenderScene* renderScene);
@@ -52,7 +53,7 @@ public:
     DirectionalLightComponent() = default;
     ~DirectionalLightComponent() override = default;
 
-    [[nodiscard]] std::unique_ptr<FLightSceneProxy> CreateLightSceneProxy() const override;
+    [[nodiscard]] TPoolUniquePtr<FLightSceneProxy> CreateLightSceneProxy() const override;
 };
 
 class PointLightComponent final : public LightComponent
@@ -64,7 +65,7 @@ public:
     void SetAttenuationRadius(float radius) { m_AttenuationRadius = radius; MarkLightStateDirty(); }
     [[nodiscard]] float GetAttenuationRadius() const { return m_AttenuationRadius; }
 
-    [[nodiscard]] std::unique_ptr<FLightSceneProxy> CreateLightSceneProxy() const override;
+    [[nodiscard]] TPoolUniquePtr<FLightSceneProxy> CreateLightSceneProxy() const override;
 
 private:
     float m_AttenuationRadius = 10.0f;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Math/MathTypes.h"
+#include "Memory/MemoryNew.h"
 #include "LightComponentId.h"
 #include "PrimitiveComponentId.h"
 
@@ -26,13 +27,13 @@ public:
     [[nodiscard]] virtual bool AddPrimitive(const PrimitiveComponent* primitiveComponent,
                                             FPrimitiveComponentId primitiveComponentId,
                                             std::unique_ptr<FPrimitiveSceneProxy> proxy) = 0;
-    virtual void UpdatePrimitiveTransform(FPrimitiveComponentId primitiveComponentId, const Matrix4& worldMatrix) = 0;
+    virtual void UpdatePrimitiveTransform(FPrimitiveComponentId primitiveComponentId, const Matrix3x4& worldMatrix) = 0;
     virtual void RemovePrimitive(FPrimitiveComponentId primitiveComponentId) = 0;
 
     [[nodiscard]] virtual bool AddLight(const LightComponent* lightComponent,
                                         FLightComponentId lightComponentId,
-                                        std::unique_ptr<FLightSceneProxy> proxy) = 0;
-    virtual void UpdateLight(FLightComponentId lightComponentId, std::unique_ptr<FLightSceneProxy> proxy) = 0;
+                                        TPoolUniquePtr<FLightSceneProxy> proxy) = 0;
+    virtual void UpdateLight(FLightComponentId lightComponentId, TPoolUniquePtr<FLightSceneProxy> proxy) = 0;
     virtual void RemoveLight(FLightComponentId lightComponentId) = 0;
 };
 
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "Actor.h"
+#include "Math/MathTypes.h"
+#include "Memory/MemoryNew.h"
 #include "RenderScene.h"
 
 #include <memory>
@@ -24,12 +26,14 @@ public:
     World(const World&) = delete;
     World& operator=(const World&) = delete;
 
-    Actor* AddActor(std::unique_ptr<Actor> actor);
+    /// 接管 Actor（也接受 std::unique_ptr，按普通 delete 释放）
+    Actor* AddActor(TPoolUniquePtr<Actor> actor);
 
+    /// 在 Actor 类型对应的对象池中构造并加入世界
     template<typename T = Actor, typename... Args>
     [[nodiscard]] T* SpawnActor(Args&&... args)
     {
-        auto actor = std::make_unique<T>(std::forward<Args>(args)...);
+        auto actor = MakePoolUnique<T, MemoryTag::Scene>(std::forward<Args>(args)...);
         T* ptr = actor.get();
         AddActor(std::move(actor));
         return ptr;
@@ -45,13 +49,20 @@ public:
 
     void SetRenderScene(IRenderScene* renderScene) { m_RenderScene = renderScene; }
 
-    [[nodiscard]] const std::vector<std::unique_ptr<Actor>>& GetActors() const { return m_Actors; }
+    [[nodiscard]] const std::vector<TPoolUniquePtr<Actor>>& GetActors() const { return m_Actors; }
 
 private:
-    std::vector<std::unique_ptr<Actor>> m_Actors;
+    std::vector<TPoolUniquePtr<Actor>> m_Actors;
     std::vector<PrimitiveComponent*> m_PrimitiveComponents;
     std::vector<LightComponent*> m_LightComponents;
     IRenderScene* m_RenderScene = nullptr;
+
+    // SyncToScene 的批量变换暂存（SoA），跨帧复用容量，稳态下不再分配
+    std::vector<PrimitiveComponent*> m_DirtyPrimitives;
+    std::vector<Vector3> m_DirtyPositions;
+    std::vector<Quat> m_DirtyRotations;
+    std::vector<Vector3> m_DirtyScales;
+    std::vector<Matrix3x4> m_DirtyWorldMatrices;
 };
 
 } // namespace TE
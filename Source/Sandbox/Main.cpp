@@ -238,13 +238,13 @@ void SetupSandboxScene(TE::Engine& engine)
         TE_LOG_WARN("[Sandbox] Texture files not found: {} or {}", pbrDir, textureA);
     }
 
-    auto meshActor = std::make_unique<TE::Actor>();
+    auto meshActor = TE::MakePoolUnique<TE::Actor, TE::MemoryTag::Scene>();
     meshActor->SetName("MeshActor");
     auto* meshComp = meshActor->AddComponent<TE::MeshComponent>();
     meshComp->SetName("ModelMesh");
     meshComp->SetStaticMesh(loadedMesh);
 
-    auto meshActorTop = std::make_unique<TE::Actor>();
+    auto meshActorTop = TE::MakePoolUnique<TE::Actor, TE::MemoryTag::Scene>();
     meshActorTop->SetName("MeshActorTop");
     auto* meshCompTop = meshActorTop->AddComponent<TE::MeshComponent>();
     meshCompTop->SetName("ModelMeshTop");
@@ -254,7 +254,7 @@ void SetupSandboxScene(TE::Engine& engine)
 
     const TE::Vector3 pointLightPosition(2.0f, 1.4f, 2.5f);
 
-    auto pointLightMarkerActor = std::make_unique<TE::Actor>();
+    auto pointLightMarkerActor = TE::MakePoolUnique<TE::Actor, TE::MemoryTag::Scene>();
     pointLightMarkerActor->SetName("PointLightMarkerActor");
     auto* pointLightMarkerComp = pointLightMarkerActor->AddComponent<TE::MeshComponent>();
     pointLightMarkerComp->SetName("PointLightMarkerMesh");
@@ -262,7 +262,7 @@ void SetupSandboxScene(TE::Engine& engine)
     pointLightMarkerComp->SetScale(TE::Vector3(1.0f / 3.0f, 1.0f / 3.0f, 1.0f / 3.0f));
     pointLightMarkerComp->SetPosition(pointLightPosition);
 
-    auto cameraActor = std::make_unique<TE::Actor>();
+    auto cameraActor = TE::MakePoolUnique<TE::Actor, TE::MemoryTag::Scene>();
     cameraActor->SetName("CameraActor");
     auto* cameraComp = cameraActor->AddComponent<TE::CameraComponent>();
     cameraComp->SetName("MainCamera");
@@ -286,7 +286,7 @@ void SetupSandboxScene(TE::Engine& engine)
     flyCamCtrl->SetInputManager(engine.GetInputManager());
     flyCamCtrl->SetWindow(engine.GetWindow());
 
-    auto directionalLightActor = std::make_unique<TE::Actor>();
+    auto directionalLightActor = TE::MakePoolUnique<TE::Actor, TE::MemoryTag::Scene>();
     directionalLightActor->SetName("DirectionalLightActor");
     auto* directionalLight = directionalLightActor->AddComponent<TE::DirectionalLightComponent>();
     directionalLight->SetName("MainDirectionalLight");
@@ -294,7 +294,7 @@ void SetupSandboxScene(TE::Engine& engine)
     directionalLight->SetIntensity(5.0f);
     directionalLight->GetTransform().SetForwardRH(TE::Vector3(0.5f, 1.0f, 0.8f).Normalize());
 
-    auto pointLightActor = std::make_unique<TE::Actor>();
+    auto pointLightActor = TE::MakePoolUnique<TE::Actor, TE::MemoryTag::Scene>();
     pointLightActor->SetName("PointLightActor");
     auto* pointLight = pointLightActor->AddComponent<TE::PointLightComponent>();
     pointLight->SetName("WarmPointLight");
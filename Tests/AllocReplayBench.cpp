@@ -0,0 +1,614 @@
+// ToyEngine - 分配轨迹回放基准
+// 读取 MemoryTrace 录制的二进制轨迹（以 TE_MEMORY_TRACE=<路径> 运行 Sandbox 即可录制），按时间顺序回放到
+// 各分配器后端（TLSF 直连 / TLSF + 线程缓存 / 系统 malloc），报告吞吐、峰值 RSS 与碎片率。
+// 用法：AllocReplayBench [轨迹文件]；不带参数时先录制一段内置的多线程合成负载再回放。
+//
+// 回放是单线程的：多线程轨迹按时间戳合并为一条序列，跨线程释放自然保持先后关系。
+// Linux 下每个后端在 fork 出的子进程中回放，峰值 RSS 互不影响。
+#include "Memory/Memory.h"
+#include "Memory/MemoryTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::uint32_t NoSlot = ~0u;
+constexpr std::size_t RssSampleInterval = 4096;
+
+// 预处理后的回放操作：轨迹中的指针换成连续槽位下标，计时循环内不再查表
+struct ReplayOp
+{
+    TE::MemoryTraceOp Op = TE::MemoryTraceOp::Alloc;
+    TE::MemoryTag Tag = TE::MemoryTag::Unknown;
+    std::uint32_t Slot = NoSlot;    // 结果所在槽位（Free 为被释放的槽位）
+    std::uint32_t OldSlot = NoSlot; // Realloc 的原槽位
+    std::uint32_t Align = 0;
+    std::uint64_t Size = 0;
+    std::uint64_t OldSize = 0;      // Realloc 原块大小（系统分配器对齐 realloc 需要）
+};
+
+struct ReplayTrace
+{
+    std::vector<ReplayOp> Ops;
+    std::uint32_t SlotCount = 0;
+    std::uint32_t ThreadCount = 0;
+    std::uint64_t PeakLiveBytes = 0; // 轨迹本身（请求字节）的峰值存活量
+    std::uint64_t SkippedEvents = 0; // 无法配对的释放（录制开始前分配的块）
+};
+
+struct ReplayResult
+{
+    double Seconds = 0.0;
+    std::uint64_t PeakRssBytes = 0; // 相对回放开始时的增量
+    std::uint64_t Failures = 0;
+};
+
+std::uint64_t ReadRssBytes()
+{
+#if defined(__linux__)
+    std::FILE* f = std::fopen("/proc/self/statm", "r");
+    if (!f)
+    {
+        return 0;
+    }
+    unsigned long long pages = 0;
+    unsigned long long resident = 0;
+    const int read = std::fscanf(f, "%llu %llu", &pages, &resident);
+    std::fclose(f);
+    return read == 2 ? resident * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+
+bool LoadTrace(const char* path, std::vector<TE::MemoryTraceEvent>& outEvents)
+{
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f)
+    {
+        std::cerr << "[AllocReplayBench] cannot open " << path << "\n";
+        return false;
+    }
+
+    TE::MemoryTraceFileHeader header;
+    if (std::fread(&header, sizeof(header), 1, f) != 1 || header.Magic != TE::MemoryTraceMagic ||
+        header.Version != TE::MemoryTraceVersion || header.EventBytes != sizeof(TE::MemoryTraceEvent))
+    {
+        std::cerr << "[AllocReplayBench] " << path << " is not a v" << TE::MemoryTraceVersion << " memory trace\n";
+        std::fclose(f);
+        return false;
+    }
+
+    TE::MemoryTraceEvent event;
+    while (std::fread(&event, sizeof(event), 1, f) == 1)
+    {
+        outEvents.push_back(event);
+    }
+    std::fclose(f);
+    return true;
+}
+
+ReplayTrace BuildReplay(std::vector<TE::MemoryTraceEvent>& events)
+{
+    // 各线程缓冲分批写出，按时间戳合并；同一时间戳上释放排在分配之前
+    std::stable_sort(events.begin(), events.end(), [](const auto& a, const auto& b) {
+        if (a.TimestampNs != b.TimestampNs)
+        {
+            return a.TimestampNs < b.TimestampNs;
+        }
+        return a.Op == TE::MemoryTraceOp::Free && b.Op != TE::MemoryTraceOp::Free;
+    });
+
+    struct LiveBlock
+    {
+        std::uint32_t Slot = NoSlot;
+        std::uint64_t Size = 0;
+    };
+
+    ReplayTrace trace;
+    trace.Ops.reserve(events.size());
+
+    // 同一地址可能因 realloc 的时间戳取在调用开始而短暂重叠，按 FIFO 配对
+    std::unordered_map<std::uint64_t, std::deque<LiveBlock>> live;
+    std::vector<std::uint32_t> freeSlots;
+    std::uint64_t liveBytes = 0;
+
+    auto takeLive = [&live](std::uint64_t ptr, LiveBlock& out) {
+        auto it = live.find(ptr);
+        if (it == live.end())
+        {
+            return false;
+        }
+        out = it->second.front();
+        it->second.pop_front();
+        if (it->second.empty())
+        {
+            live.erase(it);
+        }
+        return true;
+    };
+    auto newSlot = [&trace, &freeSlots]() {
+        if (!freeSlots.empty())
+        {
+            const std::uint32_t slot = freeSlots.back();
+            freeSlots.pop_back();
+            return slot;
+        }
+        return trace.SlotCount++;
+    };
+
+    for (const auto& e : events)
+    {
+        trace.ThreadCount = std::max<std::uint32_t>(trace.ThreadCount, e.ThreadId + 1u);
+
+        ReplayOp op;
+        op.Op = e.Op;
+        op.Tag = e.Tag;
+        op.Align = e.Align;
+        op.Size = e.Size;
+
+        switch (e.Op)
+        {
+        case TE::MemoryTraceOp::Alloc:
+        {
+            op.Slot = newSlot();
+            live[e.Ptr].push_back({ op.Slot, e.Size });
+            liveBytes += e.Size;
+            break;
+        }
+        case TE::MemoryTraceOp::Free:
+        {
+            LiveBlock block;
+            if (!takeLive(e.Ptr, block))
+            {
+                ++trace.SkippedEvents;
+                continue;
+            }
+            op.Slot = block.Slot;
+            freeSlots.push_back(block.Slot);
+            liveBytes -= block.Size;
+            break;
+        }
+        case TE::MemoryTraceOp::Realloc:
+        {
+            LiveBlock block;
+            if (e.OldPtr != 0)
+            {
+                if (!takeLive(e.OldPtr, block))
+                {
+                    ++trace.SkippedEvents;
+                    continue;
+                }
+                op.OldSlot = block.Slot;
+                op.OldSize = block.Size;
+                liveBytes -= block.Size;
+            }
+            if (e.Ptr != 0)
+            {
+                // 结果沿用原槽位（原地或搬移都由回放方的 realloc 决定）
+                op.Slot = (op.OldSlot != NoSlot) ? op.OldSlot : newSlot();
+                live[e.Ptr].push_back({ op.Slot, e.Size });
+                liveBytes += e.Size;
+            }
+            else if (op.OldSlot != NoSlot)
+            {
+                freeSlots.push_back(op.OldSlot);
+            }
+            break;
+        }
+        }
+
+        trace.PeakLiveBytes = std::max(trace.PeakLiveBytes, liveBytes);
+        trace.Ops.push_back(op);
+    }
+    return trace;
+}
+
+// ==================== 后端 ====================
+
+struct Backend
+{
+    const char* Name;
+    void (*Setup)();
+    void (*Teardown)();
+    void* (*Alloc)(std::size_t size, std::size_t align, TE::MemoryTag tag);
+    void* (*Realloc)(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t align, TE::MemoryTag tag);
+    void (*Free)(void* ptr, std::size_t align);
+};
+
+void* EngineAlloc(std::size_t size, std::size_t align, TE::MemoryTag tag)
+{
+    return TE::MemAlignedAlloc(size, align, tag);
+}
+
+void* EngineRealloc(void* ptr, std::size_t /*oldSize*/, std::size_t newSize, std::size_t align, TE::MemoryTag tag)
+{
+    return TE::MemAlignedRealloc(ptr, newSize, align, tag);
+}
+
+void EngineFree(void* ptr, std::size_t /*align*/)
+{
+    TE::MemFree(ptr);
+}
+
+void SetupTlsfLocked()
+{
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+    TE::MemorySetThreadCacheEnabled(false);
+}
+
+void SetupTlsfCached()
+{
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+    TE::MemorySetThreadCacheEnabled(true);
+}
+
+void TeardownEngine()
+{
+    TE::MemoryShutdown();
+    TE::MemorySetThreadCacheEnabled(true);
+}
+
+void SetupNothing()
+{
+}
+
+bool NeedsSystemAlignedPath(std::size_t align)
+{
+    return align > alignof(std::max_align_t);
+}
+
+void* SystemAlloc(std::size_t size, std::size_t align, TE::MemoryTag /*tag*/)
+{
+    if (!NeedsSystemAlignedPath(align))
+    {
+        return std::malloc(size);
+    }
+#if defined(_WIN32)
+    return _aligned_malloc(size, align);
+#else
+    void* p = nullptr;
+    return posix_memalign(&p, align, size) == 0 ? p : nullptr;
+#endif
+}
+
+void SystemFree(void* ptr, std::size_t align)
+{
+#if defined(_WIN32)
+    if (NeedsSystemAlignedPath(align))
+    {
+        _aligned_free(ptr);
+        return;
+    }
+#else
+    (void)align;
+#endif
+    std::free(ptr);
+}
+
+void* SystemRealloc(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t align, TE::MemoryTag tag)
+{
+    if (!NeedsSystemAlignedPath(align))
+    {
+        return std::realloc(ptr, newSize);
+    }
+    void* p = SystemAlloc(newSize, align, tag);
+    if (p && ptr)
+    {
+        std::memcpy(p, ptr, std::min(oldSize, newSize));
+        SystemFree(ptr, align);
+    }
+    return p;
+}
+
+const Backend kBackends[] = {
+    { "TLSF (locked)",       &SetupTlsfLocked, &TeardownEngine, &EngineAlloc, &EngineRealloc, &EngineFree },
+    { "TLSF + thread cache", &SetupTlsfCached, &TeardownEngine, &EngineAlloc, &EngineRealloc, &EngineFree },
+    { "system malloc",       &SetupNothing,    &SetupNothing,   &SystemAlloc, &SystemRealloc, &SystemFree },
+};
+
+// 每页写一个字节，让新分配的块真正驻留（否则 RSS 只反映分配器元数据）
+void TouchPages(void* p, std::uint64_t size)
+{
+    if (!p || size == 0)
+    {
+        return;
+    }
+    auto* bytes = static_cast<volatile std::uint8_t*>(p);
+    for (std::uint64_t offset = 0; offset < size; offset += 4096)
+    {
+        bytes[offset] = 1;
+    }
+    bytes[size - 1] = 1;
+}
+
+// touchPages = false：只测吞吐；true：写入每页以测峰值 RSS 与碎片率（两者分开回放，互不干扰）
+ReplayResult Replay(const ReplayTrace& trace, const Backend& backend, bool touchPages)
+{
+    std::vector<void*> slots(trace.SlotCount, nullptr);
+    std::vector<std::uint32_t> slotAlign(trace.SlotCount, 0);
+    ReplayResult result;
+
+    backend.Setup();
+    const std::uint64_t baseRss = ReadRssBytes();
+    std::uint64_t peakRss = baseRss;
+
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < trace.Ops.size(); ++i)
+    {
+        const ReplayOp& op = trace.Ops[i];
+        switch (op.Op)
+        {
+        case TE::MemoryTraceOp::Alloc:
+            slots[op.Slot] = backend.Alloc(op.Size, op.Align, op.Tag);
+            if (touchPages)
+            {
+                TouchPages(slots[op.Slot], op.Size);
+            }
+            slotAlign[op.Slot] = op.Align;
+            result.Failures += slots[op.Slot] ? 0 : 1;
+            break;
+        case TE::MemoryTraceOp::Free:
+            backend.Free(slots[op.Slot], slotAlign[op.Slot]);
+            slots[op.Slot] = nullptr;
+            break;
+        case TE::MemoryTraceOp::Realloc:
+        {
+            void* old = (op.OldSlot != NoSlot) ? slots[op.OldSlot] : nullptr;
+            void* p = backend.Realloc(old, op.OldSize, op.Size, op.Align, op.Tag);
+            if (op.OldSlot != NoSlot)
+            {
+                slots[op.OldSlot] = nullptr;
+            }
+            if (op.Slot != NoSlot)
+            {
+                slots[op.Slot] = p;
+                if (touchPages && op.Size > op.OldSize)
+                {
+                    TouchPages(p, op.Size);
+                }
+                slotAlign[op.Slot] = op.Align;
+                result.Failures += p ? 0 : 1;
+            }
+            break;
+        }
+        }
+
+        if (touchPages && (i % RssSampleInterval) == 0)
+        {
+            peakRss = std::max(peakRss, ReadRssBytes());
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    peakRss = std::max(peakRss, ReadRssBytes());
+
+    result.Seconds = std::chrono::duration<double>(end - begin).count();
+    result.PeakRssBytes = peakRss - baseRss;
+
+    // 轨迹结束时仍存活的块（录制时未释放）在计时外统一归还
+    for (std::uint32_t s = 0; s < trace.SlotCount; ++s)
+    {
+        if (!slots[s])
+        {
+            continue;
+        }
+        backend.Free(slots[s], slotAlign[s]);
+    }
+    backend.Teardown();
+    return result;
+}
+
+ReplayResult ReplayIsolated(const ReplayTrace& trace, const Backend& backend, bool touchPages)
+{
+#if defined(__linux__)
+    // 子进程会继承未写出的输出缓冲
+    std::cout.flush();
+    std::fflush(stdout);
+
+    int fds[2];
+    if (pipe(fds) == 0)
+    {
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            close(fds[0]);
+            const ReplayResult r = Replay(trace, backend, touchPages);
+            const ssize_t written = write(fds[1], &r, sizeof(r));
+            _exit(written == static_cast<ssize_t>(sizeof(r)) ? 0 : 1);
+        }
+        close(fds[1]);
+        if (pid > 0)
+        {
+            ReplayResult r;
+            const ssize_t got = read(fds[0], &r, sizeof(r));
+            close(fds[0]);
+            int status = 0;
+            waitpid(pid, &status, 0);
+            if (got == static_cast<ssize_t>(sizeof(r)) && WIFEXITED(status) && WEXITSTATUS(status) == 0)
+            {
+                return r;
+            }
+            std::cerr << "[AllocReplayBench] child replay for " << backend.Name << " failed, rerunning in-process\n";
+        }
+        else
+        {
+            close(fds[0]);
+        }
+    }
+#endif
+    return Replay(trace, backend, touchPages);
+}
+
+// ==================== 合成负载（无轨迹文件时） ====================
+
+struct XorShift
+{
+    std::uint64_t State;
+
+    std::uint64_t Next()
+    {
+        State ^= State << 13;
+        State ^= State >> 7;
+        State ^= State << 17;
+        return State;
+    }
+
+    std::size_t Range(std::size_t lo, std::size_t hi) { return lo + static_cast<std::size_t>(Next() % (hi - lo + 1)); }
+};
+
+// 近似 Sandbox 的分配形态：大量短命小对象、按帧重建的中等缓冲、少量长期大块与按倍增 realloc 的数组
+void SyntheticWorker(std::uint64_t seed, int frames)
+{
+    XorShift rng{ seed * 0x9E3779B97F4A7C15ull + 1 };
+    std::vector<void*> longLived;
+    void* growable = nullptr;
+    std::size_t growableBytes = 0;
+
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        void* transient[256];
+        const std::size_t transientCount = rng.Range(64, 256);
+        for (std::size_t i = 0; i < transientCount; ++i)
+        {
+            transient[i] = TE::MemAlloc(rng.Range(16, 512), TE::MemoryTag::Scene);
+        }
+
+        void* staging = TE::MemAlignedAlloc(rng.Range(4 * 1024, 64 * 1024), 256, TE::MemoryTag::RHI);
+
+        if (rng.Range(0, 9) == 0)
+        {
+            longLived.push_back(TE::MemAlloc(rng.Range(64 * 1024, 2 * 1024 * 1024), TE::MemoryTag::Asset));
+        }
+        if (longLived.size() > 24)
+        {
+            const std::size_t victim = rng.Range(0, longLived.size() - 1);
+            TE::MemFree(longLived[victim]);
+            longLived[victim] = longLived.back();
+            longLived.pop_back();
+        }
+
+        growableBytes = (growableBytes == 0 || growableBytes > 256 * 1024) ? 64 : growableBytes * 2;
+        growable = TE::MemRealloc(growable, growableBytes, TE::MemoryTag::Renderer);
+
+        TE::MemFree(staging);
+        for (std::size_t i = 0; i < transientCount; ++i)
+        {
+            TE::MemFree(transient[i]);
+        }
+    }
+
+    TE::MemFree(growable);
+    for (void* p : longLived)
+    {
+        TE::MemFree(p);
+    }
+}
+
+bool RecordSyntheticTrace(const char* path)
+{
+    constexpr int kThreads = 4;
+    constexpr int kFrames = 600;
+
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+    if (!TE::MemoryTraceStart(path))
+    {
+        std::cerr << "[AllocReplayBench] cannot record synthetic trace to " << path << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(SyntheticWorker, static_cast<std::uint64_t>(t + 1), kFrames);
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    TE::MemoryTraceStop();
+    TE::MemoryShutdown();
+    return true;
+}
+
+std::string FormatMB(std::uint64_t bytes)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.1f MB", static_cast<double>(bytes) / (1024.0 * 1024.0));
+    return buf;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* syntheticPath = "alloc_replay_synthetic.memtrace";
+    const bool synthetic = argc < 2;
+    const char* path = synthetic ? syntheticPath : argv[1];
+
+    if (synthetic && !RecordSyntheticTrace(syntheticPath))
+    {
+        return 1;
+    }
+
+    std::vector<TE::MemoryTraceEvent> events;
+    const bool loaded = LoadTrace(path, events);
+    if (synthetic)
+    {
+        std::remove(syntheticPath);
+    }
+    if (!loaded || events.empty())
+    {
+        std::cerr << "[AllocReplayBench] empty trace\n";
+        return 1;
+    }
+
+    const ReplayTrace trace = BuildReplay(events);
+    events = {};
+
+    std::cout << "[AllocReplayBench] " << (synthetic ? "synthetic trace" : path) << ": " << trace.Ops.size()
+              << " ops from " << trace.ThreadCount << " threads, peak live " << FormatMB(trace.PeakLiveBytes)
+              << ", " << trace.SkippedEvents << " unmatched events skipped\n";
+
+    bool ok = true;
+    for (const Backend& backend : kBackends)
+    {
+        const ReplayResult timed = ReplayIsolated(trace, backend, false);
+        const ReplayResult r = ReplayIsolated(trace, backend, true);
+        const double mops = timed.Seconds > 0.0 ? static_cast<double>(trace.Ops.size()) / timed.Seconds / 1e6 : 0.0;
+        // 碎片率：峰值驻留中没有被存活数据占用的比例（采样 RSS，含分配器元数据与未归还的空闲页）
+        const double fragmentation = r.PeakRssBytes > trace.PeakLiveBytes
+            ? 1.0 - static_cast<double>(trace.PeakLiveBytes) / static_cast<double>(r.PeakRssBytes)
+            : 0.0;
+
+        std::cout << "[AllocReplayBench] " << std::left << std::setw(20) << backend.Name << std::right
+                  << "  " << std::fixed << std::setprecision(2) << std::setw(8) << mops << " Mops/s"
+                  << "  peak RSS " << std::setw(10) << FormatMB(r.PeakRssBytes)
+                  << "  fragmentation " << std::setprecision(1) << std::setw(5) << fragmentation * 100.0 << "%";
+        if (timed.Failures != 0 || r.Failures != 0)
+        {
+            std::cout << "  (" << timed.Failures + r.Failures << " failed allocations)";
+            ok = false;
+        }
+        std::cout << "\n";
+    }
+    return ok ? 0 : 1;
+}
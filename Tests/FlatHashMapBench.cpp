@@ -0,0 +1,262 @@
+// ToyEngine - 扁平哈希表基准
+// 先以 std::unordered_map 为参照做随机增删查差分校验（覆盖墓碑、原容量重建与扩容），
+// 再对比 std::unordered_map、THashMap（节点式 + 引擎分配器）与 TFlatHashMap 在不同规模下的
+// 插入、命中查找、未命中查找与删除耗时。
+#include "Memory/FlatHashMap.h"
+#include "Memory/Memory.h"
+#include "Memory/MemoryContainers.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+volatile std::uint64_t g_sink = 0;
+
+// ---------- 差分校验 ----------
+
+bool ValidateAgainstStd()
+{
+    std::mt19937_64 rng(42);
+    TE::TFlatHashMap<std::uint64_t, std::uint64_t> flat(TE::MemoryTag::Sandbox);
+    std::unordered_map<std::uint64_t, std::uint64_t> reference;
+
+    // 小键域 + 高频删除，制造大量墓碑
+    for (int op = 0; op < 400'000; ++op)
+    {
+        const std::uint64_t key = rng() % 4096;
+        switch (rng() % 4)
+        {
+        case 0:
+        case 1:
+        {
+            const std::uint64_t value = rng();
+            flat[key] = value;
+            reference[key] = value;
+            break;
+        }
+        case 2:
+            if (flat.erase(key) != reference.erase(key))
+            {
+                std::cerr << "[FAIL] erase mismatch at op " << op << "\n";
+                return false;
+            }
+            break;
+        default:
+        {
+            const auto it = flat.find(key);
+            const auto ref = reference.find(key);
+            if ((it == flat.end()) != (ref == reference.end()) || (it != flat.end() && it->second != ref->second))
+            {
+                std::cerr << "[FAIL] find mismatch at op " << op << "\n";
+                return false;
+            }
+            break;
+        }
+        }
+        if (flat.size() != reference.size())
+        {
+            std::cerr << "[FAIL] size mismatch at op " << op << "\n";
+            return false;
+        }
+    }
+
+    std::uint64_t flatSum = 0;
+    std::size_t visited = 0;
+    for (const auto& [key, value] : flat)
+    {
+        flatSum += key ^ value;
+        ++visited;
+    }
+    std::uint64_t refSum = 0;
+    for (const auto& [key, value] : reference)
+    {
+        refSum += key ^ value;
+    }
+    if (visited != reference.size() || flatSum != refSum)
+    {
+        std::cerr << "[FAIL] iteration mismatch\n";
+        return false;
+    }
+
+    // 边遍历边删除
+    for (auto it = flat.begin(); it != flat.end();)
+    {
+        it = (it->first % 3 == 0) ? flat.erase(it) : std::next(it);
+    }
+    for (const auto& [key, value] : flat)
+    {
+        if (key % 3 == 0)
+        {
+            std::cerr << "[FAIL] erase during iteration\n";
+            return false;
+        }
+    }
+
+    // 拷贝 / 移动 / clear 后复用容量
+    TE::TFlatHashMap<std::uint64_t, std::uint64_t> copy = flat;
+    TE::TFlatHashMap<std::uint64_t, std::uint64_t> moved = std::move(copy);
+    if (moved.size() != flat.size() || !copy.empty())
+    {
+        std::cerr << "[FAIL] copy / move\n";
+        return false;
+    }
+    const std::size_t capacity = moved.capacity();
+    moved.clear();
+    if (!moved.empty() || moved.capacity() != capacity || moved.contains(1))
+    {
+        std::cerr << "[FAIL] clear\n";
+        return false;
+    }
+
+    // 非平凡键与集合
+    TE::TFlatHashMap<std::string, int> names;
+    TE::TFlatHashSet<std::string> nameSet;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const std::string name = "Texture_" + std::to_string(i);
+        names.emplace(name, i);
+        nameSet.insert(name);
+    }
+    for (int i = 0; i < 1000; i += 7)
+    {
+        const std::string name = "Texture_" + std::to_string(i);
+        if (names.find(name) == names.end() || names.find(name)->second != i || !nameSet.contains(name))
+        {
+            std::cerr << "[FAIL] string keys\n";
+            return false;
+        }
+    }
+    if (nameSet.insert("Texture_5").second || nameSet.size() != 1000)
+    {
+        std::cerr << "[FAIL] set duplicate insert\n";
+        return false;
+    }
+    return true;
+}
+
+// ---------- 基准 ----------
+
+template<typename Fn>
+double MeasureNsPerOp(std::size_t ops, Fn&& fn)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    fn();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(ops);
+}
+
+struct BenchResult
+{
+    double Insert = 0.0;
+    double FindHit = 0.0;
+    double FindMiss = 0.0;
+    double Erase = 0.0;
+};
+
+template<typename Map>
+BenchResult RunMapBench(Map map, const std::vector<std::uint64_t>& keys,
+                        const std::vector<std::uint64_t>& lookups, const std::vector<std::uint64_t>& misses)
+{
+    BenchResult result;
+    result.Insert = MeasureNsPerOp(keys.size(), [&]() {
+        for (const std::uint64_t key : keys)
+        {
+            map[key] = key;
+        }
+    });
+    result.FindHit = MeasureNsPerOp(lookups.size(), [&]() {
+        std::uint64_t sum = 0;
+        for (const std::uint64_t key : lookups)
+        {
+            sum += map.find(key)->second;
+        }
+        g_sink = sum;
+    });
+    result.FindMiss = MeasureNsPerOp(misses.size(), [&]() {
+        std::uint64_t found = 0;
+        for (const std::uint64_t key : misses)
+        {
+            found += map.find(key) != map.end() ? 1 : 0;
+        }
+        g_sink = found;
+    });
+    result.Erase = MeasureNsPerOp(keys.size(), [&]() {
+        for (const std::uint64_t key : keys)
+        {
+            map.erase(key);
+        }
+    });
+    return result;
+}
+
+void PrintRow(const char* name, const BenchResult& r)
+{
+    std::cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << r.Insert << std::setw(10) << r.FindHit << std::setw(10) << r.FindMiss
+              << std::setw(10) << r.Erase << "\n";
+}
+
+void RunBench(std::size_t count)
+{
+    std::mt19937_64 rng(count);
+    std::vector<std::uint64_t> keys(count);
+    for (auto& key : keys)
+    {
+        key = rng() | 1; // 奇数为命中键
+    }
+    std::vector<std::uint64_t> misses(count);
+    for (auto& key : misses)
+    {
+        key = rng() & ~std::uint64_t(1);
+    }
+
+    // 查找次数固定，小表也有足够的样本
+    const std::size_t lookupCount = std::max<std::size_t>(count, 1'000'000);
+    std::vector<std::uint64_t> lookups(lookupCount);
+    std::vector<std::uint64_t> missLookups(lookupCount);
+    for (std::size_t i = 0; i < lookupCount; ++i)
+    {
+        lookups[i] = keys[rng() % count];
+        missLookups[i] = misses[rng() % count];
+    }
+
+    std::cout << "[FlatHashMapBench] " << count << " keys, ns/op   insert  find-hit find-miss     erase\n";
+    PrintRow("std::unordered_map", RunMapBench(std::unordered_map<std::uint64_t, std::uint64_t>(),
+                                               keys, lookups, missLookups));
+    PrintRow("THashMap", RunMapBench(TE::THashMap<std::uint64_t, std::uint64_t>(
+                                         TE::TEngineAllocator<std::pair<const std::uint64_t, std::uint64_t>>(
+                                             TE::MemoryTag::Sandbox)),
+                                     keys, lookups, missLookups));
+    PrintRow("TFlatHashMap", RunMapBench(TE::TFlatHashMap<std::uint64_t, std::uint64_t>(TE::MemoryTag::Sandbox),
+                                         keys, lookups, missLookups));
+}
+
+} // namespace
+
+int main()
+{
+    TE::MemoryInit(256ull * 1024ull * 1024ull);
+
+    if (!ValidateAgainstStd())
+    {
+        TE::MemoryShutdown();
+        return 1;
+    }
+    std::cout << "[FlatHashMapBench] differential validation passed\n";
+
+    for (const std::size_t count : {64u, 1024u, 65536u, 1u << 20})
+    {
+        RunBench(count);
+    }
+
+    TE::MemoryShutdown();
+    return 0;
+}
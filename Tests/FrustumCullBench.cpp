@@ -0,0 +1,204 @@
+// ToyEngine - 视锥批量剔除基准
+// 先校验 Frustum::CullAABBs / CullSpheres 与逐个 IntersectsAABB / IntersectsSphere 的结果一致，
+// 再在 100k 与 1M 个对象下对比逐个测试、批量 SIMD 测试与启用平面一致性缓存后的耗时。
+#include "Math/Frustum.h"
+#include "Math/MatrixKernels.h"
+#include "Math/ScalarMath.h"
+#include "Memory/Memory.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+volatile std::uint64_t g_sink = 0;
+
+struct SceneData
+{
+    std::vector<TE::BoundingBox> Boxes;
+    std::vector<TE::BoundingSphere> Spheres;
+    std::vector<float> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+    std::vector<float> CenterX, CenterY, CenterZ, Radius;
+
+    [[nodiscard]] TE::BoundingBoxSoA BoxSoA() const { return {MinX, MinY, MinZ, MaxX, MaxY, MaxZ}; }
+    [[nodiscard]] TE::BoundingSphereSoA SphereSoA() const { return {CenterX, CenterY, CenterZ, Radius}; }
+};
+
+// 对象按空间网格顺序生成（与 BVH / 场景分块后的内存顺序类似），相邻对象的可见性相关
+SceneData BuildScene(std::size_t count)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> jitter(-2.0f, 2.0f);
+    std::uniform_real_distribution<float> size(0.2f, 2.0f);
+
+    SceneData scene;
+    scene.Boxes.reserve(count);
+    scene.Spheres.reserve(count);
+    const std::size_t side = static_cast<std::size_t>(std::cbrt(static_cast<double>(count))) + 1;
+    const float spacing = 1000.0f / static_cast<float>(side);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t x = i % side;
+        const std::size_t y = (i / side) % side;
+        const std::size_t z = i / (side * side);
+        const TE::Vector3 center(static_cast<float>(x) * spacing - 500.0f + jitter(rng),
+                                 static_cast<float>(y) * spacing - 500.0f + jitter(rng),
+                                 static_cast<float>(z) * spacing - 500.0f + jitter(rng));
+        const TE::Vector3 extent(size(rng), size(rng), size(rng));
+        scene.Boxes.emplace_back(center - extent, center + extent);
+        scene.Spheres.emplace_back(center, extent.Length());
+    }
+
+    for (const TE::BoundingBox& box : scene.Boxes)
+    {
+        scene.MinX.push_back(box.Min.X); scene.MinY.push_back(box.Min.Y); scene.MinZ.push_back(box.Min.Z);
+        scene.MaxX.push_back(box.Max.X); scene.MaxY.push_back(box.Max.Y); scene.MaxZ.push_back(box.Max.Z);
+    }
+    for (const TE::BoundingSphere& sphere : scene.Spheres)
+    {
+        scene.CenterX.push_back(sphere.Center.X);
+        scene.CenterY.push_back(sphere.Center.Y);
+        scene.CenterZ.push_back(sphere.Center.Z);
+        scene.Radius.push_back(sphere.Radius);
+    }
+    return scene;
+}
+
+TE::Frustum BuildFrustum()
+{
+    const TE::Matrix4 view = TE::Matrix4::LookAtRH(TE::Vector3(0.0f, 50.0f, 300.0f),
+                                                   TE::Vector3(0.0f, 0.0f, 0.0f),
+                                                   TE::Vector3(0.0f, 1.0f, 0.0f));
+    const TE::Matrix4 proj = TE::Matrix4::PerspectiveRH_ZO(TE::Math::DegToRad(60.0f), 16.0f / 9.0f, 0.1f, 600.0f);
+    return TE::Frustum::FromViewProjectionRH_ZO(proj * view);
+}
+
+bool Validate(const TE::Frustum& frustum, const SceneData& scene)
+{
+    const std::size_t count = scene.Boxes.size();
+    std::vector<std::uint64_t> boxMask(TE::Frustum::VisibilityMaskWords(count));
+    std::vector<std::uint64_t> sphereMask(TE::Frustum::VisibilityMaskWords(count));
+    std::vector<std::uint8_t> planeCache(TE::Frustum::CullBlockCount(count), 0);
+    frustum.CullAABBs(scene.BoxSoA(), boxMask, planeCache);
+    frustum.CullSpheres(scene.SphereSoA(), sphereMask);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const bool boxVisible = (boxMask[i >> 6] >> (i & 63)) & 1u;
+        const bool sphereVisible = (sphereMask[i >> 6] >> (i & 63)) & 1u;
+        if (boxVisible != frustum.IntersectsAABB(scene.Boxes[i]) ||
+            sphereVisible != frustum.IntersectsSphere(scene.Spheres[i]))
+        {
+            std::cerr << "[FAIL] batch cull mismatch at " << i << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// ---------- 基准 ----------
+
+template<typename Fn>
+double MeasureNsPerObject(std::size_t objects, int repeats, Fn&& fn)
+{
+    fn(); // 预热（也为一致性缓存写入第一帧的结果）
+    const auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+    {
+        fn();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() /
+           (static_cast<double>(objects) * static_cast<double>(repeats));
+}
+
+std::uint64_t CountBits(const std::vector<std::uint64_t>& mask)
+{
+    std::uint64_t bits = 0;
+    for (const std::uint64_t word : mask)
+    {
+        bits += static_cast<std::uint64_t>(std::popcount(word));
+    }
+    return bits;
+}
+
+void PrintRow(const char* name, double nsPerObject)
+{
+    std::cout << "  " << std::left << std::setw(32) << name << std::right << std::setw(9)
+              << std::fixed << std::setprecision(3) << nsPerObject << " ns/object\n";
+}
+
+void RunBench(const TE::Frustum& frustum, std::size_t count)
+{
+    const SceneData scene = BuildScene(count);
+    const int repeats = count >= 1'000'000 ? 5 : 40;
+
+    std::vector<std::uint64_t> mask(TE::Frustum::VisibilityMaskWords(count));
+    std::vector<std::uint8_t> planeCache(TE::Frustum::CullBlockCount(count), 0);
+
+    std::cout << "[FrustumCullBench] " << count << " objects (" << TE::MatrixKernels::ActiveIsa() << ")\n";
+
+    PrintRow("AABB scalar IntersectsAABB", MeasureNsPerObject(count, repeats, [&]() {
+        std::uint64_t visible = 0;
+        for (const TE::BoundingBox& box : scene.Boxes)
+        {
+            visible += frustum.IntersectsAABB(box) ? 1u : 0u;
+        }
+        g_sink = g_sink + visible;
+    }));
+    PrintRow("AABB batch", MeasureNsPerObject(count, repeats, [&]() {
+        frustum.CullAABBs(scene.BoxSoA(), mask);
+        g_sink = g_sink + mask[0];
+    }));
+    PrintRow("AABB batch + plane cache", MeasureNsPerObject(count, repeats, [&]() {
+        frustum.CullAABBs(scene.BoxSoA(), mask, planeCache);
+        g_sink = g_sink + mask[0];
+    }));
+    const std::uint64_t visibleBoxes = CountBits(mask);
+
+    PrintRow("Sphere scalar IntersectsSphere", MeasureNsPerObject(count, repeats, [&]() {
+        std::uint64_t visible = 0;
+        for (const TE::BoundingSphere& sphere : scene.Spheres)
+        {
+            visible += frustum.IntersectsSphere(sphere) ? 1u : 0u;
+        }
+        g_sink = g_sink + visible;
+    }));
+    std::fill(planeCache.begin(), planeCache.end(), std::uint8_t{0});
+    PrintRow("Sphere batch + plane cache", MeasureNsPerObject(count, repeats, [&]() {
+        frustum.CullSpheres(scene.SphereSoA(), mask, planeCache);
+        g_sink = g_sink + mask[0];
+    }));
+
+    std::cout << "  visible boxes: " << visibleBoxes << " / " << count << "\n";
+}
+
+} // namespace
+
+int main()
+{
+    TE::MemoryInit(256ull * 1024ull * 1024ull);
+
+    const TE::Frustum frustum = BuildFrustum();
+    if (!Validate(frustum, BuildScene(100'003)))
+    {
+        TE::MemoryShutdown();
+        return 1;
+    }
+    std::cout << "[FrustumCullBench] batch results match scalar tests\n";
+
+    for (const std::size_t count : {std::size_t(100'000), std::size_t(1'000'000)})
+    {
+        RunBench(frustum, count);
+    }
+
+    TE::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,225 @@
+// ToyEngine - 作业系统扩展性基准
+// 先校验 ParallelFor 的结果与串行一致，再按工作线程数 1, 2, 4, ... 到硬件线程数 - 1 重新初始化 JobSystem，对比：
+//   - 计算密集：每个元素若干轮超越函数迭代（理想情况下随线程数线性加速）
+//   - 访存密集：1M 个包围盒的 Math::TransformBounds 按块并行（每帧刷新世界包围盒的形态，受内存带宽限制）
+//   - 调度开销：空作业的 Run + Wait 与 grain = 1 的 ParallelFor，折算为每个作业的纳秒数
+// 加速比相对不经过作业系统的串行执行；单核环境下各列只反映调度开销。
+#include "Jobs/JobSystem.h"
+#include "Math/Geometry.h"
+#include "Math/Matrix.h"
+#include "Math/TransformBatch.h"
+#include "Memory/Memory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace {
+
+volatile double g_sink = 0.0;
+
+constexpr std::uint32_t ComputeItems = 200'000;
+constexpr std::uint32_t ComputeGrain = 512;
+constexpr std::uint32_t BoundsItems = 1'000'000;
+constexpr std::uint32_t BoundsGrain = 8192;
+constexpr std::uint32_t OverheadJobs = 100 * 1024;
+
+float ComputeItem(std::uint32_t index)
+{
+    float value = static_cast<float>(index) * 1e-3f;
+    for (int i = 0; i < 48; ++i)
+    {
+        value = std::sin(value) * 0.75f + std::sqrt(std::abs(value) + 1.0f) * 0.25f;
+    }
+    return value;
+}
+
+void ComputeRange(std::vector<float>& output, std::uint32_t begin, std::uint32_t end)
+{
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        output[i] = ComputeItem(i);
+    }
+}
+
+struct BoundsData
+{
+    std::vector<TE::BoundingBox> Local;
+    std::vector<TE::Matrix3x4> World;
+    std::vector<TE::BoundingBox> Output;
+};
+
+BoundsData BuildBounds(std::uint32_t count)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> size(0.5f, 4.0f);
+    BoundsData data;
+    data.Local.reserve(count);
+    data.World.reserve(count);
+    data.Output.resize(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        data.Local.push_back(TE::BoundingBox::FromCenterExtents(TE::Vector3(coord(rng), coord(rng), coord(rng)),
+                                                                TE::Vector3(size(rng), size(rng), size(rng))));
+        const TE::Matrix4 world = TE::Matrix4::Translate(TE::Vector3(coord(rng), coord(rng), coord(rng))) *
+                                  TE::Matrix4::Rotate(coord(rng) * 0.01f, TE::Vector3(0.0f, 1.0f, 0.0f));
+        data.World.emplace_back(world);
+    }
+    return data;
+}
+
+void TransformBoundsRange(BoundsData& data, std::uint32_t begin, std::uint32_t end)
+{
+    const std::size_t count = end - begin;
+    TE::Math::TransformBounds(std::span<const TE::BoundingBox>(data.Local).subspan(begin, count),
+                              std::span<const TE::Matrix3x4>(data.World).subspan(begin, count),
+                              std::span<TE::BoundingBox>(data.Output).subspan(begin, count));
+}
+
+template<typename Fn>
+double MeasureMs(int repeats, Fn&& fn)
+{
+    fn(); // 预热（含工作线程首次唤醒、线程缓存补货）
+    double best = 1e30;
+    for (int r = 0; r < repeats; ++r)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        fn();
+        const auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - begin).count());
+    }
+    return best;
+}
+
+bool Validate()
+{
+    std::vector<float> serial(ComputeItems);
+    ComputeRange(serial, 0, ComputeItems);
+
+    std::vector<float> parallel(ComputeItems, -1.0f);
+    TE::JobSystem::Get().ParallelFor(ComputeItems, ComputeGrain, [&parallel](std::uint32_t begin, std::uint32_t end) {
+        ComputeRange(parallel, begin, end);
+    });
+    if (!std::equal(serial.begin(), serial.end(), parallel.begin()))
+    {
+        std::cerr << "[FAIL] ParallelFor compute result differs from serial\n";
+        return false;
+    }
+
+    BoundsData data = BuildBounds(100'003);
+    std::vector<TE::BoundingBox> expected(data.Local.size());
+    TE::Math::TransformBounds(data.Local, data.World, expected);
+    TE::JobSystem::Get().ParallelFor(static_cast<std::uint32_t>(data.Local.size()), 4096,
+                                     [&data](std::uint32_t begin, std::uint32_t end) { TransformBoundsRange(data, begin, end); });
+    // 区间边界不是 4 的倍数时首尾几个走标量路径，与 SIMD 结果只差舍入
+    auto near = [](const TE::Vector3& a, const TE::Vector3& b) {
+        return (a - b).Length() <= 1e-4f * std::max(1.0f, a.Length());
+    };
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        if (!near(expected[i].Min, data.Output[i].Min) || !near(expected[i].Max, data.Output[i].Max))
+        {
+            std::cerr << "[FAIL] ParallelFor TransformBounds differs at " << i << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+void PrintRow(std::uint32_t workers, double computeMs, double computeSerialMs, double boundsMs, double boundsSerialMs,
+              double runNs, double parallelForNs)
+{
+    std::cout << "  " << std::setw(7) << workers << std::fixed << std::setprecision(2)
+              << std::setw(11) << computeMs << std::setw(8) << computeSerialMs / computeMs << "x"
+              << std::setw(11) << boundsMs << std::setw(8) << boundsSerialMs / boundsMs << "x"
+              << std::setw(12) << runNs << std::setw(14) << parallelForNs << "\n";
+}
+
+} // namespace
+
+int main()
+{
+    TE::MemoryInit(256ull * 1024ull * 1024ull);
+
+    const std::uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    TE::JobSystemConfig config;
+    config.WorkerCount = std::max(1u, hardwareThreads - 1);
+    TE::JobSystem::Get().Init(config);
+    if (!Validate())
+    {
+        TE::JobSystem::Get().Shutdown();
+        TE::MemoryShutdown();
+        return 1;
+    }
+    TE::JobSystem::Get().Shutdown();
+    std::cout << "[JobSystemBench] parallel results match serial\n";
+
+    std::vector<float> computeOutput(ComputeItems);
+    BoundsData bounds = BuildBounds(BoundsItems);
+
+    const double computeSerialMs = MeasureMs(5, [&]() { ComputeRange(computeOutput, 0, ComputeItems); });
+    const double boundsSerialMs = MeasureMs(5, [&]() { TransformBoundsRange(bounds, 0, BoundsItems); });
+
+    std::cout << "[JobSystemBench] " << hardwareThreads << " hardware threads; serial compute " << std::fixed
+              << std::setprecision(2) << computeSerialMs << " ms (" << ComputeItems << " items), serial bounds "
+              << boundsSerialMs << " ms (" << BoundsItems << " boxes)\n";
+    std::cout << "  workers  compute ms speedup  bounds ms speedup  Run+Wait ns  ParallelFor ns\n";
+
+    std::vector<std::uint32_t> workerCounts;
+    for (std::uint32_t workers = 1; workers < hardwareThreads; workers *= 2)
+    {
+        workerCounts.push_back(workers);
+    }
+    if (workerCounts.empty() || workerCounts.back() != std::max(1u, hardwareThreads - 1))
+    {
+        workerCounts.push_back(std::max(1u, hardwareThreads - 1));
+    }
+
+    for (const std::uint32_t workers : workerCounts)
+    {
+        config.WorkerCount = workers;
+        TE::JobSystem& system = TE::JobSystem::Get();
+        system.Init(config);
+
+        const double computeMs = MeasureMs(5, [&]() {
+            system.ParallelFor(ComputeItems, ComputeGrain, [&computeOutput](std::uint32_t begin, std::uint32_t end) {
+                ComputeRange(computeOutput, begin, end);
+            });
+        });
+        const double boundsMs = MeasureMs(5, [&]() {
+            system.ParallelFor(BoundsItems, BoundsGrain,
+                               [&bounds](std::uint32_t begin, std::uint32_t end) { TransformBoundsRange(bounds, begin, end); });
+        });
+        // 每批 1024 个，留在 0 号线程的 deque 容量内（不走全局队列）
+        const double runMs = MeasureMs(3, [&]() {
+            for (std::uint32_t batch = 0; batch < OverheadJobs; batch += 1024)
+            {
+                TE::JobCounter counter;
+                for (std::uint32_t i = 0; i < 1024; ++i)
+                {
+                    system.Run([]() {}, &counter);
+                }
+                system.Wait(counter);
+            }
+        });
+        const double parallelForMs = MeasureMs(3, [&]() {
+            system.ParallelFor(OverheadJobs, 1, [](std::uint32_t, std::uint32_t) {});
+        });
+
+        PrintRow(workers, computeMs, computeSerialMs, boundsMs, boundsSerialMs, runMs * 1e6 / OverheadJobs,
+                 parallelForMs * 1e6 / OverheadJobs);
+        system.Shutdown();
+    }
+
+    g_sink = g_sink + computeOutput[ComputeItems / 2] + bounds.Output[BoundsItems / 2].Max.X;
+    TE::MemoryShutdown();
+    return 0;
+}
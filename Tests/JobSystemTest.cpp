@@ -0,0 +1,430 @@
+// ToyEngine - 作业系统回归测试（未初始化回退 / 计数器 / ParallelFor 覆盖与粒度 / 依赖顺序 / 嵌套并行 / 非作业线程提交 / 作业内堆分配与日志 / Shutdown 清空队列 / 线程命名）
+#include "Jobs/JobSystem.h"
+#include "Log/Log.h"
+#include "Memory/Memory.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+namespace {
+
+constexpr std::uint32_t kWorkers = 3;
+
+bool TestUninitializedFallback()
+{
+    TE::JobSystem system;
+    int ran = 0;
+    TE::JobCounter counter;
+    system.Run([&ran]() { ++ran; }, &counter);
+    system.Wait(counter);
+
+    std::vector<int> covered(1000, 0);
+    system.ParallelFor(static_cast<std::uint32_t>(covered.size()), 16, [&covered](std::uint32_t begin, std::uint32_t end) {
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            ++covered[i];
+        }
+    });
+
+    if (ran != 1 || !counter.IsDone() || system.GetCurrentThreadIndex() != -1)
+    {
+        std::cerr << "[FAIL] uninitialized Run should execute inline\n";
+        return false;
+    }
+    for (int value : covered)
+    {
+        if (value != 1)
+        {
+            std::cerr << "[FAIL] uninitialized ParallelFor coverage\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TestCounterAndThreadIndices(TE::JobSystem& system)
+{
+    constexpr int kJobs = 20000;
+    std::atomic<int> sum{0};
+    std::atomic<bool> badIndex{false};
+    std::atomic<std::uint32_t> seenThreads{0};
+
+    TE::JobCounter counter;
+    for (int i = 0; i < kJobs; ++i)
+    {
+        system.Run([&, i]() {
+            const std::int32_t index = system.GetCurrentThreadIndex();
+            if (index < 0 || index > static_cast<std::int32_t>(kWorkers))
+            {
+                badIndex.store(true, std::memory_order_relaxed);
+                return;
+            }
+            seenThreads.fetch_or(1u << index, std::memory_order_relaxed);
+            sum.fetch_add(i, std::memory_order_relaxed);
+        }, &counter);
+    }
+    system.Wait(counter);
+
+    const int expected = kJobs * (kJobs - 1) / 2;
+    if (badIndex.load() || sum.load() != expected || !counter.IsDone())
+    {
+        std::cerr << "[FAIL] counter sum " << sum.load() << " expected " << expected << "\n";
+        return false;
+    }
+    if (system.GetWorkerCount() != kWorkers || system.GetThreadCount() != kWorkers + 1 ||
+        system.GetCurrentThreadIndex() != 0)
+    {
+        std::cerr << "[FAIL] worker count / caller thread index\n";
+        return false;
+    }
+    std::cout << "  threads that ran jobs: mask 0x" << std::hex << seenThreads.load() << std::dec << "\n";
+    return true;
+}
+
+bool TestParallelForCoverage(TE::JobSystem& system)
+{
+    for (const std::uint32_t count : {1u, 63u, 64u, 65u, 1000u, 100003u})
+    {
+        for (const std::uint32_t grain : {1u, 7u, 64u, 4096u})
+        {
+            std::vector<std::uint8_t> covered(count, 0);
+            std::atomic<bool> grainViolated{false};
+            system.ParallelFor(count, grain, [&](std::uint32_t begin, std::uint32_t end) {
+                if (begin >= end || end - begin > grain)
+                {
+                    grainViolated.store(true, std::memory_order_relaxed);
+                }
+                // 每个下标只属于一个区间，普通写入即可
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    ++covered[i];
+                }
+            });
+            if (grainViolated.load())
+            {
+                std::cerr << "[FAIL] ParallelFor range exceeds grain (count " << count << ", grain " << grain << ")\n";
+                return false;
+            }
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                if (covered[i] != 1)
+                {
+                    std::cerr << "[FAIL] ParallelFor index " << i << " visited " << int(covered[i]) << " times\n";
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool TestDependencies(TE::JobSystem& system)
+{
+    for (int round = 0; round < 200; ++round)
+    {
+        // A(64 个作业) → B → C：B 必须看到 A 全部完成，C 必须看到 B 完成
+        std::atomic<int> stageA{0};
+        std::atomic<int> order{0};
+        int bSawA = -1;
+        int bOrder = -1;
+        int cOrder = -1;
+
+        TE::JobCounter counterA;
+        TE::JobCounter counterB;
+        TE::JobCounter counterC;
+
+        for (int i = 0; i < 64; ++i)
+        {
+            system.Run([&]() { stageA.fetch_add(1, std::memory_order_relaxed); }, &counterA);
+        }
+        system.Run([&]() {
+            bSawA = stageA.load(std::memory_order_relaxed);
+            bOrder = order.fetch_add(1);
+        }, &counterB, &counterA);
+        system.Run([&]() { cOrder = order.fetch_add(1); }, &counterC, &counterB);
+        system.Wait(counterC);
+
+        if (bSawA != 64 || bOrder != 0 || cOrder != 1 || !counterA.IsDone() || !counterB.IsDone())
+        {
+            std::cerr << "[FAIL] dependency: B saw " << bSawA << " of 64 A jobs, order B " << bOrder << " C " << cOrder << "\n";
+            return false;
+        }
+
+        // 依赖已满足的计数器：立即入队
+        std::atomic<bool> ranAfterDone{false};
+        TE::JobCounter counterD;
+        system.Run([&]() { ranAfterDone.store(true); }, &counterD, &counterA);
+        system.Wait(counterD);
+        if (!ranAfterDone.load())
+        {
+            std::cerr << "[FAIL] dependency on completed counter\n";
+            return false;
+        }
+    }
+
+    // 链式依赖：每一环依赖上一环，执行顺序必须严格递增
+    constexpr int kChain = 256;
+    std::vector<TE::JobCounter> chain(kChain);
+    std::vector<int> executedAt(kChain, -1);
+    std::atomic<int> sequence{0};
+    TE::JobCounter gate;
+    system.Run([]() {}, &gate);  // 让第一环依赖一个已提交的作业
+    for (int i = 0; i < kChain; ++i)
+    {
+        TE::JobCounter* dependency = i == 0 ? &gate : &chain[static_cast<std::size_t>(i - 1)];
+        system.Run([&executedAt, &sequence, i]() { executedAt[static_cast<std::size_t>(i)] = sequence.fetch_add(1); },
+                   &chain[static_cast<std::size_t>(i)], dependency);
+    }
+    system.Wait(chain.back());
+    for (int i = 0; i < kChain; ++i)
+    {
+        if (executedAt[static_cast<std::size_t>(i)] != i)
+        {
+            std::cerr << "[FAIL] dependency chain order at " << i << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TestNestedParallelism(TE::JobSystem& system)
+{
+    // 作业内再 ParallelFor / Wait：等待方帮忙执行作业，不会死锁
+    constexpr std::uint32_t kOuter = 32;
+    constexpr std::uint32_t kInner = 2000;
+    std::vector<std::uint64_t> partial(kOuter, 0);
+    system.ParallelFor(kOuter, 1, [&](std::uint32_t begin, std::uint32_t end) {
+        for (std::uint32_t outer = begin; outer < end; ++outer)
+        {
+            std::atomic<std::uint64_t> sum{0};
+            system.ParallelFor(kInner, 37, [&sum](std::uint32_t innerBegin, std::uint32_t innerEnd) {
+                std::uint64_t local = 0;
+                for (std::uint32_t i = innerBegin; i < innerEnd; ++i)
+                {
+                    local += i;
+                }
+                sum.fetch_add(local, std::memory_order_relaxed);
+            });
+            partial[outer] = sum.load();
+        }
+    });
+    for (std::uint64_t value : partial)
+    {
+        if (value != static_cast<std::uint64_t>(kInner) * (kInner - 1) / 2)
+        {
+            std::cerr << "[FAIL] nested ParallelFor sum\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TestForeignThreadSubmit(TE::JobSystem& system)
+{
+    // 非作业线程提交的作业进入全局队列，Wait 通过窃取 / 全局队列帮忙
+    constexpr int kThreads = 4;
+    constexpr int kJobsPerThread = 2000;
+    std::atomic<int> total{0};
+    std::atomic<bool> ok{true};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&]() {
+            if (system.GetCurrentThreadIndex() != -1)
+            {
+                ok.store(false);
+            }
+            TE::JobCounter counter;
+            for (int i = 0; i < kJobsPerThread; ++i)
+            {
+                system.Run([&total]() { total.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+            system.Wait(counter);
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    if (!ok.load() || total.load() != kThreads * kJobsPerThread)
+    {
+        std::cerr << "[FAIL] foreign thread submit: " << total.load() << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool TestHeapAndLoggingInJobs(TE::JobSystem& system)
+{
+    std::atomic<bool> ok{true};
+    system.ParallelFor(4096, 16, [&ok](std::uint32_t begin, std::uint32_t end) {
+        std::vector<void*> blocks;
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            const std::size_t size = 8u + (i * 37u) % 3000u;
+            void* block = TE::MemAlloc(size, TE::MemoryTag::Scene);
+            if (!block)
+            {
+                ok.store(false);
+                break;
+            }
+            std::memset(block, static_cast<int>(i & 0xFF), size);
+            blocks.push_back(block);
+        }
+        for (void* block : blocks)
+        {
+            TE::MemFree(block);
+        }
+        if (begin % 1024 == 0)
+        {
+            TE_LOG_DEBUG("JobSystemTest: range [{}, {}) on thread {}", begin, end,
+                         TE::JobSystem::Get().GetCurrentThreadIndex());
+        }
+    });
+    if (!ok.load())
+    {
+        std::cerr << "[FAIL] MemAlloc inside job\n";
+        return false;
+    }
+    return true;
+}
+
+bool TestWorkerNames(TE::JobSystem& system)
+{
+#if defined(__linux__)
+    std::atomic<int> named{0};
+    TE::JobCounter counter;
+    for (int i = 0; i < 256; ++i)
+    {
+        system.Run([&named, &system]() {
+            if (system.GetCurrentThreadIndex() <= 0)
+            {
+                return;
+            }
+            char name[16] = {};
+            pthread_getname_np(pthread_self(), name, sizeof(name));
+            if (std::strncmp(name, "JobTest", 7) == 0)
+            {
+                named.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                named.store(-100000, std::memory_order_relaxed);
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }, &counter);
+    }
+    system.Wait(counter);
+    if (named.load() < 0)
+    {
+        std::cerr << "[FAIL] worker thread name\n";
+        return false;
+    }
+#else
+    (void)system;
+#endif
+    return true;
+}
+
+bool TestShutdownDrainsQueues()
+{
+    TE::JobSystem system;
+    TE::JobSystemConfig config;
+    config.WorkerCount = 2;
+    config.QueueCapacity = 64; // 小容量，逼出全局队列溢出路径
+    system.Init(config);
+
+    std::atomic<int> ran{0};
+    TE::JobCounter first;
+    TE::JobCounter dependent;
+    for (int i = 0; i < 5000; ++i)
+    {
+        system.Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &first);
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        system.Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &dependent, &first);
+    }
+    system.Shutdown();
+
+    if (ran.load() != 5100 || !first.IsDone() || !dependent.IsDone() || system.IsInitialized())
+    {
+        std::cerr << "[FAIL] Shutdown should run all queued jobs: " << ran.load() << "\n";
+        return false;
+    }
+
+    // 可以重新初始化
+    config.WorkerCount = 1;
+    system.Init(config);
+    TE::JobCounter counter;
+    system.Run([&ran]() { ran.fetch_add(1); }, &counter);
+    system.Wait(counter);
+    system.Shutdown();
+    return ran.load() == 5101;
+}
+
+} // namespace
+
+int main()
+{
+    TE::Log::Init();
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+
+    bool ok = true;
+    std::cout << "[JobSystemTest] uninitialized fallback...\n";
+    ok = ok && TestUninitializedFallback();
+
+    const std::uint64_t coreBytesBefore =
+        TE::GetMemoryStats().PerTag[static_cast<std::size_t>(TE::MemoryTag::Core)].CurrentBytes;
+
+    TE::JobSystemConfig config;
+    config.WorkerCount = kWorkers;
+    config.NamePrefix = "JobTest";
+    TE::JobSystem& system = TE::JobSystem::Get();
+    system.Init(config);
+
+    std::cout << "[JobSystemTest] counters and thread indices...\n";
+    ok = ok && TestCounterAndThreadIndices(system);
+    std::cout << "[JobSystemTest] ParallelFor coverage and grain...\n";
+    ok = ok && TestParallelForCoverage(system);
+    std::cout << "[JobSystemTest] dependencies...\n";
+    ok = ok && TestDependencies(system);
+    std::cout << "[JobSystemTest] nested parallelism...\n";
+    ok = ok && TestNestedParallelism(system);
+    std::cout << "[JobSystemTest] foreign thread submit...\n";
+    ok = ok && TestForeignThreadSubmit(system);
+    std::cout << "[JobSystemTest] heap and logging inside jobs...\n";
+    ok = ok && TestHeapAndLoggingInJobs(system);
+    std::cout << "[JobSystemTest] worker names...\n";
+    ok = ok && TestWorkerNames(system);
+
+    system.Shutdown();
+
+    // 作业对象全部归还（工作线程退出时已折算线程缓存统计）
+    const std::uint64_t coreBytesAfter =
+        TE::GetMemoryStats().PerTag[static_cast<std::size_t>(TE::MemoryTag::Core)].CurrentBytes;
+    if (ok && coreBytesAfter != coreBytesBefore)
+    {
+        std::cerr << "[FAIL] job allocations leaked: " << coreBytesBefore << " -> " << coreBytesAfter << " bytes\n";
+        ok = false;
+    }
+
+    std::cout << "[JobSystemTest] shutdown drains queues...\n";
+    ok = ok && TestShutdownDrainsQueues();
+
+    TE::MemoryShutdown();
+    TE::Log::Shutdown();
+
+    std::cout << (ok ? "[JobSystemTest] All passed.\n" : "[JobSystemTest] FAILED\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+// ToyEngine - 微基准测试小型框架（仅供 Tests/MathBench 使用）
+//
+// 约定：
+//   - 每个基准的迭代次数在代码中固定（pinned），不做自动校准，保证不同提交之间的测量对象完全一致；
+//     --scale 只做整体缩放，用于慢机器或 Debug 构建
+//   - 计时前先跑 1/10 迭代预热（填充缓存、分支预测与 CPU 频率爬升）
+//   - 每个基准测 Samples 次，报告中位数 ns/op 与最小值
+//   - --json=<path> 输出结果；--baseline=<path> 读取已提交的结果并打印相对变化
+//
+// 用法：
+//   TE::Bench::BenchRunner runner(TE::Bench::ParseArgs(argc, argv));
+//   runner.Run("Matrix4::operator*", 1'000'000, [&](uint64_t i) { TE::Bench::DoNotOptimize(a[i & 1023] * b); });
+//   return runner.Finish();
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace TE::Bench {
+
+/// <summary>
+/// 阻止编译器把结果当作无用计算消除
+/// </summary>
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* s_sink = nullptr;
+    s_sink = &value;
+    _ReadWriteBarrier();
+#endif
+}
+
+struct BenchConfig
+{
+    double Scale = 1.0;
+    int Samples = 5;
+    std::string Filter;
+    std::string JsonPath;
+    std::string BaselinePath;
+};
+
+struct BenchResult
+{
+    std::string Name;
+    std::uint64_t Iterations = 0;
+    double NsPerOp = 0.0;    // 中位数
+    double MinNsPerOp = 0.0;
+};
+
+inline BenchConfig ParseArgs(int argc, char** argv)
+{
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        const auto value = [&arg](std::string_view prefix) { return std::string(arg.substr(prefix.size())); };
+        if (arg.starts_with("--filter="))
+            config.Filter = value("--filter=");
+        else if (arg.starts_with("--json="))
+            config.JsonPath = value("--json=");
+        else if (arg.starts_with("--baseline="))
+            config.BaselinePath = value("--baseline=");
+        else if (arg.starts_with("--scale="))
+            config.Scale = std::max(1e-4, std::atof(value("--scale=").c_str()));
+        else if (arg.starts_with("--samples="))
+            config.Samples = std::max(1, std::atoi(value("--samples=").c_str()));
+        else
+            std::cerr << "[MathBench] unknown argument: " << arg
+                      << " (--filter= --json= --baseline= --scale= --samples=)\n";
+    }
+    return config;
+}
+
+class BenchRunner
+{
+public:
+    explicit BenchRunner(BenchConfig config, std::string label = {})
+        : m_config(std::move(config))
+        , m_label(std::move(label))
+    {
+    }
+
+    /// <summary>
+    /// 运行一个基准：fn(i) 为单次操作，i 为迭代序号（用于轮换输入，避免常量折叠）
+    /// </summary>
+    template<typename Fn>
+    void Run(std::string_view name, std::uint64_t iterations, Fn&& fn)
+    {
+        if (!m_config.Filter.empty() && name.find(m_config.Filter) == std::string_view::npos)
+        {
+            return;
+        }
+
+        const std::uint64_t pinned = std::max<std::uint64_t>(
+            1, static_cast<std::uint64_t>(static_cast<double>(iterations) * m_config.Scale));
+
+        for (std::uint64_t i = 0, warmup = std::max<std::uint64_t>(1, pinned / 10); i < warmup; ++i)
+        {
+            fn(i);
+        }
+
+        std::vector<double> samples;
+        samples.reserve(static_cast<std::size_t>(m_config.Samples));
+        for (int sample = 0; sample < m_config.Samples; ++sample)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < pinned; ++i)
+            {
+                fn(i);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count() /
+                              static_cast<double>(pinned));
+        }
+        std::sort(samples.begin(), samples.end());
+
+        BenchResult result;
+        result.Name = std::string(name);
+        result.Iterations = pinned;
+        result.NsPerOp = samples[samples.size() / 2];
+        result.MinNsPerOp = samples.front();
+        std::cout << "  " << std::left << std::setw(44) << result.Name << std::right
+                  << std::fixed << std::setprecision(3) << std::setw(10) << result.NsPerOp << " ns/op"
+                  << "  (min " << std::setw(8) << result.MinNsPerOp << ", " << pinned << " iters)\n";
+        m_results.push_back(std::move(result));
+    }
+
+    /// <summary>
+    /// 输出 JSON 并与基线比较；返回进程退出码
+    /// </summary>
+    int Finish() const
+    {
+        if (!m_config.JsonPath.empty() && !WriteJson(m_config.JsonPath))
+        {
+            std::cerr << "[MathBench] failed to write " << m_config.JsonPath << "\n";
+            return 1;
+        }
+        if (!m_config.BaselinePath.empty())
+        {
+            CompareBaseline(m_config.BaselinePath);
+        }
+        return 0;
+    }
+
+    [[nodiscard]] const std::vector<BenchResult>& GetResults() const { return m_results; }
+
+private:
+    bool WriteJson(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            return false;
+        }
+        // 每个结果独占一行，便于 diff 与 CompareBaseline 的逐行解析
+        file << "{\n  \"label\": \"" << m_label << "\",\n  \"benchmarks\": [\n";
+        for (std::size_t i = 0; i < m_results.size(); ++i)
+        {
+            const BenchResult& result = m_results[i];
+            file << "    {\"name\": \"" << result.Name << "\", \"iterations\": " << result.Iterations
+                 << ", \"ns_per_op\": " << std::fixed << std::setprecision(4) << result.NsPerOp
+                 << ", \"min_ns_per_op\": " << result.MinNsPerOp << "}"
+                 << (i + 1 < m_results.size() ? ",\n" : "\n");
+        }
+        file << "  ]\n}\n";
+        return static_cast<bool>(file);
+    }
+
+    static bool ExtractString(const std::string& line, std::string_view key, std::string& out)
+    {
+        const std::string pattern = "\"" + std::string(key) + "\": \"";
+        const std::size_t begin = line.find(pattern);
+        if (begin == std::string::npos)
+        {
+            return false;
+        }
+        const std::size_t valueBegin = begin + pattern.size();
+        const std::size_t valueEnd = line.find('"', valueBegin);
+        if (valueEnd == std::string::npos)
+        {
+            return false;
+        }
+        out = line.substr(valueBegin, valueEnd - valueBegin);
+        return true;
+    }
+
+    static bool ExtractNumber(const std::string& line, std::string_view key, double& out)
+    {
+        const std::string pattern = "\"" + std::string(key) + "\": ";
+        const std::size_t begin = line.find(pattern);
+        if (begin == std::string::npos)
+        {
+            return false;
+        }
+        out = std::atof(line.c_str() + begin + pattern.size());
+        return true;
+    }
+
+    void CompareBaseline(const std::string& path) const
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            std::cerr << "[MathBench] baseline not found: " << path << "\n";
+            return;
+        }
+
+        std::vector<std::pair<std::string, double>> baseline;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::string name;
+            double nsPerOp = 0.0;
+            if (ExtractString(line, "name", name) && ExtractNumber(line, "ns_per_op", nsPerOp))
+            {
+                baseline.emplace_back(std::move(name), nsPerOp);
+            }
+        }
+
+        std::cout << "\n[MathBench] vs baseline " << path << " (negative = faster)\n";
+        for (const BenchResult& result : m_results)
+        {
+            const auto it = std::find_if(baseline.begin(), baseline.end(),
+                                         [&result](const auto& entry) { return entry.first == result.Name; });
+            std::cout << "  " << std::left << std::setw(44) << result.Name << std::right;
+            if (it == baseline.end() || it->second <= 0.0)
+            {
+                std::cout << "        new\n";
+                continue;
+            }
+            const double delta = (result.NsPerOp - it->second) / it->second * 100.0;
+            std::cout << std::fixed << std::setprecision(1) << std::setw(9) << std::showpos << delta
+                      << std::noshowpos << " %  (" << std::setprecision(3) << it->second << " -> "
+                      << result.NsPerOp << " ns/op)\n";
+        }
+    }
+
+    BenchConfig m_config;
+    std::string m_label;
+    std::vector<BenchResult> m_results;
+};
+
+} // namespace TE::Bench
@@ -0,0 +1,509 @@
+// ToyEngine - 数学库微基准
+// 覆盖 Core/Public/Math 下的全部公开类型：向量 / 整数向量 / 矩形、Matrix3/4、Quat、Transform、
+// MathUtils / ScalarMath、Color、Random / RandomStream、Geometry、Frustum、Matrix3x4、MatrixKernels 与 TransformBatch。
+// 每个基准在 1024 个预生成输入上轮换（避免常量折叠与单一分支模式），结果经 DoNotOptimize 保留。
+//
+// 用法：MathBench [--filter=Matrix4] [--json=out.json] [--baseline=Tests/MathBench/baseline.json]
+//                 [--scale=0.1] [--samples=5]
+// 基线仅在同一台机器、同一构建配置（Release）下可比。
+#include "BenchHarness.h"
+
+#include "Math/Color.h"
+#include "Math/Frustum.h"
+#include "Math/Geometry.h"
+#include "Math/MathTypes.h"
+#include "Math/MathUtils.h"
+#include "Math/MatrixKernels.h"
+#include "Math/Random.h"
+#include "Math/RandomStream.h"
+#include "Math/ScalarMath.h"
+#include "Math/Transform.h"
+#include "Math/TransformBatch.h"
+#include "Math/VectorInt.h"
+#include "Math/VertexPacking.h"
+#include "Memory/Memory.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using TE::Bench::BenchRunner;
+using TE::Bench::DoNotOptimize;
+
+constexpr std::size_t PoolSize = 1024;
+constexpr std::uint64_t PoolMask = PoolSize - 1;
+
+// 迭代次数按单次操作的量级固定，Release 下每个基准约 5~20 ms
+constexpr std::uint64_t CheapIterations = 4'000'000;
+constexpr std::uint64_t MediumIterations = 1'000'000;
+constexpr std::uint64_t HeavyIterations = 250'000;
+constexpr std::uint64_t BatchIterations = 2'000;
+
+template<typename T>
+using TPool = std::array<T, PoolSize>;
+
+struct BenchInputs
+{
+    std::mt19937 Rng{20240601u};
+
+    float Uniform(float min, float max) { return std::uniform_real_distribution<float>(min, max)(Rng); }
+    int UniformInt(int min, int max) { return std::uniform_int_distribution<int>(min, max)(Rng); }
+
+    TE::Vector3 RandomVector3(float extent) { return {Uniform(-extent, extent), Uniform(-extent, extent), Uniform(-extent, extent)}; }
+
+    TE::Quat RandomQuat()
+    {
+        return TE::Quat(Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f)).Normalize();
+    }
+
+    TE::Transform RandomTransform()
+    {
+        return TE::Transform(RandomVector3(50.0f), RandomQuat(),
+                             TE::Vector3(Uniform(0.5f, 2.0f), Uniform(0.5f, 2.0f), Uniform(0.5f, 2.0f)));
+    }
+};
+
+struct Pools
+{
+    TPool<float> Scalars{};
+    TPool<TE::Vector2> Vec2{};
+    TPool<TE::Vector3> Vec3{};
+    TPool<TE::Vector4> Vec4{};
+    TPool<TE::IntVector2> IntVec2{};
+    TPool<TE::IntVector3> IntVec3{};
+    TPool<TE::Rect> Rects{};
+    TPool<TE::IntRect> IntRects{};
+    TPool<TE::Matrix3> Mat3{};
+    TPool<TE::Matrix4> Mat4{};
+    TPool<TE::Matrix3x4> Mat3x4{};
+    TPool<TE::Quat> Quats{};
+    TPool<TE::Transform> Transforms{};
+    TPool<TE::Color> Colors{};
+    TPool<TE::Ray> Rays{};
+    TPool<TE::Plane> Planes{};
+    TPool<TE::BoundingBox> Boxes{};
+    TPool<TE::BoundingSphere> Spheres{};
+
+    // TransformBatch / Frustum 批量接口的 SoA 输入
+    std::vector<TE::Vector3> Positions, Scales;
+    std::vector<TE::Quat> Rotations;
+    std::vector<float> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+};
+
+Pools BuildPools()
+{
+    BenchInputs inputs;
+    Pools pools;
+    for (std::size_t i = 0; i < PoolSize; ++i)
+    {
+        pools.Scalars[i] = inputs.Uniform(0.0f, 1.0f);
+        pools.Vec2[i] = TE::Vector2(inputs.Uniform(-10.0f, 10.0f), inputs.Uniform(-10.0f, 10.0f));
+        pools.Vec3[i] = inputs.RandomVector3(10.0f);
+        pools.Vec4[i] = TE::Vector4(inputs.RandomVector3(10.0f), inputs.Uniform(-10.0f, 10.0f));
+        pools.IntVec2[i] = TE::IntVector2(inputs.UniformInt(-1000, 1000), inputs.UniformInt(-1000, 1000));
+        pools.IntVec3[i] = TE::IntVector3(inputs.UniformInt(-1000, 1000), inputs.UniformInt(-1000, 1000),
+                                          inputs.UniformInt(-1000, 1000));
+        pools.Rects[i] = TE::Rect(inputs.Uniform(-100.0f, 100.0f), inputs.Uniform(-100.0f, 100.0f),
+                                  inputs.Uniform(1.0f, 80.0f), inputs.Uniform(1.0f, 80.0f));
+        pools.IntRects[i] = TE::IntRect(inputs.UniformInt(-100, 100), inputs.UniformInt(-100, 100),
+                                        inputs.UniformInt(1, 80), inputs.UniformInt(1, 80));
+
+        pools.Transforms[i] = inputs.RandomTransform();
+        pools.Quats[i] = pools.Transforms[i].Rotation;
+        pools.Mat4[i] = pools.Transforms[i].ToMatrix();
+        pools.Mat3[i] = pools.Mat4[i].ToMatrix3();
+        pools.Mat3x4[i] = TE::Matrix3x4(pools.Mat4[i]);
+
+        pools.Colors[i] = TE::Color(inputs.Uniform(0.0f, 1.0f), inputs.Uniform(0.0f, 1.0f), inputs.Uniform(0.0f, 1.0f));
+        pools.Rays[i] = TE::Ray(inputs.RandomVector3(20.0f), inputs.RandomVector3(1.0f).Normalize());
+        pools.Planes[i] = TE::Plane(inputs.RandomVector3(1.0f).Normalize(), inputs.Uniform(-5.0f, 5.0f));
+        pools.Boxes[i] = TE::BoundingBox::FromCenterExtents(inputs.RandomVector3(100.0f),
+                                                            TE::Vector3(inputs.Uniform(0.5f, 5.0f)));
+        pools.Spheres[i] = TE::BoundingSphere(inputs.RandomVector3(100.0f), inputs.Uniform(0.5f, 5.0f));
+
+        pools.Positions.push_back(pools.Transforms[i].Position);
+        pools.Rotations.push_back(pools.Transforms[i].Rotation);
+        pools.Scales.push_back(pools.Transforms[i].Scale);
+        pools.MinX.push_back(pools.Boxes[i].Min.X); pools.MinY.push_back(pools.Boxes[i].Min.Y); pools.MinZ.push_back(pools.Boxes[i].Min.Z);
+        pools.MaxX.push_back(pools.Boxes[i].Max.X); pools.MaxY.push_back(pools.Boxes[i].Max.Y); pools.MaxZ.push_back(pools.Boxes[i].Max.Z);
+    }
+    return pools;
+}
+
+// 相邻输入索引：与 i 错开，避免 a、b 恰好取同一个元素
+inline std::size_t At(std::uint64_t i) { return static_cast<std::size_t>(i & PoolMask); }
+inline std::size_t Next(std::uint64_t i) { return static_cast<std::size_t>((i * 7 + 3) & PoolMask); }
+
+void BenchVectors(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("Vector2/Dot", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Vector2::Dot(p.Vec2[At(i)], p.Vec2[Next(i)])); });
+    runner.Run("Vector2/Normalize", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Vec2[At(i)].Normalize()); });
+    runner.Run("Vector3/Dot", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Vector3::Dot(p.Vec3[At(i)], p.Vec3[Next(i)])); });
+    runner.Run("Vector3/Cross", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Vector3::Cross(p.Vec3[At(i)], p.Vec3[Next(i)])); });
+    runner.Run("Vector3/Normalize", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Vec3[At(i)].Normalize()); });
+    runner.Run("Vector3/Lerp", CheapIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Vector3::Lerp(p.Vec3[At(i)], p.Vec3[Next(i)], p.Scalars[At(i)]));
+    });
+    runner.Run("Vector4/Dot", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Vector4::Dot(p.Vec4[At(i)], p.Vec4[Next(i)])); });
+    runner.Run("Vector4/Normalize", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Vec4[At(i)].Normalize()); });
+
+    runner.Run("IntVector2/Max", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::IntVector2::Max(p.IntVec2[At(i)], p.IntVec2[Next(i)])); });
+    runner.Run("IntVector3/ToFloat", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.IntVec3[At(i)].ToFloat()); });
+    runner.Run("Rect/Intersects", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Rects[At(i)].Intersects(p.Rects[Next(i)])); });
+    runner.Run("Rect/Union", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Rects[At(i)].Union(p.Rects[Next(i)])); });
+    runner.Run("IntRect/Intersection", CheapIterations, [&](std::uint64_t i) {
+        DoNotOptimize(p.IntRects[At(i)].Intersection(p.IntRects[Next(i)]));
+    });
+}
+
+void BenchMatrices(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("Matrix3/Multiply", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat3[At(i)] * p.Mat3[Next(i)]); });
+    runner.Run("Matrix3/Inverse", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat3[At(i)].Inverse()); });
+
+    runner.Run("Matrix4/Multiply", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)] * p.Mat4[Next(i)]); });
+    runner.Run("Matrix4/TransformVector4", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)] * p.Vec4[Next(i)]); });
+    runner.Run("Matrix4/Transpose", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)].Transpose()); });
+    runner.Run("Matrix4/Inverse", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)].Inverse()); });
+    runner.Run("Matrix4/InverseAffine", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)].InverseAffine()); });
+    runner.Run("Matrix4/Determinant", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)].Determinant()); });
+    runner.Run("Matrix4/GetNormalMatrix", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)].GetNormalMatrix()); });
+    runner.Run("Matrix4/Decompose", HeavyIterations, [&](std::uint64_t i) {
+        TE::Vector3 translation, scale;
+        TE::Quat rotation;
+        DoNotOptimize(p.Mat4[At(i)].Decompose(translation, rotation, scale));
+        DoNotOptimize(rotation);
+    });
+    // 仿射 3x4：与上面的 Matrix4 同名基准对照
+    runner.Run("Matrix3x4/Multiply", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat3x4[At(i)] * p.Mat3x4[Next(i)]); });
+    runner.Run("Matrix3x4/Matrix4Multiply", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat4[At(i)] * p.Mat3x4[Next(i)]); });
+    runner.Run("Matrix3x4/Inverse", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat3x4[At(i)].Inverse()); });
+    runner.Run("Matrix3x4/GetNormalMatrix", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat3x4[At(i)].GetNormalMatrix()); });
+    runner.Run("Matrix3x4/TransformPoint", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Mat3x4[At(i)].TransformPoint(p.Vec3[Next(i)])); });
+
+    runner.Run("Matrix4/LookAtRH", MediumIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Matrix4::LookAtRH(p.Vec3[At(i)], p.Vec3[Next(i)], TE::Vector3::Up));
+    });
+    runner.Run("Matrix4/PerspectiveRH_ZO", MediumIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Matrix4::PerspectiveRH_ZO(0.5f + p.Scalars[At(i)], 16.0f / 9.0f, 0.1f, 1000.0f));
+    });
+}
+
+void BenchQuats(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("Quat/Multiply", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Quats[At(i)] * p.Quats[Next(i)]); });
+    runner.Run("Quat/RotateVector", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Quats[At(i)] * p.Vec3[Next(i)]); });
+    runner.Run("Quat/Normalize", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Quats[At(i)].Normalize()); });
+    runner.Run("Quat/Lerp", CheapIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Quat::Lerp(p.Quats[At(i)], p.Quats[Next(i)], p.Scalars[At(i)]));
+    });
+    runner.Run("Quat/Slerp", MediumIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Quat::Slerp(p.Quats[At(i)], p.Quats[Next(i)], p.Scalars[At(i)]));
+    });
+    runner.Run("Quat/ToMatrix4", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Quats[At(i)].ToMatrix4()); });
+    runner.Run("Quat/FromEuler", MediumIterations, [&](std::uint64_t i) {
+        const TE::Vector3& euler = p.Vec3[At(i)];
+        DoNotOptimize(TE::Quat::FromEuler(euler.X, euler.Y, euler.Z));
+    });
+    runner.Run("Quat/ToEulerAngles", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Quats[At(i)].ToEulerAngles()); });
+}
+
+void BenchTransforms(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("Transform/ToMatrix", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Transforms[At(i)].ToMatrix()); });
+    runner.Run("Transform/Compose", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Transforms[At(i)] * p.Transforms[Next(i)]); });
+    runner.Run("Transform/Inverse", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Transforms[At(i)].Inverse()); });
+    runner.Run("Transform/TransformPoint", CheapIterations, [&](std::uint64_t i) {
+        DoNotOptimize(p.Transforms[At(i)].TransformPoint(p.Vec3[Next(i)]));
+    });
+    runner.Run("Transform/InverseTransformPoint", MediumIterations, [&](std::uint64_t i) {
+        DoNotOptimize(p.Transforms[At(i)].InverseTransformPoint(p.Vec3[Next(i)]));
+    });
+    runner.Run("Transform/Lerp", MediumIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Transform::Lerp(p.Transforms[At(i)], p.Transforms[Next(i)], p.Scalars[At(i)]));
+    });
+    runner.Run("Transform/FromMatrix", HeavyIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Transform::FromMatrix(p.Mat4[At(i)])); });
+}
+
+void BenchScalarAndUtils(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("ScalarMath/Clamp", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::Clamp(p.Vec3[At(i)].X, -1.0f, 1.0f)); });
+    runner.Run("ScalarMath/SmoothStep", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::SmoothStep(0.2f, 0.8f, p.Scalars[At(i)])); });
+    runner.Run("ScalarMath/Sin", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::Sin(p.Vec3[At(i)].X)); });
+    runner.Run("ScalarMath/Atan2", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::Atan2(p.Vec3[At(i)].X, p.Vec3[At(i)].Y)); });
+    runner.Run("ScalarMath/Sqrt", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::Sqrt(p.Scalars[At(i)])); });
+    runner.Run("ScalarMath/FastSin", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::FastSin(p.Vec3[At(i)].X)); });
+    runner.Run("ScalarMath/FastAtan2", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::FastAtan2(p.Vec3[At(i)].X, p.Vec3[At(i)].Y)); });
+    runner.Run("ScalarMath/Asin", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::Asin(p.Scalars[At(i)])); });
+    runner.Run("ScalarMath/FastAsin", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::FastAsin(p.Scalars[At(i)])); });
+    runner.Run("ScalarMath/Exp2", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(std::exp2(p.Vec3[At(i)].X)); });
+    runner.Run("ScalarMath/FastExp2", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::FastExp2(p.Vec3[At(i)].X)); });
+    runner.Run("ScalarMath/Log2", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(std::log2(p.Scalars[At(i)] + 0.5f)); });
+    runner.Run("ScalarMath/FastLog2", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::FastLog2(p.Scalars[At(i)] + 0.5f)); });
+    runner.Run("MathUtils/FastNormalize", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::FastNormalize(p.Vec3[At(i)])); });
+
+    // 批量版本：1024 个输入一次调用
+    std::vector<float> angles(PoolSize), ys(PoolSize), xs(PoolSize), results(PoolSize), results2(PoolSize);
+    for (std::size_t i = 0; i < PoolSize; ++i)
+    {
+        angles[i] = p.Vec3[i].X;
+        ys[i] = p.Vec3[i].Y;
+        xs[i] = p.Vec3[i].Z;
+    }
+    runner.Run("ScalarMath/FastSinCos x1024", BatchIterations * 4, [&](std::uint64_t) {
+        TE::Math::FastSinCos(angles, results, results2);
+        DoNotOptimize(results[0]);
+    });
+    runner.Run("ScalarMath/FastAtan2 x1024", BatchIterations * 4, [&](std::uint64_t) {
+        TE::Math::FastAtan2(ys, xs, results);
+        DoNotOptimize(results[0]);
+    });
+    runner.Run("ScalarMath/FastAsin x1024", BatchIterations * 4, [&](std::uint64_t) {
+        TE::Math::FastAsin(p.Scalars, results);
+        DoNotOptimize(results[0]);
+    });
+    runner.Run("ScalarMath/FastExp2 x1024", BatchIterations * 4, [&](std::uint64_t) {
+        TE::Math::FastExp2(angles, results);
+        DoNotOptimize(results[0]);
+    });
+    runner.Run("MathUtils/SlerpVector3", MediumIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Math::Slerp(p.Vec3[At(i)].Normalize(), p.Vec3[Next(i)].Normalize(), p.Scalars[At(i)]));
+    });
+}
+
+void BenchColors(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("Color/ToSRGB", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Colors[At(i)].ToSRGB()); });
+    runner.Run("Color/ToLinear", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(p.Colors[At(i)].ToLinear()); });
+    runner.Run("Color/ToHSV", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Colors[At(i)].ToHSV()); });
+    runner.Run("Color/FromHSV", CheapIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Color::FromHSV(p.Scalars[At(i)] * 360.0f, p.Scalars[Next(i)], 0.8f));
+    });
+    runner.Run("Color/Lerp", CheapIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Color::Lerp(p.Colors[At(i)], p.Colors[Next(i)], p.Scalars[At(i)]));
+    });
+    runner.Run("Color/ToPackedRGBA", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Colors[At(i)].ToPackedRGBA()); });
+}
+
+void BenchRandom(BenchRunner& runner)
+{
+    TE::Random::Seed(42);
+    runner.Run("Random/Value", CheapIterations, [](std::uint64_t) { DoNotOptimize(TE::Random::Value()); });
+    runner.Run("Random/RangeInt", CheapIterations, [](std::uint64_t) { DoNotOptimize(TE::Random::Range(0, 100)); });
+    runner.Run("Random/UnitVector", MediumIterations, [](std::uint64_t) { DoNotOptimize(TE::Random::UnitVector()); });
+    runner.Run("Random/Gaussian", MediumIterations, [](std::uint64_t) { DoNotOptimize(TE::Random::Gaussian(0.0f, 1.0f)); });
+
+    TE::Random stream = TE::Random::Create(42);
+    runner.Run("Random/Instance/NextFloat", CheapIterations, [&](std::uint64_t) { DoNotOptimize(stream.NextFloat()); });
+    runner.Run("Random/Instance/NextInt", CheapIterations, [&](std::uint64_t) { DoNotOptimize(stream.NextInt(0, 100)); });
+    runner.Run("Random/Instance/NextUnitVector", MediumIterations, [&](std::uint64_t) { DoNotOptimize(stream.NextUnitVector()); });
+
+    TE::RandomStream randomStream(42, 7);
+    runner.Run("RandomStream/NextFloat", CheapIterations, [&](std::uint64_t) { DoNotOptimize(randomStream.NextFloat()); });
+    runner.Run("RandomStream/NextInsideSphere", MediumIterations, [&](std::uint64_t) { DoNotOptimize(randomStream.NextInsideSphere(1.0f)); });
+    runner.Run("RandomStream/Advance", MediumIterations, [&](std::uint64_t i) {
+        randomStream.Advance(i | 1u);
+        DoNotOptimize(randomStream);
+    });
+
+    std::vector<float> uniforms(PoolSize);
+    std::vector<TE::Vector3> points(PoolSize);
+    runner.Run("RandomStream/FillUniform x1024", BatchIterations, [&](std::uint64_t) {
+        randomStream.FillUniform(uniforms);
+        DoNotOptimize(uniforms.data());
+    });
+    runner.Run("RandomStream/FillInsideSphere x1024", BatchIterations, [&](std::uint64_t) {
+        randomStream.FillInsideSphere(points, 1.0f);
+        DoNotOptimize(points.data());
+    });
+}
+
+void BenchGeometry(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("Plane/SignedDistance", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Planes[At(i)].SignedDistance(p.Vec3[Next(i)])); });
+    runner.Run("Plane/IntersectRay", CheapIterations, [&](std::uint64_t i) {
+        float distance = 0.0f;
+        DoNotOptimize(p.Planes[At(i)].IntersectRay(p.Rays[Next(i)], distance));
+        DoNotOptimize(distance);
+    });
+    runner.Run("BoundingBox/Intersects", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Boxes[At(i)].Intersects(p.Boxes[Next(i)])); });
+    runner.Run("BoundingBox/IntersectRay", CheapIterations, [&](std::uint64_t i) {
+        float distance = 0.0f;
+        DoNotOptimize(p.Boxes[At(i)].IntersectRay(p.Rays[Next(i)], distance));
+        DoNotOptimize(distance);
+    });
+    runner.Run("BoundingBox/DistanceSquared", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Boxes[At(i)].DistanceSquared(p.Vec3[Next(i)])); });
+    runner.Run("BoundingBox/MergeBoxes", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::MergeBoxes(p.Boxes[At(i)], p.Boxes[Next(i)])); });
+    runner.Run("BoundingBox/TransformBy", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Boxes[At(i)].TransformBy(p.Mat3x4[Next(i)])); });
+    runner.Run("BoundingBox/TransformCorners", MediumIterations, [&](std::uint64_t i) {
+        // 对照：变换 8 个角点再求包围盒
+        TE::Vector3 corners[8];
+        p.Boxes[At(i)].GetCorners(corners);
+        const TE::Matrix3x4& matrix = p.Mat3x4[Next(i)];
+        TE::BoundingBox result(matrix.TransformPoint(corners[0]), matrix.TransformPoint(corners[0]));
+        for (int corner = 1; corner < 8; ++corner)
+            result.Expand(matrix.TransformPoint(corners[corner]));
+        DoNotOptimize(result);
+    });
+    runner.Run("BoundingSphere/TransformBy", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Spheres[At(i)].TransformBy(p.Mat3x4[Next(i)])); });
+    runner.Run("BoundingSphere/Intersects", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Spheres[At(i)].Intersects(p.Spheres[Next(i)])); });
+    runner.Run("BoundingSphere/IntersectsBox", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(p.Spheres[At(i)].Intersects(p.Boxes[Next(i)])); });
+    runner.Run("BoundingSphere/IntersectRay", CheapIterations, [&](std::uint64_t i) {
+        float distance = 0.0f;
+        DoNotOptimize(p.Spheres[At(i)].IntersectRay(p.Rays[Next(i)], distance));
+        DoNotOptimize(distance);
+    });
+    runner.Run("BoundingSphere/MergeSpheres", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::MergeSpheres(p.Spheres[At(i)], p.Spheres[Next(i)])); });
+}
+
+void BenchFrustum(BenchRunner& runner, const Pools& p)
+{
+    const TE::Matrix4 view = TE::Matrix4::LookAtRH(TE::Vector3(0.0f, 20.0f, 120.0f), TE::Vector3::Zero, TE::Vector3::Up);
+    const TE::Matrix4 proj = TE::Matrix4::PerspectiveRH_ZO(TE::Math::DegToRad(60.0f), 16.0f / 9.0f, 0.1f, 300.0f);
+    const TE::Matrix4 viewProjection = proj * view;
+    const TE::Frustum frustum = TE::Frustum::FromViewProjectionRH_ZO(viewProjection);
+
+    runner.Run("Frustum/FromViewProjection", MediumIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Frustum::FromViewProjectionRH_ZO(p.Mat4[At(i)] * viewProjection));
+    });
+    runner.Run("Frustum/IntersectsAABB", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(frustum.IntersectsAABB(p.Boxes[At(i)])); });
+    runner.Run("Frustum/IntersectsSphere", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(frustum.IntersectsSphere(p.Spheres[At(i)])); });
+    runner.Run("Frustum/ClassifyAABB", CheapIterations, [&](std::uint64_t i) {
+        std::uint8_t planeMask = TE::Frustum::AllPlanesMask;
+        std::uint8_t lastFailedPlane = 0;
+        DoNotOptimize(frustum.ClassifyAABB(p.Boxes[At(i)], planeMask, lastFailedPlane));
+    });
+
+    const TE::BoundingBoxSoA boxes{p.MinX, p.MinY, p.MinZ, p.MaxX, p.MaxY, p.MaxZ};
+    std::vector<std::uint64_t> mask(TE::Frustum::VisibilityMaskWords(PoolSize));
+    std::vector<std::uint8_t> planeCache(TE::Frustum::CullBlockCount(PoolSize), 0);
+    runner.Run("Frustum/CullAABBs x1024", BatchIterations * 4, [&](std::uint64_t) {
+        frustum.CullAABBs(boxes, mask);
+        DoNotOptimize(mask[0]);
+    });
+    runner.Run("Frustum/CullAABBs+cache x1024", BatchIterations * 4, [&](std::uint64_t) {
+        frustum.CullAABBs(boxes, mask, planeCache);
+        DoNotOptimize(mask[0]);
+    });
+}
+
+void BenchKernels(BenchRunner& runner, const Pools& p)
+{
+    // Scalar 参考实现与当前分派的 SIMD 路径并列，便于判断指令集收益
+    runner.Run("MatrixKernels/Scalar/Multiply", MediumIterations, [&](std::uint64_t i) {
+        TE::Matrix4 result(0.0f);
+        TE::MatrixKernels::Scalar::Multiply(&p.Mat4[At(i)].M[0][0], &p.Mat4[Next(i)].M[0][0], &result.M[0][0]);
+        DoNotOptimize(result);
+    });
+    runner.Run("MatrixKernels/Scalar/Inverse", MediumIterations, [&](std::uint64_t i) {
+        TE::Matrix4 result(0.0f);
+        DoNotOptimize(TE::MatrixKernels::Scalar::Inverse(&p.Mat4[At(i)].M[0][0], &result.M[0][0]));
+        DoNotOptimize(result);
+    });
+    runner.Run("MatrixKernels/Scalar/QuatToMatrix", MediumIterations, [&](std::uint64_t i) {
+        const TE::Quat& q = p.Quats[At(i)];
+        const float quat[4] = {q.X, q.Y, q.Z, q.W};
+        TE::Matrix4 result(0.0f);
+        TE::MatrixKernels::Scalar::QuatToMatrix(quat, &result.M[0][0]);
+        DoNotOptimize(result);
+    });
+
+    std::vector<TE::Matrix4> matrices(PoolSize);
+    std::vector<TE::Matrix3> normals(PoolSize);
+    runner.Run("TransformBatch/TransformsToMatrices x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::TransformsToMatrices(p.Positions, p.Rotations, p.Scales, matrices);
+        DoNotOptimize(matrices[0]);
+    });
+    const TE::Matrix4 viewProjection = p.Mat4[0];
+    runner.Run("TransformBatch/MultiplyMatrices x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::MultiplyMatrices(viewProjection, p.Mat4, matrices);
+        DoNotOptimize(matrices[0]);
+    });
+    runner.Run("TransformBatch/NormalMatrices x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::NormalMatrices(p.Mat4, normals);
+        DoNotOptimize(normals[0]);
+    });
+
+    std::vector<TE::Matrix3x4> affineMatrices(PoolSize);
+    std::vector<TE::Vector3> points(PoolSize);
+    runner.Run("TransformBatch/TransformsToMatrices3x4 x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::TransformsToMatrices(p.Positions, p.Rotations, p.Scales, affineMatrices);
+        DoNotOptimize(affineMatrices[0]);
+    });
+    runner.Run("TransformBatch/MultiplyMatrices3x4 x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::MultiplyMatrices(viewProjection, p.Mat3x4, matrices);
+        DoNotOptimize(matrices[0]);
+    });
+    runner.Run("TransformBatch/NormalMatrices3x4 x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::NormalMatrices(p.Mat3x4, normals);
+        DoNotOptimize(normals[0]);
+    });
+    runner.Run("TransformBatch/TransformPoints x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::TransformPoints(p.Mat3x4[0], p.Positions, points);
+        DoNotOptimize(points[0]);
+    });
+    std::vector<TE::BoundingBox> worldBounds(PoolSize);
+    runner.Run("TransformBatch/TransformBounds x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::TransformBounds(p.Boxes, p.Mat3x4, worldBounds);
+        DoNotOptimize(worldBounds[0]);
+    });
+}
+
+void BenchVertexPacking(BenchRunner& runner, const Pools& p)
+{
+    runner.Run("VertexPacking/FloatToHalf", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::FloatToHalf(p.Vec3[At(i)].X)); });
+    runner.Run("VertexPacking/Scalar/FloatToHalf", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::Scalar::FloatToHalf(p.Vec3[At(i)].X)); });
+    runner.Run("VertexPacking/PackSnorm4x8", CheapIterations, [&](std::uint64_t i) {
+        const TE::Vector3& v = p.Vec3[At(i)];
+        DoNotOptimize(TE::Math::PackSnorm4x8(TE::Vector4(v.X, v.Y, v.Z, 1.0f)));
+    });
+    runner.Run("VertexPacking/PackColorRGBA8", CheapIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::PackColorRGBA8(p.Colors[At(i)])); });
+    runner.Run("VertexPacking/PackOctahedral16", MediumIterations, [&](std::uint64_t i) { DoNotOptimize(TE::Math::PackOctahedral16(p.Vec3[At(i)])); });
+    runner.Run("VertexPacking/UnpackOctahedral16", CheapIterations, [&](std::uint64_t i) {
+        DoNotOptimize(TE::Math::UnpackOctahedral16(static_cast<std::uint32_t>(i * 2654435761u)));
+    });
+
+    std::vector<std::uint16_t> halves(PoolSize);
+    std::vector<float> floats(PoolSize);
+    runner.Run("VertexPacking/FloatsToHalves x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::FloatsToHalves(p.MinX, halves);
+        DoNotOptimize(halves[0]);
+    });
+    runner.Run("VertexPacking/HalvesToFloats x1024", BatchIterations, [&](std::uint64_t) {
+        TE::Math::HalvesToFloats(halves, floats);
+        DoNotOptimize(floats[0]);
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+
+    BenchRunner runner(TE::Bench::ParseArgs(argc, argv), TE::MatrixKernels::ActiveIsa());
+    std::cout << "[MathBench] ISA: " << TE::MatrixKernels::ActiveIsa() << "\n";
+
+    const Pools pools = BuildPools();
+    BenchVectors(runner, pools);
+    BenchMatrices(runner, pools);
+    BenchQuats(runner, pools);
+    BenchTransforms(runner, pools);
+    BenchScalarAndUtils(runner, pools);
+    BenchColors(runner, pools);
+    BenchRandom(runner);
+    BenchGeometry(runner, pools);
+    BenchFrustum(runner, pools);
+    BenchKernels(runner, pools);
+    BenchVertexPacking(runner, pools);
+
+    const int exitCode = runner.Finish();
+    TE::MemoryShutdown();
+    return exitCode;
+}
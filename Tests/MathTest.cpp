@@ -1,21 +1,30 @@
 // ToyEngine - Math 模块完整测试
-// 测试 MathTypes, Transform, MathUtils, Color, Random, Geometry
+// 测试 MathTypes, Transform, MathUtils, Color, Random, Geometry, MatrixKernels（SIMD 与标量参考实现等价）, TransformBatch, Frustum 批量剔除, Fast* 近似函数（误差上界）, RandomStream（跳跃、批量填充、线程局部门面）, Matrix3x4 仿射矩阵（复合、求逆、法线矩阵与批量接口）, 包围盒 / 包围球的仿射变换（Arvo 与批量 TransformBounds）, 射线包 vs AABB 与射线 vs SoA 三角形批量求交, 顶点量化与打包（半精度、snorm / unorm、八面体编码、RGBA8 往返误差）
 
 #include "Math/Vector.h"
 #include "Math/Matrix.h"
+#include "Math/MatrixKernels.h"
 #include "Math/Quat.h"
 #include "Math/Transform.h"
+#include "Math/TransformBatch.h"
 #include "Math/MathUtils.h"
 #include "Math/Color.h"
 #include "Math/Random.h"
+#include "Math/RayIntersection.h"
+#include "Math/RandomStream.h"
 #include "Math/Geometry.h"
 #include "Math/Frustum.h"
 #include "Math/VectorInt.h"
+#include "Math/VertexPacking.h"
 #include "Memory/Memory.h"
 
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -1070,6 +1079,1212 @@ bool TestIntVectors()
     return true;
 }
 
+// ==================== MatrixKernels 测试 ====================
+
+// 相对误差比较：|a - b| <= tolerance * max(1, |a|, |b|)
+bool NearlyEqualRelative(const float* a, const float* b, int count, float tolerance)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        const float scale = std::max({1.0f, std::abs(a[i]), std::abs(b[i])});
+        if (!(std::abs(a[i] - b[i]) <= tolerance * scale))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 范数相对误差：|a - b| <= tolerance * max(1, max|b|)；求逆结果各元素量级悬殊时按整体量级比较
+bool NearlyEqualNormRelative(const float* a, const float* b, int count, float tolerance)
+{
+    float scale = 1.0f;
+    for (int i = 0; i < count; ++i)
+        scale = std::max(scale, std::abs(b[i]));
+    for (int i = 0; i < count; ++i)
+    {
+        if (!(std::abs(a[i] - b[i]) <= tolerance * scale))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 确定性 LCG，保证各平台生成的测试矩阵一致
+struct FKernelTestRng
+{
+    std::uint32_t State = 0x12345678u;
+
+    float Next(float minValue, float maxValue)
+    {
+        State = State * 1664525u + 1013904223u;
+        const float unit = static_cast<float>(State >> 8) / static_cast<float>(1u << 24);
+        return minValue + (maxValue - minValue) * unit;
+    }
+};
+
+TE::Quat RandomUnitQuat(FKernelTestRng& rng)
+{
+    return TE::Quat(rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f)).Normalize();
+}
+
+// 随机 TRS 仿射矩阵（缩放远离 0，保证条件数可控）
+TE::Matrix4 RandomAffine(FKernelTestRng& rng)
+{
+    TE::Transform transform;
+    transform.Position = TE::Vector3(rng.Next(-50.0f, 50.0f), rng.Next(-50.0f, 50.0f), rng.Next(-50.0f, 50.0f));
+    transform.Rotation = RandomUnitQuat(rng);
+    transform.Scale = TE::Vector3(rng.Next(0.5f, 3.0f), rng.Next(0.5f, 3.0f), rng.Next(0.5f, 3.0f));
+    return transform.ToMatrix();
+}
+
+bool TestMatrixKernels()
+{
+    std::cout << "[MathTest] MatrixKernels (" << TE::MatrixKernels::ActiveIsa() << " vs scalar)...\n";
+
+    namespace MK = TE::MatrixKernels;
+    FKernelTestRng rng;
+    // 乘法 / 变换的累加顺序与标量一致，仅 FMA（AVX2 构建）改变中间舍入，部分和相消时按范数比较；
+    // 求逆的算法不同，按范数相对误差放宽到 1e-4
+    constexpr float ProductTolerance = 1e-5f;
+    constexpr float InverseTolerance = 1e-4f;
+
+    for (int iteration = 0; iteration < 256; ++iteration)
+    {
+        const TE::Matrix4 a = RandomAffine(rng);
+        TE::Matrix4 b = RandomAffine(rng);
+        // 非仿射矩阵：扰动最后一行，覆盖通用求逆（平移可达 ±50，扰动需足够小以免接近奇异）
+        TE::Matrix4 general = b;
+        general.M[0][3] = rng.Next(-0.005f, 0.005f);
+        general.M[1][3] = rng.Next(-0.005f, 0.005f);
+        general.M[2][3] = rng.Next(-0.005f, 0.005f);
+        general.M[3][3] = rng.Next(1.0f, 2.0f);
+
+        alignas(16) float simd[16];
+        alignas(16) float scalar[16];
+
+        MK::Multiply(a.Data(), general.Data(), simd);
+        MK::Scalar::Multiply(a.Data(), general.Data(), scalar);
+        if (!NearlyEqualNormRelative(simd, scalar, 16, ProductTolerance)) {
+            std::cerr << "[FAIL] MatrixKernels Multiply mismatch at iteration " << iteration << "\n";
+            return false;
+        }
+
+        const float vec[4] = {rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f), 1.0f};
+        MK::TransformVector(general.Data(), vec, simd);
+        MK::Scalar::TransformVector(general.Data(), vec, scalar);
+        if (!NearlyEqualNormRelative(simd, scalar, 4, ProductTolerance)) {
+            std::cerr << "[FAIL] MatrixKernels TransformVector mismatch at iteration " << iteration << "\n";
+            return false;
+        }
+
+        MK::Transpose(general.Data(), simd);
+        MK::Scalar::Transpose(general.Data(), scalar);
+        if (!NearlyEqualRelative(simd, scalar, 16, 0.0f)) {
+            std::cerr << "[FAIL] MatrixKernels Transpose mismatch at iteration " << iteration << "\n";
+            return false;
+        }
+
+        const float detSimd = MK::Inverse(general.Data(), simd);
+        const float detScalar = MK::Scalar::Inverse(general.Data(), scalar);
+        if (!NearlyEqualNormRelative(simd, scalar, 16, InverseTolerance) ||
+            !NearlyEqualRelative(&detSimd, &detScalar, 1, InverseTolerance)) {
+            std::cerr << "[FAIL] MatrixKernels Inverse mismatch at iteration " << iteration << "\n";
+            return false;
+        }
+
+        // M * M^-1 == I
+        TE::Matrix4 inverse(0.0f);
+        std::copy(simd, simd + 16, &inverse.M[0][0]);
+        const TE::Matrix4 product = general * inverse;
+        if (!NearlyEqualNormRelative(product.Data(), TE::Matrix4::Identity.Data(), 16, InverseTolerance)) {
+            std::cerr << "[FAIL] MatrixKernels M * Inverse(M) != I at iteration " << iteration << "\n";
+            return false;
+        }
+
+        // 仿射求逆：与标量版、与通用求逆一致
+        if (!MK::InverseAffine(a.Data(), simd) || !MK::Scalar::InverseAffine(a.Data(), scalar) ||
+            !NearlyEqualNormRelative(simd, scalar, 16, InverseTolerance)) {
+            std::cerr << "[FAIL] MatrixKernels InverseAffine mismatch at iteration " << iteration << "\n";
+            return false;
+        }
+        const TE::Matrix4 generalInverse = a.Inverse();
+        if (!NearlyEqualNormRelative(simd, generalInverse.Data(), 16, InverseTolerance)) {
+            std::cerr << "[FAIL] MatrixKernels InverseAffine != Inverse at iteration " << iteration << "\n";
+            return false;
+        }
+
+        const TE::Quat q = RandomUnitQuat(rng);
+        const float quat[4] = {q.X, q.Y, q.Z, q.W};
+        MK::QuatToMatrix(quat, simd);
+        MK::Scalar::QuatToMatrix(quat, scalar);
+        if (!NearlyEqualRelative(simd, scalar, 16, ProductTolerance)) {
+            std::cerr << "[FAIL] MatrixKernels QuatToMatrix mismatch at iteration " << iteration << "\n";
+            return false;
+        }
+
+        // 旋转矩阵作用于向量应与四元数旋转一致
+        const TE::Vector3 point(vec[0], vec[1], vec[2]);
+        const TE::Vector4 rotated = q.ToMatrix4() * TE::Vector4(point.X, point.Y, point.Z, 1.0f);
+        if (!ApproxEqual(TE::Vector3(rotated.X, rotated.Y, rotated.Z), q * point, 1e-4f)) {
+            std::cerr << "[FAIL] MatrixKernels QuatToMatrix disagrees with Quat * Vector3\n";
+            return false;
+        }
+    }
+
+    // 奇异仿射矩阵：返回 false，Matrix4::InverseAffine 退化为单位矩阵
+    const TE::Matrix4 singular = TE::Matrix4::Scale(TE::Vector3(1.0f, 0.0f, 1.0f));
+    alignas(16) float unused[16];
+    if (MK::InverseAffine(singular.Data(), unused) || MK::Scalar::InverseAffine(singular.Data(), unused)) {
+        std::cerr << "[FAIL] MatrixKernels InverseAffine should reject singular matrix\n";
+        return false;
+    }
+    if (!NearlyEqualRelative(singular.InverseAffine().Data(), TE::Matrix4::Identity.Data(), 16, 0.0f)) {
+        std::cerr << "[FAIL] Matrix4::InverseAffine singular fallback\n";
+        return false;
+    }
+
+    // 原地运算（输出与输入重叠）
+    TE::Matrix4 inPlace = RandomAffine(rng);
+    const TE::Matrix4 expectedSquare = inPlace * inPlace;
+    MK::Multiply(inPlace.Data(), inPlace.Data(), &inPlace.M[0][0]);
+    if (!NearlyEqualRelative(inPlace.Data(), expectedSquare.Data(), 16, 0.0f)) {
+        std::cerr << "[FAIL] MatrixKernels Multiply in-place\n";
+        return false;
+    }
+
+    std::cout << "[MathTest] MatrixKernels passed.\n";
+    return true;
+}
+
+// ==================== TransformBatch 测试 ====================
+
+bool TestTransformBatch()
+{
+    std::cout << "[MathTest] TransformBatch...\n";
+
+    FKernelTestRng rng;
+    rng.State = 0xC0FFEEu;
+    constexpr float Tolerance = 1e-5f;
+
+    // 覆盖空批、不足 4 个与带余数的批次
+    for (const size_t count : {size_t(0), size_t(1), size_t(3), size_t(4), size_t(37)})
+    {
+        std::vector<TE::Vector3> positions(count);
+        std::vector<TE::Quat> rotations(count);
+        std::vector<TE::Vector3> scales(count);
+        std::vector<TE::Transform> transforms(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            positions[i] = TE::Vector3(rng.Next(-50.0f, 50.0f), rng.Next(-50.0f, 50.0f), rng.Next(-50.0f, 50.0f));
+            rotations[i] = RandomUnitQuat(rng);
+            scales[i] = TE::Vector3(rng.Next(0.5f, 3.0f), rng.Next(0.5f, 3.0f), rng.Next(0.5f, 3.0f));
+            transforms[i] = TE::Transform(positions[i], rotations[i], scales[i]);
+        }
+
+        std::vector<TE::Matrix4> soaWorlds(count);
+        std::vector<TE::Matrix4> aosWorlds(count);
+        TE::Math::TransformsToMatrices(positions, rotations, scales, soaWorlds);
+        TE::Math::TransformsToMatrices(transforms, aosWorlds);
+
+        const TE::Matrix4 viewProjection =
+            TE::Matrix4::PerspectiveRH_ZO(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f) *
+            TE::Matrix4::LookAtRH(TE::Vector3(0.0f, 5.0f, 20.0f), TE::Vector3::Zero, TE::Vector3::Up);
+        std::vector<TE::Matrix4> mvps(count);
+        std::vector<TE::Matrix3> normals(count);
+        TE::Math::MultiplyMatrices(viewProjection, soaWorlds, mvps);
+        TE::Math::NormalMatrices(soaWorlds, normals);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const TE::Matrix4 expectedWorld = transforms[i].ToMatrix();
+            if (!NearlyEqualNormRelative(soaWorlds[i].Data(), expectedWorld.Data(), 16, Tolerance) ||
+                !NearlyEqualNormRelative(aosWorlds[i].Data(), expectedWorld.Data(), 16, Tolerance)) {
+                std::cerr << "[FAIL] TransformsToMatrices mismatch at " << i << " of " << count << "\n";
+                return false;
+            }
+
+            const TE::Matrix4 expectedMvp = viewProjection * soaWorlds[i];
+            if (!NearlyEqualNormRelative(mvps[i].Data(), expectedMvp.Data(), 16, Tolerance)) {
+                std::cerr << "[FAIL] MultiplyMatrices mismatch at " << i << " of " << count << "\n";
+                return false;
+            }
+
+            const TE::Matrix3 expectedNormal = soaWorlds[i].GetNormalMatrix();
+            if (!NearlyEqualNormRelative(normals[i].Data(), expectedNormal.Data(), 9, Tolerance)) {
+                std::cerr << "[FAIL] NormalMatrices mismatch at " << i << " of " << count << "\n";
+                return false;
+            }
+        }
+    }
+
+    // 原地批量乘法：输出与输入为同一数组
+    std::vector<TE::Matrix4> inPlace = {RandomAffine(rng), RandomAffine(rng), RandomAffine(rng)};
+    const std::vector<TE::Matrix4> original = inPlace;
+    const TE::Matrix4 lhs = RandomAffine(rng);
+    TE::Math::MultiplyMatrices(lhs, inPlace, inPlace);
+    for (size_t i = 0; i < inPlace.size(); ++i)
+    {
+        const TE::Matrix4 expected = lhs * original[i];
+        if (!NearlyEqualNormRelative(inPlace[i].Data(), expected.Data(), 16, Tolerance)) {
+            std::cerr << "[FAIL] MultiplyMatrices in-place\n";
+            return false;
+        }
+    }
+
+    std::cout << "[MathTest] TransformBatch passed.\n";
+    return true;
+}
+
+// ==================== Frustum 批量剔除测试 ====================
+
+bool TestFrustumBatchCulling()
+{
+    std::cout << "[MathTest] Frustum batch culling...\n";
+
+    const TE::Matrix4 viewProjection =
+        TE::Matrix4::PerspectiveRH_ZO(TE::Math::DegToRad(60.0f), 16.0f / 9.0f, 0.1f, 200.0f) *
+        TE::Matrix4::LookAtRH(TE::Vector3(0.0f, 10.0f, 30.0f), TE::Vector3::Zero, TE::Vector3::Up);
+    const TE::Frustum frustum = TE::Frustum::FromViewProjectionRH_ZO(viewProjection);
+
+    FKernelTestRng rng;
+    rng.State = 0xF00Du;
+
+    // 1005 个：覆盖满块与尾块
+    constexpr size_t Count = 1005;
+    std::vector<float> minX(Count), minY(Count), minZ(Count), maxX(Count), maxY(Count), maxZ(Count);
+    std::vector<float> centerX(Count), centerY(Count), centerZ(Count), radius(Count);
+    std::vector<TE::BoundingBox> boxes(Count);
+    std::vector<TE::BoundingSphere> spheres(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const TE::Vector3 center(rng.Next(-150.0f, 150.0f), rng.Next(-60.0f, 60.0f), rng.Next(-200.0f, 60.0f));
+        const TE::Vector3 extent(rng.Next(0.1f, 6.0f), rng.Next(0.1f, 6.0f), rng.Next(0.1f, 6.0f));
+        boxes[i] = TE::BoundingBox(center - extent, center + extent);
+        spheres[i] = TE::BoundingSphere(center, extent.X);
+        minX[i] = boxes[i].Min.X; minY[i] = boxes[i].Min.Y; minZ[i] = boxes[i].Min.Z;
+        maxX[i] = boxes[i].Max.X; maxY[i] = boxes[i].Max.Y; maxZ[i] = boxes[i].Max.Z;
+        centerX[i] = center.X; centerY[i] = center.Y; centerZ[i] = center.Z; radius[i] = extent.X;
+    }
+
+    const TE::BoundingBoxSoA boxSoA{minX, minY, minZ, maxX, maxY, maxZ};
+    const TE::BoundingSphereSoA sphereSoA{centerX, centerY, centerZ, radius};
+    std::vector<uint64_t> boxMask(TE::Frustum::VisibilityMaskWords(Count));
+    std::vector<uint64_t> sphereMask(TE::Frustum::VisibilityMaskWords(Count));
+    std::vector<uint8_t> planeCache(TE::Frustum::CullBlockCount(Count), 0);
+    std::vector<TE::EFrustumCullResult> classes(Count);
+
+    // 跑两遍：第二遍使用第一遍写入的平面一致性缓存，结果必须不变
+    size_t visibleCount = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        frustum.CullAABBs(boxSoA, boxMask, planeCache);
+        frustum.CullSpheres(sphereSoA, sphereMask);
+        frustum.ClassifyAABBs(boxSoA, classes);
+
+        visibleCount = 0;
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const bool boxVisible = (boxMask[i >> 6] >> (i & 63)) & 1u;
+            const bool sphereVisible = (sphereMask[i >> 6] >> (i & 63)) & 1u;
+            if (boxVisible != frustum.IntersectsAABB(boxes[i]) || sphereVisible != frustum.IntersectsSphere(spheres[i])) {
+                std::cerr << "[FAIL] Frustum batch cull mismatch at " << i << " (pass " << pass << ")\n";
+                return false;
+            }
+
+            uint8_t planeMask = TE::Frustum::AllPlanesMask;
+            uint8_t lastFailed = 0;
+            if (classes[i] != frustum.ClassifyAABB(boxes[i], planeMask, lastFailed) ||
+                (classes[i] == TE::EFrustumCullResult::Outside) == boxVisible) {
+                std::cerr << "[FAIL] Frustum ClassifyAABBs mismatch at " << i << "\n";
+                return false;
+            }
+            visibleCount += boxVisible ? 1 : 0;
+        }
+    }
+    // 随机分布需要同时产生可见与不可见对象，否则上面的比较没有意义
+    if (visibleCount == 0 || visibleCount == Count) {
+        std::cerr << "[FAIL] Frustum batch test data degenerate\n";
+        return false;
+    }
+    // 尾块之后的位必须为 0
+    if ((boxMask.back() >> (Count & 63)) != 0) {
+        std::cerr << "[FAIL] Frustum batch mask tail bits\n";
+        return false;
+    }
+
+    // 分级剔除：父节点完全在内时掩码清空，子节点无需再测
+    uint8_t planeMask = TE::Frustum::AllPlanesMask;
+    uint8_t lastFailed = 0;
+    const TE::BoundingBox small(TE::Vector3(-1.0f, -1.0f, -1.0f), TE::Vector3(1.0f, 1.0f, 1.0f));
+    if (frustum.ClassifyAABB(small, planeMask, lastFailed) != TE::EFrustumCullResult::Inside || planeMask != 0) {
+        std::cerr << "[FAIL] Frustum ClassifyAABB inside\n";
+        return false;
+    }
+    planeMask = TE::Frustum::AllPlanesMask;
+    const TE::BoundingBox huge(TE::Vector3(-1000.0f, -1000.0f, -1000.0f), TE::Vector3(1000.0f, 1000.0f, 1000.0f));
+    if (frustum.ClassifyAABB(huge, planeMask, lastFailed) != TE::EFrustumCullResult::Intersect || planeMask == 0) {
+        std::cerr << "[FAIL] Frustum ClassifyAABB intersect\n";
+        return false;
+    }
+    // 相机后方：被某平面剔除并记录到一致性缓存
+    planeMask = TE::Frustum::AllPlanesMask;
+    lastFailed = 0;
+    const TE::BoundingSphere behind(TE::Vector3(0.0f, 10.0f, 60.0f), 1.0f);
+    if (frustum.ClassifySphere(behind, planeMask, lastFailed) != TE::EFrustumCullResult::Outside ||
+        frustum.GetPlane(static_cast<TE::EFrustumPlane>(lastFailed)).SignedDistance(behind.Center) >= -behind.Radius) {
+        std::cerr << "[FAIL] Frustum ClassifySphere outside / last failed plane\n";
+        return false;
+    }
+
+    std::cout << "[MathTest] Frustum batch culling passed.\n";
+    return true;
+}
+
+// ==================== 快速近似数学测试 ====================
+
+// 在 [min, max] 上均匀取 count 个点
+std::vector<float> FastMathSweep(float min, float max, size_t count)
+{
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        values[i] = min + (max - min) * static_cast<float>(static_cast<double>(i) / static_cast<double>(count - 1));
+    }
+    return values;
+}
+
+// 标量与批量版本都与 double 精度参考比较；误差上界即 ScalarMath.h 中标注的数值
+template<typename FScalarFn, typename FBulkFn, typename FReferenceFn>
+bool CheckFastFunction(const char* name, const std::vector<float>& inputs, double maxError, bool relative,
+                       FScalarFn&& scalarFn, FBulkFn&& bulkFn, FReferenceFn&& referenceFn)
+{
+    std::vector<float> bulk(inputs.size());
+    bulkFn(inputs, bulk);
+    double worst = 0.0;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        const double reference = referenceFn(static_cast<double>(inputs[i]));
+        const double scale = relative ? std::abs(reference) : 1.0;
+        worst = std::max({worst,
+                          std::abs(static_cast<double>(scalarFn(inputs[i])) - reference) / scale,
+                          std::abs(static_cast<double>(bulk[i]) - reference) / scale});
+    }
+    if (worst > maxError) {
+        std::cerr << "[FAIL] " << name << " max error " << worst << " > " << maxError << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool TestFastMath()
+{
+    std::cout << "[MathTest] Fast math approximations...\n";
+    using namespace TE::Math;
+
+    // 奇数个样本：覆盖 SIMD 主循环与标量尾部
+    constexpr size_t Count = 200003;
+    bool passed = true;
+
+    const std::vector<float> angles = FastMathSweep(-25000.0f, 25000.0f, Count);
+    const std::vector<float> smallAngles = FastMathSweep(-7.0f, 7.0f, Count);
+    for (const std::vector<float>* input : {&angles, &smallAngles})
+    {
+        passed &= CheckFastFunction("FastSin", *input, 5e-7, false,
+            [](float x) { return FastSin(x); },
+            [](const std::vector<float>& in, std::vector<float>& out) { FastSin(in, out); },
+            [](double x) { return std::sin(x); });
+        passed &= CheckFastFunction("FastCos", *input, 5e-7, false,
+            [](float x) { return FastCos(x); },
+            [](const std::vector<float>& in, std::vector<float>& out) { FastCos(in, out); },
+            [](double x) { return std::cos(x); });
+    }
+
+    // FastSinCos 必须与单独的 FastSin / FastCos 一致
+    std::vector<float> sinValues(Count), cosValues(Count), sinOnly(Count), cosOnly(Count);
+    FastSinCos(smallAngles, sinValues, cosValues);
+    FastSin(smallAngles, sinOnly);
+    FastCos(smallAngles, cosOnly);
+    if (sinValues != sinOnly || cosValues != cosOnly) {
+        std::cerr << "[FAIL] FastSinCos differs from FastSin / FastCos\n";
+        passed = false;
+    }
+
+    const std::vector<float> unit = FastMathSweep(-1.0f, 1.0f, Count);
+    passed &= CheckFastFunction("FastAsin", unit, 1e-6, false,
+        [](float x) { return FastAsin(x); },
+        [](const std::vector<float>& in, std::vector<float>& out) { FastAsin(in, out); },
+        [](double x) { return std::asin(x); });
+    passed &= CheckFastFunction("FastAcos", unit, 1e-6, false,
+        [](float x) { return FastAcos(x); },
+        [](const std::vector<float>& in, std::vector<float>& out) { FastAcos(in, out); },
+        [](double x) { return std::acos(x); });
+
+    const std::vector<float> exponents = FastMathSweep(-126.0f, 127.0f, Count);
+    passed &= CheckFastFunction("FastExp2", exponents, 5e-7, true,
+        [](float x) { return FastExp2(x); },
+        [](const std::vector<float>& in, std::vector<float>& out) { FastExp2(in, out); },
+        [](double x) { return std::exp2(x); });
+
+    std::vector<float> positives(Count);
+    std::transform(exponents.begin(), exponents.end(), positives.begin(), [](float e) { return std::exp2(std::max(e, -125.0f)); });
+    passed &= CheckFastFunction("FastLog2", positives, 5e-7, false,
+        [](float x) { return FastLog2(x); },
+        [](const std::vector<float>& in, std::vector<float>& out) { FastLog2(in, out); },
+        [](double x) { return std::log2(x); });
+    passed &= CheckFastFunction("FastRsqrt", positives, 5e-6, true,
+        [](float x) { return FastRsqrt(x); },
+        [](const std::vector<float>& in, std::vector<float>& out) { FastRsqrt(in, out); },
+        [](double x) { return 1.0 / std::sqrt(x); });
+
+    // atan2：极坐标采样覆盖全部象限与 1e-3 ~ 1e3 的幅值
+    std::vector<float> ys, xs;
+    for (int angleIndex = 0; angleIndex < 2001; ++angleIndex)
+    {
+        const double angle = -PI + TWO_PI * angleIndex / 2000.0;
+        for (int magnitudeIndex = 0; magnitudeIndex < 61; ++magnitudeIndex)
+        {
+            const double magnitude = std::pow(10.0, -3.0 + magnitudeIndex / 10.0);
+            ys.push_back(static_cast<float>(magnitude * std::sin(angle)));
+            xs.push_back(static_cast<float>(magnitude * std::cos(angle)));
+        }
+    }
+    std::vector<float> atanValues(ys.size());
+    FastAtan2(ys, xs, atanValues);
+    double worstAtan = 0.0;
+    for (size_t i = 0; i < ys.size(); ++i)
+    {
+        const double reference = std::atan2(static_cast<double>(ys[i]), static_cast<double>(xs[i]));
+        for (const float value : {FastAtan2(ys[i], xs[i]), atanValues[i]})
+        {
+            double error = std::abs(static_cast<double>(value) - reference);
+            error = std::min(error, std::abs(error - 2.0 * PI)); // ±π 分支切割处两侧等价
+            worstAtan = std::max(worstAtan, error);
+        }
+    }
+    if (worstAtan > 3e-6 || FastAtan2(0.0f, 0.0f) != 0.0f || FastAtan2(0.0f, -1.0f) != PI) {
+        std::cerr << "[FAIL] FastAtan2 max error " << worstAtan << "\n";
+        passed = false;
+    }
+
+    // 快速归一化
+    const TE::Vector3 v(3.0f, -4.0f, 12.0f);
+    if (!ApproxEqual(FastNormalize(v), v.Normalize(), 1e-6f) ||
+        !ApproxEqual(FastNormalize(TE::Vector3::Zero), TE::Vector3::Zero) ||
+        !ApproxEqual(FastNormalize(TE::Vector4(0.0f, 0.0f, 0.0f, 2.0f)).W, 1.0f, 1e-6f)) {
+        std::cerr << "[FAIL] FastNormalize\n";
+        passed = false;
+    }
+
+    if (passed) {
+        std::cout << "[MathTest] Fast math approximations passed.\n";
+    }
+    return passed;
+}
+
+// ==================== RandomStream 测试 ====================
+
+bool TestRandomStream()
+{
+    std::cout << "[MathTest] RandomStream...\n";
+    bool passed = true;
+
+    // 相同 (seed, streamId) 序列一致；不同流 ID 序列不同
+    {
+        TE::RandomStream a(777, 3);
+        TE::RandomStream b(777, 3);
+        TE::RandomStream c(777, 4);
+        int sameAsOtherStream = 0;
+        for (int i = 0; i < 1000; ++i) {
+            const uint32_t va = a.NextUInt32();
+            if (va != b.NextUInt32()) {
+                std::cerr << "[FAIL] RandomStream not deterministic\n";
+                return false;
+            }
+            if (va == c.NextUInt32()) sameAsOtherStream++;
+        }
+        if (sameAsOtherStream > 2) {
+            std::cerr << "[FAIL] RandomStream streams are correlated\n";
+            passed = false;
+        }
+        if (a.Fork(4).NextUInt32() != TE::RandomStream(777, 4).NextUInt32()) {
+            std::cerr << "[FAIL] RandomStream::Fork\n";
+            passed = false;
+        }
+    }
+
+    // Advance(n) 等价于 n 次 NextUInt32
+    for (uint64_t delta : {0ull, 1ull, 7ull, 8ull, 1000ull, 65537ull}) {
+        TE::RandomStream stepped(99, 5);
+        TE::RandomStream jumped(99, 5);
+        for (uint64_t i = 0; i < delta; ++i) (void)stepped.NextUInt32();
+        jumped.Advance(delta);
+        if (stepped.NextUInt32() != jumped.NextUInt32()) {
+            std::cerr << "[FAIL] RandomStream::Advance(" << delta << ")\n";
+            passed = false;
+        }
+    }
+
+    // 批量填充与逐个取值序列一致（含非 8 对齐的尾部），之后的状态也一致
+    {
+        constexpr size_t Count = 1003;
+        TE::RandomStream bulk(2024, 11);
+        TE::RandomStream serial(2024, 11);
+
+        std::vector<uint32_t> bits(Count);
+        bulk.FillUInt32(bits);
+        for (size_t i = 0; i < Count; ++i) {
+            if (bits[i] != serial.NextUInt32()) {
+                std::cerr << "[FAIL] RandomStream::FillUInt32 mismatch at " << i << "\n";
+                return false;
+            }
+        }
+
+        std::vector<float> values(Count);
+        bulk.FillUniform(values, -3.0f, 5.0f);
+        for (size_t i = 0; i < Count; ++i) {
+            const float expected = serial.NextFloat(-3.0f, 5.0f);
+            if (values[i] != expected || values[i] < -3.0f || values[i] >= 5.0f) {
+                std::cerr << "[FAIL] RandomStream::FillUniform mismatch at " << i << "\n";
+                return false;
+            }
+        }
+
+        std::vector<TE::Vector3> points(Count);
+        bulk.FillInsideSphere(points, 2.0f);
+        TE::Vector3 mean = TE::Vector3::Zero;
+        for (size_t i = 0; i < Count; ++i) {
+            const TE::Vector3 expected = serial.NextInsideSphere(2.0f);
+            if (!ApproxEqual(points[i], expected, 1e-5f) || points[i].Length() > 2.0f + 1e-4f) {
+                std::cerr << "[FAIL] RandomStream::FillInsideSphere mismatch at " << i << "\n";
+                return false;
+            }
+            mean += points[i];
+        }
+        mean = mean * (1.0f / static_cast<float>(Count));
+        if (mean.Length() > 0.15f) {
+            std::cerr << "[FAIL] RandomStream::FillInsideSphere not centered\n";
+            passed = false;
+        }
+
+        if (bulk.NextUInt32() != serial.NextUInt32()) {
+            std::cerr << "[FAIL] RandomStream state diverged after bulk fill\n";
+            passed = false;
+        }
+    }
+
+    // 静态门面：Seed(s) 与 Random(s) 及 RandomStream(s, s) 序列一致
+    {
+        TE::Random::Seed(12345);
+        TE::Random instance(12345);
+        TE::RandomStream stream(12345, 12345);
+        for (int i = 0; i < 100; ++i) {
+            const float v = TE::Random::Value();
+            if (v != instance.NextFloat() || v != stream.NextFloat()) {
+                std::cerr << "[FAIL] Random facade sequence\n";
+                passed = false;
+                break;
+            }
+        }
+    }
+
+    // 线程局部状态：各线程 Seed 相同种子得到相同序列，互不干扰
+    {
+        constexpr int ThreadCount = 4;
+        std::vector<std::vector<float>> results(ThreadCount);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t) {
+            threads.emplace_back([&results, t]() {
+                TE::Random::Seed(42);
+                for (int i = 0; i < 10000; ++i) {
+                    results[t].push_back(TE::Random::Gaussian(0.0f, 1.0f));
+                }
+            });
+        }
+        for (std::thread& thread : threads) thread.join();
+        for (int t = 1; t < ThreadCount; ++t) {
+            if (results[t] != results[0]) {
+                std::cerr << "[FAIL] Random thread-local streams not independent\n";
+                passed = false;
+                break;
+            }
+        }
+    }
+
+    if (passed) {
+        std::cout << "[MathTest] RandomStream passed.\n";
+    }
+    return passed;
+}
+
+// ==================== Matrix3x4 测试 ====================
+
+bool TestMatrix3x4()
+{
+    std::cout << "[MathTest] Matrix3x4...\n";
+
+    FKernelTestRng rng;
+    rng.State = 0x3A4B5C6Du;
+    constexpr float Tolerance = 1e-5f;
+
+    static_assert(sizeof(TE::Matrix3x4) == 48, "Matrix3x4 must stay 3/4 of Matrix4");
+
+    const TE::Matrix4 viewProjection =
+        TE::Matrix4::PerspectiveRH_ZO(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f) *
+        TE::Matrix4::LookAtRH(TE::Vector3(0.0f, 5.0f, 20.0f), TE::Vector3::Zero, TE::Vector3::Up);
+
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        const TE::Matrix4 a4 = RandomAffine(rng);
+        const TE::Matrix4 b4 = RandomAffine(rng);
+        const TE::Matrix3x4 a(a4);
+        const TE::Matrix3x4 b(b4);
+
+        // 往返转换与元素访问
+        if (!NearlyEqualRelative(a.ToMatrix4().Data(), a4.Data(), 16, 0.0f) || a(3, 1) != a4(3, 1)) {
+            std::cerr << "[FAIL] Matrix3x4 <-> Matrix4 round trip\n";
+            return false;
+        }
+
+        // 复合：SIMD 与标量参考、与 4x4 乘法一致
+        const TE::Matrix3x4 ab = a * b;
+        TE::Matrix3x4 scalarAb;
+        TE::MatrixKernels::Scalar::Multiply3x4(a.Data(), b.Data(), &scalarAb.M[0][0]);
+        const TE::Matrix4 expectedAb = a4 * b4;
+        if (!NearlyEqualNormRelative(ab.ToMatrix4().Data(), expectedAb.Data(), 16, Tolerance) ||
+            !NearlyEqualNormRelative(ab.Data(), scalarAb.Data(), 12, Tolerance)) {
+            std::cerr << "[FAIL] Matrix3x4 compose\n";
+            return false;
+        }
+
+        // 4x4 * 3x4
+        const TE::Matrix4 mvp = viewProjection * a;
+        TE::Matrix4 scalarMvp;
+        TE::MatrixKernels::Scalar::Multiply4x4By3x4(viewProjection.Data(), a.Data(), &scalarMvp.M[0][0]);
+        const TE::Matrix4 expectedMvp = viewProjection * a4;
+        if (!NearlyEqualNormRelative(mvp.Data(), expectedMvp.Data(), 16, Tolerance) ||
+            !NearlyEqualNormRelative(scalarMvp.Data(), expectedMvp.Data(), 16, Tolerance)) {
+            std::cerr << "[FAIL] Matrix4 * Matrix3x4\n";
+            return false;
+        }
+
+        // 求逆：与 Matrix4::InverseAffine 一致，且 a * a^-1 = I
+        const TE::Matrix3x4 inverse = a.Inverse();
+        TE::Matrix3x4 scalarInverse;
+        const bool scalarOk = TE::MatrixKernels::Scalar::Inverse3x4(a.Data(), &scalarInverse.M[0][0]);
+        const TE::Matrix4 expectedInverse = a4.InverseAffine();
+        const TE::Matrix3x4 roundTrip = a * inverse;
+        if (!scalarOk ||
+            !NearlyEqualNormRelative(inverse.ToMatrix4().Data(), expectedInverse.Data(), 16, Tolerance) ||
+            !NearlyEqualNormRelative(scalarInverse.Data(), inverse.Data(), 12, Tolerance) ||
+            !NearlyEqualNormRelative(roundTrip.Data(), TE::Matrix3x4::Identity.Data(), 12, 1e-4f)) {
+            std::cerr << "[FAIL] Matrix3x4 Inverse\n";
+            return false;
+        }
+
+        // 法线矩阵与行列式
+        const TE::Matrix3 normal = a.GetNormalMatrix();
+        TE::Matrix3 scalarNormal;
+        TE::MatrixKernels::Scalar::NormalMatrix3x4(a.Data(), &scalarNormal.M[0][0]);
+        const TE::Matrix3 expectedNormal = a4.GetNormalMatrix();
+        if (!NearlyEqualNormRelative(normal.Data(), expectedNormal.Data(), 9, Tolerance) ||
+            !NearlyEqualNormRelative(scalarNormal.Data(), expectedNormal.Data(), 9, Tolerance) ||
+            !ApproxEqual(a.Determinant(), a4.Determinant(), std::abs(a4.Determinant()) * 1e-5f)) {
+            std::cerr << "[FAIL] Matrix3x4 GetNormalMatrix\n";
+            return false;
+        }
+
+        // 点 / 方向变换
+        const TE::Vector3 point(rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f));
+        const TE::Vector4 expectedPoint = a4 * TE::Vector4(point, 1.0f);
+        const TE::Vector4 expectedVector = a4 * TE::Vector4(point, 0.0f);
+        if (!ApproxEqual(a.TransformPoint(point), TE::Vector3(expectedPoint.X, expectedPoint.Y, expectedPoint.Z), 1e-3f) ||
+            !ApproxEqual(a.TransformVector(point), TE::Vector3(expectedVector.X, expectedVector.Y, expectedVector.Z), 1e-3f)) {
+            std::cerr << "[FAIL] Matrix3x4 TransformPoint / TransformVector\n";
+            return false;
+        }
+    }
+
+    // 奇异线性部分：与 Matrix4::InverseAffine 相同返回单位矩阵
+    TE::Matrix3x4 singular;
+    singular.M[2][2] = 0.0f;
+    if (!NearlyEqualRelative(singular.Inverse().Data(), TE::Matrix3x4::Identity.Data(), 12, 0.0f)) {
+        std::cerr << "[FAIL] Matrix3x4 singular Inverse\n";
+        return false;
+    }
+
+    // 批量接口：3x4 输出与 Matrix4 路径一致（覆盖不足 4 个与带余数的批次）
+    for (const size_t count : {size_t(0), size_t(3), size_t(4), size_t(37)})
+    {
+        std::vector<TE::Vector3> positions(count);
+        std::vector<TE::Quat> rotations(count);
+        std::vector<TE::Vector3> scales(count);
+        std::vector<TE::Transform> transforms(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            positions[i] = TE::Vector3(rng.Next(-50.0f, 50.0f), rng.Next(-50.0f, 50.0f), rng.Next(-50.0f, 50.0f));
+            rotations[i] = RandomUnitQuat(rng);
+            scales[i] = TE::Vector3(rng.Next(0.5f, 3.0f), rng.Next(0.5f, 3.0f), rng.Next(0.5f, 3.0f));
+            transforms[i] = TE::Transform(positions[i], rotations[i], scales[i]);
+        }
+
+        std::vector<TE::Matrix3x4> soaWorlds(count);
+        std::vector<TE::Matrix3x4> aosWorlds(count);
+        std::vector<TE::Matrix4> mvps(count);
+        std::vector<TE::Matrix3> normals(count);
+        TE::Math::TransformsToMatrices(positions, rotations, scales, soaWorlds);
+        TE::Math::TransformsToMatrices(transforms, aosWorlds);
+        TE::Math::MultiplyMatrices(viewProjection, soaWorlds, mvps);
+        TE::Math::NormalMatrices(soaWorlds, normals);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const TE::Matrix4 expectedWorld = transforms[i].ToMatrix();
+            const TE::Matrix4 expectedMvp = viewProjection * expectedWorld;
+            const TE::Matrix3 expectedNormal = expectedWorld.GetNormalMatrix();
+            if (!NearlyEqualNormRelative(soaWorlds[i].ToMatrix4().Data(), expectedWorld.Data(), 16, Tolerance) ||
+                !NearlyEqualNormRelative(aosWorlds[i].ToMatrix4().Data(), expectedWorld.Data(), 16, Tolerance) ||
+                !NearlyEqualNormRelative(mvps[i].Data(), expectedMvp.Data(), 16, Tolerance) ||
+                !NearlyEqualNormRelative(normals[i].Data(), expectedNormal.Data(), 9, Tolerance)) {
+                std::cerr << "[FAIL] Matrix3x4 batch mismatch at " << i << " of " << count << "\n";
+                return false;
+            }
+        }
+
+        // 批量点变换（含原地）
+        const TE::Matrix3x4 matrix(RandomAffine(rng));
+        std::vector<TE::Vector3> transformed(count);
+        TE::Math::TransformPoints(matrix, positions, transformed);
+        TE::Math::TransformPoints(matrix, positions, positions);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const TE::Vector3 expected = matrix.TransformPoint(TE::Vector3(transforms[i].Position));
+            if (!ApproxEqual(transformed[i], expected, 1e-3f) || !ApproxEqual(positions[i], expected, 1e-3f)) {
+                std::cerr << "[FAIL] TransformPoints mismatch at " << i << " of " << count << "\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "[MathTest] Matrix3x4 passed.\n";
+    return true;
+}
+
+bool TestBoundsTransform()
+{
+    std::cout << "[MathTest] Bounds transform...\n";
+
+    FKernelTestRng rng;
+    rng.State = 0x5EEDB0B5u;
+    constexpr float Tolerance = 1e-4f;
+
+    auto boxNearlyEqual = [](const TE::BoundingBox& a, const TE::BoundingBox& b, float tolerance) {
+        const float scale = std::max(1.0f, b.GetDiagonal());
+        return ApproxEqual(a.Min, b.Min, tolerance * scale) && ApproxEqual(a.Max, b.Max, tolerance * scale);
+    };
+
+    constexpr std::size_t Count = 103; // 覆盖 SIMD 主循环与尾部
+    std::vector<TE::BoundingBox> localBounds(Count);
+    std::vector<TE::Matrix3x4> worldMatrices(Count);
+    std::vector<TE::BoundingBox> expected(Count);
+
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        const TE::Vector3 center(rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f));
+        const TE::Vector3 extents(rng.Next(0.0f, 5.0f), rng.Next(0.0f, 5.0f), rng.Next(0.0f, 5.0f));
+        localBounds[i] = TE::BoundingBox::FromCenterExtents(center, extents);
+        const TE::Matrix4 world4 = RandomAffine(rng);
+        worldMatrices[i] = TE::Matrix3x4(world4);
+
+        // 参考：变换 8 个角点后求包围盒
+        TE::Vector3 corners[8];
+        localBounds[i].GetCorners(corners);
+        TE::BoundingBox reference(worldMatrices[i].TransformPoint(corners[0]), worldMatrices[i].TransformPoint(corners[0]));
+        for (const TE::Vector3& corner : corners)
+        {
+            reference.Expand(worldMatrices[i].TransformPoint(corner));
+        }
+        expected[i] = reference;
+
+        if (!boxNearlyEqual(localBounds[i].TransformBy(worldMatrices[i]), reference, Tolerance) ||
+            !boxNearlyEqual(localBounds[i].TransformBy(world4), reference, Tolerance)) {
+            std::cerr << "[FAIL] BoundingBox::TransformBy != transformed corners\n";
+            return false;
+        }
+
+        // 包围球：变换后的球包含原球表面点的像
+        const TE::BoundingSphere sphere(center, extents.Length() + 0.1f);
+        const TE::BoundingSphere worldSphere = sphere.TransformBy(worldMatrices[i]);
+        for (int sample = 0; sample < 8; ++sample)
+        {
+            const TE::Vector3 direction = TE::Vector3(rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f)).Normalize();
+            const TE::Vector3 surface = worldMatrices[i].TransformPoint(sphere.Center + direction * sphere.Radius);
+            if (TE::Vector3::Distance(surface, worldSphere.Center) > worldSphere.Radius * (1.0f + Tolerance)) {
+                std::cerr << "[FAIL] BoundingSphere::TransformBy does not enclose transformed surface\n";
+                return false;
+            }
+        }
+    }
+
+    // 均匀缩放 + 平移时球半径精确
+    const TE::Transform uniform(TE::Vector3(1.0f, 2.0f, 3.0f), TE::Quat(TE::Vector3::Up, 0.7f), TE::Vector3(2.0f, 2.0f, 2.0f));
+    const TE::BoundingSphere uniformSphere = TE::BoundingSphere(TE::Vector3::Zero, 1.5f).TransformBy(uniform.ToMatrix3x4());
+    if (!ApproxEqual(uniformSphere.Radius, 3.0f) || !ApproxEqual(uniformSphere.Center, TE::Vector3(1.0f, 2.0f, 3.0f))) {
+        std::cerr << "[FAIL] BoundingSphere::TransformBy uniform scale\n";
+        return false;
+    }
+
+    // 批量：与逐个 TransformBy 一致，且支持原地
+    std::vector<TE::BoundingBox> batched(Count);
+    TE::Math::TransformBounds(localBounds, worldMatrices, batched);
+    TE::Math::TransformBounds(localBounds, worldMatrices, localBounds);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        if (!boxNearlyEqual(batched[i], expected[i], Tolerance) || !boxNearlyEqual(localBounds[i], expected[i], Tolerance)) {
+            std::cerr << "[FAIL] Math::TransformBounds at " << i << "\n";
+            return false;
+        }
+    }
+
+    std::cout << "  All passed.\n";
+    return true;
+}
+
+bool TestRayIntersection()
+{
+    std::cout << "[MathTest] Ray intersection kernels...\n";
+
+    FKernelTestRng rng;
+    rng.State = 0x7A1CE5u;
+    constexpr float Tolerance = 1e-4f;
+
+    // 标量 Möller–Trumbore：重心坐标与距离
+    {
+        const TE::Ray ray(TE::Vector3(0.25f, 0.25f, 5.0f), TE::Vector3(0.0f, 0.0f, -1.0f));
+        float distance = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+        const TE::Vector3 a(0.0f, 0.0f, 1.0f), b(1.0f, 0.0f, 1.0f), c(0.0f, 1.0f, 1.0f);
+        if (!TE::IntersectRayTriangle(ray, a, b, c, 100.0f, distance, u, v) ||
+            !ApproxEqual(distance, 4.0f) || !ApproxEqual(u, 0.25f) || !ApproxEqual(v, 0.25f) ||
+            TE::IntersectRayTriangle(ray, a, b, c, 3.0f, distance, u, v) ||
+            TE::IntersectRayTriangle(TE::Ray(ray.Origin, TE::Vector3(0.0f, 0.0f, 1.0f)), a, b, c, 100.0f, distance, u, v)) {
+            std::cerr << "[FAIL] IntersectRayTriangle\n";
+            return false;
+        }
+    }
+
+    // 三角形汤：共 37 个（覆盖补齐的尾块）
+    std::vector<TE::Vector3> vertices;
+    TE::TriangleSoA triangles;
+    for (int i = 0; i < 37; ++i)
+    {
+        const TE::Vector3 center(rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f));
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            vertices.push_back(center + TE::Vector3(rng.Next(-3.0f, 3.0f), rng.Next(-3.0f, 3.0f), rng.Next(-3.0f, 3.0f)));
+        }
+        if (triangles.Add(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]) != static_cast<uint32_t>(i)) {
+            std::cerr << "[FAIL] TriangleSoA::Add index\n";
+            return false;
+        }
+    }
+    if (triangles.Size() != 37 || triangles.PaddedSize() != 40) {
+        std::cerr << "[FAIL] TriangleSoA padding\n";
+        return false;
+    }
+
+    for (int iteration = 0; iteration < 500; ++iteration)
+    {
+        // 一半射线瞄准随机三角形内部，保证有命中
+        const TE::Vector3 origin(rng.Next(-30.0f, 30.0f), rng.Next(-30.0f, 30.0f), rng.Next(-30.0f, 30.0f));
+        TE::Vector3 target(rng.Next(-15.0f, 15.0f), rng.Next(-15.0f, 15.0f), rng.Next(-15.0f, 15.0f));
+        if (iteration % 2 == 0)
+        {
+            const int t = iteration % 37;
+            const float u = rng.Next(0.1f, 0.45f);
+            const float v = rng.Next(0.1f, 0.45f);
+            target = vertices[t * 3] + (vertices[t * 3 + 1] - vertices[t * 3]) * u + (vertices[t * 3 + 2] - vertices[t * 3]) * v;
+        }
+        const TE::Ray ray(origin, target - origin);
+        const float maxDistance = rng.Next(10.0f, 80.0f);
+
+        // 参考：逐个标量求交
+        bool expectedFound = false;
+        TE::RayTriangleHit expected;
+        for (uint32_t t = 0; t < 37; ++t)
+        {
+            float distance = 0.0f;
+            float u = 0.0f;
+            float v = 0.0f;
+            if (TE::IntersectRayTriangle(ray, vertices[t * 3], vertices[t * 3 + 1], vertices[t * 3 + 2], maxDistance, distance, u, v) &&
+                (!expectedFound || distance < expected.Distance))
+            {
+                expectedFound = true;
+                expected = {distance, u, v, t};
+            }
+        }
+
+        TE::RayTriangleHit hit;
+        const bool found = TE::Math::RaycastTriangles(ray, triangles, maxDistance, hit);
+        if (found != expectedFound || TE::Math::AnyTriangleHit(ray, triangles, maxDistance) != expectedFound ||
+            (found && (!ApproxEqual(hit.Distance, expected.Distance, Tolerance * std::max(1.0f, expected.Distance)) ||
+                       (hit.TriangleIndex == expected.TriangleIndex &&
+                        (!ApproxEqual(hit.U, expected.U, Tolerance) || !ApproxEqual(hit.V, expected.V, Tolerance)))))) {
+            std::cerr << "[FAIL] RaycastTriangles / AnyTriangleHit at iteration " << iteration << "\n";
+            return false;
+        }
+
+        // 4 / 8 通道内核逐块与标量一致
+        for (size_t first = 0; first < triangles.PaddedSize(); first += 8)
+        {
+            float distances8[8];
+            float distances4[8];
+            const uint32_t mask8 = TE::Math::IntersectTriangles8(ray, triangles, first, maxDistance, distances8);
+            const uint32_t mask4 = TE::Math::IntersectTriangles4(ray, triangles, first, maxDistance, distances4) |
+                                   (TE::Math::IntersectTriangles4(ray, triangles, first + 4, maxDistance, distances4 + 4) << 4);
+            uint32_t expectedMask = 0;
+            for (size_t lane = 0; lane < 8 && first + lane < 37; ++lane)
+            {
+                const size_t t = first + lane;
+                float distance = 0.0f;
+                float u = 0.0f;
+                float v = 0.0f;
+                if (TE::IntersectRayTriangle(ray, vertices[t * 3], vertices[t * 3 + 1], vertices[t * 3 + 2], maxDistance, distance, u, v))
+                {
+                    expectedMask |= 1u << lane;
+                    if (!ApproxEqual(distances8[lane], distance, Tolerance * std::max(1.0f, distance)) ||
+                        !ApproxEqual(distances4[lane], distance, Tolerance * std::max(1.0f, distance))) {
+                        std::cerr << "[FAIL] IntersectTriangles4/8 distance\n";
+                        return false;
+                    }
+                }
+            }
+            if (mask8 != expectedMask || mask4 != expectedMask) {
+                std::cerr << "[FAIL] IntersectTriangles4/8 mask at iteration " << iteration << "\n";
+                return false;
+            }
+        }
+
+        // 射线包 vs AABB：与 BoundingBox::IntersectRay 一致
+        const TE::BoundingBox box = TE::BoundingBox::FromCenterExtents(
+            TE::Vector3(rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f), rng.Next(-10.0f, 10.0f)),
+            TE::Vector3(rng.Next(0.5f, 6.0f), rng.Next(0.5f, 6.0f), rng.Next(0.5f, 6.0f)));
+        TE::RayPacket8 packet8;
+        TE::RayPacket4 packet4;
+        TE::Ray rays[8];
+        for (size_t lane = 0; lane < 8; ++lane)
+        {
+            const TE::Vector3 from(rng.Next(-30.0f, 30.0f), rng.Next(-30.0f, 30.0f), rng.Next(-30.0f, 30.0f));
+            rays[lane] = TE::Ray(from, box.GetCenter() + TE::Vector3(rng.Next(-8.0f, 8.0f), rng.Next(-8.0f, 8.0f), rng.Next(-8.0f, 8.0f)) - from);
+            packet8.SetRay(lane, rays[lane]);
+            if (lane < 4)
+                packet4.SetRay(lane, rays[lane]);
+        }
+        float near8[8];
+        float near4[4];
+        const uint32_t boxMask8 = TE::Math::IntersectAABB(packet8, box, near8);
+        const uint32_t boxMask4 = TE::Math::IntersectAABB(packet4, box, near4);
+        for (size_t lane = 0; lane < 8; ++lane)
+        {
+            float distance = 0.0f;
+            const bool expectedHit = box.IntersectRay(rays[lane], distance);
+            const bool hit8 = ((boxMask8 >> lane) & 1u) != 0;
+            if (hit8 != expectedHit || (lane < 4 && (((boxMask4 >> lane) & 1u) != 0) != expectedHit) ||
+                (expectedHit && !ApproxEqual(near8[lane], distance, Tolerance * std::max(1.0f, distance)))) {
+                std::cerr << "[FAIL] IntersectAABB(RayPacket) lane " << lane << "\n";
+                return false;
+            }
+        }
+    }
+
+    // 未设置的通道不命中；MaxDistance 截断
+    TE::RayPacket4 partial;
+    partial.SetRay(1, TE::Ray(TE::Vector3(0.0f, 0.0f, -10.0f), TE::Vector3(0.0f, 0.0f, 1.0f)), 5.0f);
+    partial.SetRay(2, TE::Ray(TE::Vector3(0.0f, 0.0f, -10.0f), TE::Vector3(0.0f, 0.0f, 1.0f)));
+    if (TE::Math::IntersectAABB(partial, TE::BoundingBox::FromCenterHalfSize(TE::Vector3::Zero, 1.0f)) != 0b0100u) {
+        std::cerr << "[FAIL] RayPacket unused lanes / MaxDistance\n";
+        return false;
+    }
+
+    std::cout << "  All passed.\n";
+    return true;
+}
+
+bool TestVertexPacking()
+{
+    std::cout << "[MathTest] Vertex packing...\n";
+
+    FKernelTestRng rng;
+    rng.State = 0x0C7A16u;
+
+    // 半精度：全部 65536 个值 half -> float -> half 逐位还原（NaN 只要求仍为 NaN），且分派版本与标量参考一致
+    for (uint32_t bits = 0; bits <= 0xFFFFu; ++bits)
+    {
+        const auto half = static_cast<uint16_t>(bits);
+        const float value = TE::Math::HalfToFloat(half);
+        const bool isNaN = (half & 0x7C00u) == 0x7C00u && (half & 0x03FFu) != 0;
+        const float reference = TE::Math::Scalar::HalfToFloat(half);
+        if (std::bit_cast<uint32_t>(value) != std::bit_cast<uint32_t>(reference) ||
+            (isNaN ? !std::isnan(value) : TE::Math::FloatToHalf(value) != half)) {
+            std::cerr << "[FAIL] Half round trip 0x" << std::hex << bits << std::dec << "\n";
+            return false;
+        }
+    }
+
+    // 随机位模式（覆盖舍入、非规格化、溢出与 NaN）：分派版本与标量参考逐位一致
+    for (int i = 0; i < 200000; ++i)
+    {
+        rng.State = rng.State * 1664525u + 1013904223u;
+        const float value = std::bit_cast<float>(rng.State);
+        if (TE::Math::FloatToHalf(value) != TE::Math::Scalar::FloatToHalf(value)) {
+            std::cerr << "[FAIL] FloatToHalf dispatch vs scalar 0x" << std::hex << rng.State << std::dec << "\n";
+            return false;
+        }
+    }
+
+    // 舍入边界：就近舍入到偶数、溢出、非规格化
+    {
+        struct FHalfCase { float Value; uint16_t Expected; };
+        const FHalfCase cases[] = {
+            {1.0f, 0x3C00u}, {-2.0f, 0xC000u}, {65504.0f, 0x7BFFu}, {65519.0f, 0x7BFFu}, {65520.0f, 0x7C00u},
+            {1.0f + 1.0f / 2048.0f, 0x3C00u},                 // 恰在中点，舍入到偶数
+            {1.0f + 3.0f / 2048.0f, 0x3C02u},                 // 恰在中点，舍入到偶数（向上）
+            {std::ldexp(1.0f, -24), 0x0001u}, {std::ldexp(1.0f, -25), 0x0000u}, {std::ldexp(1.5f, -25), 0x0001u},
+            {std::ldexp(1.0f, -14), 0x0400u}, {-0.0f, 0x8000u}, {1e10f, 0x7C00u}, {-1e10f, 0xFC00u},
+        };
+        for (const FHalfCase& c : cases)
+        {
+            if (TE::Math::FloatToHalf(c.Value) != c.Expected || TE::Math::Scalar::FloatToHalf(c.Value) != c.Expected) {
+                std::cerr << "[FAIL] FloatToHalf(" << c.Value << ")\n";
+                return false;
+            }
+        }
+    }
+
+    // 批量转换：长度不是 8 的倍数时尾部走单值路径，结果与单值转换一致
+    {
+        std::vector<float> values(37);
+        for (float& value : values)
+            value = rng.Next(-70000.0f, 70000.0f) * (rng.Next(0.0f, 1.0f) < 0.5f ? 1e-6f : 1.0f);
+        std::vector<uint16_t> halves(values.size());
+        std::vector<float> restored(values.size());
+        TE::Math::FloatsToHalves(values, halves);
+        TE::Math::HalvesToFloats(halves, restored);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (halves[i] != TE::Math::FloatToHalf(values[i]) ||
+                std::bit_cast<uint32_t>(restored[i]) != std::bit_cast<uint32_t>(TE::Math::HalfToFloat(halves[i]))) {
+                std::cerr << "[FAIL] FloatsToHalves / HalvesToFloats index " << i << "\n";
+                return false;
+            }
+        }
+    }
+
+    // snorm / unorm：端点精确，往返误差不超过半个量化步长
+    {
+        if (TE::Math::FloatToSnorm8(1.0f) != 127 || TE::Math::FloatToSnorm8(-1.0f) != -127 ||
+            TE::Math::Snorm8ToFloat(-128) != -1.0f || TE::Math::FloatToUnorm8(2.0f) != 255 ||
+            TE::Math::FloatToUnorm16(-1.0f) != 0 || TE::Math::FloatToSnorm16(-1.0f) != -32767 ||
+            TE::Math::Unorm16ToFloat(65535) != 1.0f || TE::Math::FloatToSnorm8(0.0f) != 0) {
+            std::cerr << "[FAIL] snorm / unorm endpoints\n";
+            return false;
+        }
+        for (int i = 0; i < 10000; ++i)
+        {
+            const TE::Vector4 unorm(rng.Next(0.0f, 1.0f), rng.Next(0.0f, 1.0f), rng.Next(0.0f, 1.0f), rng.Next(0.0f, 1.0f));
+            const TE::Vector4 snorm(rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f));
+            const TE::Vector4 unorm8 = TE::Math::UnpackUnorm4x8(TE::Math::PackUnorm4x8(unorm));
+            const TE::Vector4 snorm8 = TE::Math::UnpackSnorm4x8(TE::Math::PackSnorm4x8(snorm));
+            const TE::Vector2 unorm16 = TE::Math::UnpackUnorm2x16(TE::Math::PackUnorm2x16(TE::Vector2(unorm.X, unorm.Y)));
+            const TE::Vector2 snorm16 = TE::Math::UnpackSnorm2x16(TE::Math::PackSnorm2x16(TE::Vector2(snorm.X, snorm.Y)));
+            const float unorm8Error = 0.5f / 255.0f + 1e-6f;
+            const float snorm8Error = 0.5f / 127.0f + 1e-6f;
+            const float unorm16Error = 0.5f / 65535.0f + 1e-7f;
+            const float snorm16Error = 0.5f / 32767.0f + 1e-7f;
+            if (!ApproxEqual(unorm8.X, unorm.X, unorm8Error) || !ApproxEqual(unorm8.W, unorm.W, unorm8Error) ||
+                !ApproxEqual(snorm8.Y, snorm.Y, snorm8Error) || !ApproxEqual(snorm8.Z, snorm.Z, snorm8Error) ||
+                !ApproxEqual(unorm16.X, unorm.X, unorm16Error) || !ApproxEqual(unorm16.Y, unorm.Y, unorm16Error) ||
+                !ApproxEqual(snorm16.X, snorm.X, snorm16Error) || !ApproxEqual(snorm16.Y, snorm.Y, snorm16Error)) {
+                std::cerr << "[FAIL] snorm / unorm round trip\n";
+                return false;
+            }
+            const TE::Vector2 uv(rng.Next(-4.0f, 4.0f), rng.Next(-4.0f, 4.0f));
+            const TE::Vector2 uvHalf = TE::Math::UnpackHalf2x16(TE::Math::PackHalf2x16(uv));
+            if (!ApproxEqual(uvHalf.X, uv.X, 4.0f / 2048.0f) || !ApproxEqual(uvHalf.Y, uv.Y, 4.0f / 2048.0f)) {
+                std::cerr << "[FAIL] PackHalf2x16 round trip\n";
+                return false;
+            }
+        }
+    }
+
+    // RGBA8：R 在最低字节，往返误差不超过半个量化步长
+    {
+        if (TE::Math::PackColorRGBA8(TE::Color(1.0f, 0.0f, 0.0f, 0.0f)) != 0x000000FFu ||
+            TE::Math::PackColorRGBA8(TE::Color(0.0f, 0.0f, 0.0f, 1.0f)) != 0xFF000000u ||
+            TE::Math::PackColorRGBA8(TE::Color(0.5f, 2.0f, -1.0f, 1.0f)) != 0xFF00FF80u) {
+            std::cerr << "[FAIL] PackColorRGBA8 byte order\n";
+            return false;
+        }
+        for (int i = 0; i < 1000; ++i)
+        {
+            const TE::Color color(rng.Next(0.0f, 1.0f), rng.Next(0.0f, 1.0f), rng.Next(0.0f, 1.0f), rng.Next(0.0f, 1.0f));
+            const TE::Color restored = TE::Math::UnpackColorRGBA8(TE::Math::PackColorRGBA8(color));
+            const float error = 0.5f / 255.0f + 1e-6f;
+            if (!ApproxEqual(restored.R, color.R, error) || !ApproxEqual(restored.G, color.G, error) ||
+                !ApproxEqual(restored.B, color.B, error) || !ApproxEqual(restored.A, color.A, error)) {
+                std::cerr << "[FAIL] RGBA8 round trip\n";
+                return false;
+            }
+        }
+    }
+
+    // 八面体编码：未量化时往返精确；量化后的最大角度误差不超过文档给出的上界
+    {
+        const TE::Vector3 axes[] = {TE::Vector3(1.0f, 0.0f, 0.0f), TE::Vector3(-1.0f, 0.0f, 0.0f), TE::Vector3(0.0f, 1.0f, 0.0f),
+                                    TE::Vector3(0.0f, -1.0f, 0.0f), TE::Vector3(0.0f, 0.0f, 1.0f), TE::Vector3(0.0f, 0.0f, -1.0f)};
+        for (const TE::Vector3& axis : axes)
+        {
+            if (!ApproxEqual(TE::Math::UnpackOctahedral16(TE::Math::PackOctahedral16(axis)), axis, 1e-6f) ||
+                !ApproxEqual(TE::Math::UnpackOctahedral8(TE::Math::PackOctahedral8(axis)), axis, 1e-6f)) {
+                std::cerr << "[FAIL] Octahedral axis round trip\n";
+                return false;
+            }
+        }
+
+        float maxError16 = 0.0f;
+        float maxError8 = 0.0f;
+        for (int i = 0; i < 200000; ++i)
+        {
+            TE::Vector3 direction(rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f), rng.Next(-1.0f, 1.0f));
+            if (direction.LengthSquared() < 1e-4f)
+                continue;
+            direction = direction.Normalize();
+            if (!ApproxEqual(TE::Math::OctahedralDecode(TE::Math::OctahedralEncode(direction)), direction, 1e-5f)) {
+                std::cerr << "[FAIL] OctahedralEncode / Decode\n";
+                return false;
+            }
+            // atan2(|a x b|, a . b)：小角度下比 acos(dot) 精确得多
+            auto angleDegrees = [&](const TE::Vector3& decoded) {
+                const double crossLength = static_cast<double>(TE::Vector3::Cross(decoded, direction).Length());
+                const double dot = static_cast<double>(TE::Vector3::Dot(decoded, direction));
+                return static_cast<float>(std::atan2(crossLength, dot) * 57.29577951308232);
+            };
+            maxError16 = std::max(maxError16, angleDegrees(TE::Math::UnpackOctahedral16(TE::Math::PackOctahedral16(direction))));
+            maxError8 = std::max(maxError8, angleDegrees(TE::Math::UnpackOctahedral8(TE::Math::PackOctahedral8(direction))));
+        }
+        std::cout << "  Octahedral max angular error: oct16 " << maxError16 << " deg, oct8 " << maxError8 << " deg\n";
+        if (maxError16 > 0.003f || maxError8 > 0.7f) {
+            std::cerr << "[FAIL] Octahedral quantization error\n";
+            return false;
+        }
+    }
+
+    std::cout << "  All passed.\n";
+    return true;
+}
+
 } // anonymous namespace
 
 int main()
@@ -1095,6 +2310,15 @@ int main()
     allPassed &= TestMatrixDecompose();
     allPassed &= TestFrustum();
     allPassed &= TestIntVectors();
+    allPassed &= TestMatrixKernels();
+    allPassed &= TestTransformBatch();
+    allPassed &= TestFrustumBatchCulling();
+    allPassed &= TestFastMath();
+    allPassed &= TestRandomStream();
+    allPassed &= TestMatrix3x4();
+    allPassed &= TestBoundsTransform();
+    allPassed &= TestRayIntersection();
+    allPassed &= TestVertexPacking();
 
     TE::MemoryShutdown();
 
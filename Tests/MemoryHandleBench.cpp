@@ -0,0 +1,149 @@
+// ToyEngine - 全局分配器句柄开销基准
+// 对比旧方案（每次调用加锁并拷贝 shared_ptr 快照）与当前方案（读区间内纪元指针一次 acquire 加载）的单次调用开销，
+// 并给出 MemAlloc/MemFree 端到端的每次调用耗时。
+// 读区间分两种：进程级屏障可用时（Linux membarrier / Windows）读端只有编译器屏障，否则每次进入多一次 seq_cst 栅栏。
+#include "Memory/Memory.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kIterations = 2'000'000;
+
+struct DummyAllocator
+{
+    std::atomic<std::uint64_t> Calls{0};
+};
+
+// 旧方案：与原 Memory.cpp 中 GetAllocatorSnapshot() 相同的加锁 + shared_ptr 拷贝
+std::mutex g_legacyMutex;
+std::shared_ptr<DummyAllocator> g_legacyAllocator = std::make_shared<DummyAllocator>();
+
+DummyAllocator g_dummy;
+std::atomic<DummyAllocator*> g_publishedAllocator{&g_dummy};
+
+template <typename Fn>
+double MeasureNsPerCall(int threadCount, Fn&& fn)
+{
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<std::size_t>(threadCount));
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&start, &fn]() {
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < kIterations; ++i)
+            {
+                fn();
+            }
+        });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // 每个线程各自执行 kIterations 次，按单线程视角报告每次调用的墙钟耗时
+    return std::chrono::duration<double, std::nano>(end - begin).count() / kIterations;
+}
+
+void LegacySnapshotCall()
+{
+    std::shared_ptr<DummyAllocator> snapshot;
+    {
+        std::scoped_lock lock(g_legacyMutex);
+        snapshot = g_legacyAllocator;
+    }
+    if (!snapshot)
+    {
+        std::abort();
+    }
+}
+
+void AtomicHandleCall()
+{
+    DummyAllocator* alloc = g_publishedAllocator.load(std::memory_order_acquire);
+    if (!alloc)
+    {
+        std::abort();
+    }
+}
+
+// 与 Memory.cpp 的 EnterAllocatorEpochRead / ExitAllocatorEpochRead 相同：本线程序号 +1 → 屏障 → 加载 → 序号 +1
+thread_local std::atomic<std::uint64_t> t_readSequence{0};
+
+template <bool SeqCstFence>
+void EpochReadSectionCall()
+{
+    t_readSequence.store(t_readSequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if constexpr (SeqCstFence)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+    else
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+    DummyAllocator* alloc = g_publishedAllocator.load(std::memory_order_acquire);
+    if (!alloc)
+    {
+        std::abort();
+    }
+    t_readSequence.store(t_readSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void AllocFreeCall()
+{
+    void* p = TE::MemAlloc(64, TE::MemoryTag::Sandbox);
+    TE::MemFree(p);
+}
+
+} // namespace
+
+int main()
+{
+    TE::MemoryInit(32ull * 1024ull * 1024ull);
+
+    const int threadCounts[] = { 1, 2, 4, 8 };
+
+    std::cout << "[MemoryHandleBench] ns per call (each thread runs " << kIterations << " calls)\n";
+    for (int threads : threadCounts)
+    {
+        const double legacy = MeasureNsPerCall(threads, LegacySnapshotCall);
+        const double atomicLoad = MeasureNsPerCall(threads, AtomicHandleCall);
+        const double readSection = MeasureNsPerCall(threads, EpochReadSectionCall<false>);
+        const double readSectionFenced = MeasureNsPerCall(threads, EpochReadSectionCall<true>);
+
+        TE::MemorySetThreadCacheEnabled(false);
+        const double allocLocked = MeasureNsPerCall(threads, AllocFreeCall);
+        TE::MemorySetThreadCacheEnabled(true);
+        const double allocCached = MeasureNsPerCall(threads, AllocFreeCall);
+
+        std::cout << "[MemoryHandleBench] threads=" << threads
+                  << "  handle: mutex+shared_ptr " << legacy << " ns, atomic acquire " << atomicLoad
+                  << " ns, read section " << readSection << " ns (seq_cst fence " << readSectionFenced << " ns)"
+                  << "  |  MemAlloc+MemFree(64B): TLSF " << allocLocked << " ns, thread cache " << allocCached
+                  << " ns\n";
+    }
+
+    // 开启全局 new/delete 覆盖时 shared_ptr 控制块来自引擎堆，需在关闭前释放
+    g_legacyAllocator.reset();
+    TE::MemoryShutdown();
+    return 0;
+}
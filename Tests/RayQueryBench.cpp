@@ -0,0 +1,295 @@
+// ToyEngine - 射线批量求交基准
+// 先校验 RaycastTriangles / IntersectAABB(RayPacket) 与标量 IntersectRayTriangle / BoundingBox::IntersectRay 的结果一致，
+// 再对比：
+//   - 1 条射线 vs 高度场网格的全部三角形：逐个标量求交、IntersectTriangles4、RaycastTriangles（最宽通道）、AnyTriangleHit
+//   - 射线包 vs 100k 个 AABB：逐条 BoundingBox::IntersectRay、RayPacket4、RayPacket8
+#include "Math/Geometry.h"
+#include "Math/MatrixKernels.h"
+#include "Math/RayIntersection.h"
+#include "Memory/Memory.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+volatile std::uint64_t g_sink = 0;
+
+struct MeshData
+{
+    std::vector<TE::Vector3> Vertices; // 每 3 个一个三角形（AoS，标量对照用）
+    TE::TriangleSoA Triangles;
+};
+
+// side x side 的起伏高度场，每格两个三角形（与导入网格的 Section 数据规模相近）
+MeshData BuildHeightField(int side)
+{
+    MeshData mesh;
+    mesh.Triangles.Reserve(static_cast<std::size_t>(side) * side * 2);
+    auto height = [](float x, float z) { return std::sin(x * 0.35f) * std::cos(z * 0.27f) * 2.0f; };
+    for (int z = 0; z < side; ++z)
+    {
+        for (int x = 0; x < side; ++x)
+        {
+            const float x0 = static_cast<float>(x), x1 = x0 + 1.0f;
+            const float z0 = static_cast<float>(z), z1 = z0 + 1.0f;
+            const TE::Vector3 a(x0, height(x0, z0), z0), b(x1, height(x1, z0), z0);
+            const TE::Vector3 c(x0, height(x0, z1), z1), d(x1, height(x1, z1), z1);
+            for (const TE::Vector3& v : {a, b, c, b, d, c})
+            {
+                mesh.Vertices.push_back(v);
+            }
+            mesh.Triangles.Add(a, b, c);
+            mesh.Triangles.Add(b, d, c);
+        }
+    }
+    return mesh;
+}
+
+std::vector<TE::Ray> BuildPickRays(std::size_t count, float extent)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> onField(0.0f, extent);
+    std::uniform_real_distribution<float> offset(-20.0f, 20.0f);
+    std::vector<TE::Ray> rays;
+    rays.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const TE::Vector3 target(onField(rng), 0.0f, onField(rng));
+        const TE::Vector3 origin(target.X + offset(rng), 30.0f, target.Z + offset(rng));
+        rays.emplace_back(origin, target - origin);
+    }
+    return rays;
+}
+
+bool ScalarClosestHit(const MeshData& mesh, const TE::Ray& ray, float maxDistance, float& outDistance)
+{
+    bool found = false;
+    for (std::size_t t = 0; t + 2 < mesh.Vertices.size(); t += 3)
+    {
+        float distance = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+        if (TE::IntersectRayTriangle(ray, mesh.Vertices[t], mesh.Vertices[t + 1], mesh.Vertices[t + 2],
+                                     found ? outDistance : maxDistance, distance, u, v))
+        {
+            found = true;
+            outDistance = distance;
+        }
+    }
+    return found;
+}
+
+bool Validate(const MeshData& mesh, const std::vector<TE::Ray>& rays)
+{
+    for (const TE::Ray& ray : rays)
+    {
+        float expected = 0.0f;
+        const bool expectedFound = ScalarClosestHit(mesh, ray, 1000.0f, expected);
+        TE::RayTriangleHit hit;
+        const bool found = TE::Math::RaycastTriangles(ray, mesh.Triangles, 1000.0f, hit);
+        if (found != expectedFound || (found && std::abs(hit.Distance - expected) > 1e-3f * std::max(1.0f, expected)))
+        {
+            std::cerr << "[FAIL] RaycastTriangles mismatch\n";
+            return false;
+        }
+    }
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    for (int i = 0; i < 2000; ++i)
+    {
+        const TE::BoundingBox box = TE::BoundingBox::FromCenterHalfSize(TE::Vector3(coord(rng), coord(rng), coord(rng)), 8.0f);
+        TE::RayPacket8 packet;
+        TE::Ray packetRays[8];
+        for (std::size_t lane = 0; lane < 8; ++lane)
+        {
+            const TE::Vector3 origin(coord(rng), coord(rng), coord(rng));
+            packetRays[lane] = TE::Ray(origin, box.GetCenter() + TE::Vector3(coord(rng), coord(rng), coord(rng)) * 0.2f - origin);
+            packet.SetRay(lane, packetRays[lane]);
+        }
+        const std::uint32_t mask = TE::Math::IntersectAABB(packet, box);
+        for (std::size_t lane = 0; lane < 8; ++lane)
+        {
+            float distance = 0.0f;
+            if (box.IntersectRay(packetRays[lane], distance) != (((mask >> lane) & 1u) != 0))
+            {
+                std::cerr << "[FAIL] IntersectAABB(RayPacket8) mismatch\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ---------- 基准 ----------
+
+template<typename Fn>
+double MeasureNsPerTest(std::size_t tests, int repeats, Fn&& fn)
+{
+    fn(); // 预热
+    const auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+    {
+        fn();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() /
+           (static_cast<double>(tests) * static_cast<double>(repeats));
+}
+
+void PrintRow(const char* name, double nsPerTest)
+{
+    std::cout << "  " << std::left << std::setw(36) << name << std::right << std::setw(9)
+              << std::fixed << std::setprecision(3) << nsPerTest << " ns/test\n";
+}
+
+void BenchTriangles(const MeshData& mesh, const std::vector<TE::Ray>& rays)
+{
+    const std::size_t tests = rays.size() * mesh.Triangles.Size();
+    constexpr float MaxDistance = 1000.0f;
+    std::cout << "[RayQueryBench] " << rays.size() << " rays x " << mesh.Triangles.Size() << " triangles ("
+              << TE::MatrixKernels::ActiveIsa() << ")\n";
+
+    PrintRow("Triangle scalar closest hit", MeasureNsPerTest(tests, 1, [&]() {
+        std::uint64_t hits = 0;
+        for (const TE::Ray& ray : rays)
+        {
+            float distance = 0.0f;
+            hits += ScalarClosestHit(mesh, ray, MaxDistance, distance) ? 1u : 0u;
+        }
+        g_sink = g_sink + hits;
+    }));
+    PrintRow("Triangle IntersectTriangles4", MeasureNsPerTest(tests, 3, [&]() {
+        std::uint64_t hits = 0;
+        alignas(16) float distances[4];
+        for (const TE::Ray& ray : rays)
+        {
+            for (std::size_t first = 0; first < mesh.Triangles.PaddedSize(); first += 4)
+            {
+                hits += static_cast<std::uint64_t>(std::popcount(
+                    TE::Math::IntersectTriangles4(ray, mesh.Triangles, first, MaxDistance, distances)));
+            }
+        }
+        g_sink = g_sink + hits;
+    }));
+    PrintRow("Triangle IntersectTriangles8", MeasureNsPerTest(tests, 3, [&]() {
+        std::uint64_t hits = 0;
+        alignas(32) float distances[8];
+        for (const TE::Ray& ray : rays)
+        {
+            for (std::size_t first = 0; first < mesh.Triangles.PaddedSize(); first += 8)
+            {
+                hits += static_cast<std::uint64_t>(std::popcount(
+                    TE::Math::IntersectTriangles8(ray, mesh.Triangles, first, MaxDistance, distances)));
+            }
+        }
+        g_sink = g_sink + hits;
+    }));
+    PrintRow("Triangle RaycastTriangles", MeasureNsPerTest(tests, 3, [&]() {
+        std::uint64_t hits = 0;
+        for (const TE::Ray& ray : rays)
+        {
+            TE::RayTriangleHit hit;
+            hits += TE::Math::RaycastTriangles(ray, mesh.Triangles, MaxDistance, hit) ? 1u : 0u;
+        }
+        g_sink = g_sink + hits;
+    }));
+    PrintRow("Triangle AnyTriangleHit (early out)", MeasureNsPerTest(tests, 3, [&]() {
+        std::uint64_t hits = 0;
+        for (const TE::Ray& ray : rays)
+        {
+            hits += TE::Math::AnyTriangleHit(ray, mesh.Triangles, MaxDistance) ? 1u : 0u;
+        }
+        g_sink = g_sink + hits;
+    }));
+}
+
+void BenchBoxes(std::size_t boxCount)
+{
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> size(0.5f, 10.0f);
+    std::vector<TE::BoundingBox> boxes;
+    boxes.reserve(boxCount);
+    for (std::size_t i = 0; i < boxCount; ++i)
+    {
+        boxes.push_back(TE::BoundingBox::FromCenterExtents(TE::Vector3(coord(rng), coord(rng), coord(rng)),
+                                                           TE::Vector3(size(rng), size(rng), size(rng))));
+    }
+
+    // 相机附近发出的相干射线（拾取 / 阴影射线的典型分布）
+    TE::Ray rays[8];
+    TE::RayPacket8 packet8;
+    TE::RayPacket4 packet4Low;
+    TE::RayPacket4 packet4High;
+    for (std::size_t lane = 0; lane < 8; ++lane)
+    {
+        const TE::Vector3 origin(static_cast<float>(lane), 5.0f, -600.0f);
+        rays[lane] = TE::Ray(origin, TE::Vector3(coord(rng) * 0.5f, coord(rng) * 0.5f, 600.0f) - origin);
+        packet8.SetRay(lane, rays[lane]);
+        (lane < 4 ? packet4Low : packet4High).SetRay(lane % 4, rays[lane]);
+    }
+
+    const std::size_t tests = boxCount * 8;
+    std::cout << "[RayQueryBench] 8 rays x " << boxCount << " AABBs\n";
+    PrintRow("AABB scalar IntersectRay", MeasureNsPerTest(tests, 5, [&]() {
+        std::uint64_t hits = 0;
+        for (const TE::BoundingBox& box : boxes)
+        {
+            for (const TE::Ray& ray : rays)
+            {
+                float distance = 0.0f;
+                hits += box.IntersectRay(ray, distance) ? 1u : 0u;
+            }
+        }
+        g_sink = g_sink + hits;
+    }));
+    PrintRow("AABB RayPacket4 x2", MeasureNsPerTest(tests, 5, [&]() {
+        std::uint64_t hits = 0;
+        for (const TE::BoundingBox& box : boxes)
+        {
+            hits += static_cast<std::uint64_t>(std::popcount(TE::Math::IntersectAABB(packet4Low, box)));
+            hits += static_cast<std::uint64_t>(std::popcount(TE::Math::IntersectAABB(packet4High, box)));
+        }
+        g_sink = g_sink + hits;
+    }));
+    PrintRow("AABB RayPacket8", MeasureNsPerTest(tests, 5, [&]() {
+        std::uint64_t hits = 0;
+        for (const TE::BoundingBox& box : boxes)
+        {
+            hits += static_cast<std::uint64_t>(std::popcount(TE::Math::IntersectAABB(packet8, box)));
+        }
+        g_sink = g_sink + hits;
+    }));
+}
+
+} // namespace
+
+int main()
+{
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+
+    constexpr int FieldSide = 64;
+    const MeshData mesh = BuildHeightField(FieldSide);
+    const std::vector<TE::Ray> rays = BuildPickRays(512, static_cast<float>(FieldSide));
+    if (!Validate(mesh, rays))
+    {
+        TE::MemoryShutdown();
+        return 1;
+    }
+    std::cout << "[RayQueryBench] batch results match scalar tests\n";
+
+    BenchTriangles(mesh, rays);
+    BenchBoxes(100'000);
+
+    TE::MemoryShutdown();
+    return 0;
+}
@@ -1,15 +1,32 @@
-// ToyEngine - 内存分配器最小回归测试（多线程 / 对齐 realloc / 有序 Shutdown）
+// ToyEngine - 内存分配器最小回归测试（多线程 / 对齐 realloc / 有序 Shutdown / 分配中 Shutdown / 线程缓存吞吐 / 帧 arena / 对象池 / 堆原地增长与回收 / 策略回收 / 采样分析器 / 分片计数器与标签预算 / 分配轨迹 / 内联容器 / 小块 slab / 堆碎片报告 / 内存作用域 / 帧分配守卫）
 #include "Log/Log.h"
 #include "Memory/Memory.h"
 
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <format>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
 #include <thread>
 #include <vector>
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include "Memory/FrameAllocationGuard.h"
+#include "Memory/FrameArena.h"
+#include "Memory/InlineContainers.h"
+#include "Memory/MemoryContainers.h"
+#include "Memory/MemoryNew.h"
+#include "Memory/MemoryProfiler.h"
+#include "Memory/MemoryScope.h"
+#include "Memory/MemoryTrace.h"
 #include "Memory/MemoryUtils.h"
 
 namespace {
@@ -213,28 +230,1432 @@ bool TestOrderedShutdownNoCrash()
     return true;
 }
 
-} // namespace
+// 一个线程持续 MemAlloc / MemFree 时主线程关闭内存系统：调用内部读到旧纪元的线程不能访问到已归还 OS 的池。
+// 宽限期只保护调用内部，因此 worker 不写入返回的块、并在下一次分配前释放它；
+// 只有一个 worker，避免别的线程惰性创建新纪元后旧块被交给新纪元释放（违反 Memory.h 的关闭契约）
+bool TestShutdownWhileAllocating()
+{
+    constexpr int kRounds = 40;
+    static constexpr std::size_t kSizes[] = { 24, 48, 200, 480, 4096, 96 * 1024 };
 
-int main()
+    for (int round = 0; round < kRounds; ++round)
+    {
+        TE::MemoryInit(24ull * 1024ull * 1024ull);
+
+        std::atomic<bool> stop{false};
+        std::atomic<std::uint64_t> calls{0};
+        std::thread worker([&stop, &calls]() {
+            std::uint64_t local = 0;
+            while (!stop.load(std::memory_order_acquire))
+            {
+                const std::size_t size = kSizes[local % std::size(kSizes)];
+                void* p = TE::MemAlloc(size, TE::MemoryTag::Sandbox);
+                TE::MemFree(p);
+                ++local;
+                calls.store(local, std::memory_order_relaxed);
+            }
+        });
+
+        // 等 worker 进入循环后再关闭，关闭时刻随轮次错开
+        while (calls.load(std::memory_order_relaxed) < 64)
+        {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200 + 150 * (round % 8)));
+        TE::MemoryShutdown();
+
+        // 关闭后 worker 继续分配（惰性创建新纪元）一段时间再停止
+        const std::uint64_t afterShutdown = calls.load(std::memory_order_relaxed);
+        while (calls.load(std::memory_order_relaxed) < afterShutdown + 64)
+        {
+            std::this_thread::yield();
+        }
+        stop.store(true, std::memory_order_release);
+        worker.join();
+        TE::MemoryShutdown();
+    }
+    return true;
+}
+
+// 多线程小块 alloc/free 吞吐：分别在开启/关闭线程缓存时运行同一负载，返回 Mops/s
+double RunSmallAllocThroughput(int threadCount, std::atomic<bool>& ok)
 {
-    TE::Log::Init();
+    constexpr int kRounds = 400;
+    constexpr int kBatch = 64;
 
-    std::cout << "[MemoryAllocatorRegressionTest] multi-thread alloc/free...\n";
-    if (!TestMultiThreadAllocFree())
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<std::size_t>(threadCount));
+
+    for (int t = 0; t < threadCount; ++t)
     {
-        TE::Log::Shutdown();
-        return 1;
+        threads.emplace_back([t, &start, &ok]() {
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            void* ptrs[kBatch];
+            for (int r = 0; r < kRounds; ++r)
+            {
+                for (int i = 0; i < kBatch; ++i)
+                {
+                    const std::size_t size = 8u + static_cast<std::size_t>((t * 7 + r + i * 13) % 248);
+                    ptrs[i] = TE::MemAlloc(size, TE::MemoryTag::Sandbox);
+                    if (!ptrs[i])
+                    {
+                        ok.store(false, std::memory_order_release);
+                        return;
+                    }
+                    *static_cast<std::uint32_t*>(ptrs[i]) = static_cast<std::uint32_t>(i);
+                }
+                for (int i = 0; i < kBatch; ++i)
+                {
+                    TE::MemFree(ptrs[i]);
+                }
+            }
+        });
     }
 
-    std::cout << "[MemoryAllocatorRegressionTest] aligned realloc...\n";
-    if (!TestAlignedReallocPreservesAlignment())
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& th : threads)
     {
-        TE::Log::Shutdown();
-        return 1;
+        th.join();
     }
+    const auto end = std::chrono::steady_clock::now();
 
-    std::cout << "[MemoryAllocatorRegressionTest] ordered shutdown...\n";
-    if (!TestOrderedShutdownNoCrash())
+    const double seconds = std::chrono::duration<double>(end - begin).count();
+    const double ops = static_cast<double>(threadCount) * kRounds * kBatch * 2.0;
+    return seconds > 0.0 ? ops / seconds / 1.0e6 : 0.0;
+}
+
+bool TestThreadCacheThroughput()
+{
+    constexpr int kThreads = 8;
+
+    TE::MemoryInit(32ull * 1024ull * 1024ull);
+
+    std::atomic<bool> ok{true};
+    TE::MemorySetThreadCacheEnabled(false);
+    const double lockedMops = RunSmallAllocThroughput(kThreads, ok);
+    TE::MemorySetThreadCacheEnabled(true);
+    const double cachedMops = RunSmallAllocThroughput(kThreads, ok);
+
+    if (!ok.load(std::memory_order_acquire))
+    {
+        std::cerr << "[FAIL] MemAlloc returned nullptr during throughput run\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest]   " << kThreads << " threads: global lock "
+              << lockedMops << " Mops/s, thread cache " << cachedMops << " Mops/s (x"
+              << (lockedMops > 0.0 ? cachedMops / lockedMops : 0.0) << ")\n";
+
+    // worker 退出时已折算各自的统计增量：Sandbox 标签应完全配平
+    const TE::MemoryStats stats = TE::GetMemoryStats();
+    const auto& sandbox = stats.PerTag[static_cast<std::size_t>(TE::MemoryTag::Sandbox)];
+    if (sandbox.CurrentBytes != 0 || sandbox.AllocCount != sandbox.FreeCount || sandbox.AllocCount == 0)
+    {
+        std::cerr << "[FAIL] thread cache stats not folded: current=" << sandbox.CurrentBytes
+                  << " allocs=" << sandbox.AllocCount << " frees=" << sandbox.FreeCount << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    TE::MemoryShutdown();
+    return true;
+}
+
+bool TestFrameArena()
+{
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+
+    auto& arena = TE::FrameArena::Get();
+    arena.Init(2, 64u * 1024u);
+
+    // 对齐与数据独立性
+    auto* a = static_cast<std::uint8_t*>(arena.Allocate(24, 16));
+    auto* b = static_cast<std::uint8_t*>(arena.Allocate(100, 64));
+    if (!a || !b || !IsAligned(a, 16) || !IsAligned(b, 64))
+    {
+        std::cerr << "[FAIL] FrameArena alignment\n";
+        arena.Shutdown();
+        TE::MemoryShutdown();
+        return false;
+    }
+    std::memset(a, 0x11, 24);
+    std::memset(b, 0x22, 100);
+    if (a[23] != 0x11)
+    {
+        std::cerr << "[FAIL] FrameArena overlapping blocks\n";
+        arena.Shutdown();
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // 多线程并发 bump，且超出单 chunk 容量（触发追加 chunk）
+    constexpr int kThreads = 4;
+    constexpr int kAllocs = 2000;
+    std::atomic<bool> ok{true};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([t, &arena, &ok]() {
+            for (int i = 0; i < kAllocs; ++i)
+            {
+                auto* p = static_cast<std::uint32_t*>(arena.Allocate(32, 16));
+                if (!p)
+                {
+                    ok.store(false, std::memory_order_release);
+                    return;
+                }
+                p[0] = static_cast<std::uint32_t>(t);
+                p[7] = static_cast<std::uint32_t>(i);
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    TE::TFrameArray<int> values;
+    for (int i = 0; i < 1000; ++i)
+    {
+        values.push_back(i);
+    }
+    if (!ok.load(std::memory_order_acquire) || values[999] != 999)
+    {
+        std::cerr << "[FAIL] FrameArena concurrent allocate / TFrameArray\n";
+        arena.Shutdown();
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // 两轮帧后回到同一缓冲：溢出的 chunk 已合并，同样的负载不再增长
+    const std::size_t firstFrameUsed = arena.GetUsedBytes();
+    arena.EndFrame();
+    arena.EndFrame();
+    if (arena.GetCurrentFrameIndex() != 0 || arena.GetUsedBytes() != 0)
+    {
+        std::cerr << "[FAIL] FrameArena reset\n";
+        arena.Shutdown();
+        TE::MemoryShutdown();
+        return false;
+    }
+    const TE::MemoryStats before = TE::GetMemoryStats();
+    void* big = arena.Allocate(firstFrameUsed / 2, 16);
+    const TE::MemoryStats after = TE::GetMemoryStats();
+    const auto frameTag = static_cast<std::size_t>(TE::MemoryTag::Frame);
+    if (!big || after.PerTag[frameTag].AllocCount != before.PerTag[frameTag].AllocCount)
+    {
+        std::cerr << "[FAIL] FrameArena did not coalesce chunks on reset\n";
+        arena.Shutdown();
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    arena.Shutdown();
+    TE::MemoryShutdown();
+    return true;
+}
+
+struct PoolTestBase
+{
+    virtual ~PoolTestBase() = default;
+    int BaseValue = 1;
+};
+
+struct PoolTestMixin
+{
+    virtual ~PoolTestMixin() = default;
+    double MixinValue = 2.0;
+};
+
+// 多继承：经第二基类指针释放时需回到完整对象起点
+struct PoolTestDerived final : PoolTestBase, PoolTestMixin
+{
+    explicit PoolTestDerived(int* destroyed)
+        : Destroyed(destroyed)
+    {
+    }
+    ~PoolTestDerived() override { ++*Destroyed; }
+
+    int* Destroyed = nullptr;
+    char Payload[40] = {};
+};
+
+bool TestObjectPool()
+{
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+
+    // 槽位按缓存行对齐且同一 chunk 内连续
+    {
+        TE::TPool<PoolTestBase> pool(TE::MemoryTag::Sandbox, 16);
+        PoolTestBase* objects[16] = {};
+        for (auto*& obj : objects)
+        {
+            obj = pool.New();
+        }
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            const auto expected = reinterpret_cast<std::uintptr_t>(objects[0]) + i * pool.GetSlotSize();
+            if (!IsAligned(objects[i], 64) || reinterpret_cast<std::uintptr_t>(objects[i]) != expected)
+            {
+                std::cerr << "[FAIL] TPool slots not contiguous/aligned\n";
+                TE::MemoryShutdown();
+                return false;
+            }
+        }
+
+        // LIFO 复用：释放后立刻重用同一地址，不增长 chunk
+        PoolTestBase* released = objects[5];
+        pool.Delete(released);
+        objects[5] = pool.New();
+        if (objects[5] != released || pool.GetChunkCount() != 1 || pool.GetLiveCount() != 16)
+        {
+            std::cerr << "[FAIL] TPool free-list reuse\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+
+        for (auto* obj : objects)
+        {
+            pool.Delete(obj);
+        }
+        if (!pool.Trim() || pool.GetChunkCount() != 0)
+        {
+            std::cerr << "[FAIL] TPool trim\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+    }
+
+    // TPoolUniquePtr 向基类转换后按完整对象归还；std::unique_ptr 可直接转入
+    int destroyed = 0;
+    {
+        auto& pool = TE::GetObjectPool<PoolTestDerived, TE::MemoryTag::Sandbox>();
+        std::vector<TE::TPoolUniquePtr<PoolTestMixin>> holders;
+        for (int i = 0; i < 100; ++i)
+        {
+            holders.push_back(TE::MakePoolUnique<PoolTestDerived, TE::MemoryTag::Sandbox>(&destroyed));
+        }
+        holders.push_back(std::make_unique<PoolTestDerived>(&destroyed));
+        if (pool.GetLiveCount() != 100)
+        {
+            std::cerr << "[FAIL] TPool live count\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+
+        // 乱序释放一半再补回：地址全部落在已有 chunk 内
+        const std::size_t chunksBefore = pool.GetChunkCount();
+        for (std::size_t i = 0; i < holders.size(); i += 2)
+        {
+            holders[i].reset();
+        }
+        for (std::size_t i = 0; i < holders.size(); i += 2)
+        {
+            holders[i] = TE::MakePoolUnique<PoolTestDerived, TE::MemoryTag::Sandbox>(&destroyed);
+        }
+        if (pool.GetChunkCount() != chunksBefore)
+        {
+            std::cerr << "[FAIL] TPool grew under churn\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+        holders.clear();
+        if (pool.GetLiveCount() != 0)
+        {
+            std::cerr << "[FAIL] TPool leaked slots via base pointer\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+    }
+    if (destroyed != 152)
+    {
+        std::cerr << "[FAIL] TPool destructor count " << destroyed << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // MemoryShutdown 归还全部池的 chunk；重新初始化后共享池从新纪元重新申请
+    TE::MemoryShutdown();
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+    {
+        auto& pool = TE::GetObjectPool<PoolTestDerived, TE::MemoryTag::Sandbox>();
+        if (pool.GetChunkCount() != 0)
+        {
+            std::cerr << "[FAIL] TPool chunks survived MemoryShutdown\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+        auto obj = TE::MakePoolUnique<PoolTestDerived, TE::MemoryTag::Sandbox>(&destroyed);
+        std::memset(obj->Payload, 0x5a, sizeof(obj->Payload));
+    }
+    TE::MemoryShutdown();
+    return true;
+}
+
+#if defined(__linux__)
+std::uint64_t ReadResidentBytes()
+{
+    std::FILE* f = std::fopen("/proc/self/statm", "r");
+    if (!f)
+    {
+        return 0;
+    }
+    unsigned long long size = 0;
+    unsigned long long resident = 0;
+    const int read = std::fscanf(f, "%llu %llu", &size, &resident);
+    std::fclose(f);
+    return read == 2 ? resident * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+}
+#endif
+
+bool TestHeapGrowInPlaceAndTrim()
+{
+    const TE::MemoryHeapConfig defaultConfig = TE::MemoryGetHeapConfig();
+    TE::MemoryHeapConfig config = defaultConfig;
+    config.TrimThresholdBytes = 0; // 只在显式 MemoryTrim 时回收，便于断言
+    TE::MemorySetHeapConfig(config);
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+
+    // 首次分配触发初始化：一个保留区 + 初始提交
+    void* first = TE::MemAlloc(1024, TE::MemoryTag::Sandbox);
+    const TE::MemoryStats initial = TE::GetMemoryStats();
+    if (!first || initial.CommittedBytes < 64ull * 1024ull * 1024ull || initial.ReservedBytes < initial.CommittedBytes)
+    {
+        std::cerr << "[FAIL] heap reserve/commit\n";
+        TE::MemoryShutdown();
+        TE::MemorySetHeapConfig(defaultConfig);
+        return false;
+    }
+
+    // 超出初始提交量：应在同一保留区内原地提交，而不是另开地址范围
+    constexpr int kBlocks = 40;
+    constexpr std::size_t kBlockBytes = 4ull * 1024ull * 1024ull;
+    std::vector<void*> blocks;
+    for (int i = 0; i < kBlocks; ++i)
+    {
+        void* p = TE::MemAlloc(kBlockBytes, TE::MemoryTag::Sandbox);
+        if (!p)
+        {
+            break;
+        }
+        std::memset(p, 0x3c, kBlockBytes);
+        blocks.push_back(p);
+    }
+    const TE::MemoryStats grown = TE::GetMemoryStats();
+    if (blocks.size() != kBlocks || grown.ReservedBytes != initial.ReservedBytes ||
+        grown.CommittedBytes <= initial.CommittedBytes)
+    {
+        std::cerr << "[FAIL] heap did not grow in place (reserved " << initial.ReservedBytes << " -> "
+                  << grown.ReservedBytes << ")\n";
+        TE::MemoryShutdown();
+        TE::MemorySetHeapConfig(defaultConfig);
+        return false;
+    }
+
+#if defined(__linux__)
+    const std::uint64_t residentBefore = ReadResidentBytes();
+#endif
+
+    for (void* p : blocks)
+    {
+        TE::MemFree(p);
+    }
+    const std::size_t returned = TE::MemoryTrim();
+    const TE::MemoryStats trimmed = TE::GetMemoryStats();
+    if (returned < kBlocks * kBlockBytes / 2 || trimmed.CommittedBytes >= grown.CommittedBytes ||
+        trimmed.LastTrimBytes != returned)
+    {
+        std::cerr << "[FAIL] heap trim returned " << returned << " bytes, committed "
+                  << grown.CommittedBytes << " -> " << trimmed.CommittedBytes << "\n";
+        TE::MemoryShutdown();
+        TE::MemorySetHeapConfig(defaultConfig);
+        return false;
+    }
+
+#if defined(__linux__)
+    const std::uint64_t residentAfter = ReadResidentBytes();
+    if (residentBefore != 0 && residentAfter + kBlocks * kBlockBytes / 2 > residentBefore)
+    {
+        std::cerr << "[FAIL] heap trim did not reduce RSS (" << residentBefore << " -> " << residentAfter << ")\n";
+        TE::MemoryShutdown();
+        TE::MemorySetHeapConfig(defaultConfig);
+        return false;
+    }
+#endif
+
+    // 回收后的地址可直接复用（丢弃的页再次触碰时按需分配）
+    void* again = TE::MemAlloc(kBlockBytes * 8, TE::MemoryTag::Sandbox);
+    if (!again)
+    {
+        std::cerr << "[FAIL] heap regrow after trim\n";
+        TE::MemoryShutdown();
+        TE::MemorySetHeapConfig(defaultConfig);
+        return false;
+    }
+    std::memset(again, 0x5a, kBlockBytes * 8);
+    TE::MemFree(again);
+    TE::MemFree(first);
+
+    TE::MemoryShutdown();
+    TE::MemorySetHeapConfig(defaultConfig);
+    return true;
+}
+
+// 策略回收：每帧分配又释放的跨度不能被丢弃（否则下一帧整片缺页），停止使用后连续两遍空闲才归还
+bool TestHeapTrimIdlePolicy()
+{
+    const TE::MemoryHeapConfig defaultConfig = TE::MemoryGetHeapConfig();
+    TE::MemoryHeapConfig config = defaultConfig;
+    config.TrimThresholdBytes = 1ull * 1024ull * 1024ull;
+    config.TrimMinSpanBytes = 1ull * 1024ull * 1024ull;
+    config.SmallSlabReserveBytes = 0; // 只观察 TLSF 堆
+    TE::MemorySetHeapConfig(config);
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+
+    auto fail = [&defaultConfig](const char* message, std::size_t value) {
+        std::cerr << "[FAIL] " << message << " (" << value << ")\n";
+        TE::MemoryShutdown();
+        TE::MemorySetHeapConfig(defaultConfig);
+        return false;
+    };
+
+    void* first = TE::MemAlloc(1024, TE::MemoryTag::Sandbox);
+
+    // 稳态：每“帧”使用 8MB 临时内存后释放，帧末跑一遍策略回收。释放量每帧都越过阈值，但跨度每帧都被重新切分
+    constexpr std::size_t kFrameBytes = 8ull * 1024ull * 1024ull;
+    for (int frame = 0; frame < 32; ++frame)
+    {
+        void* scratch = TE::MemAlloc(kFrameBytes, TE::MemoryTag::Sandbox);
+        if (!scratch)
+        {
+            return fail("scratch allocation failed at frame", static_cast<std::size_t>(frame));
+        }
+        std::memset(scratch, 0x6b, kFrameBytes);
+        TE::MemFree(scratch);
+
+        const std::size_t returned = TE::MemoryTrimIdle();
+        if (returned != 0)
+        {
+            return fail("steady alloc/free churn was discarded, bytes", returned);
+        }
+    }
+
+    // 停止使用：上一遍记下的候选在这一遍确认空闲后归还；再一遍没有新的待办
+    const std::size_t idleReturned = TE::MemoryTrimIdle();
+    if (idleReturned < kFrameBytes / 2 || TE::GetMemoryStats().LastTrimBytes != idleReturned)
+    {
+        return fail("idle span was not returned on the confirming pass, bytes", idleReturned);
+    }
+    const std::size_t repeated = TE::MemoryTrimIdle();
+    if (repeated != 0)
+    {
+        return fail("already discarded span was returned again, bytes", repeated);
+    }
+
+    TE::MemFree(first);
+    TE::MemoryShutdown();
+    TE::MemorySetHeapConfig(defaultConfig);
+    return true;
+}
+
+// 独立的分配点，便于在折叠栈中区分
+[[gnu::noinline]] void* ProfiledAllocationSite(std::size_t bytes)
+{
+    return TE::MemAlloc(bytes, TE::MemoryTag::Sandbox);
+}
+
+bool ReadWholeFile(const char* path, std::string& out)
+{
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f)
+    {
+        return false;
+    }
+    char buffer[4096];
+    std::size_t n = 0;
+    while ((n = std::fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        out.append(buffer, n);
+    }
+    std::fclose(f);
+    return true;
+}
+
+bool TestMemoryProfiler()
+{
+    TE::MemoryInit(32ull * 1024ull * 1024ull);
+
+    TE::MemoryProfilerConfig config;
+    config.SampleIntervalBytes = 16 * 1024;
+    TE::MemoryProfilerStart(config);
+
+    // 4000 x 256B 小块（线程缓存路径）+ 64 x 64KB 大块（TLSF 路径），共约 5MB
+    constexpr int kSmall = 4000;
+    constexpr int kLarge = 64;
+    std::vector<void*> blocks;
+    std::uint64_t totalBytes = 0;
+    for (int i = 0; i < kSmall; ++i)
+    {
+        blocks.push_back(ProfiledAllocationSite(256));
+        totalBytes += 256;
+    }
+    for (int i = 0; i < kLarge; ++i)
+    {
+        blocks.push_back(ProfiledAllocationSite(64 * 1024));
+        totalBytes += 64 * 1024;
+    }
+
+    const TE::MemoryProfilerSummary live = TE::MemoryProfilerGetSummary();
+    const double ratio = static_cast<double>(live.EstimatedAllocatedBytes) / static_cast<double>(totalBytes);
+    if (live.SampleCount == 0 || live.UniqueStacks == 0 || ratio < 0.7 || ratio > 1.3)
+    {
+        std::cerr << "[FAIL] MemoryProfiler estimate " << live.EstimatedAllocatedBytes << " vs actual " << totalBytes
+                  << " (" << live.SampleCount << " samples)\n";
+        TE::MemoryProfilerStop();
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    for (void* p : blocks)
+    {
+        TE::MemFree(p);
+    }
+    const TE::MemoryProfilerSummary freed = TE::MemoryProfilerGetSummary();
+    if (freed.LiveSampleCount != 0 || freed.EstimatedLiveBytes != 0 ||
+        freed.EstimatedAllocatedBytes != live.EstimatedAllocatedBytes)
+    {
+        std::cerr << "[FAIL] MemoryProfiler live table not cleared on free\n";
+        TE::MemoryProfilerStop();
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    const char* foldedPath = "memory_profiler_test.folded";
+    const char* pprofPath = "memory_profiler_test.prof";
+    std::string folded;
+    std::string pprof;
+    const bool dumped = TE::MemoryProfilerDump(foldedPath, TE::MemoryProfileFormat::Folded) &&
+                        TE::MemoryProfilerDump(pprofPath, TE::MemoryProfileFormat::Pprof) &&
+                        ReadWholeFile(foldedPath, folded) && ReadWholeFile(pprofPath, pprof);
+    std::remove(foldedPath);
+    std::remove(pprofPath);
+    TE::MemoryProfilerStop();
+
+    if (!dumped || folded.rfind("Sandbox;", 0) != 0 ||
+        pprof.find("@ heap_v2/16384") == std::string::npos)
+    {
+        std::cerr << "[FAIL] MemoryProfiler dump format\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // 停止后不再采样
+    void* after = ProfiledAllocationSite(1024 * 1024);
+    const bool stillCounting = TE::MemoryProfilerGetSummary().SampleCount != freed.SampleCount;
+    TE::MemFree(after);
+    TE::MemoryShutdown();
+    if (stillCounting)
+    {
+        std::cerr << "[FAIL] MemoryProfiler sampled after stop\n";
+        return false;
+    }
+    return true;
+}
+
+
+struct BudgetEventLog
+{
+    int HighWatermark = 0;
+    int OverBudget = 0;
+    std::uint64_t LastBytes = 0;
+};
+
+void RecordBudgetEvent(TE::MemoryTag /*tag*/, TE::MemoryBudgetEvent event,
+                       std::uint64_t currentBytes, std::uint64_t /*budgetBytes*/, void* userData)
+{
+    auto* log = static_cast<BudgetEventLog*>(userData);
+    if (event == TE::MemoryBudgetEvent::HighWatermark)
+    {
+        ++log->HighWatermark;
+    }
+    else
+    {
+        ++log->OverBudget;
+    }
+    log->LastBytes = currentBytes;
+
+    // 回调内分配不应再次触发回调
+    void* nested = TE::MemAlloc(256 * 1024, TE::MemoryTag::Sandbox);
+    TE::MemFree(nested);
+}
+
+bool TestCountersAndBudgets()
+{
+    TE::MemoryInit(32ull * 1024ull * 1024ull);
+
+    // 读线程持续汇总统计，写线程并发分配/释放：读端不持有分配器锁，结束后计数必须配平
+    constexpr int kWriters = 4;
+    constexpr int kOps = 20000;
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> reads{0};
+    std::thread reader([&stop, &reads]() {
+        while (!stop.load(std::memory_order_acquire))
+        {
+            (void)TE::GetMemoryStats();
+            reads.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kWriters; ++t)
+    {
+        writers.emplace_back([t]() {
+            for (int i = 0; i < kOps; ++i)
+            {
+                const std::size_t size = (i % 8 == 0) ? 4096u + static_cast<std::size_t>(t) : 64u;
+                void* p = TE::MemAlloc(size, TE::MemoryTag::Scene);
+                TE::MemFree(p);
+            }
+        });
+    }
+    for (auto& th : writers)
+    {
+        th.join();
+    }
+    stop.store(true, std::memory_order_release);
+    reader.join();
+
+    const auto sceneTag = static_cast<std::size_t>(TE::MemoryTag::Scene);
+    const TE::MemoryStats balanced = TE::GetMemoryStats();
+    const auto& scene = balanced.PerTag[sceneTag];
+    if (reads.load() == 0 || scene.CurrentBytes != 0 ||
+        scene.AllocCount != static_cast<std::uint64_t>(kWriters) * kOps || scene.AllocCount != scene.FreeCount)
+    {
+        std::cerr << "[FAIL] sharded counters: current=" << scene.CurrentBytes << " allocs=" << scene.AllocCount
+                  << " frees=" << scene.FreeCount << " peak=" << scene.PeakBytes << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // 预算 4MB、水位线 50%：2.5MB 越过水位线，4.5MB 越过预算，各只回调一次
+    BudgetEventLog log;
+    TE::MemoryTagBudget budget;
+    budget.BudgetBytes = 4ull * 1024ull * 1024ull;
+    budget.HighWatermark = 0.5f;
+    budget.Callback = &RecordBudgetEvent;
+    budget.UserData = &log;
+    TE::MemorySetTagBudget(TE::MemoryTag::Sandbox, budget);
+
+    auto fail = [](const char* what, const BudgetEventLog& l) {
+        std::cerr << "[FAIL] memory budget " << what << ": watermark=" << l.HighWatermark
+                  << " over=" << l.OverBudget << " bytes=" << l.LastBytes << "\n";
+        TE::MemorySetTagBudget(TE::MemoryTag::Sandbox, {});
+        TE::MemoryShutdown();
+        return false;
+    };
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 10; ++i)
+    {
+        blocks.push_back(TE::MemAlloc(256 * 1024, TE::MemoryTag::Sandbox));
+    }
+    if (log.HighWatermark != 1 || log.OverBudget != 0 || log.LastBytes < budget.BudgetBytes / 2)
+    {
+        return fail("high watermark", log);
+    }
+    if (TE::GetMemoryStats().PerTag[static_cast<std::size_t>(TE::MemoryTag::Sandbox)].BudgetBytes != budget.BudgetBytes)
+    {
+        return fail("stats budget", log);
+    }
+
+    for (int i = 0; i < 8; ++i)
+    {
+        blocks.push_back(TE::MemAlloc(256 * 1024, TE::MemoryTag::Sandbox));
+    }
+    if (log.HighWatermark != 1 || log.OverBudget != 1 || log.LastBytes < budget.BudgetBytes)
+    {
+        return fail("over budget", log);
+    }
+
+    // 小块走线程缓存：显式检查点折算后同样能触发
+    for (void* p : blocks)
+    {
+        TE::MemFree(p);
+    }
+    blocks.clear();
+    TE::MemoryCheckBudgets();
+    for (int i = 0; i < 6000; ++i)
+    {
+        blocks.push_back(TE::MemAlloc(512, TE::MemoryTag::Sandbox));
+    }
+    TE::MemoryCheckBudgets();
+    if (log.HighWatermark != 2 || log.OverBudget != 1)
+    {
+        return fail("re-arm after drop", log);
+    }
+
+    for (void* p : blocks)
+    {
+        TE::MemFree(p);
+    }
+    TE::MemorySetTagBudget(TE::MemoryTag::Sandbox, {});
+    TE::MemoryShutdown();
+    return true;
+}
+
+
+bool TestMemoryTrace()
+{
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+
+    const char* path = "memory_trace_test.memtrace";
+    if (!TE::MemoryTraceStart(path) || TE::MemoryTraceStart(path))
+    {
+        std::cerr << "[FAIL] MemoryTraceStart\n";
+        TE::MemoryTraceStop();
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // 主线程：alloc -> realloc（线程缓存块搬移到 TLSF）-> free；worker：alloc/free 各 1000 次
+    void* p = TE::MemAlloc(100, TE::MemoryTag::Sandbox);
+    void* grown = TE::MemRealloc(p, 64 * 1024, TE::MemoryTag::Sandbox);
+    std::thread worker([]() {
+        for (int i = 0; i < 1000; ++i)
+        {
+            TE::MemFree(TE::MemAlignedAlloc(48, 64, TE::MemoryTag::Scene));
+        }
+    });
+    worker.join();
+    TE::MemFree(grown);
+    TE::MemoryTraceStop();
+    TE::MemoryShutdown();
+
+    std::string data;
+    const bool read = ReadWholeFile(path, data);
+    std::remove(path);
+
+    TE::MemoryTraceFileHeader header;
+    const std::size_t eventCount = read && data.size() >= sizeof(header)
+        ? (data.size() - sizeof(header)) / sizeof(TE::MemoryTraceEvent)
+        : 0;
+    if (eventCount != 2003 || (data.size() - sizeof(header)) % sizeof(TE::MemoryTraceEvent) != 0)
+    {
+        std::cerr << "[FAIL] MemoryTrace event count " << eventCount << "\n";
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    int allocs = 0;
+    int reallocs = 0;
+    int frees = 0;
+    bool fieldsOk = header.Magic == TE::MemoryTraceMagic && header.EventBytes == sizeof(TE::MemoryTraceEvent);
+    for (std::size_t i = 0; i < eventCount; ++i)
+    {
+        TE::MemoryTraceEvent e;
+        std::memcpy(&e, data.data() + sizeof(header) + i * sizeof(e), sizeof(e));
+        switch (e.Op)
+        {
+        case TE::MemoryTraceOp::Alloc:
+            ++allocs;
+            fieldsOk = fieldsOk && e.Ptr != 0 && (e.Tag != TE::MemoryTag::Scene || (e.Align == 64 && e.Size == 48));
+            break;
+        case TE::MemoryTraceOp::Realloc:
+            ++reallocs;
+            fieldsOk = fieldsOk && e.OldPtr != 0 && e.Ptr != 0 && e.Size == 64 * 1024;
+            break;
+        case TE::MemoryTraceOp::Free:
+            ++frees;
+            break;
+        }
+    }
+    if (!fieldsOk || allocs != 1001 || reallocs != 1 || frees != 1001)
+    {
+        std::cerr << "[FAIL] MemoryTrace events: allocs=" << allocs << " reallocs=" << reallocs
+                  << " frees=" << frees << "\n";
+        return false;
+    }
+    return true;
+}
+
+std::uint64_t SandboxAllocCount()
+{
+    return TE::GetMemoryStats().PerTag[static_cast<std::size_t>(TE::MemoryTag::Sandbox)].AllocCount;
+}
+
+bool TestInlineContainers()
+{
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+
+    // 不超过 N 个元素时不触碰堆；第 N+1 个元素溢出到指定 tag
+    {
+        const std::uint64_t before = SandboxAllocCount();
+        TE::TInlineArray<int, 4> values(TE::MemoryTag::Sandbox);
+        for (int i = 0; i < 4; ++i)
+        {
+            values.push_back(i);
+        }
+        if (!values.IsInline() || SandboxAllocCount() != before)
+        {
+            std::cerr << "[FAIL] TInlineArray allocated within inline capacity\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+
+        // 参数引用自身元素时扩容仍需拿到正确的值
+        values.push_back(values[0]);
+        if (values.IsInline() || values.size() != 5 || values[4] != 0 || values[3] != 3 ||
+            SandboxAllocCount() != before + 1)
+        {
+            std::cerr << "[FAIL] TInlineArray spill\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+
+        // 移动已溢出的容器直接接管堆缓冲
+        TE::TInlineArray<int, 4> moved(std::move(values));
+        if (moved.size() != 5 || !values.empty() || !values.IsInline() || SandboxAllocCount() != before + 1)
+        {
+            std::cerr << "[FAIL] TInlineArray move of spilled storage\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+
+        TE::TInlineArray<int, 4> copy = moved;
+        copy.resize(2);
+        copy = {7, 8, 9};
+        if (copy.size() != 3 || copy[2] != 9 || moved.size() != 5)
+        {
+            std::cerr << "[FAIL] TInlineArray copy / assign\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+    }
+
+    // 只可移动的元素在内联与溢出之间搬移时保持所有权
+    {
+        TE::TInlineArray<std::unique_ptr<int>, 2> owners;
+        for (int i = 0; i < 3; ++i)
+        {
+            owners.push_back(std::make_unique<int>(i));
+        }
+        TE::TInlineArray<std::unique_ptr<int>, 2> inlineOwners;
+        inlineOwners.push_back(std::make_unique<int>(42));
+        TE::TInlineArray<std::unique_ptr<int>, 2> target = std::move(inlineOwners);
+        if (*owners[2] != 2 || !target.IsInline() || *target[0] != 42 || !inlineOwners.empty())
+        {
+            std::cerr << "[FAIL] TInlineArray move-only elements\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+    }
+
+    // 短字符串内联存储，长字符串溢出；可直接格式化
+    {
+        const std::uint64_t before = SandboxAllocCount();
+        TE::TSmallString<16> name(TE::MemoryTag::Sandbox);
+        name = "GBuffer";
+        if (!name.IsInline() || name != std::string_view("GBuffer") || SandboxAllocCount() != before)
+        {
+            std::cerr << "[FAIL] TSmallString inline\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+
+        name += "_PipelineLayout";
+        name = name.view().substr(1);
+        if (name.IsInline() || name != std::string_view("Buffer_PipelineLayout") ||
+            std::strlen(name.c_str()) != name.size() || SandboxAllocCount() != before + 1)
+        {
+            std::cerr << "[FAIL] TSmallString spill\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+
+        const TE::TSmallString<16> copied = name;
+        if (std::format("[{}]", copied) != "[Buffer_PipelineLayout]")
+        {
+            std::cerr << "[FAIL] TSmallString format\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+    }
+
+    TE::MemoryShutdown();
+    return true;
+}
+
+
+// 小块 slab 层：块不带块头、按档位记账，sized / 跨线程释放配平，关闭后回退到带块头档位
+bool TestSmallSlabs()
+{
+    constexpr std::size_t kBlocks = 4096;
+    constexpr std::size_t kRequest = 24;
+    constexpr std::size_t kClassBytes = 32;
+    const auto sandboxIndex = static_cast<std::size_t>(TE::MemoryTag::Sandbox);
+
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+
+    std::vector<void*> blocks(kBlocks, nullptr);
+    std::size_t tight = 0;
+    for (std::size_t i = 0; i < kBlocks; ++i)
+    {
+        blocks[i] = TE::MemAlloc(kRequest, TE::MemoryTag::Sandbox);
+        if (!blocks[i] || !IsAligned(blocks[i], 16))
+        {
+            std::cerr << "[FAIL] slab allocation\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+        std::memset(blocks[i], static_cast<int>(i & 0xFF), kRequest);
+        if (i > 0)
+        {
+            const auto a = reinterpret_cast<std::uintptr_t>(blocks[i - 1]);
+            const auto b = reinterpret_cast<std::uintptr_t>(blocks[i]);
+            tight += ((a > b ? a - b : b - a) == kClassBytes) ? 1 : 0;
+        }
+    }
+
+    // 同一批补货切出的块首尾相接：间距就是档位大小，没有块头
+    TE::MemoryStats stats = TE::GetMemoryStats();
+    if (tight < kBlocks * 3 / 4 || stats.PerTag[sandboxIndex].CurrentBytes != kBlocks * kClassBytes ||
+        stats.SlabLiveBlocks < kBlocks || stats.SlabSavedBytes == 0)
+    {
+        std::cerr << "[FAIL] slab layout / accounting: tight=" << tight
+                  << " current=" << stats.PerTag[sandboxIndex].CurrentBytes
+                  << " live=" << stats.SlabLiveBlocks << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // realloc 出 slab 档位时保留内容
+    void* grown = TE::MemRealloc(blocks[0], 200);
+    const auto* bytes = static_cast<const unsigned char*>(grown);
+    if (!grown || bytes[0] != 0 || bytes[kRequest - 1] != 0)
+    {
+        std::cerr << "[FAIL] slab realloc\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+    TE::MemFree(grown);
+
+    // 一半在另一个线程按 sized delete 释放，其余按普通释放
+    std::thread([&blocks]() {
+        for (std::size_t i = 1; i < kBlocks; i += 2)
+        {
+            TE::MemFreeSized(blocks[i], kRequest);
+        }
+    }).join();
+    for (std::size_t i = 2; i < kBlocks; i += 2)
+    {
+        if (static_cast<const unsigned char*>(blocks[i])[kRequest - 1] != (i & 0xFF))
+        {
+            std::cerr << "[FAIL] slab block content\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+        TE::MemFree(blocks[i]);
+    }
+    TE::MemoryFlushThreadCache();
+
+    stats = TE::GetMemoryStats();
+    const auto& sandbox = stats.PerTag[sandboxIndex];
+    if (sandbox.CurrentBytes != 0 || sandbox.AllocCount != sandbox.FreeCount || stats.SlabLiveBlocks != 0)
+    {
+        std::cerr << "[FAIL] slab frees not balanced: current=" << sandbox.CurrentBytes
+                  << " live=" << stats.SlabLiveBlocks << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    // STL 节点负载（场景里 map / list 的典型形态）：报告相对带块头档位省下的内存
+    {
+        TE::TMap<int, int> map{TE::TEngineAllocator<std::pair<const int, int>>(TE::MemoryTag::Sandbox)};
+        TE::TList<int> list{TE::TEngineAllocator<int>(TE::MemoryTag::Sandbox)};
+        for (int i = 0; i < 20000; ++i)
+        {
+            map.emplace(i, i);
+            list.push_back(i);
+        }
+
+        stats = TE::GetMemoryStats();
+        const auto saved = TE::FormatBytes(stats.SlabSavedBytes);
+        std::cout << "[MemoryAllocatorRegressionTest]   STL nodes: " << stats.SlabLiveBlocks << " slab blocks, saved "
+                  << saved.Value << " " << saved.Unit << " ("
+                  << (stats.SlabLiveBlocks ? stats.SlabSavedBytes / stats.SlabLiveBlocks : 0)
+                  << " B/block) vs header blocks\n";
+        if (stats.SlabLiveBlocks < 40000 || stats.SlabSavedBytes < stats.SlabLiveBlocks * 32)
+        {
+            std::cerr << "[FAIL] slab savings\n";
+            TE::MemoryShutdown();
+            return false;
+        }
+    }
+    TE::MemoryShutdown();
+
+    // 关闭 slab 层：小块回退到带块头的线程缓存档位
+    const TE::MemoryHeapConfig config = TE::MemoryGetHeapConfig();
+    TE::MemoryHeapConfig noSlabs = config;
+    noSlabs.SmallSlabReserveBytes = 0;
+    TE::MemorySetHeapConfig(noSlabs);
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+    {
+        void* p = TE::MemAlloc(kRequest, TE::MemoryTag::Sandbox);
+        stats = TE::GetMemoryStats();
+        TE::MemFreeSized(p, kRequest);
+        if (!p || stats.SlabLiveBlocks != 0 || stats.PerTag[sandboxIndex].CurrentBytes != kRequest)
+        {
+            std::cerr << "[FAIL] slab fallback\n";
+            TE::MemoryShutdown();
+            TE::MemorySetHeapConfig(config);
+            return false;
+        }
+    }
+    TE::MemoryShutdown();
+    TE::MemorySetHeapConfig(config);
+    return true;
+}
+
+
+// 堆碎片报告：交错释放后空闲块落入对应直方图桶、碎片率上升，全部释放后空闲空间重新连续
+bool TestHeapFragmentationReport()
+{
+    constexpr std::size_t kBlocks = 2048;
+    constexpr std::size_t kBlockBytes = 4096; // 超出线程缓存档位，直接走 TLSF
+
+    TE::MemoryInit(64ull * 1024ull * 1024ull);
+
+    std::vector<void*> blocks(kBlocks, nullptr);
+    for (auto& block : blocks)
+    {
+        block = TE::MemAlloc(kBlockBytes, TE::MemoryTag::Sandbox);
+    }
+    const TE::HeapFragmentationReport packed = TE::GetHeapFragmentationReport();
+
+    for (std::size_t i = 0; i < kBlocks; i += 2)
+    {
+        TE::MemFree(blocks[i]);
+        blocks[i] = nullptr;
+    }
+    const TE::HeapFragmentationReport holes = TE::GetHeapFragmentationReport();
+
+    // 4KB 空洞（含块头）落在 [4KB, 8KB) 桶
+    constexpr std::size_t holeBucket = 8;
+    static_assert(TE::HeapFragmentationReport::BucketMinBytes(holeBucket) == 4096);
+
+    std::uint64_t poolUsed = 0;
+    std::uint64_t poolFree = 0;
+    for (std::uint32_t i = 0; i < holes.PoolCount; ++i)
+    {
+        poolUsed += holes.Pools[i].UsedBytes;
+        poolFree += holes.Pools[i].FreeBytes;
+    }
+
+    if (packed.PoolCount == 0 || packed.UsedBlocks < kBlocks ||
+        holes.FreeBlockCount[holeBucket] < kBlocks / 2 - 1 ||
+        holes.FragmentationRatio <= packed.FragmentationRatio ||
+        holes.UsedBytes + kBlocks / 2 * kBlockBytes > packed.UsedBytes ||
+        poolUsed != holes.UsedBytes || poolFree != holes.FreeBytes ||
+        holes.LargestFreeBlock > holes.FreeBytes)
+    {
+        std::cerr << "[FAIL] fragmentation report: holes=" << holes.FreeBlockCount[holeBucket]
+                  << " ratio " << packed.FragmentationRatio << " -> " << holes.FragmentationRatio << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+    std::cout << "[MemoryAllocatorRegressionTest]   " << kBlocks / 2 << " interleaved holes: fragmentation "
+              << packed.FragmentationRatio * 100.0 << "% -> " << holes.FragmentationRatio * 100.0 << "%\n";
+    TE::DumpHeapFragmentationReport();
+
+    for (void* block : blocks)
+    {
+        TE::MemFree(block);
+    }
+    const TE::HeapFragmentationReport released = TE::GetHeapFragmentationReport();
+    if (released.FreeBlockCount[holeBucket] != 0 || released.FragmentationRatio >= holes.FragmentationRatio)
+    {
+        std::cerr << "[FAIL] fragmentation report after release: ratio " << released.FragmentationRatio << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    TE::MemoryShutdown();
+    return true;
+}
+
+
+std::uint64_t TagCurrentBytes(TE::MemoryTag tag)
+{
+    return TE::GetMemoryStats().PerTag[static_cast<std::size_t>(tag)].CurrentBytes;
+}
+
+// 内存作用域：未指定 tag 的分配继承最内层作用域，显式 tag 不受影响，作用域按线程嵌套。
+// 关闭 TE_ENABLE_MEMORY_SCOPES 时作用域不生效，但按 tag 的计数照常
+bool TestMemoryScopes()
+{
+    constexpr bool kScopesEnabled = TE_ENABLE_MEMORY_SCOPES != 0;
+    const TE::MemoryTag rendererScope = kScopesEnabled ? TE::MemoryTag::Renderer : TE::MemoryTag::Unknown;
+    const TE::MemoryTag assetScope = kScopesEnabled ? TE::MemoryTag::Asset : TE::MemoryTag::Unknown;
+
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+
+    const std::uint64_t rendererBefore = TagCurrentBytes(TE::MemoryTag::Renderer);
+    const std::uint64_t assetBefore = TagCurrentBytes(TE::MemoryTag::Asset);
+    const std::uint64_t sandboxBefore = TagCurrentBytes(TE::MemoryTag::Sandbox);
+
+    void* untagged = nullptr;
+    void* stl = nullptr;
+    void* nested = nullptr;
+    void* explicitTag = nullptr;
+    void* otherThread = nullptr;
+    bool scopeTagsOk = true;
+    {
+        TE_MEMORY_SCOPE(Renderer);
+        untagged = TE::MemAlloc(1000);
+        stl = TE::MemAlloc(40, TE::MemoryTag::STL);
+        explicitTag = TE::MemAlloc(300, TE::MemoryTag::Sandbox);
+        {
+            TE_MEMORY_SCOPE(Asset);
+            nested = TE::MemAlloc(2000);
+            scopeTagsOk = scopeTagsOk && TE::MemoryGetScopeTag() == assetScope;
+        }
+        scopeTagsOk = scopeTagsOk && TE::MemoryGetScopeTag() == rendererScope;
+
+        // 作用域只对所在线程生效
+        std::thread([&otherThread]() {
+            otherThread = TE::MemAlloc(4000);
+        }).join();
+    }
+    scopeTagsOk = scopeTagsOk && TE::MemoryGetScopeTag() == TE::MemoryTag::Unknown;
+
+    const std::uint64_t rendererBytes = TagCurrentBytes(TE::MemoryTag::Renderer) - rendererBefore;
+    const std::uint64_t assetBytes = TagCurrentBytes(TE::MemoryTag::Asset) - assetBefore;
+    const std::uint64_t sandboxBytes = TagCurrentBytes(TE::MemoryTag::Sandbox) - sandboxBefore;
+
+    // STL 小块走 slab 档位，按 48 字节档位记账
+    const std::uint64_t expectedRenderer = kScopesEnabled ? 1000 + 48 : 0;
+    const std::uint64_t expectedAsset = kScopesEnabled ? 2000 : 0;
+    const bool ok = scopeTagsOk && untagged && stl && nested && explicitTag && otherThread &&
+                    rendererBytes == expectedRenderer && assetBytes == expectedAsset && sandboxBytes == 300;
+
+    TE::MemFree(untagged);
+    TE::MemFree(stl);
+    TE::MemFree(nested);
+    TE::MemFree(explicitTag);
+    TE::MemFree(otherThread);
+
+    if (!ok || TagCurrentBytes(TE::MemoryTag::Renderer) != rendererBefore)
+    {
+        std::cerr << "[FAIL] memory scopes: renderer +" << rendererBytes << " asset +" << assetBytes
+                  << " sandbox +" << sandboxBytes << " scope tags " << (scopeTagsOk ? "ok" : "wrong") << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    TE::MemoryShutdown();
+    return true;
+}
+
+bool TestFrameAllocationGuard()
+{
+    TE::MemoryInit(16ull * 1024ull * 1024ull);
+
+    // Off：不统计
+    TE::MemorySetFrameAllocationGuard({});
+    TE::MemoryBeginFrameAllocationGuard();
+    void* ignored = TE::MemAlloc(128, TE::MemoryTag::Sandbox);
+    const TE::FrameAllocationReport offReport = TE::MemoryEndFrameAllocationGuard();
+    TE::MemFree(ignored);
+
+    TE::FrameAllocationGuardConfig config;
+    config.Policy = TE::FrameAllocationPolicy::Count;
+    config.WarmupFrames = 2;
+    TE::MemorySetFrameAllocationGuard(config);
+    TE::FrameArena::Get().Init(2, 64 * 1024);
+
+    // 帧内工作：FrameArena 分配 + 复用预先分配好的缓冲；grow 为真时额外触碰一次堆
+    void* persistent = TE::MemAlloc(256, TE::MemoryTag::Sandbox);
+    void* extra = nullptr;
+    auto runFrame = [&](bool grow) {
+        TE::FrameAllocationGuardScope guard;
+        auto* scratch = TE::FrameArena::Get().AllocateArray<std::uint32_t>(1024);
+        if (scratch)
+        {
+            scratch[0] = 1;
+        }
+        std::memset(persistent, 0, 256);
+        if (grow)
+        {
+            extra = TE::MemRealloc(extra, 4096, TE::MemoryTag::Sandbox);
+        }
+        const TE::FrameAllocationReport report = guard.End();
+        TE::FrameArena::Get().EndFrame();
+        return report;
+    };
+
+    // 预热帧内的分配（arena 首个 chunk）不算违规
+    const TE::FrameAllocationReport warm0 = runFrame(false);
+    const TE::FrameAllocationReport warm1 = runFrame(false);
+    const TE::FrameAllocationReport steady = runFrame(false);
+    const TE::FrameAllocationReport violating = runFrame(true);
+
+    // 重新预热后同样的分配不再判定为违规
+    TE::MemoryResetFrameAllocationWarmup();
+    TE::MemFree(extra);
+    extra = nullptr;
+    const TE::FrameAllocationReport rewarm = runFrame(true);
+
+    TE::MemFree(extra);
+    TE::MemFree(persistent);
+    TE::FrameArena::Get().Shutdown();
+    TE::MemorySetFrameAllocationGuard({});
+
+    const bool ok = offReport.Allocations == 0 && !offReport.Violation &&
+                    warm0.Allocations != 0 && !warm0.Violation && !warm0.SteadyState &&
+                    !warm1.Violation && warm1.FrameIndex == 1 &&
+                    steady.SteadyState && steady.Allocations == 0 && !steady.Violation &&
+                    violating.Violation && violating.Allocations == 1 && violating.Bytes == 4096 &&
+                    violating.FirstTag == TE::MemoryTag::Sandbox && violating.FirstBytes == 4096 &&
+                    rewarm.FrameIndex == 0 && rewarm.Allocations == 1 && !rewarm.Violation;
+    if (!ok)
+    {
+        std::cerr << "[FAIL] frame allocation guard: warm0 " << warm0.Allocations << " steady " << steady.Allocations
+                  << " violating " << violating.Allocations << "/" << violating.Bytes
+                  << (violating.Violation ? " flagged" : " not flagged") << " rewarm frame " << rewarm.FrameIndex << "\n";
+        TE::MemoryShutdown();
+        return false;
+    }
+
+    TE::MemoryShutdown();
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    TE::Log::Init();
+
+    std::cout << "[MemoryAllocatorRegressionTest] multi-thread alloc/free...\n";
+    if (!TestMultiThreadAllocFree())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] aligned realloc...\n";
+    if (!TestAlignedReallocPreservesAlignment())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] ordered shutdown...\n";
+    if (!TestOrderedShutdownNoCrash())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] shutdown while allocating...\n";
+    if (!TestShutdownWhileAllocating())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] thread cache throughput...\n";
+    if (!TestThreadCacheThroughput())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] frame arena...\n";
+    if (!TestFrameArena())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] object pool...\n";
+    if (!TestObjectPool())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] heap grow in place / trim...\n";
+    if (!TestHeapGrowInPlaceAndTrim())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] heap idle trim policy...\n";
+    if (!TestHeapTrimIdlePolicy())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] sampling profiler...\n";
+    if (!TestMemoryProfiler())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] sharded counters / tag budgets...\n";
+    if (!TestCountersAndBudgets())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] allocation trace...\n";
+    if (!TestMemoryTrace())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] inline containers...\n";
+    if (!TestInlineContainers())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] small-object slabs...\n";
+    if (!TestSmallSlabs())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] heap fragmentation report...\n";
+    if (!TestHeapFragmentationReport())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] memory tag scopes...\n";
+    if (!TestMemoryScopes())
+    {
+        TE::Log::Shutdown();
+        return 1;
+    }
+
+    std::cout << "[MemoryAllocatorRegressionTest] frame allocation guard...\n";
+    if (!TestFrameAllocationGuard())
     {
         TE::Log::Shutdown();
         return 1;